@@ -153,6 +153,9 @@ typedef struct SDL_AudioCVT
     double len_ratio;           /* Given len, final size is len*len_ratio */
     SDL_AudioFilter filters[10];        /* Filter list */
     int filter_index;           /* Current audio conversion function */
+    void *resampler;            /* Polyphase filter for rate conversion */
+    int rate_index;             /* Index of the rate converter, or -1 */
+    int block_size;             /* Bytes converted at a time, or 0 */
 } SDL_AudioCVT;
 
 
@@ -366,6 +369,48 @@ extern DECLSPEC int SDLCALL SDL_BuildAudioCVT(SDL_AudioCVT * cvt,
  */
 extern DECLSPEC int SDLCALL SDL_ConvertAudio(SDL_AudioCVT * cvt);
 
+/* Quality levels for the polyphase resampler.  Higher levels use longer
+ * filters, which cost more time but alias less and keep more of the high
+ * frequencies.  SDL_BuildAudioCVT() uses the level in the
+ * SDL_AUDIO_RESAMPLE_QUALITY environment variable, SDL_RESAMPLE_MEDIUM by
+ * default, or the older linear resamplers if it's set to 0.
+ */
+#define SDL_RESAMPLE_FAST   1
+#define SDL_RESAMPLE_MEDIUM 2
+#define SDL_RESAMPLE_BEST   3
+
+typedef struct SDL_AudioResampler SDL_AudioResampler;
+
+/*
+ * This function creates a resampler that converts a stream of AUDIO_S16SYS
+ * or AUDIO_F32SYS audio from one rate to another in pieces of any size.
+ * Unlike SDL_ConvertAudio(), it keeps the end of each piece to filter the
+ * start of the next one, so there are no clicks between pieces.
+ * Returns NULL if the format isn't supported or there isn't enough memory.
+ */
+extern DECLSPEC SDL_AudioResampler *SDLCALL
+SDL_CreateAudioResampler(SDL_AudioFormat format, Uint8 channels,
+                         int src_rate, int dst_rate, int quality);
+
+/*
+ * This resamples 'len' bytes of audio from 'src' into 'dst', which is
+ * 'dst_len' bytes long, and returns the number of bytes written to 'dst',
+ * or -1 on error.  'dst' should have room for len * dst_rate / src_rate
+ * bytes and one more sample frame; input that doesn't fit is kept for the
+ * next call.  Half a filter length of input is always held back until the
+ * samples after it arrive, so pass some silence at the end of the stream
+ * to get the rest of it out.
+ */
+extern DECLSPEC int SDLCALL SDL_AudioResample(SDL_AudioResampler * resampler,
+                                              const Uint8 * src, int len,
+                                              Uint8 * dst, int dst_len);
+
+/*
+ * This function frees a resampler created with SDL_CreateAudioResampler().
+ */
+extern DECLSPEC void SDLCALL SDL_FreeAudioResampler(SDL_AudioResampler *
+                                                    resampler);
+
 /*
  * This takes two audio buffers of the playing audio format and mixes
  * them, performing addition, volume adjustment, and overflow clipping.
@@ -67,6 +67,15 @@ extern DECLSPEC SDL_bool SDLCALL SDL_HasSSE(void);
  */
 extern DECLSPEC SDL_bool SDLCALL SDL_HasSSE2(void);
 
+/* This function returns true if the CPU has SSE4.1 features
+ */
+extern DECLSPEC SDL_bool SDLCALL SDL_HasSSE41(void);
+
+/* This function returns true if the CPU has AVX2 features
+   and the operating system saves the AVX registers
+ */
+extern DECLSPEC SDL_bool SDLCALL SDL_HasAVX2(void);
+
 /* This function returns true if the CPU has AltiVec features
  */
 extern DECLSPEC SDL_bool SDLCALL SDL_HasAltiVec(void);
@@ -123,6 +123,33 @@ extern DECLSPEC SDL_RWops *SDLCALL SDL_RWFromMem(void *mem, int size);
 extern DECLSPEC SDL_RWops *SDLCALL SDL_RWFromConstMem(const void *mem,
                                                       int size);
 
+/* Open a file for reading by mapping it into memory.
+ * Reads come straight from the mapping without any buffering, and
+ * SDL_RWGetPointer() gives loaders access to the file contents in place.
+ * If the file can't be mapped, it's opened with SDL_RWFromFile() instead.
+ */
+extern DECLSPEC SDL_RWops *SDLCALL SDL_RWFromMappedFile(const char *file);
+
+/* Get a pointer to the data at the current position of a memory based
+ * SDL_RWops, from SDL_RWFromMem(), SDL_RWFromConstMem() or a mapped file,
+ * or one of those wrapped by SDL_RWBuffered().
+ * 'size' is set to the number of bytes available, and the position isn't
+ * changed.  The data stays valid until the SDL_RWops is closed.
+ * Returns NULL if the data source isn't in memory.
+ */
+extern DECLSPEC const void *SDLCALL SDL_RWGetPointer(SDL_RWops * context,
+                                                    size_t * size);
+
+/* Create an SDL_RWops that reads ahead from 'src' in blocks of 'size' bytes,
+ * which makes lots of small reads and seeks much faster.  If 'size' is 0,
+ * the SDL_RWOPS_BUFFER_SIZE environment variable is used (0 there turns
+ * buffering off), or 4096 if it isn't set.  Seeking or writing moves the
+ * source to the right position, and closing it leaves the source where
+ * reading stopped, or closes it if 'freesrc' is set.
+ */
+extern DECLSPEC SDL_RWops *SDLCALL SDL_RWBuffered(SDL_RWops * src, int size,
+                                                  int freesrc);
+
 extern DECLSPEC SDL_RWops *SDLCALL SDL_AllocRW(void);
 extern DECLSPEC void SDLCALL SDL_FreeRW(SDL_RWops * area);
 
@@ -54,6 +54,26 @@ extern DECLSPEC Uint32 SDLCALL SDL_GetTicks(void);
 /* Wait a specified number of milliseconds before returning */
 extern DECLSPEC void SDLCALL SDL_Delay(Uint32 ms);
 
+/* Get the current value of the high resolution counter.
+ * The counter increases monotonically from an arbitrary starting point,
+ * and at nanosecond resolution it won't wrap for centuries.  Divide the
+ * difference between two values by SDL_GetPerformanceFrequency() to get
+ * the time between them in seconds.
+ */
+extern DECLSPEC Uint64 SDLCALL SDL_GetPerformanceCounter(void);
+
+/* Get the number of counts per second of the high resolution counter */
+extern DECLSPEC Uint64 SDLCALL SDL_GetPerformanceFrequency(void);
+
+/* Wait until the high resolution counter reaches 'deadline'.
+ * This sleeps for most of the wait and spins for the last fraction of a
+ * millisecond, so it returns much closer to the deadline than SDL_Delay().
+ * It's meant for frame pacing, e.g.
+ *   next += SDL_GetPerformanceFrequency() / 60;
+ *   SDL_DelayUntil(next);
+ */
+extern DECLSPEC void SDLCALL SDL_DelayUntil(Uint64 deadline);
+
 /* Function prototype for the timer callback function */
 typedef Uint32(SDLCALL * SDL_TimerCallback) (Uint32 interval);
 
@@ -0,0 +1,149 @@
+/*
+    SDL - Simple DirectMedia Layer
+    Copyright (C) 1997-2009 Sam Lantinga
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+    Sam Lantinga
+    slouken@libsdl.org
+*/
+
+#include "SDL_config.h"
+
+/* Atomic operations for lock-free communication between SDL's threads.
+
+   All of these operations act as full memory barriers.  If the compiler
+   doesn't provide atomic operations, SDL_ATOMIC_DISABLED is defined and
+   the functions are plain, non-atomic operations, so code using them must
+   hold a mutex.  They aren't part of the API for that reason.
+*/
+
+#ifndef _SDL_atomic_c_h
+#define _SDL_atomic_c_h
+
+#include "SDL_stdinc.h"
+
+#if defined(__GNUC__) && \
+    ((__GNUC__ > 4) || (__GNUC__ == 4 && __GNUC_MINOR__ >= 1))
+
+#define SDL_MemoryBarrier()     __sync_synchronize()
+
+static __inline__ SDL_bool
+SDL_AtomicCAS(volatile int *a, int oldval, int newval)
+{
+    return __sync_bool_compare_and_swap(a, oldval, newval) ?
+        SDL_TRUE : SDL_FALSE;
+}
+
+static __inline__ int
+SDL_AtomicAdd(volatile int *a, int value)
+{
+    return __sync_fetch_and_add(a, value);
+}
+
+static __inline__ SDL_bool
+SDL_AtomicCASPtr(void *volatile *a, void *oldval, void *newval)
+{
+    return __sync_bool_compare_and_swap(a, oldval, newval) ?
+        SDL_TRUE : SDL_FALSE;
+}
+
+#elif defined(_MSC_VER) && (_MSC_VER >= 1400)
+#include <intrin.h>
+
+static __inline__ void
+SDL_MemoryBarrier(void)
+{
+    long barrier = 0;
+    _InterlockedExchange(&barrier, 0);
+}
+
+static __inline__ SDL_bool
+SDL_AtomicCAS(volatile int *a, int oldval, int newval)
+{
+    return (_InterlockedCompareExchange((volatile long *) a, newval,
+                                        oldval) == oldval) ?
+        SDL_TRUE : SDL_FALSE;
+}
+
+static __inline__ int
+SDL_AtomicAdd(volatile int *a, int value)
+{
+    return _InterlockedExchangeAdd((volatile long *) a, value);
+}
+
+static __inline__ SDL_bool
+SDL_AtomicCASPtr(void *volatile *a, void *oldval, void *newval)
+{
+    return (_InterlockedCompareExchangePointer(a, newval, oldval) ==
+            oldval) ? SDL_TRUE : SDL_FALSE;
+}
+
+#else
+
+#define SDL_ATOMIC_DISABLED     1
+#define SDL_MemoryBarrier()
+
+static __inline__ SDL_bool
+SDL_AtomicCAS(volatile int *a, int oldval, int newval)
+{
+    if (*a == oldval) {
+        *a = newval;
+        return SDL_TRUE;
+    }
+    return SDL_FALSE;
+}
+
+static __inline__ int
+SDL_AtomicAdd(volatile int *a, int value)
+{
+    int oldval = *a;
+    *a = oldval + value;
+    return oldval;
+}
+
+static __inline__ SDL_bool
+SDL_AtomicCASPtr(void *volatile *a, void *oldval, void *newval)
+{
+    if (*a == oldval) {
+        *a = newval;
+        return SDL_TRUE;
+    }
+    return SDL_FALSE;
+}
+
+#endif
+
+/* Returns the current value of 'a' */
+static __inline__ int
+SDL_AtomicGet(volatile int *a)
+{
+    return SDL_AtomicAdd(a, 0);
+}
+
+/* Sets 'a' to 'value' and returns the previous value */
+static __inline__ int
+SDL_AtomicSet(volatile int *a, int value)
+{
+    int oldval;
+    do {
+        oldval = *a;
+    } while (!SDL_AtomicCAS(a, oldval, value));
+    return oldval;
+}
+
+#endif /* _SDL_atomic_c_h */
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -53,4 +53,11 @@ typedef struct
 } SDL_AudioRateFilters;
 extern const SDL_AudioRateFilters sdl_audio_rate_filters[];
 
+/* The polyphase resampler in SDL_audioresample.c */
+extern int SDL_GetResampleQuality(void);
+extern void *SDL_GetResampleFilter(int src_rate, int dst_rate, int channels,
+                                   int quality);
+extern void SDLCALL SDL_ResampleCVT(SDL_AudioCVT * cvt,
+                                    SDL_AudioFormat format);
+
 /* vi: set ts=4 sw=4 expandtab: */
@@ -296,8 +296,8 @@ SDL_ConvertStereo(SDL_AudioCVT * cvt, SDL_AudioFormat format)
     { \
         const type *src = (const type *) (cvt->buf + cvt->len_cvt); \
         type *dst = (type *) (cvt->buf + cvt->len_cvt * 2); \
-        for (i = cvt->len_cvt / 2; i; --i, --src) { \
-            const type val = *src; \
+        for (i = cvt->len_cvt / sizeof (type); i; --i) { \
+            const type val = *(--src); \
             dst -= 2; \
             dst[0] = dst[1] = val; \
         } \
@@ -342,7 +342,7 @@ SDL_ConvertSurround(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
             src = (Uint8 *) (cvt->buf + cvt->len_cvt);
             dst = (Uint8 *) (cvt->buf + cvt->len_cvt * 3);
-            for (i = cvt->len_cvt; i; --i) {
+            for (i = cvt->len_cvt / 2; i; --i) {
                 dst -= 6;
                 src -= 2;
                 lf = src[0];
@@ -364,7 +364,7 @@ SDL_ConvertSurround(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
             src = (Sint8 *) cvt->buf + cvt->len_cvt;
             dst = (Sint8 *) cvt->buf + cvt->len_cvt * 3;
-            for (i = cvt->len_cvt; i; --i) {
+            for (i = cvt->len_cvt / 2; i; --i) {
                 dst -= 6;
                 src -= 2;
                 lf = src[0];
@@ -503,8 +503,8 @@ SDL_ConvertSurround(SDL_AudioCVT * cvt, SDL_AudioFormat format)
     case AUDIO_S32:
         {
             Sint32 lf, rf, ce;
-            const Uint32 *src = (const Uint32 *) cvt->buf + cvt->len_cvt;
-            Uint32 *dst = (Uint32 *) cvt->buf + cvt->len_cvt * 3;
+            const Uint32 *src = (const Uint32 *) (cvt->buf + cvt->len_cvt);
+            Uint32 *dst = (Uint32 *) (cvt->buf + cvt->len_cvt * 3);
 
             if (SDL_AUDIO_ISBIGENDIAN(format)) {
                 for (i = cvt->len_cvt / 8; i; --i) {
@@ -541,8 +541,8 @@ SDL_ConvertSurround(SDL_AudioCVT * cvt, SDL_AudioFormat format)
     case AUDIO_F32:
         {
             float lf, rf, ce;
-            const float *src = (const float *) cvt->buf + cvt->len_cvt;
-            float *dst = (float *) cvt->buf + cvt->len_cvt * 3;
+            const float *src = (const float *) (cvt->buf + cvt->len_cvt);
+            float *dst = (float *) (cvt->buf + cvt->len_cvt * 3);
 
             if (SDL_AUDIO_ISBIGENDIAN(format)) {
                 for (i = cvt->len_cvt / 8; i; --i) {
@@ -599,7 +599,7 @@ SDL_ConvertSurround_4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
             src = (Uint8 *) (cvt->buf + cvt->len_cvt);
             dst = (Uint8 *) (cvt->buf + cvt->len_cvt * 2);
-            for (i = cvt->len_cvt; i; --i) {
+            for (i = cvt->len_cvt / 2; i; --i) {
                 dst -= 4;
                 src -= 2;
                 lf = src[0];
@@ -619,7 +619,7 @@ SDL_ConvertSurround_4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
             src = (Sint8 *) cvt->buf + cvt->len_cvt;
             dst = (Sint8 *) cvt->buf + cvt->len_cvt * 2;
-            for (i = cvt->len_cvt; i; --i) {
+            for (i = cvt->len_cvt / 2; i; --i) {
                 dst -= 4;
                 src -= 2;
                 lf = src[0];
@@ -774,11 +774,119 @@ SDL_ConvertSurround_4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 }
 
 
+/* Filters that work sample by sample are run over the buffer in blocks of
+   about this many bytes, so the data stays in the cache from one filter
+   to the next.  Blocks are a multiple of every possible frame size. */
+#define CONVERT_BLOCK_SIZE  16384
+#define CONVERT_BLOCK_ALIGN 48
+
+/* A run of filters from the chain, with a filter at the end that records
+   the format the run leaves the data in. */
+typedef struct
+{
+    SDL_AudioCVT cvt;
+    SDL_AudioFormat format;
+} SDL_AudioFilterRun;
+
+static void SDLCALL
+SDL_EndFilterRun(SDL_AudioCVT * cvt, SDL_AudioFormat format)
+{
+    ((SDL_AudioFilterRun *) cvt)->format = format;
+}
+
+static int
+SDL_GetConvertBlockSize(const SDL_AudioCVT * cvt)
+{
+    const char *env = SDL_getenv("SDL_AUDIO_CONVERT_BLOCK_SIZE");
+    int size = CONVERT_BLOCK_SIZE / cvt->len_mult;
+
+    if (env && *env) {
+        size = SDL_atoi(env);
+    }
+    if (size <= 0) {
+        return 0;
+    }
+    size -= size % CONVERT_BLOCK_ALIGN;
+    return (size > 0) ? size : CONVERT_BLOCK_ALIGN;
+}
+
+/* Runs 'len' bytes at 'buf' through the filters and returns the new length */
+static int
+SDL_RunFilters(SDL_AudioFilterRun * run, Uint8 * buf, int len,
+               SDL_AudioFormat format)
+{
+    run->cvt.buf = buf;
+    run->cvt.len_cvt = len;
+    run->cvt.filter_index = 0;
+    run->cvt.filters[0] (&run->cvt, format);
+    return run->cvt.len_cvt;
+}
+
+/* Runs filters first to last - 1 over the whole buffer, a block at a time
+   if 'block' is set, and returns the format they leave it in. */
+static SDL_AudioFormat
+SDL_RunFilterBlocks(SDL_AudioCVT * cvt, int first, int last,
+                    SDL_AudioFormat format, int block)
+{
+    SDL_AudioFilterRun run;
+    Uint8 probe[CONVERT_BLOCK_ALIGN * 32];
+    int i, in, out, probe_len;
+
+    run.cvt = *cvt;
+    for (i = first; i < last; ++i) {
+        run.cvt.filters[i - first] = cvt->filters[i];
+    }
+    run.cvt.filters[last - first] = SDL_EndFilterRun;
+    run.format = format;
+
+    if (!block || (last - first) < 2 || cvt->len_cvt <= block ||
+        cvt->len_mult * CONVERT_BLOCK_ALIGN > sizeof(probe)) {
+        cvt->len_cvt = SDL_RunFilters(&run, cvt->buf, cvt->len_cvt, format);
+        return run.format;
+    }
+
+    /* These filters change the length by a fixed ratio, so find it */
+    SDL_memset(probe, 0, sizeof(probe));
+    probe_len = SDL_RunFilters(&run, probe, CONVERT_BLOCK_ALIGN, format);
+
+    if (probe_len <= CONVERT_BLOCK_ALIGN) {
+        /* Shrinking: go forwards, packing each block after the last */
+        in = out = 0;
+        while (in < cvt->len_cvt) {
+            const int len = SDL_min(block, cvt->len_cvt - in);
+            const int len_out = SDL_RunFilters(&run, cvt->buf + in, len,
+                                               format);
+            if (out != in) {
+                SDL_memmove(cvt->buf + out, cvt->buf + in, len_out);
+            }
+            in += len;
+            out += len_out;
+        }
+    } else {
+        /* Growing: go backwards, so no block overwrites one still to come.
+           Each block moves up to where its output goes and grows there. */
+        in = ((cvt->len_cvt - 1) / block) * block;
+        out = (int) (((Sint64) cvt->len_cvt * probe_len) /
+                     CONVERT_BLOCK_ALIGN);
+        for (; in >= 0; in -= block) {
+            const int len = SDL_min(block, cvt->len_cvt - in);
+            const int pos = (int) (((Sint64) in * probe_len) /
+                                   CONVERT_BLOCK_ALIGN);
+            if (pos != in) {
+                SDL_memmove(cvt->buf + pos, cvt->buf + in, len);
+            }
+            SDL_RunFilters(&run, cvt->buf + pos, len, format);
+        }
+    }
+    cvt->len_cvt = out;
+    return run.format;
+}
+
 int
 SDL_ConvertAudio(SDL_AudioCVT * cvt)
 {
-    /* !!! FIXME: (cvt) should be const; stack-copy it here. */
-    /* !!! FIXME: (actually, we can't...len_cvt needs to be updated. Grr.) */
+    SDL_AudioFormat format;
+    int i, first, block;
 
     /* Make sure there's data to convert */
     if (cvt->buf == NULL) {
@@ -791,9 +899,26 @@ SDL_ConvertAudio(SDL_AudioCVT * cvt)
         return (0);
     }
 
-    /* Set up the conversion and go! */
-    cvt->filter_index = 0;
-    cvt->filters[0] (cvt, cvt->src_format);
+    /* Run the filters that work sample by sample together over blocks of
+       the buffer, and the resampler over the whole thing. */
+    block = cvt->block_size;
+    format = cvt->src_format;
+    first = 0;
+    for (i = 0;; ++i) {
+        const SDL_AudioFilter filter = cvt->filters[i];
+
+        if (filter != NULL && i != cvt->rate_index) {
+            continue;
+        }
+        if (i > first) {
+            format = SDL_RunFilterBlocks(cvt, first, i, format, block);
+        }
+        if (filter == NULL) {
+            break;
+        }
+        format = SDL_RunFilterBlocks(cvt, i, i + 1, format, 0);
+        first = i + 1;
+    }
     return (0);
 }
 
@@ -858,15 +983,36 @@ SDL_BuildAudioTypeCVT(SDL_AudioCVT * cvt,
 }
 
 
+/* The formats the polyphase resampler reads and writes */
+static int
+SDL_IsPolyphaseFormat(SDL_AudioFormat format)
+{
+    return ((format == AUDIO_S16SYS) || (format == AUDIO_F32SYS));
+}
+
 static SDL_AudioFilter
-SDL_HandTunedResampleCVT(SDL_AudioCVT * cvt, int dst_channels,
-                         int src_rate, int dst_rate)
+SDL_HandTunedResampleCVT(SDL_AudioCVT * cvt, SDL_AudioFormat format,
+                         int channels, int src_rate, int dst_rate)
 {
     /*
      * Fill in any future conversions that are specialized to a
      *  processor, platform, compiler, or library here.
      */
 
+    /* The polyphase resampler handles any ratio in the common formats,
+       converting straight to cvt->dst_format if that's one of them too. */
+    if (SDL_IsPolyphaseFormat(format) &&
+        SDL_IsPolyphaseFormat(cvt->dst_format)) {
+        const int quality = SDL_GetResampleQuality();
+        if (quality > 0) {
+            cvt->resampler = SDL_GetResampleFilter(src_rate, dst_rate,
+                                                   channels, quality);
+            if (cvt->resampler != NULL) {
+                return SDL_ResampleCVT;
+            }
+        }
+    }
+
     return NULL;                /* no specialized converter code available. */
 }
 
@@ -903,13 +1049,26 @@ SDL_FindFrequencyMultiple(const int src_rate, const int dst_rate)
     return retval;
 }
 
+/* Adds a rate converter for audio in (*format) with (channels) channels,
+   and sets (*format) to the format it leaves the data in. */
 static int
-SDL_BuildAudioResampleCVT(SDL_AudioCVT * cvt, int dst_channels,
-                          int src_rate, int dst_rate)
+SDL_BuildAudioResampleCVT(SDL_AudioCVT * cvt, SDL_AudioFormat * format,
+                          int channels, int src_rate, int dst_rate)
 {
     if (src_rate != dst_rate) {
-        SDL_AudioFilter filter = SDL_HandTunedResampleCVT(cvt, dst_channels,
-                                                          src_rate, dst_rate);
+        SDL_AudioFilter filter = SDL_HandTunedResampleCVT(cvt, *format,
+                                                          channels, src_rate,
+                                                          dst_rate);
+
+        if (filter == SDL_ResampleCVT && *format != cvt->dst_format) {
+            const Uint16 src_bitsize = SDL_AUDIO_BITSIZE(*format);
+            const Uint16 dst_bitsize = SDL_AUDIO_BITSIZE(cvt->dst_format);
+            if (src_bitsize < dst_bitsize) {
+                cvt->len_mult *= (dst_bitsize / src_bitsize);
+            }
+            cvt->len_ratio *= ((double) dst_bitsize) / src_bitsize;
+            *format = cvt->dst_format;
+        }
 
         /* No hand-tuned converter? Try the autogenerated ones. */
         if (filter == NULL) {
@@ -920,8 +1079,8 @@ SDL_BuildAudioResampleCVT(SDL_AudioCVT * cvt, int dst_channels,
 
             for (i = 0; sdl_audio_rate_filters[i].filter != NULL; i++) {
                 const SDL_AudioRateFilters *filt = &sdl_audio_rate_filters[i];
-                if ((filt->fmt == cvt->dst_format) &&
-                    (filt->channels == dst_channels) &&
+                if ((filt->fmt == *format) &&
+                    (filt->channels == channels) &&
                     (filt->upsample == upsample) &&
                     (filt->multiple == multiple)) {
                     filter = filt->filter;
@@ -935,6 +1094,7 @@ SDL_BuildAudioResampleCVT(SDL_AudioCVT * cvt, int dst_channels,
         }
 
         /* Update (cvt) with filter details... */
+        cvt->rate_index = cvt->filter_index;
         cvt->filters[cvt->filter_index++] = filter;
         if (src_rate < dst_rate) {
             const double mult = ((double) dst_rate) / ((double) src_rate);
@@ -961,13 +1121,7 @@ SDL_BuildAudioCVT(SDL_AudioCVT * cvt,
                   SDL_AudioFormat src_fmt, Uint8 src_channels, int src_rate,
                   SDL_AudioFormat dst_fmt, Uint8 dst_channels, int dst_rate)
 {
-    /*
-     * !!! FIXME: reorder filters based on which grow/shrink the buffer.
-     * !!! FIXME: ideally, we should do everything that shrinks the buffer
-     * !!! FIXME: first, so we don't have to process as many bytes in a given
-     * !!! FIXME: filter and abuse the CPU cache less. This might not be as
-     * !!! FIXME: good in practice as it sounds in theory, though.
-     */
+    SDL_AudioFormat fmt;
 
     /* there are no unsigned types over 16 bits, so catch this upfront. */
     if ((SDL_AUDIO_BITSIZE(src_fmt) > 16) && (!SDL_AUDIO_ISSIGNED(src_fmt))) {
@@ -996,15 +1150,75 @@ SDL_BuildAudioCVT(SDL_AudioCVT * cvt,
     cvt->len_mult = 1;
     cvt->len_ratio = 1.0;
     cvt->rate_incr = ((double) dst_rate) / ((double) src_rate);
+    cvt->rate_index = -1;
+
+    /*
+     * Filters that shrink the data go first, so the ones after them have
+     *  less to do: fewer channels, then smaller samples, then resampling
+     *  with the fewest channels, then bigger samples and more channels.
+     */
+    fmt = src_fmt;
+    if (src_channels > dst_channels) {
+        if ((src_channels == 6) && (dst_channels <= 2)) {
+            cvt->filters[cvt->filter_index++] = SDL_ConvertStrip;
+            src_channels = 2;
+            cvt->len_ratio /= 3;
+        }
+        if ((src_channels == 6) && (dst_channels == 4)) {
+            cvt->filters[cvt->filter_index++] = SDL_ConvertStrip_2;
+            src_channels = 4;
+            cvt->len_ratio /= 2;
+        }
+        /* This assumes that 4 channel audio is in the format:
+           Left {front/back} + Right {front/back}
+           so converting to L/R stereo works properly.
+         */
+        while (((src_channels % 2) == 0) &&
+               ((src_channels / 2) >= dst_channels)) {
+            cvt->filters[cvt->filter_index++] = SDL_ConvertMono;
+            src_channels /= 2;
+            cvt->len_ratio /= 2;
+        }
+    }
+
+    /*
+     * Resample in a format the polyphase resampler handles if we can,
+     *  letting it convert the type on the way if both ends are ones it
+     *  handles. Otherwise resample in the smaller of the two formats.
+     */
+    if (src_rate != dst_rate) {
+        SDL_AudioFormat rate_fmt;
+        const int quality = SDL_GetResampleQuality();
+        if ((quality > 0) && SDL_IsPolyphaseFormat(dst_fmt)) {
+            rate_fmt = SDL_IsPolyphaseFormat(fmt) ? fmt : dst_fmt;
+        } else if ((quality > 0) && SDL_IsPolyphaseFormat(fmt)) {
+            rate_fmt = fmt;
+        } else if (SDL_AUDIO_BITSIZE(dst_fmt) <= SDL_AUDIO_BITSIZE(fmt)) {
+            rate_fmt = dst_fmt;
+        } else {
+            rate_fmt = fmt;
+        }
+
+        if (SDL_BuildAudioTypeCVT(cvt, fmt, rate_fmt) == -1) {
+            return -1;          /* shouldn't happen, but just in case... */
+        }
+        fmt = rate_fmt;
+
+        /* Do rate conversion. Updates (cvt) and (fmt). */
+        if (SDL_BuildAudioResampleCVT(cvt, &fmt, src_channels,
+                                      src_rate, dst_rate) == -1) {
+            return -1;          /* shouldn't happen, but just in case... */
+        }
+    }
 
     /* Convert data types, if necessary. Updates (cvt). */
-    if (SDL_BuildAudioTypeCVT(cvt, src_fmt, dst_fmt) == -1) {
+    if (SDL_BuildAudioTypeCVT(cvt, fmt, dst_fmt) == -1) {
         return -1;              /* shouldn't happen, but just in case... */
     }
 
-    /* Channel conversion */
-    if (src_channels != dst_channels) {
-        if ((src_channels == 1) && (dst_channels > 1)) {
+    /* Channel expansion */
+    if (src_channels < dst_channels) {
+        if (src_channels == 1) {
             cvt->filters[cvt->filter_index++] = SDL_ConvertStereo;
             cvt->len_mult *= 2;
             src_channels = 2;
@@ -1028,35 +1242,9 @@ SDL_BuildAudioCVT(SDL_AudioCVT * cvt,
             src_channels *= 2;
             cvt->len_ratio *= 2;
         }
-        if ((src_channels == 6) && (dst_channels <= 2)) {
-            cvt->filters[cvt->filter_index++] = SDL_ConvertStrip;
-            src_channels = 2;
-            cvt->len_ratio /= 3;
-        }
-        if ((src_channels == 6) && (dst_channels == 4)) {
-            cvt->filters[cvt->filter_index++] = SDL_ConvertStrip_2;
-            src_channels = 4;
-            cvt->len_ratio /= 2;
-        }
-        /* This assumes that 4 channel audio is in the format:
-           Left {front/back} + Right {front/back}
-           so converting to L/R stereo works properly.
-         */
-        while (((src_channels % 2) == 0) &&
-               ((src_channels / 2) >= dst_channels)) {
-            cvt->filters[cvt->filter_index++] = SDL_ConvertMono;
-            src_channels /= 2;
-            cvt->len_ratio /= 2;
-        }
-        if (src_channels != dst_channels) {
-            /* Uh oh.. */ ;
-        }
     }
-
-    /* Do rate conversion, if necessary. Updates (cvt). */
-    if (SDL_BuildAudioResampleCVT(cvt, dst_channels, src_rate, dst_rate) ==
-        -1) {
-        return -1;              /* shouldn't happen, but just in case... */
+    if (src_channels != dst_channels) {
+        /* Uh oh.. */ ;
     }
 
     /* Set up the filter information */
@@ -1067,6 +1255,7 @@ SDL_BuildAudioCVT(SDL_AudioCVT * cvt,
         cvt->len = 0;
         cvt->buf = NULL;
         cvt->filters[cvt->filter_index] = NULL;
+        cvt->block_size = SDL_GetConvertBlockSize(cvt);
     }
     return (cvt->needed);
 }
@@ -0,0 +1,525 @@
+/*
+    SDL - Simple DirectMedia Layer
+    Copyright (C) 1997-2009 Sam Lantinga
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+    Sam Lantinga
+    slouken@libsdl.org
+*/
+#include "SDL_config.h"
+
+/* Polyphase windowed-sinc sample rate conversion.
+
+   Converting from src_rate to dst_rate is treated as upsampling by
+   L = dst_rate / gcd and downsampling by M = src_rate / gcd.  Each output
+   sample falls at one of L phases between two input samples, and the
+   Kaiser windowed sinc filter for every phase is computed up front, so
+   making an output sample is one dot product per channel.  The input is
+   kept as planes of floats so the dot products run over contiguous data.
+*/
+
+#include "SDL_audio.h"
+#include "SDL_audio_c.h"
+#include "../SDL_atomic_c.h"
+
+#ifdef __SSE__
+#include <xmmintrin.h>
+#endif
+
+/* Rates with more phases than this round the phase to the nearest table
+   entry below it, which is off by less than a thousandth of a sample. */
+#define MAX_PHASES  1024
+
+/* Downsampling widens the filter, up to this many taps */
+#define MAX_TAPS    1024
+
+/* Stop caching filters after this many different conversions */
+#define MAX_FILTERS 64
+
+typedef struct SDL_ResampleFilter
+{
+    int src_rate, dst_rate;     /* What the filter was built for */
+    int channels;
+    int quality;
+    int L, M;                   /* Upsampling and downsampling factors */
+    int step, step_phase;       /* M / L and M % L */
+    int phases;                 /* Rows in the table, min(L, MAX_PHASES) */
+    int taps;                   /* Taps per phase, a multiple of 4 */
+    float *coeffs;              /* phases * taps, 16 byte aligned */
+    struct SDL_ResampleFilter *next;
+} SDL_ResampleFilter;
+
+struct SDL_AudioResampler
+{
+    SDL_ResampleFilter *filter;
+    SDL_bool free_filter;       /* Set if the filter isn't in the cache */
+    SDL_AudioFormat format;
+    int framesize;
+    int phase;                  /* Phase of the next output sample */
+    int frames;                 /* Frames of input not used up yet */
+    int max_frames;             /* Room in each plane */
+    float *planes;              /* channels * max_frames samples */
+};
+
+/* Filters are shared and never freed, since SDL_AudioCVT has no way to
+   release one.  The list is only ever pushed onto. */
+static SDL_ResampleFilter *volatile cached_filters = NULL;
+static int num_cached_filters = 0;
+
+static const struct
+{
+    int taps;                   /* At the input rate when upsampling */
+    double rolloff;             /* Passband edge as a fraction of Nyquist */
+    double beta;                /* Kaiser window shape */
+} qualities[] = {
+    { 8, 0.80, 5.0 },           /* SDL_RESAMPLE_FAST */
+    { 16, 0.88, 7.0 },          /* SDL_RESAMPLE_MEDIUM */
+    { 64, 0.94, 10.0 }          /* SDL_RESAMPLE_BEST */
+};
+
+int
+SDL_GetResampleQuality(void)
+{
+    const char *env = SDL_getenv("SDL_AUDIO_RESAMPLE_QUALITY");
+    int quality;
+
+    if (!env) {
+        return SDL_RESAMPLE_MEDIUM;
+    }
+    quality = SDL_atoi(env);
+    if (quality < 0) {
+        quality = 0;
+    } else if (quality > SDL_RESAMPLE_BEST) {
+        quality = SDL_RESAMPLE_BEST;
+    }
+    return quality;
+}
+
+static int
+gcd(int a, int b)
+{
+    while (b) {
+        int t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+/* Zeroth order modified Bessel function of the first kind */
+static double
+bessel_i0(double x)
+{
+    double sum = 1.0, term = 1.0;
+    int k;
+
+    for (k = 1; k < 50 && term > sum * 1e-12; ++k) {
+        term *= (x * x) / (4.0 * k * k);
+        sum += term;
+    }
+    return sum;
+}
+
+static SDL_ResampleFilter *
+create_filter(int src_rate, int dst_rate, int channels, int quality)
+{
+    SDL_ResampleFilter *filter;
+    const int div = gcd(src_rate, dst_rate);
+    const int L = dst_rate / div;
+    const int M = src_rate / div;
+    double cutoff = qualities[quality - 1].rolloff * 0.5;
+    const double beta = qualities[quality - 1].beta;
+    const double i0_beta = bessel_i0(beta);
+    int taps = qualities[quality - 1].taps;
+    int phases = (L > MAX_PHASES) ? MAX_PHASES : L;
+    int p, k;
+
+    /* When downsampling, cut off below the output rate's Nyquist */
+    if (M > L) {
+        cutoff = (cutoff * L) / M;
+        taps = (int) SDL_ceil(((double) taps * M) / L);
+    }
+    taps = (taps + 3) & ~3;
+    if (taps > MAX_TAPS) {
+        taps = MAX_TAPS;
+    }
+
+    filter = (SDL_ResampleFilter *) SDL_malloc(sizeof(*filter) + 15 +
+                                               phases * taps *
+                                               sizeof(float));
+    if (!filter) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    filter->src_rate = src_rate;
+    filter->dst_rate = dst_rate;
+    filter->channels = channels;
+    filter->quality = quality;
+    filter->L = L;
+    filter->M = M;
+    filter->step = M / L;
+    filter->step_phase = M % L;
+    filter->phases = phases;
+    filter->taps = taps;
+    filter->coeffs =
+        (float *) (((size_t) (filter + 1) + 15) & ~(size_t) 15);
+    filter->next = NULL;
+
+    /* Tap k of phase p weights the input sample that is
+       (k - (taps / 2 - 1)) - p / phases samples away from the output */
+    for (p = 0; p < phases; ++p) {
+        float *h = filter->coeffs + p * taps;
+        double sum = 0.0;
+
+        for (k = 0; k < taps; ++k) {
+            const double t = (k - (taps / 2 - 1)) - ((double) p / phases);
+            const double x = t / (taps / 2);
+            double value = 2.0 * cutoff;
+
+            if (t != 0.0) {
+                value = SDL_sin(2.0 * M_PI * cutoff * t) / (M_PI * t);
+            }
+            if (x * x < 1.0) {
+                value *= bessel_i0(beta * SDL_sqrt(1.0 - x * x)) / i0_beta;
+            } else {
+                value *= 1.0 / i0_beta;
+            }
+            h[k] = (float) value;
+            sum += value;
+        }
+
+        /* Normalize each phase so silence and DC come out unchanged */
+        for (k = 0; k < taps; ++k) {
+            h[k] = (float) (h[k] / sum);
+        }
+    }
+    return filter;
+}
+
+void *
+SDL_GetResampleFilter(int src_rate, int dst_rate, int channels, int quality)
+{
+    SDL_ResampleFilter *filter, *head;
+
+    if (quality < SDL_RESAMPLE_FAST || quality > SDL_RESAMPLE_BEST) {
+        SDL_SetError("Unsupported resampling quality");
+        return NULL;
+    }
+    for (filter = cached_filters; filter; filter = filter->next) {
+        if (filter->src_rate == src_rate && filter->dst_rate == dst_rate &&
+            filter->channels == channels && filter->quality == quality) {
+            return filter;
+        }
+    }
+    if (SDL_AtomicAdd(&num_cached_filters, 1) >= MAX_FILTERS) {
+        SDL_AtomicAdd(&num_cached_filters, -1);
+        SDL_SetError("Too many different resampling filters");
+        return NULL;
+    }
+
+    filter = create_filter(src_rate, dst_rate, channels, quality);
+    if (!filter) {
+        SDL_AtomicAdd(&num_cached_filters, -1);
+        return NULL;
+    }
+    /* If another thread built the same filter meanwhile, both are kept,
+       which is harmless. */
+    do {
+        head = cached_filters;
+        filter->next = head;
+    } while (!SDL_AtomicCASPtr((void *volatile *) &cached_filters, head,
+                               filter));
+    return filter;
+}
+
+#ifdef __SSE__
+static __inline__ float
+dot_product(const float *x, const float *h, int taps)
+{
+    __m128 sum0 = _mm_setzero_ps();
+    __m128 sum1 = _mm_setzero_ps();
+    int i;
+
+    for (i = 0; i + 8 <= taps; i += 8) {
+        sum0 = _mm_add_ps(sum0, _mm_mul_ps(_mm_loadu_ps(x + i),
+                                           _mm_load_ps(h + i)));
+        sum1 = _mm_add_ps(sum1, _mm_mul_ps(_mm_loadu_ps(x + i + 4),
+                                           _mm_load_ps(h + i + 4)));
+    }
+    if (i < taps) {
+        sum0 = _mm_add_ps(sum0, _mm_mul_ps(_mm_loadu_ps(x + i),
+                                           _mm_load_ps(h + i)));
+    }
+    sum0 = _mm_add_ps(sum0, sum1);
+    sum0 = _mm_add_ps(sum0, _mm_movehl_ps(sum0, sum0));
+    sum0 = _mm_add_ss(sum0, _mm_shuffle_ps(sum0, sum0, 1));
+    return _mm_cvtss_f32(sum0);
+}
+#else
+static __inline__ float
+dot_product(const float *x, const float *h, int taps)
+{
+    float sum0 = 0.0f, sum1 = 0.0f, sum2 = 0.0f, sum3 = 0.0f;
+    int i;
+
+    for (i = 0; i < taps; i += 4) {
+        sum0 += x[i] * h[i];
+        sum1 += x[i + 1] * h[i + 1];
+        sum2 += x[i + 2] * h[i + 2];
+        sum3 += x[i + 3] * h[i + 3];
+    }
+    return (sum0 + sum2) + (sum1 + sum3);
+}
+#endif
+
+/* Splits interleaved samples into planes of floats */
+static void
+deinterleave(const Uint8 * src, SDL_AudioFormat format, int channels,
+             int frames, float *planes, int stride)
+{
+    int i, c;
+
+    if (format == AUDIO_F32SYS) {
+        const float *in = (const float *) src;
+        for (c = 0; c < channels; ++c) {
+            float *out = planes + c * stride;
+            for (i = 0; i < frames; ++i) {
+                out[i] = in[i * channels + c];
+            }
+        }
+    } else {
+        const Sint16 *in = (const Sint16 *) src;
+        for (c = 0; c < channels; ++c) {
+            float *out = planes + c * stride;
+            for (i = 0; i < frames; ++i) {
+                out[i] = in[i * channels + c] * (1.0f / 32768.0f);
+            }
+        }
+    }
+}
+
+/* Writes up to 'max_out' frames to 'dst', using the input planes from frame
+   '*pos' on, and returns the number of frames written.  '*pos' and '*phase'
+   are left at the next output sample. */
+static int
+run_filter(const SDL_ResampleFilter * filter, const float *planes,
+           int stride, int frames, int *pos, int *phase, Uint8 * dst,
+           SDL_AudioFormat format, int max_out)
+{
+    const int channels = filter->channels;
+    const int taps = filter->taps;
+    int i = *pos, p = *phase;
+    int out = 0, c;
+
+    while (out < max_out && i + taps <= frames) {
+        const float *h;
+
+        if (filter->phases == filter->L) {
+            h = filter->coeffs + p * taps;
+        } else {
+            h = filter->coeffs +
+                (int) (((Sint64) p * filter->phases) / filter->L) * taps;
+        }
+        if (format == AUDIO_F32SYS) {
+            float *o = (float *) dst + out * channels;
+            for (c = 0; c < channels; ++c) {
+                o[c] = dot_product(planes + c * stride + i, h, taps);
+            }
+        } else {
+            Sint16 *o = (Sint16 *) dst + out * channels;
+            for (c = 0; c < channels; ++c) {
+                float sample = dot_product(planes + c * stride + i, h, taps);
+                sample *= 32768.0f;
+                if (sample >= 32767.0f) {
+                    o[c] = 32767;
+                } else if (sample <= -32768.0f) {
+                    o[c] = -32768;
+                } else {
+                    o[c] = (Sint16) (sample + (sample < 0.0f ? -0.5f : 0.5f));
+                }
+            }
+        }
+        ++out;
+
+        i += filter->step;
+        p += filter->step_phase;
+        if (p >= filter->L) {
+            p -= filter->L;
+            ++i;
+        }
+    }
+    *pos = i;
+    *phase = p;
+    return out;
+}
+
+/* Filter for SDL_AudioCVT, which resamples the whole buffer at once, as if
+   it had silence on either side.  It reads any format the resampler
+   supports and writes cvt->dst_format, so it can convert the type too. */
+void SDLCALL
+SDL_ResampleCVT(SDL_AudioCVT * cvt, SDL_AudioFormat format)
+{
+    const SDL_ResampleFilter *filter =
+        (const SDL_ResampleFilter *) cvt->resampler;
+    const SDL_AudioFormat dst_format = cvt->dst_format;
+    const int framesize = filter->channels * (SDL_AUDIO_BITSIZE(format) / 8);
+    const int dst_framesize =
+        filter->channels * (SDL_AUDIO_BITSIZE(dst_format) / 8);
+    const int frames = cvt->len_cvt / framesize;
+    const int before = filter->taps / 2 - 1;
+    const int stride = frames + filter->taps - 1;
+    const int dst_frames = (int) (((Sint64) frames * filter->L) / filter->M);
+    float *planes;
+    int c, pos = 0, phase = 0;
+
+#ifdef DEBUG_CONVERT
+    fprintf(stderr, "Polyphase resample (x%f), %d taps, %d channels.\n",
+            cvt->rate_incr, filter->taps, filter->channels);
+#endif
+
+    planes = (float *) SDL_malloc(filter->channels * stride * sizeof(float));
+    if (!planes) {
+        SDL_OutOfMemory();
+        SDL_memset(cvt->buf, 0, dst_frames * dst_framesize);
+    } else {
+        for (c = 0; c < filter->channels; ++c) {
+            float *plane = planes + c * stride;
+            SDL_memset(plane, 0, before * sizeof(float));
+            SDL_memset(plane + before + frames, 0,
+                       (stride - before - frames) * sizeof(float));
+        }
+        deinterleave(cvt->buf, format, filter->channels, frames,
+                     planes + before, stride);
+        run_filter(filter, planes, stride, stride, &pos, &phase, cvt->buf,
+                   dst_format, dst_frames);
+        SDL_free(planes);
+    }
+    cvt->len_cvt = dst_frames * dst_framesize;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, dst_format);
+    }
+}
+
+SDL_AudioResampler *
+SDL_CreateAudioResampler(SDL_AudioFormat format, Uint8 channels,
+                         int src_rate, int dst_rate, int quality)
+{
+    SDL_AudioResampler *resampler;
+
+    if (format != AUDIO_S16SYS && format != AUDIO_F32SYS) {
+        SDL_SetError("Resampling needs AUDIO_S16SYS or AUDIO_F32SYS");
+        return NULL;
+    }
+    if (channels == 0 || src_rate <= 0 || dst_rate <= 0) {
+        SDL_SetError("Invalid resampling parameters");
+        return NULL;
+    }
+
+    resampler = (SDL_AudioResampler *) SDL_calloc(1, sizeof(*resampler));
+    if (!resampler) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    resampler->filter = (SDL_ResampleFilter *)
+        SDL_GetResampleFilter(src_rate, dst_rate, channels, quality);
+    if (!resampler->filter && quality >= SDL_RESAMPLE_FAST &&
+        quality <= SDL_RESAMPLE_BEST) {
+        /* The cache is full, so this one gets its own filter */
+        resampler->filter = create_filter(src_rate, dst_rate, channels,
+                                          quality);
+        resampler->free_filter = SDL_TRUE;
+    }
+    if (!resampler->filter) {
+        SDL_free(resampler);
+        return NULL;
+    }
+    resampler->format = format;
+    resampler->framesize = channels * (SDL_AUDIO_BITSIZE(format) / 8);
+
+    /* Start with silence before the first sample, so it lines up with the
+       center of the filter */
+    resampler->frames = resampler->filter->taps / 2 - 1;
+    resampler->max_frames = resampler->filter->taps;
+    resampler->planes = (float *) SDL_calloc(channels * resampler->max_frames,
+                                             sizeof(float));
+    if (!resampler->planes) {
+        SDL_FreeAudioResampler(resampler);
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    return resampler;
+}
+
+int
+SDL_AudioResample(SDL_AudioResampler * resampler, const Uint8 * src,
+                  int len, Uint8 * dst, int dst_len)
+{
+    const int channels = resampler->filter->channels;
+    const int frames = len / resampler->framesize;
+    const int total = resampler->frames + frames;
+    int c, out, pos = 0;
+
+    if (total > resampler->max_frames) {
+        int max_frames = resampler->max_frames;
+        float *planes;
+
+        while (max_frames < total) {
+            max_frames *= 2;
+        }
+        planes = (float *) SDL_malloc(channels * max_frames * sizeof(float));
+        if (!planes) {
+            SDL_OutOfMemory();
+            return -1;
+        }
+        for (c = 0; c < channels; ++c) {
+            SDL_memcpy(planes + c * max_frames,
+                       resampler->planes + c * resampler->max_frames,
+                       resampler->frames * sizeof(float));
+        }
+        SDL_free(resampler->planes);
+        resampler->planes = planes;
+        resampler->max_frames = max_frames;
+    }
+    deinterleave(src, resampler->format, channels, frames,
+                 resampler->planes + resampler->frames,
+                 resampler->max_frames);
+
+    out = run_filter(resampler->filter, resampler->planes,
+                     resampler->max_frames, total, &pos, &resampler->phase,
+                     dst, resampler->format, dst_len / resampler->framesize);
+
+    /* Keep what the next output samples still need */
+    resampler->frames = total - pos;
+    for (c = 0; c < channels; ++c) {
+        float *plane = resampler->planes + c * resampler->max_frames;
+        SDL_memmove(plane, plane + pos, resampler->frames * sizeof(float));
+    }
+    return out * resampler->framesize;
+}
+
+void
+SDL_FreeAudioResampler(SDL_AudioResampler * resampler)
+{
+    if (resampler) {
+        if (resampler->free_filter) {
+            SDL_free(resampler->filter);
+        }
+        SDL_free(resampler->planes);
+        SDL_free(resampler);
+    }
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
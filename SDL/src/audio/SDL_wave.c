@@ -27,7 +27,8 @@
 #include "SDL_wave.h"
 
 
-static int ReadChunk(SDL_RWops * src, Chunk * chunk);
+static int ReadChunk(SDL_RWops * src, Chunk * chunk, int direct);
+static void FreeChunk(Chunk * chunk);
 
 struct MS_ADPCM_decodestate
 {
@@ -121,7 +122,7 @@ static int
 MS_ADPCM_decode(Uint8 ** audio_buf, Uint32 * audio_len)
 {
     struct MS_ADPCM_decodestate *state[2];
-    Uint8 *freeable, *encoded, *decoded;
+    Uint8 *encoded, *decoded;
     Sint32 encoded_len, samplesleft;
     Sint8 nybble, stereo;
     Sint16 *coeff[2];
@@ -130,7 +131,6 @@ MS_ADPCM_decode(Uint8 ** audio_buf, Uint32 * audio_len)
     /* Allocate the proper sized output buffer */
     encoded_len = *audio_len;
     encoded = *audio_buf;
-    freeable = *audio_buf;
     *audio_len = (encoded_len / MS_ADPCM_state.wavefmt.blockalign) *
         MS_ADPCM_state.wSamplesPerBlock *
         MS_ADPCM_state.wavefmt.channels * sizeof(Sint16);
@@ -213,7 +213,6 @@ MS_ADPCM_decode(Uint8 ** audio_buf, Uint32 * audio_len)
         }
         encoded_len -= MS_ADPCM_state.wavefmt.blockalign;
     }
-    SDL_free(freeable);
     return (0);
 }
 
@@ -340,7 +339,7 @@ static int
 IMA_ADPCM_decode(Uint8 ** audio_buf, Uint32 * audio_len)
 {
     struct IMA_ADPCM_decodestate *state;
-    Uint8 *freeable, *encoded, *decoded;
+    Uint8 *encoded, *decoded;
     Sint32 encoded_len, samplesleft;
     unsigned int c, channels;
 
@@ -356,7 +355,6 @@ IMA_ADPCM_decode(Uint8 ** audio_buf, Uint32 * audio_len)
     /* Allocate the proper sized output buffer */
     encoded_len = *audio_len;
     encoded = *audio_buf;
-    freeable = *audio_buf;
     *audio_len = (encoded_len / IMA_ADPCM_state.wavefmt.blockalign) *
         IMA_ADPCM_state.wSamplesPerBlock *
         IMA_ADPCM_state.wavefmt.channels * sizeof(Sint16);
@@ -402,7 +400,6 @@ IMA_ADPCM_decode(Uint8 ** audio_buf, Uint32 * audio_len)
         }
         encoded_len -= IMA_ADPCM_state.wavefmt.blockalign;
     }
-    SDL_free(freeable);
     return (0);
 }
 
@@ -455,7 +452,7 @@ SDL_LoadWAV_RW(SDL_RWops * src, int freesrc,
         if (chunk.data != NULL) {
             SDL_free(chunk.data);
         }
-        lenread = ReadChunk(src, &chunk);
+        lenread = ReadChunk(src, &chunk, 0);
         if (lenread < 0) {
             was_error = 1;
             goto done;
@@ -548,35 +545,47 @@ SDL_LoadWAV_RW(SDL_RWops * src, int freesrc,
     spec->channels = (Uint8) SDL_SwapLE16(format->channels);
     spec->samples = 4096;       /* Good default buffer size */
 
-    /* Read the audio data chunk */
+    /* Read the audio data chunk, in place if the source is in memory */
     *audio_buf = NULL;
+    chunk.data = NULL;
+    chunk.mapped = 0;
     do {
-        if (*audio_buf != NULL) {
-            SDL_free(*audio_buf);
-        }
-        lenread = ReadChunk(src, &chunk);
+        FreeChunk(&chunk);
+        lenread = ReadChunk(src, &chunk, 1);
         if (lenread < 0) {
             was_error = 1;
             goto done;
         }
-        *audio_len = lenread;
-        *audio_buf = chunk.data;
         if (chunk.magic != DATA)
             headerDiff += lenread + 2 * sizeof(Uint32);
     } while (chunk.magic != DATA);
     headerDiff += 2 * sizeof(Uint32);   /* for the data chunk and len */
+    *audio_len = lenread;
+    *audio_buf = chunk.data;
 
+    /* The decoders read the encoded data and allocate a new buffer */
     if (MS_ADPCM_encoded) {
         if (MS_ADPCM_decode(audio_buf, audio_len) < 0) {
             was_error = 1;
-            goto done;
         }
-    }
-    if (IMA_ADPCM_encoded) {
+        FreeChunk(&chunk);
+    } else if (IMA_ADPCM_encoded) {
         if (IMA_ADPCM_decode(audio_buf, audio_len) < 0) {
             was_error = 1;
-            goto done;
         }
+        FreeChunk(&chunk);
+    } else if (chunk.mapped) {
+        /* The caller frees the samples, so they need a copy */
+        *audio_buf = (Uint8 *) SDL_malloc(*audio_len);
+        if (*audio_buf == NULL) {
+            SDL_Error(SDL_ENOMEM);
+            was_error = 1;
+        } else {
+            SDL_memcpy(*audio_buf, chunk.data, *audio_len);
+        }
+    }
+    if (was_error) {
+        goto done;
     }
 
     /* Don't return a buffer that isn't a multiple of samplesize */
@@ -612,11 +621,25 @@ SDL_FreeWAV(Uint8 * audio_buf)
     }
 }
 
+/* If 'direct' is set and the data is in memory, the chunk points at it
+   instead of being copied, and must be released with FreeChunk().
+ */
 static int
-ReadChunk(SDL_RWops * src, Chunk * chunk)
+ReadChunk(SDL_RWops * src, Chunk * chunk, int direct)
 {
     chunk->magic = SDL_ReadLE32(src);
     chunk->length = SDL_ReadLE32(src);
+    chunk->mapped = 0;
+    if (direct) {
+        size_t available;
+        const void *data = SDL_RWGetPointer(src, &available);
+        if (data && chunk->length <= available) {
+            SDL_RWseek(src, chunk->length, RW_SEEK_CUR);
+            chunk->data = (Uint8 *) data;
+            chunk->mapped = 1;
+            return (chunk->length);
+        }
+    }
     chunk->data = (Uint8 *) SDL_malloc(chunk->length);
     if (chunk->data == NULL) {
         SDL_Error(SDL_ENOMEM);
@@ -625,9 +648,19 @@ ReadChunk(SDL_RWops * src, Chunk * chunk)
     if (SDL_RWread(src, chunk->data, chunk->length, 1) != 1) {
         SDL_Error(SDL_EFREAD);
         SDL_free(chunk->data);
+        chunk->data = NULL;
         return (-1);
     }
     return (chunk->length);
 }
 
+static void
+FreeChunk(Chunk * chunk)
+{
+    if (chunk->data != NULL && !chunk->mapped) {
+        SDL_free(chunk->data);
+    }
+    chunk->data = NULL;
+}
+
 /* vi: set ts=4 sw=4 expandtab: */
@@ -61,5 +61,6 @@ typedef struct Chunk
     Uint32 magic;
     Uint32 length;
     Uint8 *data;
+    int mapped;                 /* data points into the SDL_RWops memory */
 } Chunk;
 /* vi: set ts=4 sw=4 expandtab: */
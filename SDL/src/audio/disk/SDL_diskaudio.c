@@ -127,6 +127,7 @@ DISKAUD_OpenDevice(_THIS, const char *devname, int iscapture)
     }
 
     /* Allocate mixing buffer */
+    this->hidden->mixlen = this->spec.size;
     this->hidden->mixbuf = (Uint8 *) SDL_AllocAudioMem(this->hidden->mixlen);
     if (this->hidden->mixbuf == NULL) {
         DISKAUD_CloseDevice(this);
@@ -134,7 +135,6 @@ DISKAUD_OpenDevice(_THIS, const char *devname, int iscapture)
     }
     SDL_memset(this->hidden->mixbuf, this->spec.silence, this->spec.size);
 
-    this->hidden->mixlen = this->spec.size;
     this->hidden->write_delay =
         (envr) ? SDL_atoi(envr) : DISKDEFAULT_WRITEDELAY;
 
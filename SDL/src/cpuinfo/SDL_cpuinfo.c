@@ -24,6 +24,7 @@
 /* CPU feature detection for SDL */
 
 #include "SDL_cpuinfo.h"
+#include "SDL_cpuinfo_c.h"
 
 #if defined(__MACOSX__) && defined(__ppc__)
 #include <sys/sysctl.h>         /* For AltiVec check */
@@ -40,6 +41,9 @@
 #define CPU_HAS_SSE	0x00000040
 #define CPU_HAS_SSE2	0x00000080
 #define CPU_HAS_ALTIVEC	0x00000100
+#define CPU_HAS_SSE41	0x00000200
+#define CPU_HAS_AVX2	0x00000400
+#define CPU_HAS_INVARIANT_TSC	0x00000800
 
 #if SDL_ALTIVEC_BLITTERS && HAVE_SETJMP && !__MACOSX__
 /* This is the brute force way of detecting instruction sets...
@@ -289,6 +293,200 @@ done:
     return features;
 }
 
+static __inline__ int
+CPU_getCPUIDFeaturesECX(void)
+{
+    int features = 0;
+/* *INDENT-OFF* */
+#if defined(__GNUC__) && defined(i386)
+	__asm__ (
+"        movl    %%ebx,%%edi\n"
+"        xorl    %%eax,%%eax         # Set up for CPUID instruction    \n"
+"        cpuid                       # Get and save vendor ID          \n"
+"        cmpl    $1,%%eax            # Make sure 1 is valid input for CPUID\n"
+"        jl      1f                  # We dont have the CPUID instruction\n"
+"        xorl    %%eax,%%eax                                           \n"
+"        incl    %%eax                                                 \n"
+"        cpuid                       # Get family/model/stepping/features\n"
+"        movl    %%ecx,%0                                              \n"
+"1:                                                                    \n"
+"        movl    %%edi,%%ebx\n"
+	: "=m" (features)
+	:
+	: "%eax", "%ecx", "%edx", "%edi"
+	);
+#elif defined(__GNUC__) && defined(__x86_64__)
+	__asm__ (
+"        movq    %%rbx,%%rdi\n"
+"        xorl    %%eax,%%eax         # Set up for CPUID instruction    \n"
+"        cpuid                       # Get and save vendor ID          \n"
+"        cmpl    $1,%%eax            # Make sure 1 is valid input for CPUID\n"
+"        jl      1f                  # We dont have the CPUID instruction\n"
+"        xorl    %%eax,%%eax                                           \n"
+"        incl    %%eax                                                 \n"
+"        cpuid                       # Get family/model/stepping/features\n"
+"        movl    %%ecx,%0                                              \n"
+"1:                                                                    \n"
+"        movq    %%rdi,%%rbx\n"
+	: "=m" (features)
+	:
+	: "%rax", "%rcx", "%rdx", "%rdi"
+	);
+#elif (defined(_MSC_VER) && defined(_M_IX86)) || defined(__WATCOMC__)
+	__asm {
+        xor     eax, eax            ; Set up for CPUID instruction
+        cpuid                       ; Get and save vendor ID
+        cmp     eax, 1              ; Make sure 1 is valid input for CPUID
+        jl      done                ; We dont have the CPUID instruction
+        xor     eax, eax
+        inc     eax
+        cpuid                       ; Get family/model/stepping/features
+        mov     features, ecx
+done:
+	}
+#endif
+/* *INDENT-ON* */
+    return features;
+}
+
+static __inline__ int
+CPU_getCPUIDFeatures7(void)
+{
+    int features = 0;
+/* *INDENT-OFF* */
+#if defined(__GNUC__) && defined(i386)
+	__asm__ (
+"        movl    %%ebx,%%edi\n"
+"        xorl    %%eax,%%eax         # Set up for CPUID instruction    \n"
+"        cpuid                       # Get and save vendor ID          \n"
+"        cmpl    $7,%%eax            # Make sure 7 is valid input for CPUID\n"
+"        jl      1f                  # We dont have the extended features\n"
+"        movl    $7,%%eax                                              \n"
+"        xorl    %%ecx,%%ecx                                           \n"
+"        cpuid                       # Get structured extended features\n"
+"        movl    %%ebx,%0                                              \n"
+"1:                                                                    \n"
+"        movl    %%edi,%%ebx\n"
+	: "=m" (features)
+	:
+	: "%eax", "%ecx", "%edx", "%edi"
+	);
+#elif defined(__GNUC__) && defined(__x86_64__)
+	__asm__ (
+"        movq    %%rbx,%%rdi\n"
+"        xorl    %%eax,%%eax         # Set up for CPUID instruction    \n"
+"        cpuid                       # Get and save vendor ID          \n"
+"        cmpl    $7,%%eax            # Make sure 7 is valid input for CPUID\n"
+"        jl      1f                  # We dont have the extended features\n"
+"        movl    $7,%%eax                                              \n"
+"        xorl    %%ecx,%%ecx                                           \n"
+"        cpuid                       # Get structured extended features\n"
+"        movl    %%ebx,%0                                              \n"
+"1:                                                                    \n"
+"        movq    %%rdi,%%rbx\n"
+	: "=m" (features)
+	:
+	: "%rax", "%rcx", "%rdx", "%rdi"
+	);
+#elif (defined(_MSC_VER) && defined(_M_IX86)) || defined(__WATCOMC__)
+	__asm {
+        xor     eax, eax            ; Set up for CPUID instruction
+        cpuid                       ; Get and save vendor ID
+        cmp     eax, 7              ; Make sure 7 is valid input for CPUID
+        jl      done                ; We dont have the extended features
+        mov     eax, 7
+        xor     ecx, ecx
+        cpuid                       ; Get structured extended features
+        mov     features, ebx
+done:
+	}
+#endif
+/* *INDENT-ON* */
+    return features;
+}
+
+/* Returns EDX of the advanced power management leaf, 80000007h */
+static __inline__ int
+CPU_getCPUIDPowerFeatures(void)
+{
+    int features = 0;
+/* *INDENT-OFF* */
+#if defined(__GNUC__) && defined(i386)
+	__asm__ (
+"        movl    %%ebx,%%edi\n"
+"        movl    $0x80000000,%%eax   # Query for extended functions    \n"
+"        cpuid                       # Get extended function limit     \n"
+"        cmpl    $0x80000007,%%eax                                     \n"
+"        jl      1f                  # Nope, we dont have function 800000007h\n"
+"        movl    $0x80000007,%%eax   # Setup extended function 800000007h\n"
+"        cpuid                       # and get the information         \n"
+"        movl    %%edx,%0                                              \n"
+"1:                                                                    \n"
+"        movl    %%edi,%%ebx\n"
+	: "=m" (features)
+	:
+	: "%eax", "%ecx", "%edx", "%edi"
+	);
+#elif defined(__GNUC__) && defined (__x86_64__)
+	__asm__ (
+"        movq    %%rbx,%%rdi\n"
+"        movl    $0x80000000,%%eax   # Query for extended functions    \n"
+"        cpuid                       # Get extended function limit     \n"
+"        cmpl    $0x80000007,%%eax                                     \n"
+"        jl      1f                  # Nope, we dont have function 800000007h\n"
+"        movl    $0x80000007,%%eax   # Setup extended function 800000007h\n"
+"        cpuid                       # and get the information         \n"
+"        movl    %%edx,%0                                              \n"
+"1:                                                                    \n"
+"        movq    %%rdi,%%rbx\n"
+	: "=m" (features)
+	:
+	: "%rax", "%rcx", "%rdx", "%rdi"
+	);
+#elif (defined(_MSC_VER) && defined(_M_IX86)) || defined(__WATCOMC__)
+	__asm {
+        mov     eax,80000000h       ; Query for extended functions
+        cpuid                       ; Get extended function limit
+        cmp     eax,80000007h
+        jl      done                ; Nope, we dont have function 800000007h
+        mov     eax,80000007h       ; Setup extended function 800000007h
+        cpuid                       ; and get the information
+        mov     features,edx
+done:
+	}
+#endif
+/* *INDENT-ON* */
+    return features;
+}
+
+/* Returns the XCR0 register, only valid if the OS has enabled XSAVE */
+static __inline__ int
+CPU_getXCR0(void)
+{
+    int xcr0 = 0;
+/* *INDENT-OFF* */
+#if defined(__GNUC__) && (defined(i386) || defined(__x86_64__))
+	__asm__ (
+"        xorl    %%ecx,%%ecx                                           \n"
+"        .byte   0x0f, 0x01, 0xd0    # xgetbv                          \n"
+"        movl    %%eax,%0                                              \n"
+	: "=m" (xcr0)
+	:
+	: "%eax", "%ecx", "%edx"
+	);
+#elif (defined(_MSC_VER) && defined(_M_IX86)) || defined(__WATCOMC__)
+	__asm {
+        xor     ecx, ecx
+        _emit   0x0f                ; xgetbv
+        _emit   0x01
+        _emit   0xd0
+        mov     xcr0, eax
+	}
+#endif
+/* *INDENT-ON* */
+    return xcr0;
+}
+
 static __inline__ int
 CPU_haveRDTSC(void)
 {
@@ -298,6 +496,16 @@ CPU_haveRDTSC(void)
     return 0;
 }
 
+/* The time stamp counter runs at a constant rate in all power states */
+static __inline__ int
+CPU_haveInvariantTSC(void)
+{
+    if (CPU_haveRDTSC()) {
+        return (CPU_getCPUIDPowerFeatures() & 0x00000100);
+    }
+    return 0;
+}
+
 static __inline__ int
 CPU_haveMMX(void)
 {
@@ -352,6 +560,32 @@ CPU_haveSSE2(void)
     return 0;
 }
 
+static __inline__ int
+CPU_haveSSE41(void)
+{
+    if (CPU_haveCPUID()) {
+        return (CPU_getCPUIDFeaturesECX() & 0x00080000);
+    }
+    return 0;
+}
+
+static __inline__ int
+CPU_haveAVX2(void)
+{
+    if (CPU_haveCPUID()) {
+        /* The OS needs to save the YMM registers across context switches */
+        const int osxsave_avx = 0x18000000;
+        if ((CPU_getCPUIDFeaturesECX() & osxsave_avx) != osxsave_avx) {
+            return 0;
+        }
+        if ((CPU_getXCR0() & 0x00000006) != 0x00000006) {
+            return 0;
+        }
+        return (CPU_getCPUIDFeatures7() & 0x00000020);
+    }
+    return 0;
+}
+
 static __inline__ int
 CPU_haveAltiVec(void)
 {
@@ -385,6 +619,9 @@ SDL_GetCPUFeatures(void)
         if (CPU_haveRDTSC()) {
             SDL_CPUFeatures |= CPU_HAS_RDTSC;
         }
+        if (CPU_haveInvariantTSC()) {
+            SDL_CPUFeatures |= CPU_HAS_INVARIANT_TSC;
+        }
         if (CPU_haveMMX()) {
             SDL_CPUFeatures |= CPU_HAS_MMX;
         }
@@ -403,6 +640,12 @@ SDL_GetCPUFeatures(void)
         if (CPU_haveSSE2()) {
             SDL_CPUFeatures |= CPU_HAS_SSE2;
         }
+        if (CPU_haveSSE41()) {
+            SDL_CPUFeatures |= CPU_HAS_SSE41;
+        }
+        if (CPU_haveAVX2()) {
+            SDL_CPUFeatures |= CPU_HAS_AVX2;
+        }
         if (CPU_haveAltiVec()) {
             SDL_CPUFeatures |= CPU_HAS_ALTIVEC;
         }
@@ -419,6 +662,15 @@ SDL_HasRDTSC(void)
     return SDL_FALSE;
 }
 
+SDL_bool
+SDL_HasInvariantTSC(void)
+{
+    if (SDL_GetCPUFeatures() & CPU_HAS_INVARIANT_TSC) {
+        return SDL_TRUE;
+    }
+    return SDL_FALSE;
+}
+
 SDL_bool
 SDL_HasMMX(void)
 {
@@ -473,6 +725,24 @@ SDL_HasSSE2(void)
     return SDL_FALSE;
 }
 
+SDL_bool
+SDL_HasSSE41(void)
+{
+    if (SDL_GetCPUFeatures() & CPU_HAS_SSE41) {
+        return SDL_TRUE;
+    }
+    return SDL_FALSE;
+}
+
+SDL_bool
+SDL_HasAVX2(void)
+{
+    if (SDL_GetCPUFeatures() & CPU_HAS_AVX2) {
+        return SDL_TRUE;
+    }
+    return SDL_FALSE;
+}
+
 SDL_bool
 SDL_HasAltiVec(void)
 {
@@ -490,12 +760,15 @@ int
 main()
 {
     printf("RDTSC: %d\n", SDL_HasRDTSC());
+    printf("Invariant TSC: %d\n", SDL_HasInvariantTSC());
     printf("MMX: %d\n", SDL_HasMMX());
     printf("MMXExt: %d\n", SDL_HasMMXExt());
     printf("3DNow: %d\n", SDL_Has3DNow());
     printf("3DNowExt: %d\n", SDL_Has3DNowExt());
     printf("SSE: %d\n", SDL_HasSSE());
     printf("SSE2: %d\n", SDL_HasSSE2());
+    printf("SSE4.1: %d\n", SDL_HasSSE41());
+    printf("AVX2: %d\n", SDL_HasAVX2());
     printf("AltiVec: %d\n", SDL_HasAltiVec());
     return 0;
 }
@@ -29,6 +29,7 @@
 #include "SDL_thread.h"
 #include "SDL_sysevents.h"
 #include "SDL_events_c.h"
+#include "../SDL_atomic_c.h"
 #include "../timer/SDL_timer_c.h"
 #if !SDL_JOYSTICK_DISABLED
 #include "../joystick/SDL_joystick_c.h"
@@ -40,19 +41,49 @@ void *SDL_EventOKParam;
 Uint8 SDL_ProcessEvents[SDL_NUMEVENTS];
 static Uint32 SDL_eventstate = 0;
 
-/* Private data -- event queue */
-#define MAXEVENTS	128
+/* Private data -- event queue
+
+   Events are posted into a lock-free ring by any thread, and moved in
+   batches into the pending queue by the thread reading events.  Reading,
+   peeking and filtering work on the pending queue, under the queue lock.
+ */
+#define DEFAULT_MAXEVENTS   128
+#define MAXIMUM_MAXEVENTS   (1 << 20)
+
+typedef struct
+{
+    volatile int sequence;
+    SDL_Event event;
+    struct SDL_SysWMmsg wmmsg;
+} SDL_EventSlot;
+
 static struct
 {
     SDL_mutex *lock;
-    int active;
+    volatile int active;
+    int size;                   /* Power of two size of both queues */
+    SDL_EventSlot *posted;
+    volatile int post_pos;
+    int take_pos;
     int head;
     int tail;
-    SDL_Event event[MAXEVENTS];
+    SDL_Event *event;
     int wmmsg_next;
-    struct SDL_SysWMmsg wmmsg[MAXEVENTS];
+    struct SDL_SysWMmsg *wmmsg;
 } SDL_EventQ;
 
+/* Private data -- threads blocked waiting for events */
+static struct
+{
+    SDL_mutex *lock;
+    SDL_cond *cond;
+    volatile int waiters;       /* Threads in SDL_WaitForEvents() */
+    volatile int video_waiters; /* ... sleeping in the video driver */
+} SDL_EventWait;
+
+/* How often to poll for input the video driver can't wait on, in ms */
+#define SDL_EVENT_POLL_INTERVAL 10
+
 /* Private data -- event locking structure */
 static struct
 {
@@ -109,6 +140,7 @@ SDL_GobbleEvents(void *unused)
 
     while (SDL_EventQ.active) {
         SDL_VideoDevice *_this = SDL_GetVideoDevice();
+        int timeout = -1;
 
         /* Get events from the video subsystem */
         if (_this) {
@@ -118,15 +150,21 @@ SDL_GobbleEvents(void *unused)
         /* Check for joystick state change */
         if (SDL_numjoysticks && (SDL_eventstate & SDL_JOYEVENTMASK)) {
             SDL_JoystickUpdate();
+            timeout = 1;
         }
 #endif
 
-        /* Give up the CPU for the rest of our timeslice */
+        /* Sleep until there's input, or it's time to poll again */
         SDL_EventLock.safe = 1;
         if (SDL_timer_running) {
             SDL_ThreadedTimerCheck();
+            timeout = 1;
+        }
+        if (_this && _this->WaitEventTimeout) {
+            _this->WaitEventTimeout(_this, timeout);
+        } else {
+            SDL_Delay(1);
         }
-        SDL_Delay(1);
 
         /* Check for event locking.
            On the P of the lock mutex, if the lock is held, this thread
@@ -145,6 +183,64 @@ SDL_GobbleEvents(void *unused)
     return (0);
 }
 
+static void
+SDL_FreeEventQueue(void)
+{
+    if (SDL_EventQ.posted) {
+        SDL_free(SDL_EventQ.posted);
+        SDL_EventQ.posted = NULL;
+    }
+    if (SDL_EventQ.event) {
+        SDL_free(SDL_EventQ.event);
+        SDL_EventQ.event = NULL;
+    }
+    if (SDL_EventQ.wmmsg) {
+        SDL_free(SDL_EventQ.wmmsg);
+        SDL_EventQ.wmmsg = NULL;
+    }
+    SDL_EventQ.size = 0;
+}
+
+static int
+SDL_AllocEventQueue(void)
+{
+    const char *env = SDL_getenv("SDL_EVENT_QUEUE_SIZE");
+    int i, size;
+
+    size = DEFAULT_MAXEVENTS;
+    if (env) {
+        int requested = SDL_atoi(env);
+
+        /* Round up to a power of two, so positions can wrap around */
+        size = 16;
+        while (size < requested && size < MAXIMUM_MAXEVENTS) {
+            size *= 2;
+        }
+    }
+
+    SDL_EventQ.posted =
+        (SDL_EventSlot *) SDL_malloc(size * sizeof(*SDL_EventQ.posted));
+    SDL_EventQ.event =
+        (SDL_Event *) SDL_malloc(size * sizeof(*SDL_EventQ.event));
+    SDL_EventQ.wmmsg = (struct SDL_SysWMmsg *)
+        SDL_malloc(size * sizeof(*SDL_EventQ.wmmsg));
+    if (!SDL_EventQ.posted || !SDL_EventQ.event || !SDL_EventQ.wmmsg) {
+        SDL_FreeEventQueue();
+        SDL_OutOfMemory();
+        return (-1);
+    }
+    for (i = 0; i < size; ++i) {
+        SDL_EventQ.posted[i].sequence = i;
+    }
+    SDL_EventQ.size = size;
+    SDL_EventQ.post_pos = 0;
+    SDL_EventQ.take_pos = 0;
+    SDL_EventQ.head = 0;
+    SDL_EventQ.tail = 0;
+    SDL_EventQ.wmmsg_next = 0;
+    return (0);
+}
+
 static int
 SDL_StartEventThread(Uint32 flags)
 {
@@ -159,6 +255,16 @@ SDL_StartEventThread(Uint32 flags)
         return (-1);
     }
 #endif /* !SDL_THREADS_DISABLED */
+    if (SDL_AllocEventQueue() < 0) {
+        return (-1);
+    }
+    SDL_EventWait.lock = SDL_CreateMutex();
+    SDL_EventWait.cond = SDL_CreateCond();
+    if (SDL_EventWait.lock == NULL || SDL_EventWait.cond == NULL) {
+        return (-1);
+    }
+    SDL_EventWait.waiters = 0;
+    SDL_EventWait.video_waiters = 0;
     SDL_EventQ.active = 1;
 
     if ((flags & SDL_INIT_EVENTTHREAD) == SDL_INIT_EVENTTHREAD) {
@@ -191,6 +297,12 @@ SDL_StopEventThread(void)
 {
     SDL_EventQ.active = 0;
     if (SDL_EventThread) {
+        SDL_VideoDevice *_this = SDL_GetVideoDevice();
+
+        /* The event thread may be asleep in the video driver */
+        if (_this && _this->SendWakeupEvent) {
+            _this->SendWakeupEvent(_this);
+        }
         SDL_WaitThread(SDL_EventThread, NULL);
         SDL_EventThread = NULL;
         SDL_DestroyMutex(SDL_EventLock.lock);
@@ -198,6 +310,15 @@ SDL_StopEventThread(void)
 #ifndef IPOD
     SDL_DestroyMutex(SDL_EventQ.lock);
 #endif
+    SDL_FreeEventQueue();
+    if (SDL_EventWait.cond) {
+        SDL_DestroyCond(SDL_EventWait.cond);
+        SDL_EventWait.cond = NULL;
+    }
+    if (SDL_EventWait.lock) {
+        SDL_DestroyMutex(SDL_EventWait.lock);
+        SDL_EventWait.lock = NULL;
+    }
 }
 
 Uint32
@@ -220,6 +341,8 @@ SDL_StopEventLoop(void)
     SDL_QuitQuit();
 
     /* Clean out EventQ */
+    SDL_EventQ.post_pos = 0;
+    SDL_EventQ.take_pos = 0;
     SDL_EventQ.head = 0;
     SDL_EventQ.tail = 0;
     SDL_EventQ.wmmsg_next = 0;
@@ -263,62 +386,170 @@ SDL_StartEventLoop(Uint32 flags)
 }
 
 
-/* Add an event to the event queue -- called with the queue locked */
+/* Post an event to the event queue -- safe to call from any thread */
 static int
 SDL_AddEvent(SDL_Event * event)
 {
-    int tail, added;
+    const unsigned int mask = SDL_EventQ.size - 1;
+    SDL_EventSlot *slot;
+    int pos, diff;
 
-    tail = (SDL_EventQ.tail + 1) % MAXEVENTS;
-    if (tail == SDL_EventQ.head) {
-        /* Overflow, drop event */
-        added = 0;
-    } else {
-        SDL_EventQ.event[SDL_EventQ.tail] = *event;
+    /* Claim a slot, the sequence says whether it has been read yet */
+    pos = SDL_AtomicGet(&SDL_EventQ.post_pos);
+    for (;;) {
+        slot = &SDL_EventQ.posted[pos & mask];
+        diff = (int) ((unsigned int) SDL_AtomicGet(&slot->sequence) -
+                      (unsigned int) pos);
+        if (diff == 0) {
+            if (SDL_AtomicCAS(&SDL_EventQ.post_pos, pos,
+                              (int) ((unsigned int) pos + 1))) {
+                break;
+            }
+        } else if (diff < 0) {
+            /* Overflow, drop event */
+            return (0);
+        }
+        pos = SDL_AtomicGet(&SDL_EventQ.post_pos);
+    }
+
+    slot->event = *event;
+    if (event->type == SDL_SYSWMEVENT) {
+        slot->wmmsg = *event->syswm.msg;
+    }
+    SDL_MemoryBarrier();
+    slot->sequence = (int) ((unsigned int) pos + 1);
+    return (1);
+}
+
+/* Move posted events to the pending queue -- called with the queue locked */
+static void
+SDL_TakePostedEvents(void)
+{
+    const unsigned int mask = SDL_EventQ.size - 1;
+
+    for (;;) {
+        int pos = SDL_EventQ.take_pos;
+        int tail = (SDL_EventQ.tail + 1) & mask;
+        SDL_EventSlot *slot = &SDL_EventQ.posted[pos & mask];
+        SDL_Event *event;
+
+        if (tail == SDL_EventQ.head) {
+            /* The pending queue is full, leave the rest for later */
+            break;
+        }
+        if (SDL_AtomicGet(&slot->sequence) != (int) ((unsigned int) pos + 1)) {
+            /* Nothing (completely) posted yet */
+            break;
+        }
+
+        event = &SDL_EventQ.event[SDL_EventQ.tail];
+        *event = slot->event;
         if (event->type == SDL_SYSWMEVENT) {
             /* Note that it's possible to lose an event */
             int next = SDL_EventQ.wmmsg_next;
-            SDL_EventQ.wmmsg[next] = *event->syswm.msg;
-            SDL_EventQ.event[SDL_EventQ.tail].syswm.msg =
-                &SDL_EventQ.wmmsg[next];
-            SDL_EventQ.wmmsg_next = (next + 1) % MAXEVENTS;
+            SDL_EventQ.wmmsg[next] = slot->wmmsg;
+            event->syswm.msg = &SDL_EventQ.wmmsg[next];
+            SDL_EventQ.wmmsg_next = (next + 1) & mask;
         }
+        SDL_MemoryBarrier();
+        slot->sequence = (int) ((unsigned int) pos + mask + 1);
+        SDL_EventQ.take_pos = (int) ((unsigned int) pos + 1);
         SDL_EventQ.tail = tail;
-        added = 1;
     }
-    return (added);
 }
 
-/* Cut an event, and return the next valid spot, or the tail */
+/* Take events from the front of the pending queue, in large batches */
+/*                           -- called with the queue locked */
+static int
+SDL_GetEvents(SDL_Event * events, int numevents)
+{
+    const int mask = SDL_EventQ.size - 1;
+    int used, count;
+
+    used = 0;
+    while (used < numevents) {
+        /* Copy the contiguous run of events at the head */
+        if (SDL_EventQ.tail >= SDL_EventQ.head) {
+            count = SDL_EventQ.tail - SDL_EventQ.head;
+        } else {
+            count = SDL_EventQ.size - SDL_EventQ.head;
+        }
+        if (count == 0) {
+            /* Make room for (and pick up) any events still being posted */
+            SDL_TakePostedEvents();
+            if (SDL_EventQ.tail == SDL_EventQ.head) {
+                break;
+            }
+            continue;
+        }
+        if (count > numevents - used) {
+            count = numevents - used;
+        }
+        SDL_memcpy(&events[used], &SDL_EventQ.event[SDL_EventQ.head],
+                   count * sizeof(*events));
+        used += count;
+        SDL_EventQ.head = (SDL_EventQ.head + count) & mask;
+    }
+    return (used);
+}
+
+/* Cut the events matching 'mask', closing the gaps in a single pass */
 /*                           -- called with the queue locked */
 static int
-SDL_CutEvent(int spot)
-{
-    if (spot == SDL_EventQ.head) {
-        SDL_EventQ.head = (SDL_EventQ.head + 1) % MAXEVENTS;
-        return (SDL_EventQ.head);
-    } else if ((spot + 1) % MAXEVENTS == SDL_EventQ.tail) {
-        SDL_EventQ.tail = spot;
-        return (SDL_EventQ.tail);
-    } else
-        /* We cut the middle -- shift everything over */
-    {
-        int here, next;
-
-        /* This can probably be optimized with SDL_memcpy() -- careful! */
-        if (--SDL_EventQ.tail < 0) {
-            SDL_EventQ.tail = MAXEVENTS - 1;
-        }
-        for (here = spot; here != SDL_EventQ.tail; here = next) {
-            next = (here + 1) % MAXEVENTS;
-            SDL_EventQ.event[here] = SDL_EventQ.event[next];
-        }
-        return (spot);
-    }
-    /* NOTREACHED */
+SDL_CutEvents(SDL_Event * events, int numevents, Uint32 mask)
+{
+    const int wrap = SDL_EventQ.size - 1;
+    int used, spot, keep;
+
+    used = 0;
+    keep = SDL_EventQ.head;
+    for (spot = SDL_EventQ.head; spot != SDL_EventQ.tail;
+         spot = (spot + 1) & wrap) {
+        if ((used < numevents) &&
+            (mask & SDL_EVENTMASK(SDL_EventQ.event[spot].type))) {
+            events[used++] = SDL_EventQ.event[spot];
+        } else {
+            if (keep != spot) {
+                SDL_EventQ.event[keep] = SDL_EventQ.event[spot];
+            }
+            keep = (keep + 1) & wrap;
+        }
+    }
+    SDL_EventQ.tail = keep;
+    return (used);
 }
 
-/* Lock the event queue, take a peep at it, and unlock it */
+/* Wake up the event thread if it's asleep in the video driver, so it
+   notices new timers or newly enabled joystick events */
+void
+SDL_WakeEventThread(void)
+{
+    if (SDL_EventThread && SDL_ThreadID() != event_thread) {
+        SDL_VideoDevice *_this = SDL_GetVideoDevice();
+        if (_this && _this->SendWakeupEvent) {
+            _this->SendWakeupEvent(_this);
+        }
+    }
+}
+
+/* Wake up the threads in SDL_WaitForEvents() after posting an event */
+static void
+SDL_WakeEventWaiters(void)
+{
+    SDL_mutexP(SDL_EventWait.lock);
+    SDL_CondBroadcast(SDL_EventWait.cond);
+    SDL_mutexV(SDL_EventWait.lock);
+
+    if (SDL_EventWait.video_waiters) {
+        SDL_VideoDevice *_this = SDL_GetVideoDevice();
+        if (_this && _this->SendWakeupEvent) {
+            _this->SendWakeupEvent(_this);
+        }
+    }
+}
+
+/* Take a peep at the event queue.
+   Adding events never locks the queue, the other actions do. */
 int
 SDL_PeepEvents(SDL_Event * events, int numevents, SDL_eventaction action,
                Uint32 mask)
@@ -329,36 +560,52 @@ SDL_PeepEvents(SDL_Event * events, int numevents, SDL_eventaction action,
     if (!SDL_EventQ.active) {
         return (-1);
     }
-    /* Lock the event queue */
     used = 0;
+    if (action == SDL_ADDEVENT) {
+#ifdef SDL_ATOMIC_DISABLED
+        if (SDL_mutexP(SDL_EventQ.lock) < 0) {
+            SDL_SetError("Couldn't lock event queue");
+            return (-1);
+        }
+#endif
+        for (i = 0; i < numevents; ++i) {
+            used += SDL_AddEvent(&events[i]);
+        }
+#ifdef SDL_ATOMIC_DISABLED
+        SDL_mutexV(SDL_EventQ.lock);
+#endif
+        /* Make the events visible before checking for sleeping readers */
+        SDL_MemoryBarrier();
+        if (used > 0 && SDL_EventWait.waiters) {
+            SDL_WakeEventWaiters();
+        }
+        return (used);
+    }
+
+    /* Lock the event queue */
     if (SDL_mutexP(SDL_EventQ.lock) == 0) {
-        if (action == SDL_ADDEVENT) {
-            for (i = 0; i < numevents; ++i) {
-                used += SDL_AddEvent(&events[i]);
-            }
-        } else {
-            SDL_Event tmpevent;
-            int spot;
-
-            /* If 'events' is NULL, just see if they exist */
-            if (events == NULL) {
-                action = SDL_PEEKEVENT;
-                numevents = 1;
-                events = &tmpevent;
-            }
-            spot = SDL_EventQ.head;
+        SDL_Event tmpevent;
+
+        SDL_TakePostedEvents();
+
+        /* If 'events' is NULL, just see if they exist */
+        if (events == NULL) {
+            action = SDL_PEEKEVENT;
+            numevents = 1;
+            events = &tmpevent;
+        }
+        if (action == SDL_PEEKEVENT) {
+            int spot = SDL_EventQ.head;
             while ((used < numevents) && (spot != SDL_EventQ.tail)) {
                 if (mask & SDL_EVENTMASK(SDL_EventQ.event[spot].type)) {
                     events[used++] = SDL_EventQ.event[spot];
-                    if (action == SDL_GETEVENT) {
-                        spot = SDL_CutEvent(spot);
-                    } else {
-                        spot = (spot + 1) % MAXEVENTS;
-                    }
-                } else {
-                    spot = (spot + 1) % MAXEVENTS;
                 }
+                spot = (spot + 1) & (SDL_EventQ.size - 1);
             }
+        } else if (mask == SDL_ALLEVENTS) {
+            used = SDL_GetEvents(events, numevents);
+        } else {
+            used = SDL_CutEvents(events, numevents, mask);
         }
         SDL_mutexV(SDL_EventQ.lock);
     } else {
@@ -408,6 +655,57 @@ SDL_WaitEvent(SDL_Event * event)
     return SDL_WaitEventTimeout(event, -1);
 }
 
+/* Sleep until an event is posted, the video driver has input, or
+   'timeout' milliseconds pass (-1 to wait forever).
+ */
+static void
+SDL_WaitForEvents(int timeout)
+{
+    SDL_VideoDevice *_this = SDL_GetVideoDevice();
+    SDL_bool use_video = SDL_FALSE;
+
+    if (!SDL_EventThread && _this) {
+        if (_this->WaitEventTimeout) {
+            use_video = SDL_TRUE;
+        } else if (timeout < 0 || timeout > SDL_EVENT_POLL_INTERVAL) {
+            /* We have to keep polling the video driver for input */
+            timeout = SDL_EVENT_POLL_INTERVAL;
+        }
+    }
+#if !SDL_JOYSTICK_DISABLED
+    if (!SDL_EventThread && SDL_numjoysticks &&
+        (SDL_eventstate & SDL_JOYEVENTMASK)) {
+        if (timeout < 0 || timeout > SDL_EVENT_POLL_INTERVAL) {
+            timeout = SDL_EVENT_POLL_INTERVAL;
+        }
+    }
+#endif
+
+    /* Posting threads check the waiter counts after adding their events,
+       so either we see the event here, or they see us and wake us up.
+     */
+    SDL_AtomicAdd(&SDL_EventWait.waiters, 1);
+    if (use_video) {
+        SDL_AtomicAdd(&SDL_EventWait.video_waiters, 1);
+        if (SDL_PeepEvents(NULL, 0, SDL_PEEKEVENT, SDL_ALLEVENTS) == 0) {
+            _this->WaitEventTimeout(_this, timeout);
+        }
+        SDL_AtomicAdd(&SDL_EventWait.video_waiters, -1);
+    } else {
+        SDL_mutexP(SDL_EventWait.lock);
+        if (SDL_PeepEvents(NULL, 0, SDL_PEEKEVENT, SDL_ALLEVENTS) == 0) {
+            if (timeout < 0) {
+                SDL_CondWait(SDL_EventWait.cond, SDL_EventWait.lock);
+            } else {
+                SDL_CondWaitTimeout(SDL_EventWait.cond, SDL_EventWait.lock,
+                                    timeout);
+            }
+        }
+        SDL_mutexV(SDL_EventWait.lock);
+    }
+    SDL_AtomicAdd(&SDL_EventWait.waiters, -1);
+}
+
 int
 SDL_WaitEventTimeout(SDL_Event * event, int timeout)
 {
@@ -428,11 +726,16 @@ SDL_WaitEventTimeout(SDL_Event * event, int timeout)
                 /* Polling and no events, just return */
                 return 0;
             }
-            if (timeout > 0 && ((int) (SDL_GetTicks() - expiration) >= 0)) {
-                /* Timeout expired and no events */
-                return 0;
+            if (timeout > 0) {
+                int remaining = (int) (expiration - SDL_GetTicks());
+                if (remaining <= 0) {
+                    /* Timeout expired and no events */
+                    return 0;
+                }
+                SDL_WaitForEvents(remaining);
+            } else {
+                SDL_WaitForEvents(-1);
             }
-            SDL_Delay(10);
             break;
         }
     }
@@ -477,16 +780,22 @@ void
 SDL_FilterEvents(SDL_EventFilter filter, void *userdata)
 {
     if (SDL_mutexP(SDL_EventQ.lock) == 0) {
-        int spot;
+        const int wrap = SDL_EventQ.size - 1;
+        int spot, keep;
 
-        spot = SDL_EventQ.head;
-        while (spot != SDL_EventQ.tail) {
+        SDL_TakePostedEvents();
+
+        keep = SDL_EventQ.head;
+        for (spot = SDL_EventQ.head; spot != SDL_EventQ.tail;
+             spot = (spot + 1) & wrap) {
             if (filter(userdata, &SDL_EventQ.event[spot])) {
-                spot = (spot + 1) % MAXEVENTS;
-            } else {
-                spot = SDL_CutEvent(spot);
+                if (keep != spot) {
+                    SDL_EventQ.event[keep] = SDL_EventQ.event[spot];
+                }
+                keep = (keep + 1) & wrap;
             }
         }
+        SDL_EventQ.tail = keep;
     }
     SDL_mutexV(SDL_EventQ.lock);
 }
@@ -511,6 +820,9 @@ SDL_EventState(Uint8 type, int state)
                 SDL_eventstate &= ~(0x00000001 << (type));
             }
         }
+        if (state == SDL_ENABLE) {
+            SDL_WakeEventThread();
+        }
         while (SDL_PollEvent(&bitbucket) > 0);
         return (current_state);
     }
@@ -524,6 +836,10 @@ SDL_EventState(Uint8 type, int state)
         SDL_ProcessEvents[type] = state;
         if (state == SDL_ENABLE) {
             SDL_eventstate |= (0x00000001 << (type));
+            /* The event thread may need to start polling joysticks */
+            if (SDL_JOYEVENTMASK & SDL_EVENTMASK(type)) {
+                SDL_WakeEventThread();
+            }
         } else {
             SDL_eventstate &= ~(0x00000001 << (type));
         }
@@ -35,6 +35,7 @@ extern void SDL_QuitInterrupt(void);
 extern void SDL_Lock_EventThread(void);
 extern void SDL_Unlock_EventThread(void);
 extern Uint32 SDL_EventThreadID(void);
+extern void SDL_WakeEventThread(void);
 
 extern int SDL_SendSysWMEvent(SDL_SysWMmsg * message);
 
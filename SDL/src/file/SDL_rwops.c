@@ -28,6 +28,17 @@
 #include "SDL_endian.h"
 #include "SDL_rwops.h"
 
+#ifdef HAVE_MMAP
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#define SDL_RWOPS_MAPPED_FILES  1
+#elif defined(__WIN32__) && !defined(_WIN32_WCE)
+#define SDL_RWOPS_MAPPED_FILES  1
+#endif
+
 #ifdef __NDS__
 /* include libfat headers for fatInitDefault(). */
 #include <fat.h>
@@ -430,6 +441,237 @@ mem_close(SDL_RWops * context)
     return (0);
 }
 
+#ifdef SDL_RWOPS_MAPPED_FILES
+
+/* Functions to read memory mapped files, using the memory functions */
+
+static int SDLCALL
+mapped_close(SDL_RWops * context)
+{
+    if (context) {
+#ifdef __WIN32__
+        UnmapViewOfFile(context->hidden.mem.base);
+#else
+        munmap(context->hidden.mem.base,
+               context->hidden.mem.stop - context->hidden.mem.base);
+#endif
+        SDL_FreeRW(context);
+    }
+    return (0);
+}
+
+/* Returns the mapped file, or NULL if it can't (or shouldn't) be mapped */
+static void *
+map_file(const char *file, size_t * size)
+{
+    void *data = NULL;
+#ifdef __WIN32__
+    UINT old_error_mode;
+    HANDLE h, mapping;
+    DWORD high, low;
+
+    /* Do not open a dialog box if failure */
+    old_error_mode =
+        SetErrorMode(SEM_NOOPENFILEERRORBOX | SEM_FAILCRITICALERRORS);
+    h = CreateFile(file, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                   FILE_ATTRIBUTE_NORMAL, NULL);
+    SetErrorMode(old_error_mode);
+    if (h == INVALID_HANDLE_VALUE) {
+        return NULL;
+    }
+    low = GetFileSize(h, &high);
+    /* Empty files can't be mapped, and the offsets have to fit in a long */
+    if (low != INVALID_FILE_SIZE && high == 0 && low > 0 && low < 0x7FFFFFFF) {
+        mapping = CreateFileMapping(h, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (mapping) {
+            data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            /* The view keeps the file open */
+            CloseHandle(mapping);
+        }
+        *size = low;
+    }
+    CloseHandle(h);
+#else
+    struct stat st;
+    int fd;
+
+    fd = open(file, O_RDONLY);
+    if (fd < 0) {
+        return NULL;
+    }
+    /* Empty files can't be mapped, and the offsets have to fit in a long */
+    if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) &&
+        st.st_size > 0 && st.st_size < 0x7FFFFFFF) {
+        int flags = MAP_PRIVATE;
+#ifdef MAP_POPULATE
+        /* Loaders read the whole file, so fault it all in at once */
+        flags |= MAP_POPULATE;
+#endif
+        data = mmap(NULL, st.st_size, PROT_READ, flags, fd, 0);
+        if (data == MAP_FAILED) {
+            data = NULL;
+        }
+        *size = st.st_size;
+    }
+    /* The mapping keeps the file open */
+    close(fd);
+#endif
+    return data;
+}
+
+#endif /* SDL_RWOPS_MAPPED_FILES */
+
+
+/* Functions to read ahead from another SDL_RWops in blocks */
+
+#define DEFAULT_BUFFER_SIZE     4096
+
+typedef struct
+{
+    SDL_RWops *src;
+    int freesrc;
+    long start;                 /* Source offset of data[0], -1 if unknown */
+    size_t pos;                 /* Current position in the buffer */
+    size_t len;                 /* Amount of data in the buffer */
+    size_t size;
+    Uint8 data[1];
+} SDL_RWBuffer;
+
+/* Empty the buffer, the source is positioned at the end of it */
+static void
+buffer_discard(SDL_RWBuffer * buffer)
+{
+    if (buffer->start >= 0) {
+        buffer->start += buffer->len;
+    }
+    buffer->pos = buffer->len = 0;
+}
+
+static long SDLCALL
+buffered_seek(SDL_RWops * context, long offset, int whence)
+{
+    SDL_RWBuffer *buffer = (SDL_RWBuffer *) context->hidden.unknown.data1;
+    long target, result;
+
+    if (buffer->start >= 0 && whence != RW_SEEK_END) {
+        if (whence == RW_SEEK_SET) {
+            target = offset;
+        } else if (whence == RW_SEEK_CUR) {
+            target = buffer->start + buffer->pos + offset;
+        } else {
+            SDL_SetError("Unknown value for 'whence'");
+            return (-1);
+        }
+        /* Seeks within the buffer don't need to touch the source */
+        if (target >= buffer->start &&
+            target <= (long) (buffer->start + buffer->len)) {
+            buffer->pos = target - buffer->start;
+            return (target);
+        }
+        result = SDL_RWseek(buffer->src, target, RW_SEEK_SET);
+    } else {
+        /* The source is at the end of the buffer, not the read position */
+        if (whence == RW_SEEK_CUR) {
+            offset -= (buffer->len - buffer->pos);
+        }
+        result = SDL_RWseek(buffer->src, offset, whence);
+    }
+    if (result >= 0) {
+        buffer->pos = buffer->len = 0;
+        buffer->start = result;
+    }
+    return (result);
+}
+
+static size_t SDLCALL
+buffered_read(SDL_RWops * context, void *ptr, size_t size, size_t maxnum)
+{
+    SDL_RWBuffer *buffer = (SDL_RWBuffer *) context->hidden.unknown.data1;
+    Uint8 *dst = (Uint8 *) ptr;
+    size_t total_bytes, left, amount, got;
+
+    total_bytes = (maxnum * size);
+    if ((maxnum <= 0) || (size <= 0)
+        || ((total_bytes / maxnum) != (size_t) size)) {
+        return 0;
+    }
+
+    left = total_bytes;
+    while (left > 0) {
+        if (buffer->pos == buffer->len) {
+            buffer_discard(buffer);
+            if (left >= buffer->size) {
+                /* Big reads go straight to the destination */
+                got = SDL_RWread(buffer->src, dst, 1, left);
+                if (got == 0) {
+                    break;
+                }
+                if (buffer->start >= 0) {
+                    buffer->start += got;
+                }
+                dst += got;
+                left -= got;
+                continue;
+            }
+            buffer->len = SDL_RWread(buffer->src, buffer->data, 1,
+                                     buffer->size);
+            if (buffer->len == 0) {
+                break;
+            }
+        }
+        amount = buffer->len - buffer->pos;
+        if (amount > left) {
+            amount = left;
+        }
+        SDL_memcpy(dst, buffer->data + buffer->pos, amount);
+        buffer->pos += amount;
+        dst += amount;
+        left -= amount;
+    }
+    return ((total_bytes - left) / size);
+}
+
+static size_t SDLCALL
+buffered_write(SDL_RWops * context, const void *ptr, size_t size, size_t num)
+{
+    SDL_RWBuffer *buffer = (SDL_RWBuffer *) context->hidden.unknown.data1;
+    size_t wrote;
+
+    /* Move the source back to the read position, and write there */
+    if (buffer->pos < buffer->len) {
+        if (SDL_RWseek(buffer->src, -(long) (buffer->len - buffer->pos),
+                       RW_SEEK_CUR) < 0) {
+            return (0);
+        }
+        buffer->len = buffer->pos;
+    }
+    buffer_discard(buffer);
+    wrote = SDL_RWwrite(buffer->src, ptr, size, num);
+    if (buffer->start >= 0 && wrote != (size_t) - 1) {
+        buffer->start += wrote * size;
+    }
+    return (wrote);
+}
+
+static int SDLCALL
+buffered_close(SDL_RWops * context)
+{
+    int status = 0;
+    if (context) {
+        SDL_RWBuffer *buffer = (SDL_RWBuffer *) context->hidden.unknown.data1;
+        if (buffer->freesrc) {
+            status = SDL_RWclose(buffer->src);
+        } else if (buffer->pos < buffer->len) {
+            /* Leave the source where the caller stopped reading */
+            SDL_RWseek(buffer->src, -(long) (buffer->len - buffer->pos),
+                       RW_SEEK_CUR);
+        }
+        SDL_free(buffer);
+        SDL_FreeRW(context);
+    }
+    return status;
+}
+
 
 /* Functions to create SDL_RWops structures from various data sources */
 
@@ -534,6 +776,109 @@ SDL_RWFromConstMem(const void *mem, int size)
     return (rwops);
 }
 
+SDL_RWops *
+SDL_RWFromMappedFile(const char *file)
+{
+#ifdef SDL_RWOPS_MAPPED_FILES
+    SDL_RWops *rwops;
+    size_t size = 0;
+    void *data;
+
+    if (!file || !*file) {
+        SDL_SetError("SDL_RWFromMappedFile(): No file specified");
+        return NULL;
+    }
+    data = map_file(file, &size);
+    if (data) {
+        rwops = SDL_AllocRW();
+        if (rwops == NULL) {
+#ifdef __WIN32__
+            UnmapViewOfFile(data);
+#else
+            munmap(data, size);
+#endif
+            return NULL;
+        }
+        rwops->seek = mem_seek;
+        rwops->read = mem_read;
+        rwops->write = mem_writeconst;
+        rwops->close = mapped_close;
+        rwops->hidden.mem.base = (Uint8 *) data;
+        rwops->hidden.mem.here = rwops->hidden.mem.base;
+        rwops->hidden.mem.stop = rwops->hidden.mem.base + size;
+        return rwops;
+    }
+#endif /* SDL_RWOPS_MAPPED_FILES */
+
+    /* Fall back to reading it the normal way */
+    return SDL_RWFromFile(file, "rb");
+}
+
+SDL_RWops *
+SDL_RWBuffered(SDL_RWops * src, int size, int freesrc)
+{
+    SDL_RWops *rwops;
+    SDL_RWBuffer *buffer;
+
+    if (!src) {
+        SDL_SetError("SDL_RWBuffered(): No data source specified");
+        return NULL;
+    }
+    if (size <= 0) {
+        const char *env = SDL_getenv("SDL_RWOPS_BUFFER_SIZE");
+        size = env ? SDL_atoi(env) : DEFAULT_BUFFER_SIZE;
+        if (size < 0) {
+            size = DEFAULT_BUFFER_SIZE;
+        }
+    }
+    /* There's nothing to gain from buffering data that's in memory */
+    if (SDL_RWGetPointer(src, NULL)) {
+        size = 0;
+    }
+
+    rwops = SDL_AllocRW();
+    if (rwops == NULL) {
+        return NULL;
+    }
+    buffer = (SDL_RWBuffer *) SDL_malloc(sizeof(*buffer) + size);
+    if (buffer == NULL) {
+        SDL_FreeRW(rwops);
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    buffer->src = src;
+    buffer->freesrc = freesrc;
+    buffer->start = SDL_RWtell(src);
+    buffer->pos = buffer->len = 0;
+    buffer->size = size;
+    rwops->seek = buffered_seek;
+    rwops->read = buffered_read;
+    rwops->write = buffered_write;
+    rwops->close = buffered_close;
+    rwops->hidden.unknown.data1 = buffer;
+    return rwops;
+}
+
+const void *
+SDL_RWGetPointer(SDL_RWops * context, size_t * size)
+{
+    if (context && context->read == buffered_read) {
+        SDL_RWBuffer *buffer = (SDL_RWBuffer *) context->hidden.unknown.data1;
+        /* Only valid if the source is at the read position */
+        if (buffer->pos != buffer->len) {
+            return NULL;
+        }
+        return SDL_RWGetPointer(buffer->src, size);
+    }
+    if (!context || context->read != mem_read) {
+        return NULL;
+    }
+    if (size) {
+        *size = (context->hidden.mem.stop - context->hidden.mem.here);
+    }
+    return context->hidden.mem.here;
+}
+
 SDL_RWops *
 SDL_AllocRW(void)
 {
@@ -554,12 +899,27 @@ SDL_FreeRW(SDL_RWops * area)
 
 /* Functions for dynamically reading and writing endian-specific values */
 
+/* Small values are copied straight out of a read-ahead buffer if possible */
+static __inline__ void
+read_value(SDL_RWops * src, void *value, size_t size)
+{
+    if (src->read == buffered_read) {
+        SDL_RWBuffer *buffer = (SDL_RWBuffer *) src->hidden.unknown.data1;
+        if (buffer->len - buffer->pos >= size) {
+            SDL_memcpy(value, buffer->data + buffer->pos, size);
+            buffer->pos += size;
+            return;
+        }
+    }
+    SDL_RWread(src, value, size, 1);
+}
+
 Uint16
 SDL_ReadLE16(SDL_RWops * src)
 {
     Uint16 value;
 
-    SDL_RWread(src, &value, (sizeof value), 1);
+    read_value(src, &value, (sizeof value));
     return (SDL_SwapLE16(value));
 }
 
@@ -568,7 +928,7 @@ SDL_ReadBE16(SDL_RWops * src)
 {
     Uint16 value;
 
-    SDL_RWread(src, &value, (sizeof value), 1);
+    read_value(src, &value, (sizeof value));
     return (SDL_SwapBE16(value));
 }
 
@@ -577,7 +937,7 @@ SDL_ReadLE32(SDL_RWops * src)
 {
     Uint32 value;
 
-    SDL_RWread(src, &value, (sizeof value), 1);
+    read_value(src, &value, (sizeof value));
     return (SDL_SwapLE32(value));
 }
 
@@ -586,7 +946,7 @@ SDL_ReadBE32(SDL_RWops * src)
 {
     Uint32 value;
 
-    SDL_RWread(src, &value, (sizeof value), 1);
+    read_value(src, &value, (sizeof value));
     return (SDL_SwapBE32(value));
 }
 
@@ -595,7 +955,7 @@ SDL_ReadLE64(SDL_RWops * src)
 {
     Uint64 value;
 
-    SDL_RWread(src, &value, (sizeof value), 1);
+    read_value(src, &value, (sizeof value));
     return (SDL_SwapLE64(value));
 }
 
@@ -604,7 +964,7 @@ SDL_ReadBE64(SDL_RWops * src)
 {
     Uint64 value;
 
-    SDL_RWread(src, &value, (sizeof value), 1);
+    read_value(src, &value, (sizeof value));
     return (SDL_SwapBE64(value));
 }
 
@@ -38,4 +38,16 @@ extern int SDL_SYS_StartTimer(void);
 
 /* Stop a previously started timer */
 extern void SDL_SYS_StopTimer(void);
+
+#if SDL_TIMER_UNIX || SDL_TIMER_WIN32
+#define SDL_SYS_PERFORMANCE_COUNTER 1
+/* The high resolution counter behind SDL_GetPerformanceCounter() */
+extern Uint64 SDL_SYS_GetPerformanceCounter(void);
+extern Uint64 SDL_SYS_GetPerformanceFrequency(void);
+#endif
+
+#if SDL_TIMER_UNIX
+/* Wait a specified number of microseconds before returning */
+extern void SDL_SYS_DelayUS(Uint32 us);
+#endif
 /* vi: set ts=4 sw=4 expandtab: */
@@ -25,6 +25,7 @@
 #include "SDL_timer_c.h"
 #include "SDL_mutex.h"
 #include "SDL_systimer.h"
+#include "../events/SDL_events_c.h"
 
 /* #define DEBUG_TIMERS */
 
@@ -38,18 +39,102 @@ SDL_TimerCallback SDL_alarm_callback;
 /* Data used for a thread-based timer */
 static int SDL_timer_threaded = 0;
 
+/* Sleep for a number of microseconds, as closely as the platform allows */
+#if SDL_TIMER_UNIX
+#define SDL_DelayUS(us)     SDL_SYS_DelayUS(us)
+#else
+#define SDL_DelayUS(us)     SDL_Delay(((us) + 999) / 1000)
+#endif
+
 struct _SDL_TimerID
 {
     Uint32 interval;
     SDL_NewTimerCallback cb;
     void *param;
-    Uint32 last_alarm;
-    struct _SDL_TimerID *next;
+    Uint64 deadline;            /* Performance counter when next due */
+    int index;                  /* Position in the heap, -1 if not in it */
+    struct _SDL_TimerID *next;  /* Next unused timer */
 };
 
-static SDL_TimerID SDL_timers = NULL;
+/* The timers are kept in a binary min-heap ordered by deadline, so the
+   next one due is always SDL_timer_heap[0], and SDL_timer_running is the
+   number of timers in it.
+   Removed timers go on a free list, and are only freed by SDL_TimerQuit(),
+   so checking a stale timer ID is safe.
+ */
+static SDL_TimerID *SDL_timer_heap = NULL;
+static int SDL_timer_heap_max = 0;
+static SDL_TimerID SDL_timer_free = NULL;
+static SDL_TimerID SDL_timer_current = NULL;
+static SDL_bool SDL_timer_current_removed = SDL_FALSE;
 static SDL_mutex *SDL_timer_mutex;
-static volatile SDL_bool list_changed = SDL_FALSE;
+static SDL_cond *SDL_timer_cond;
+static SDL_bool SDL_timer_wakeup = SDL_FALSE;
+static Uint64 SDL_timer_frequency = 0;
+
+Uint64
+SDL_GetPerformanceCounter(void)
+{
+#if SDL_SYS_PERFORMANCE_COUNTER
+    return SDL_SYS_GetPerformanceCounter();
+#else
+    /* Extend the millisecond ticks to 64 bits */
+    static Uint32 last_ticks = 0;
+    static Uint64 wraps = 0;
+    Uint32 ticks = SDL_GetTicks();
+
+    if (ticks < last_ticks) {
+        wraps += ((Uint64) 1 << 32);
+    }
+    last_ticks = ticks;
+    return wraps + ticks;
+#endif
+}
+
+Uint64
+SDL_GetPerformanceFrequency(void)
+{
+#if SDL_SYS_PERFORMANCE_COUNTER
+    return SDL_SYS_GetPerformanceFrequency();
+#else
+    return 1000;
+#endif
+}
+
+/* Converts milliseconds to counts of the high resolution counter */
+static Uint64
+SDL_TimerCounts(Uint32 ms)
+{
+    if (!SDL_timer_frequency) {
+        SDL_timer_frequency = SDL_GetPerformanceFrequency();
+    }
+    return (ms / 1000) * SDL_timer_frequency +
+        ((ms % 1000) * SDL_timer_frequency) / 1000;
+}
+
+void
+SDL_DelayUntil(Uint64 deadline)
+{
+    Uint64 frequency = SDL_GetPerformanceFrequency();
+    Uint64 now, left, us;
+
+    while ((now = SDL_GetPerformanceCounter()) < deadline) {
+        left = deadline - now;
+        us = (left / frequency) * 1000000 +
+            ((left % frequency) * 1000000) / frequency;
+        if (us > 2000) {
+            /* Sleep most of the way, SDL_Delay() tends to oversleep */
+            SDL_Delay((Uint32) SDL_min(us / 1000 - 1, 60000));
+        } else if (us > 200) {
+#if SDL_TIMER_UNIX
+            SDL_DelayUS((Uint32) us - 100);
+#else
+            SDL_Delay(0);
+#endif
+        }
+        /* ... and spin for the last moment */
+    }
+}
 
 /* Set whether or not the timer should use a thread.
    This should not be called while the timer subsystem is running.
@@ -78,11 +163,18 @@ SDL_TimerInit(void)
     if (SDL_timer_started) {
         SDL_TimerQuit();
     }
+    /* A timer thread may start using these right away */
+    SDL_timer_mutex = SDL_CreateMutex();
+    SDL_timer_cond = SDL_CreateCond();
+    SDL_timer_wakeup = SDL_FALSE;
     if (!SDL_timer_threaded) {
         retval = SDL_SYS_TimerInit();
     }
-    if (SDL_timer_threaded) {
-        SDL_timer_mutex = SDL_CreateMutex();
+    if (!SDL_timer_threaded) {
+        SDL_DestroyCond(SDL_timer_cond);
+        SDL_timer_cond = NULL;
+        SDL_DestroyMutex(SDL_timer_mutex);
+        SDL_timer_mutex = NULL;
     }
     if (retval == 0) {
         SDL_timer_started = 1;
@@ -98,6 +190,18 @@ SDL_TimerQuit(void)
         SDL_SYS_TimerQuit();
     }
     if (SDL_timer_threaded) {
+        while (SDL_timer_free) {
+            SDL_TimerID freeme = SDL_timer_free;
+            SDL_timer_free = SDL_timer_free->next;
+            SDL_free(freeme);
+        }
+        if (SDL_timer_heap) {
+            SDL_free(SDL_timer_heap);
+            SDL_timer_heap = NULL;
+        }
+        SDL_timer_heap_max = 0;
+        SDL_DestroyCond(SDL_timer_cond);
+        SDL_timer_cond = NULL;
         SDL_DestroyMutex(SDL_timer_mutex);
         SDL_timer_mutex = NULL;
     }
@@ -105,82 +209,213 @@ SDL_TimerQuit(void)
     SDL_timer_threaded = 0;
 }
 
+/* Heap maintenance -- called with the timer mutex held */
+static void
+SDL_TimerHeapUp(int i)
+{
+    SDL_TimerID t = SDL_timer_heap[i];
+
+    while (i > 0) {
+        int parent = (i - 1) / 2;
+        if (SDL_timer_heap[parent]->deadline <= t->deadline) {
+            break;
+        }
+        SDL_timer_heap[i] = SDL_timer_heap[parent];
+        SDL_timer_heap[i]->index = i;
+        i = parent;
+    }
+    SDL_timer_heap[i] = t;
+    t->index = i;
+}
+
+static void
+SDL_TimerHeapDown(int i)
+{
+    SDL_TimerID t = SDL_timer_heap[i];
+
+    for (;;) {
+        int child = 2 * i + 1;
+        if (child >= SDL_timer_running) {
+            break;
+        }
+        if (child + 1 < SDL_timer_running &&
+            SDL_timer_heap[child + 1]->deadline <
+            SDL_timer_heap[child]->deadline) {
+            ++child;
+        }
+        if (t->deadline <= SDL_timer_heap[child]->deadline) {
+            break;
+        }
+        SDL_timer_heap[i] = SDL_timer_heap[child];
+        SDL_timer_heap[i]->index = i;
+        i = child;
+    }
+    SDL_timer_heap[i] = t;
+    t->index = i;
+}
+
+static int
+SDL_TimerHeapInsert(SDL_TimerID t)
+{
+    if (SDL_timer_running == SDL_timer_heap_max) {
+        int max = SDL_timer_heap_max ? SDL_timer_heap_max * 2 : 16;
+        SDL_TimerID *heap = (SDL_TimerID *)
+            SDL_realloc(SDL_timer_heap, max * sizeof(*heap));
+        if (!heap) {
+            SDL_OutOfMemory();
+            return -1;
+        }
+        SDL_timer_heap = heap;
+        SDL_timer_heap_max = max;
+    }
+    SDL_timer_heap[SDL_timer_running++] = t;
+    SDL_TimerHeapUp(SDL_timer_running - 1);
+
+    /* Let the timer thread know if it needs to wake up sooner, or the
+       event thread if it runs the timers and is asleep waiting for input */
+    if (t->index == 0) {
+        if (SDL_timer_cond) {
+            SDL_timer_wakeup = SDL_TRUE;
+            SDL_CondSignal(SDL_timer_cond);
+        }
+#if !SDL_EVENTS_DISABLED
+        SDL_WakeEventThread();
+#endif
+    }
+    return 0;
+}
+
+static void
+SDL_TimerHeapRemove(SDL_TimerID t)
+{
+    int i = t->index;
+    SDL_TimerID last = SDL_timer_heap[--SDL_timer_running];
+
+    t->index = -1;
+    if (last != t) {
+        SDL_timer_heap[i] = last;
+        last->index = i;
+        if (i > 0 && SDL_timer_heap[(i - 1) / 2]->deadline > last->deadline) {
+            SDL_TimerHeapUp(i);
+        } else {
+            SDL_TimerHeapDown(i);
+        }
+    }
+}
+
+static void
+SDL_FreeTimer(SDL_TimerID t)
+{
+    t->next = SDL_timer_free;
+    SDL_timer_free = t;
+}
+
 void
 SDL_ThreadedTimerCheck(void)
 {
-    Uint32 now, ms;
-    SDL_TimerID t, prev, next;
-    SDL_bool removed;
+    Uint64 now;
+    Uint32 ms;
+    SDL_TimerID t;
 
     SDL_mutexP(SDL_timer_mutex);
-    list_changed = SDL_FALSE;
-    now = SDL_GetTicks();
-    for (prev = NULL, t = SDL_timers; t; t = next) {
-        removed = SDL_FALSE;
-        ms = t->interval - SDL_TIMESLICE;
-        next = t->next;
-        if ((int) (now - t->last_alarm) > (int) ms) {
-            struct _SDL_TimerID timer;
-
-            if ((now - t->last_alarm) < t->interval) {
-                t->last_alarm += t->interval;
-            } else {
-                t->last_alarm = now;
-            }
+    now = SDL_GetPerformanceCounter();
+    while (SDL_timer_running && SDL_timer_heap[0]->deadline <= now) {
+        t = SDL_timer_heap[0];
+        SDL_TimerHeapRemove(t);
+        SDL_timer_current = t;
+        SDL_timer_current_removed = SDL_FALSE;
 #ifdef DEBUG_TIMERS
-            printf("Executing timer %p (thread = %d)\n", t, SDL_ThreadID());
+        printf("Executing timer %p (thread = %d)\n", t, SDL_ThreadID());
 #endif
-            timer = *t;
-            SDL_mutexV(SDL_timer_mutex);
-            ms = timer.cb(timer.interval, timer.param);
-            SDL_mutexP(SDL_timer_mutex);
-            if (list_changed) {
-                /* Abort, list of timers modified */
-                /* FIXME: what if ms was changed? */
-                break;
-            }
-            if (ms != t->interval) {
-                if (ms) {
-                    t->interval = ROUND_RESOLUTION(ms);
-                } else {
-                    /* Remove timer from the list */
+        SDL_mutexV(SDL_timer_mutex);
+        ms = t->cb(t->interval, t->param);
+        SDL_mutexP(SDL_timer_mutex);
+        SDL_timer_current = NULL;
+
+        if (!ms || SDL_timer_current_removed) {
 #ifdef DEBUG_TIMERS
-                    printf("SDL: Removing timer %p\n", t);
+            printf("SDL: Removing timer %p\n", t);
 #endif
-                    if (prev) {
-                        prev->next = next;
-                    } else {
-                        SDL_timers = next;
-                    }
-                    SDL_free(t);
-                    --SDL_timer_running;
-                    removed = SDL_TRUE;
-                }
-            }
+            SDL_FreeTimer(t);
+            continue;
+        }
+
+        /* Keep to the original schedule, unless we've fallen behind */
+        t->interval = ms;
+        t->deadline += SDL_TimerCounts(ms);
+        if (t->deadline <= now) {
+            t->deadline = now + SDL_TimerCounts(ms);
         }
-        /* Don't update prev if the timer has disappeared */
-        if (!removed) {
-            prev = t;
+        if (SDL_TimerHeapInsert(t) < 0) {
+            SDL_FreeTimer(t);
         }
     }
     SDL_mutexV(SDL_timer_mutex);
 }
 
+void
+SDL_ThreadedTimerWait(void)
+{
+    SDL_ThreadedTimerCheck();
+
+    SDL_mutexP(SDL_timer_mutex);
+    if (SDL_timer_wakeup) {
+        /* The timers changed while we were running them */
+    } else if (!SDL_timer_running) {
+        SDL_CondWait(SDL_timer_cond, SDL_timer_mutex);
+    } else {
+        Uint64 now = SDL_GetPerformanceCounter();
+        Uint64 deadline = SDL_timer_heap[0]->deadline;
+
+        if (deadline > now + SDL_TimerCounts(2)) {
+            /* Condition variables only time out to the millisecond, so
+               wake up early and do the last bit with a precise delay */
+            Uint64 ms = (deadline - now) / SDL_TimerCounts(1);
+            SDL_CondWaitTimeout(SDL_timer_cond, SDL_timer_mutex,
+                                (Uint32) SDL_min(ms - 1, 60000));
+        } else if (deadline > now) {
+            /* Timers don't need SDL_DelayUntil() precision, so don't spin */
+            Uint64 us = ((deadline - now) * 1000) / SDL_TimerCounts(1);
+            SDL_mutexV(SDL_timer_mutex);
+            SDL_DelayUS((Uint32) us);
+            SDL_mutexP(SDL_timer_mutex);
+        }
+    }
+    SDL_timer_wakeup = SDL_FALSE;
+    SDL_mutexV(SDL_timer_mutex);
+}
+
+void
+SDL_ThreadedTimerWake(void)
+{
+    SDL_mutexP(SDL_timer_mutex);
+    SDL_timer_wakeup = SDL_TRUE;
+    SDL_CondSignal(SDL_timer_cond);
+    SDL_mutexV(SDL_timer_mutex);
+}
+
 static SDL_TimerID
 SDL_AddTimerInternal(Uint32 interval, SDL_NewTimerCallback callback,
                      void *param)
 {
     SDL_TimerID t;
-    t = (SDL_TimerID) SDL_malloc(sizeof(struct _SDL_TimerID));
+
+    if (SDL_timer_free) {
+        t = SDL_timer_free;
+        SDL_timer_free = t->next;
+    } else {
+        t = (SDL_TimerID) SDL_malloc(sizeof(struct _SDL_TimerID));
+    }
     if (t) {
-        t->interval = ROUND_RESOLUTION(interval);
+        t->interval = interval;
         t->cb = callback;
         t->param = param;
-        t->last_alarm = SDL_GetTicks();
-        t->next = SDL_timers;
-        SDL_timers = t;
-        ++SDL_timer_running;
-        list_changed = SDL_TRUE;
+        t->deadline = SDL_GetPerformanceCounter() + SDL_TimerCounts(interval);
+        t->next = NULL;
+        if (SDL_TimerHeapInsert(t) < 0) {
+            SDL_FreeTimer(t);
+            t = NULL;
+        }
     }
 #ifdef DEBUG_TIMERS
     printf("SDL_AddTimer(%d) = %08x num_timers = %d\n", interval, (Uint32) t,
@@ -214,25 +449,22 @@ SDL_AddTimer(Uint32 interval, SDL_NewTimerCallback callback, void *param)
 SDL_bool
 SDL_RemoveTimer(SDL_TimerID id)
 {
-    SDL_TimerID t, prev = NULL;
     SDL_bool removed;
 
     removed = SDL_FALSE;
+    if (!id || !SDL_timer_mutex) {
+        return removed;
+    }
     SDL_mutexP(SDL_timer_mutex);
-    /* Look for id in the linked list of timers */
-    for (t = SDL_timers; t; prev = t, t = t->next) {
-        if (t == id) {
-            if (prev) {
-                prev->next = t->next;
-            } else {
-                SDL_timers = t->next;
-            }
-            SDL_free(t);
-            --SDL_timer_running;
-            removed = SDL_TRUE;
-            list_changed = SDL_TRUE;
-            break;
-        }
+    if (id == SDL_timer_current) {
+        /* It's running, it'll be freed when the callback returns */
+        removed = !SDL_timer_current_removed;
+        SDL_timer_current_removed = SDL_TRUE;
+    } else if (id->index >= 0 && id->index < SDL_timer_running &&
+               SDL_timer_heap[id->index] == id) {
+        SDL_TimerHeapRemove(id);
+        SDL_FreeTimer(id);
+        removed = SDL_TRUE;
     }
 #ifdef DEBUG_TIMERS
     printf("SDL_RemoveTimer(%08x) = %d num_timers = %d thread = %d\n",
@@ -263,15 +495,16 @@ SDL_SetTimer(Uint32 ms, SDL_TimerCallback callback)
     if (SDL_timer_threaded) {
         SDL_mutexP(SDL_timer_mutex);
     }
-    if (SDL_timer_running) {    /* Stop any currently running timer */
+    if (SDL_timer_running || SDL_timer_current) {       /* Stop any currently running timer */
         if (SDL_timer_threaded) {
-            while (SDL_timers) {
-                SDL_TimerID freeme = SDL_timers;
-                SDL_timers = SDL_timers->next;
-                SDL_free(freeme);
+            while (SDL_timer_running) {
+                SDL_TimerID freeme = SDL_timer_heap[--SDL_timer_running];
+                freeme->index = -1;
+                SDL_FreeTimer(freeme);
+            }
+            if (SDL_timer_current) {
+                SDL_timer_current_removed = SDL_TRUE;
             }
-            SDL_timer_running = 0;
-            list_changed = SDL_TRUE;
         } else {
             SDL_SYS_StopTimer();
             SDL_timer_running = 0;
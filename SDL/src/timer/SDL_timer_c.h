@@ -44,4 +44,9 @@ extern void SDL_TimerQuit(void);
 
 /* This function is called from the SDL event thread if it is available */
 extern void SDL_ThreadedTimerCheck(void);
+
+/* Runs the timers that are due, then sleeps until the next one is due or
+   SDL_ThreadedTimerWake() is called -- used by dedicated timer threads */
+extern void SDL_ThreadedTimerWait(void);
+extern void SDL_ThreadedTimerWake(void);
 /* vi: set ts=4 sw=4 expandtab: */
@@ -32,6 +32,9 @@
 
 #include "SDL_timer.h"
 #include "../SDL_timer_c.h"
+#include "../SDL_systimer.h"
+#include "SDL_cpuinfo.h"
+#include "../../cpuinfo/SDL_cpuinfo_c.h"
 
 /* The clock_gettime provides monotonous time, so we should use it if
    it's available. The clock_gettime function is behind ifdef
@@ -58,9 +61,113 @@ static struct timeval start;
 #endif /* HAVE_CLOCK_GETTIME */
 
 
+/* The clock behind the high resolution counter, in nanoseconds if we have
+   clock_gettime() and microseconds otherwise */
+#if HAVE_CLOCK_GETTIME
+#define CLOCK_FREQUENCY 1000000000
+#else
+#define CLOCK_FREQUENCY 1000000
+#endif
+
+static Uint64
+SDL_GetClockCounter(void)
+{
+#if HAVE_CLOCK_GETTIME
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (Uint64) now.tv_sec * 1000000000 + now.tv_nsec;
+#else
+    struct timeval now;
+    gettimeofday(&now, NULL);
+    return (Uint64) now.tv_sec * 1000000 + now.tv_usec;
+#endif
+}
+
+/* If the CPU's time stamp counter ticks at a constant rate, reading it is
+   much cheaper than asking the kernel for the time.  Its rate is measured
+   against the clock the first time someone needs to know it.
+   Setting SDL_TIMER_RDTSC=0 in the environment turns this off.
+ */
+static SDL_bool counter_checked = SDL_FALSE;
+
+#if defined(__GNUC__) && (defined(i386) || defined(__x86_64__))
+#define USE_RDTSC
+
+static SDL_bool counter_rdtsc = SDL_FALSE;
+static Uint64 rdtsc_start;
+static Uint64 rdtsc_start_clock;
+static Uint64 rdtsc_frequency = 0;
+
+static __inline__ Uint64
+SDL_ReadTSC(void)
+{
+    Uint32 lo, hi;
+    __asm__ __volatile__("rdtsc":"=a"(lo), "=d"(hi));
+    return ((Uint64) hi << 32) | lo;
+}
+#endif /* USE_RDTSC */
+
+static void
+SDL_CheckPerformanceCounter(void)
+{
+#ifdef USE_RDTSC
+    const char *env = SDL_getenv("SDL_TIMER_RDTSC");
+
+    if (SDL_HasRDTSC() && SDL_HasInvariantTSC() && (!env || SDL_atoi(env))) {
+        rdtsc_start_clock = SDL_GetClockCounter();
+        rdtsc_start = SDL_ReadTSC();
+        counter_rdtsc = SDL_TRUE;
+    }
+#endif
+    counter_checked = SDL_TRUE;
+}
+
+Uint64
+SDL_SYS_GetPerformanceCounter(void)
+{
+    if (!counter_checked) {
+        SDL_CheckPerformanceCounter();
+    }
+#ifdef USE_RDTSC
+    if (counter_rdtsc) {
+        return SDL_ReadTSC();
+    }
+#endif
+    return SDL_GetClockCounter();
+}
+
+Uint64
+SDL_SYS_GetPerformanceFrequency(void)
+{
+    if (!counter_checked) {
+        SDL_CheckPerformanceCounter();
+    }
+#ifdef USE_RDTSC
+    if (counter_rdtsc) {
+        if (!rdtsc_frequency) {
+            Uint64 clock, ticks;
+
+            /* Measure over at least 10 ms, which is usually long past */
+            do {
+                clock = SDL_GetClockCounter() - rdtsc_start_clock;
+                ticks = SDL_ReadTSC() - rdtsc_start;
+            } while (clock < CLOCK_FREQUENCY / 100);
+            rdtsc_frequency =
+                (Uint64) (((double) ticks * CLOCK_FREQUENCY) / clock);
+        }
+        return rdtsc_frequency;
+    }
+#endif
+    return CLOCK_FREQUENCY;
+}
+
 void
 SDL_StartTicks(void)
 {
+    if (!counter_checked) {
+        SDL_CheckPerformanceCounter();
+    }
+
     /* Set first ticks value */
 #if HAVE_CLOCK_GETTIME
     clock_gettime(CLOCK_MONOTONIC, &start);
@@ -91,6 +198,33 @@ SDL_GetTicks(void)
 #endif
 }
 
+void
+SDL_SYS_DelayUS(Uint32 us)
+{
+#if SDL_THREAD_PTH
+    pth_time_t tv;
+    tv.tv_sec = us / 1000000;
+    tv.tv_usec = us % 1000000;
+    pth_nap(tv);
+#elif HAVE_NANOSLEEP
+    struct timespec elapsed, tv;
+
+    elapsed.tv_sec = us / 1000000;
+    elapsed.tv_nsec = (us % 1000000) * 1000;
+    do {
+        errno = 0;
+        tv.tv_sec = elapsed.tv_sec;
+        tv.tv_nsec = elapsed.tv_nsec;
+    } while (nanosleep(&tv, &elapsed) && (errno == EINTR));
+#else
+    struct timeval tv;
+
+    tv.tv_sec = us / 1000000;
+    tv.tv_usec = us % 1000000;
+    select(0, NULL, NULL, NULL, &tv);
+#endif
+}
+
 void
 SDL_Delay(Uint32 ms)
 {
@@ -210,10 +344,7 @@ static int
 RunTimer(void *unused)
 {
     while (timer_alive) {
-        if (SDL_timer_running) {
-            SDL_ThreadedTimerCheck();
-        }
-        SDL_Delay(1);
+        SDL_ThreadedTimerWait();
     }
     return (0);
 }
@@ -234,6 +365,7 @@ SDL_SYS_TimerQuit(void)
 {
     timer_alive = 0;
     if (timer) {
+        SDL_ThreadedTimerWake();
         SDL_WaitThread(timer, NULL);
         timer = NULL;
     }
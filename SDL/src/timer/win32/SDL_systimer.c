@@ -29,6 +29,7 @@
 
 #include "SDL_timer.h"
 #include "../SDL_timer_c.h"
+#include "../SDL_systimer.h"
 
 #ifdef _WIN32_WCE
 #error This is WinCE. Please use src/timer/wince/SDL_systimer.c instead.
@@ -107,6 +108,47 @@ SDL_Delay(Uint32 ms)
     Sleep(ms);
 }
 
+/* The performance counter is used for timing only, so the problems that
+   keep it from being used for SDL_GetTicks() don't matter here. */
+static LARGE_INTEGER counter_frequency;
+static BOOL counter_checked = FALSE;
+
+static void
+SDL_CheckPerformanceCounter(void)
+{
+    if (!QueryPerformanceFrequency(&counter_frequency)) {
+        counter_frequency.QuadPart = 0;
+    }
+    counter_checked = TRUE;
+}
+
+Uint64
+SDL_SYS_GetPerformanceCounter(void)
+{
+    LARGE_INTEGER counter;
+
+    if (!counter_checked) {
+        SDL_CheckPerformanceCounter();
+    }
+    if (counter_frequency.QuadPart) {
+        QueryPerformanceCounter(&counter);
+        return (Uint64) counter.QuadPart;
+    }
+    return (Uint64) timeGetTime();
+}
+
+Uint64
+SDL_SYS_GetPerformanceFrequency(void)
+{
+    if (!counter_checked) {
+        SDL_CheckPerformanceCounter();
+    }
+    if (counter_frequency.QuadPart) {
+        return (Uint64) counter_frequency.QuadPart;
+    }
+    return 1000;
+}
+
 /* Data to handle a single periodic alarm */
 static UINT timerID = 0;
 
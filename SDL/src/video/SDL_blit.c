@@ -22,6 +22,7 @@
 #include "SDL_config.h"
 
 #include "SDL_video.h"
+#include "SDL_thread.h"
 #include "SDL_sysvideo.h"
 #include "SDL_blit.h"
 #include "SDL_blit_auto.h"
@@ -30,6 +31,230 @@
 #include "SDL_RLEaccel_c.h"
 #include "SDL_pixels_c.h"
 
+#if !SDL_THREADS_DISABLED
+/* Parallel software blitting
+
+   If the SDL_BLIT_THREADS environment variable is set to a number greater
+   than one, large unscaled blits are split into horizontal bands which are
+   run concurrently on a pool of that many threads.  The calling thread
+   always runs the first band itself, so the pool has one thread less.
+   The pool is created by SDL_VideoInit(), so the blits don't race to
+   create it.
+ */
+#define SDL_BLIT_MAX_THREADS        16
+#define SDL_BLIT_THREAD_MIN_PIXELS  (128 * 128)
+#define SDL_BLIT_THREAD_MIN_ROWS    8
+
+typedef struct
+{
+    SDL_BlitFunc func;
+    SDL_BlitInfo info;
+} SDL_BlitBand;
+
+struct SDL_BlitThreadPool;
+
+typedef struct
+{
+    struct SDL_BlitThreadPool *pool;
+    int band;
+} SDL_BlitWorker;
+
+typedef struct SDL_BlitThreadPool
+{
+    int numthreads;
+    SDL_Thread *threads[SDL_BLIT_MAX_THREADS];
+    SDL_BlitWorker workers[SDL_BLIT_MAX_THREADS];
+    SDL_mutex *busy;            /* Serializes blits from several threads */
+    SDL_mutex *lock;            /* Protects the job description below */
+    SDL_cond *wakeup;
+    SDL_sem *done;
+    SDL_bool quit;
+    Uint32 generation;
+    int numbands;
+    SDL_BlitBand bands[SDL_BLIT_MAX_THREADS];
+} SDL_BlitThreadPool;
+
+static SDL_BlitThreadPool *SDL_blit_pool = NULL;
+
+static int SDLCALL
+SDL_BlitWorkerThread(void *data)
+{
+    SDL_BlitWorker *worker = (SDL_BlitWorker *) data;
+    SDL_BlitThreadPool *pool = worker->pool;
+    Uint32 generation = 0;
+
+    SDL_mutexP(pool->lock);
+    for (;;) {
+        while (!pool->quit && pool->generation == generation) {
+            SDL_CondWait(pool->wakeup, pool->lock);
+        }
+        if (pool->quit) {
+            break;
+        }
+        generation = pool->generation;
+
+        /* The submitting thread won't touch our band until we post */
+        if (worker->band < pool->numbands) {
+            SDL_BlitBand *band = &pool->bands[worker->band];
+
+            SDL_mutexV(pool->lock);
+            band->func(&band->info);
+            SDL_SemPost(pool->done);
+            SDL_mutexP(pool->lock);
+        }
+    }
+    SDL_mutexV(pool->lock);
+
+    return 0;
+}
+
+static void
+SDL_DestroyBlitThreadPool(SDL_BlitThreadPool * pool)
+{
+    int i;
+
+    if (pool->lock) {
+        SDL_mutexP(pool->lock);
+        pool->quit = SDL_TRUE;
+        SDL_CondBroadcast(pool->wakeup);
+        SDL_mutexV(pool->lock);
+    }
+    for (i = 1; i < pool->numthreads; ++i) {
+        SDL_WaitThread(pool->threads[i], NULL);
+    }
+    if (pool->done) {
+        SDL_DestroySemaphore(pool->done);
+    }
+    if (pool->wakeup) {
+        SDL_DestroyCond(pool->wakeup);
+    }
+    if (pool->lock) {
+        SDL_DestroyMutex(pool->lock);
+    }
+    if (pool->busy) {
+        SDL_DestroyMutex(pool->busy);
+    }
+    SDL_free(pool);
+}
+
+static SDL_BlitThreadPool *
+SDL_CreateBlitThreadPool(int numthreads)
+{
+    SDL_BlitThreadPool *pool;
+
+    pool = (SDL_BlitThreadPool *) SDL_calloc(1, sizeof(*pool));
+    if (!pool) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    pool->busy = SDL_CreateMutex();
+    pool->lock = SDL_CreateMutex();
+    pool->wakeup = SDL_CreateCond();
+    pool->done = SDL_CreateSemaphore(0);
+    if (!pool->busy || !pool->lock || !pool->wakeup || !pool->done) {
+        SDL_DestroyBlitThreadPool(pool);
+        return NULL;
+    }
+
+    /* Slot 0 is the thread submitting the blit */
+    numthreads = SDL_min(numthreads, SDL_BLIT_MAX_THREADS);
+    for (pool->numthreads = 1; pool->numthreads < numthreads;
+         ++pool->numthreads) {
+        SDL_BlitWorker *worker = &pool->workers[pool->numthreads];
+
+        worker->pool = pool;
+        worker->band = pool->numthreads;
+        pool->threads[pool->numthreads] =
+            SDL_CreateThread(SDL_BlitWorkerThread, worker);
+        if (!pool->threads[pool->numthreads]) {
+            break;
+        }
+    }
+    if (pool->numthreads < 2) {
+        SDL_DestroyBlitThreadPool(pool);
+        return NULL;
+    }
+    return pool;
+}
+
+/* Returns 1 if the blit was run on the thread pool, 0 otherwise */
+static int
+SDL_SoftBlitParallel(SDL_Surface * src, SDL_Surface * dst,
+                     SDL_BlitFunc RunBlit, SDL_BlitInfo * info)
+{
+    SDL_BlitThreadPool *pool;
+    int i, y, numbands;
+
+    /* Scaled and overlapping blits can't be split into bands */
+    if (src == dst || (info->flags & SDL_COPY_NEAREST) ||
+        info->src_w != info->dst_w || info->src_h != info->dst_h) {
+        return 0;
+    }
+    if (info->dst_w * info->dst_h < SDL_BLIT_THREAD_MIN_PIXELS) {
+        return 0;
+    }
+    pool = SDL_blit_pool;
+    if (!pool) {
+        return 0;
+    }
+    numbands = SDL_min(pool->numthreads,
+                       info->dst_h / SDL_BLIT_THREAD_MIN_ROWS);
+    if (numbands < 2) {
+        return 0;
+    }
+
+    SDL_mutexP(pool->busy);
+    SDL_mutexP(pool->lock);
+    for (i = 0, y = 0; i < numbands; ++i) {
+        SDL_BlitBand *band = &pool->bands[i];
+        int h = (info->dst_h - y) / (numbands - i);
+
+        band->func = RunBlit;
+        band->info = *info;
+        band->info.src += y * info->src_pitch;
+        band->info.src_h = h;
+        band->info.dst += y * info->dst_pitch;
+        band->info.dst_h = h;
+        y += h;
+    }
+    pool->numbands = numbands;
+    ++pool->generation;
+    SDL_CondBroadcast(pool->wakeup);
+    SDL_mutexV(pool->lock);
+
+    RunBlit(&pool->bands[0].info);
+    for (i = 1; i < numbands; ++i) {
+        SDL_SemWait(pool->done);
+    }
+    SDL_mutexV(pool->busy);
+
+    return 1;
+}
+#endif /* !SDL_THREADS_DISABLED */
+
+void
+SDL_InitBlitThreads(void)
+{
+#if !SDL_THREADS_DISABLED
+    const char *env = SDL_getenv("SDL_BLIT_THREADS");
+
+    if (!SDL_blit_pool && env && SDL_atoi(env) > 1) {
+        SDL_blit_pool = SDL_CreateBlitThreadPool(SDL_atoi(env));
+    }
+#endif
+}
+
+void
+SDL_QuitBlitThreads(void)
+{
+#if !SDL_THREADS_DISABLED
+    if (SDL_blit_pool) {
+        SDL_DestroyBlitThreadPool(SDL_blit_pool);
+        SDL_blit_pool = NULL;
+    }
+#endif
+}
+
 /* The general purpose software blit routine */
 static int
 SDL_SoftBlit(SDL_Surface * src, SDL_Rect * srcrect,
@@ -86,7 +311,10 @@ SDL_SoftBlit(SDL_Surface * src, SDL_Rect * srcrect,
         RunBlit = (SDL_BlitFunc) src->map->data;
 
         /* Run the actual software blit */
-        RunBlit(info);
+#if !SDL_THREADS_DISABLED
+        if (!SDL_SoftBlitParallel(src, dst, RunBlit, info))
+#endif
+            RunBlit(info);
     }
 
     /* We need to unlock the surfaces if they're locked */
@@ -130,39 +358,44 @@ SDL_ChooseBlitFunc(Uint32 src_format, Uint32 dst_format, int flags,
                    SDL_BlitFuncEntry * entries)
 {
     int i, flagcheck;
+    Uint32 cpu;
     static Uint32 features = 0xffffffff;
+    const char *override = SDL_getenv("SDL_BLIT_CPU_FEATURES");
 
     /* Get the available CPU features */
     if (features == 0xffffffff) {
-        const char *override = SDL_getenv("SDL_BLIT_CPU_FEATURES");
-
         features = SDL_CPU_ANY;
-
-        /* Allow an override for testing .. */
-        if (override) {
-            SDL_sscanf(override, "%u", &features);
-        } else {
-            if (SDL_HasMMX()) {
-                features |= SDL_CPU_MMX;
-            }
-            if (SDL_Has3DNow()) {
-                features |= SDL_CPU_3DNOW;
-            }
-            if (SDL_HasSSE()) {
-                features |= SDL_CPU_SSE;
-            }
-            if (SDL_HasSSE2()) {
-                features |= SDL_CPU_SSE2;
-            }
-            if (SDL_HasAltiVec()) {
-                if (SDL_UseAltivecPrefetch()) {
-                    features |= SDL_CPU_ALTIVEC_PREFETCH;
-                } else {
-                    features |= SDL_CPU_ALTIVEC_NOPREFETCH;
-                }
+        if (SDL_HasMMX()) {
+            features |= SDL_CPU_MMX;
+        }
+        if (SDL_Has3DNow()) {
+            features |= SDL_CPU_3DNOW;
+        }
+        if (SDL_HasSSE()) {
+            features |= SDL_CPU_SSE;
+        }
+        if (SDL_HasSSE2()) {
+            features |= SDL_CPU_SSE2;
+        }
+        if (SDL_HasAVX2()) {
+            features |= SDL_CPU_AVX2;
+        }
+        if (SDL_HasAltiVec()) {
+            if (SDL_UseAltivecPrefetch()) {
+                features |= SDL_CPU_ALTIVEC_PREFETCH;
+            } else {
+                features |= SDL_CPU_ALTIVEC_NOPREFETCH;
             }
         }
     }
+    cpu = features;
+
+    /* Allow an override for testing ..
+       This is checked every time so blitters can be compared in one run */
+    if (override && *override) {
+        cpu = SDL_CPU_ANY;
+        SDL_sscanf(override, "%u", &cpu);
+    }
 
     for (i = 0; entries[i].func; ++i) {
         /* Check for matching pixel formats */
@@ -202,7 +435,7 @@ SDL_ChooseBlitFunc(Uint32 src_format, Uint32 dst_format, int flags,
 
         /* Check CPU features */
         flagcheck = entries[i].cpu;
-        if ((flagcheck & features) != flagcheck) {
+        if ((flagcheck & cpu) != flagcheck) {
             continue;
         }
 
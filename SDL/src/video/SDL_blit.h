@@ -37,6 +37,15 @@
 #include <emmintrin.h>
 #endif
 
+/* The AVX2 blitters are compiled for AVX2 function by function, so they
+   don't require -mavx2 and are only used when the CPU supports them. */
+#if defined(__SSE2__) && (defined(__clang__) || \
+    (defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))))
+#include <immintrin.h>
+#define SDL_AVX2_BLITTERS 1
+#define SDL_TARGETING_AVX2 __attribute__((target("avx2")))
+#endif
+
 #include "SDL_cpuinfo.h"
 #include "SDL_endian.h"
 #include "SDL_video.h"
@@ -63,6 +72,7 @@
 #define SDL_CPU_SSE2                0x00000008
 #define SDL_CPU_ALTIVEC_PREFETCH    0x00000010
 #define SDL_CPU_ALTIVEC_NOPREFETCH  0x00000020
+#define SDL_CPU_AVX2                0x00000040
 
 typedef struct
 {
@@ -109,6 +119,8 @@ typedef struct SDL_BlitMap
 
 /* Functions found in SDL_blit.c */
 extern int SDL_CalculateBlit(SDL_Surface * surface);
+extern void SDL_InitBlitThreads(void);
+extern void SDL_QuitBlitThreads(void);
 
 /* Functions found in SDL_blit_*.c */
 extern SDL_BlitFunc SDL_CalculateBlit0(SDL_Surface * surface);
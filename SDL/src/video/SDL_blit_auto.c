@@ -67,13 +67,235 @@ static void SDL_Blit_RGB888_RGB888_Scale(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_BLITTERS
+static void SDL_TARGETING_AVX2 SDL_Blit_RGB888_RGB888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i v255 = _mm256_set1_epi32(0xFF);
+    const __m256i vdiv = _mm256_set1_epi32(0x8081);
+    const __m256i vzero = _mm256_setzero_si256();
+    __m256i vkeep, vinvA;
+    __m256i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m256i vdstpixel, vdstR, vdstG, vdstB;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            vsrcpixel = _mm256_loadu_si256((__m256i *)src);
+            vsrcR = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 16), v255);
+            vsrcG = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 8), v255);
+            vsrcB = _mm256_and_si256(vsrcpixel, v255);
+            vsrcA = v255;
+            vdstpixel = _mm256_loadu_si256((__m256i *)dst);
+            vdstR = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 16), v255);
+            vdstG = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm256_and_si256(vdstpixel, v255);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm256_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm256_or_si256(_mm256_and_si256(vkeep, vdstR), _mm256_andnot_si256(vkeep, vsrcR));
+                vdstG = _mm256_or_si256(_mm256_and_si256(vkeep, vdstG), _mm256_andnot_si256(vkeep, vsrcG));
+                vdstB = _mm256_or_si256(_mm256_and_si256(vkeep, vdstB), _mm256_andnot_si256(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm256_sub_epi32(v255, vsrcA);
+                vdstR = _mm256_add_epi32(vsrcR, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm256_add_epi32(vsrcG, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm256_add_epi32(vsrcB, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm256_min_epi16(_mm256_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm256_min_epi16(_mm256_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm256_min_epi16(_mm256_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(vdstR, 16), _mm256_slli_epi32(vdstG, 8)), vdstB));
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            srcpixel = *src;
+            srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel; srcA = 0xFF;
+            dstpixel = *dst;
+            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            *dst = dstpixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* SDL_AVX2_BLITTERS */
+
+#if defined(__SSE2__)
+static void SDL_Blit_RGB888_RGB888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i v255 = _mm_set1_epi32(0xFF);
+    const __m128i vdiv = _mm_set1_epi32(0x8081);
+    const __m128i vzero = _mm_setzero_si128();
+    __m128i vkeep, vinvA;
+    __m128i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m128i vdstpixel, vdstR, vdstG, vdstB;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            vsrcpixel = _mm_loadu_si128((__m128i *)src);
+            vsrcR = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 16), v255);
+            vsrcG = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 8), v255);
+            vsrcB = _mm_and_si128(vsrcpixel, v255);
+            vsrcA = v255;
+            vdstpixel = _mm_loadu_si128((__m128i *)dst);
+            vdstR = _mm_and_si128(_mm_srli_epi32(vdstpixel, 16), v255);
+            vdstG = _mm_and_si128(_mm_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm_and_si128(vdstpixel, v255);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm_or_si128(_mm_and_si128(vkeep, vdstR), _mm_andnot_si128(vkeep, vsrcR));
+                vdstG = _mm_or_si128(_mm_and_si128(vkeep, vdstG), _mm_andnot_si128(vkeep, vsrcG));
+                vdstB = _mm_or_si128(_mm_and_si128(vkeep, vdstB), _mm_andnot_si128(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm_sub_epi32(v255, vsrcA);
+                vdstR = _mm_add_epi32(vsrcR, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm_add_epi32(vsrcG, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm_add_epi32(vsrcB, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm_min_epi16(_mm_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm_min_epi16(_mm_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm_min_epi16(_mm_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_or_si128(_mm_slli_epi32(vdstR, 16), _mm_slli_epi32(vdstG, 8)), vdstB));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixel = *src;
+            srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel; srcA = 0xFF;
+            dstpixel = *dst;
+            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            *dst = dstpixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* defined(__SSE2__) */
+
 static void SDL_Blit_RGB888_RGB888_Blend(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
     Uint32 srcpixel;
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
-    Uint32 dstR, dstG, dstB, dstA;
+    Uint32 dstR, dstG, dstB;
 
     while (info->dst_h--) {
         Uint32 *src = (Uint32 *)info->src;
@@ -83,7 +305,7 @@ static void SDL_Blit_RGB888_RGB888_Blend(SDL_BlitInfo *info)
             srcpixel = *src;
             srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel; srcA = 0xFF;
             dstpixel = *dst;
-            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel; dstA = 0xFF;
+            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -132,7 +354,7 @@ static void SDL_Blit_RGB888_RGB888_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcpixel;
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
-    Uint32 dstR, dstG, dstB, dstA;
+    Uint32 dstR, dstG, dstB;
     int srcy, srcx;
     int posy, posx;
     int incy, incx;
@@ -163,7 +385,7 @@ static void SDL_Blit_RGB888_RGB888_Blend_Scale(SDL_BlitInfo *info)
             srcpixel = *src;
             srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel; srcA = 0xFF;
             dstpixel = *dst;
-            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel; dstA = 0xFF;
+            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -206,6 +428,124 @@ static void SDL_Blit_RGB888_RGB888_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_BLITTERS
+static void SDL_TARGETING_AVX2 SDL_Blit_RGB888_RGB888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    const __m256i vmodulateR = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m256i vmodulateG = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m256i vmodulateB = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m256i vmodulateA = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m256i v255 = _mm256_set1_epi32(0xFF);
+    const __m256i vdiv = _mm256_set1_epi32(0x8081);
+    __m256i vpixel, vR, vG, vB, vA;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            vpixel = _mm256_loadu_si256((__m256i *)src);
+            vR = _mm256_and_si256(_mm256_srli_epi32(vpixel, 16), v255);
+            vG = _mm256_and_si256(_mm256_srli_epi32(vpixel, 8), v255);
+            vB = _mm256_and_si256(vpixel, v255);
+            vA = v255;
+            vR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vR, vmodulateR), vdiv), 7);
+            vG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vG, vmodulateG), vdiv), 7);
+            vB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vB, vmodulateB), vdiv), 7);
+            vA = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vA, vmodulateA), vdiv), 7);
+            _mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(vR, 16), _mm256_slli_epi32(vG, 8)), vB));
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            pixel = *src;
+            R = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); B = (Uint8)pixel; A = 0xFF;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = (R * modulateR) / 255;
+                G = (G * modulateG) / 255;
+                B = (B * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = (A * modulateA) / 255;
+            }
+            pixel = ((Uint32)R << 16) | ((Uint32)G << 8) | B;
+            *dst = pixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* SDL_AVX2_BLITTERS */
+
+#if defined(__SSE2__)
+static void SDL_Blit_RGB888_RGB888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    const __m128i vmodulateR = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m128i vmodulateG = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m128i vmodulateB = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m128i vmodulateA = _mm_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m128i v255 = _mm_set1_epi32(0xFF);
+    const __m128i vdiv = _mm_set1_epi32(0x8081);
+    __m128i vpixel, vR, vG, vB, vA;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            vpixel = _mm_loadu_si128((__m128i *)src);
+            vR = _mm_and_si128(_mm_srli_epi32(vpixel, 16), v255);
+            vG = _mm_and_si128(_mm_srli_epi32(vpixel, 8), v255);
+            vB = _mm_and_si128(vpixel, v255);
+            vA = v255;
+            vR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vR, vmodulateR), vdiv), 7);
+            vG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vG, vmodulateG), vdiv), 7);
+            vB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vB, vmodulateB), vdiv), 7);
+            vA = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vA, vmodulateA), vdiv), 7);
+            _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_or_si128(_mm_slli_epi32(vR, 16), _mm_slli_epi32(vG, 8)), vB));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            pixel = *src;
+            R = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); B = (Uint8)pixel; A = 0xFF;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = (R * modulateR) / 255;
+                G = (G * modulateG) / 255;
+                B = (B * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = (A * modulateA) / 255;
+            }
+            pixel = ((Uint32)R << 16) | ((Uint32)G << 8) | B;
+            *dst = pixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* defined(__SSE2__) */
+
 static void SDL_Blit_RGB888_RGB888_Modulate(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -297,27 +637,86 @@ static void SDL_Blit_RGB888_RGB888_Modulate_Scale(SDL_BlitInfo *info)
     }
 }
 
-static void SDL_Blit_RGB888_RGB888_Modulate_Blend(SDL_BlitInfo *info)
+#if SDL_AVX2_BLITTERS
+static void SDL_TARGETING_AVX2 SDL_Blit_RGB888_RGB888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
     const Uint32 modulateR = info->r;
     const Uint32 modulateG = info->g;
     const Uint32 modulateB = info->b;
     const Uint32 modulateA = info->a;
+    const __m256i vmodulateR = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m256i vmodulateG = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m256i vmodulateB = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m256i vmodulateA = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m256i v255 = _mm256_set1_epi32(0xFF);
+    const __m256i vdiv = _mm256_set1_epi32(0x8081);
+    const __m256i vzero = _mm256_setzero_si256();
+    __m256i vkeep, vinvA;
+    __m256i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m256i vdstpixel, vdstR, vdstG, vdstB;
     Uint32 srcpixel;
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
-    Uint32 dstR, dstG, dstB, dstA;
+    Uint32 dstR, dstG, dstB;
 
     while (info->dst_h--) {
         Uint32 *src = (Uint32 *)info->src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
+        while (n >= 8) {
+            vsrcpixel = _mm256_loadu_si256((__m256i *)src);
+            vsrcR = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 16), v255);
+            vsrcG = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 8), v255);
+            vsrcB = _mm256_and_si256(vsrcpixel, v255);
+            vsrcA = v255;
+            vdstpixel = _mm256_loadu_si256((__m256i *)dst);
+            vdstR = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 16), v255);
+            vdstG = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm256_and_si256(vdstpixel, v255);
+            vsrcR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vmodulateR), vdiv), 7);
+            vsrcG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vmodulateG), vdiv), 7);
+            vsrcB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vmodulateB), vdiv), 7);
+            vsrcA = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcA, vmodulateA), vdiv), 7);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm256_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm256_or_si256(_mm256_and_si256(vkeep, vdstR), _mm256_andnot_si256(vkeep, vsrcR));
+                vdstG = _mm256_or_si256(_mm256_and_si256(vkeep, vdstG), _mm256_andnot_si256(vkeep, vsrcG));
+                vdstB = _mm256_or_si256(_mm256_and_si256(vkeep, vdstB), _mm256_andnot_si256(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm256_sub_epi32(v255, vsrcA);
+                vdstR = _mm256_add_epi32(vsrcR, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm256_add_epi32(vsrcG, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm256_add_epi32(vsrcB, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm256_min_epi16(_mm256_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm256_min_epi16(_mm256_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm256_min_epi16(_mm256_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(vdstR, 16), _mm256_slli_epi32(vdstG, 8)), vdstB));
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
         while (n--) {
             srcpixel = *src;
             srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel; srcA = 0xFF;
             dstpixel = *dst;
-            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel; dstA = 0xFF;
+            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
             if (flags & SDL_COPY_MODULATE_COLOR) {
                 srcR = (srcR * modulateR) / 255;
                 srcG = (srcG * modulateG) / 255;
@@ -367,49 +766,88 @@ static void SDL_Blit_RGB888_RGB888_Modulate_Blend(SDL_BlitInfo *info)
         info->dst += info->dst_pitch;
     }
 }
+#endif /* SDL_AVX2_BLITTERS */
 
-static void SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
+#if defined(__SSE2__)
+static void SDL_Blit_RGB888_RGB888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
     const Uint32 modulateR = info->r;
     const Uint32 modulateG = info->g;
     const Uint32 modulateB = info->b;
     const Uint32 modulateA = info->a;
+    const __m128i vmodulateR = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m128i vmodulateG = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m128i vmodulateB = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m128i vmodulateA = _mm_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m128i v255 = _mm_set1_epi32(0xFF);
+    const __m128i vdiv = _mm_set1_epi32(0x8081);
+    const __m128i vzero = _mm_setzero_si128();
+    __m128i vkeep, vinvA;
+    __m128i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m128i vdstpixel, vdstR, vdstG, vdstB;
     Uint32 srcpixel;
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
-    Uint32 dstR, dstG, dstB, dstA;
-    int srcy, srcx;
-    int posy, posx;
-    int incy, incx;
-
-    srcy = 0;
-    posy = 0;
-    incy = (info->src_h << 16) / info->dst_h;
-    incx = (info->src_w << 16) / info->dst_w;
+    Uint32 dstR, dstG, dstB;
 
     while (info->dst_h--) {
-        Uint32 *src;
+        Uint32 *src = (Uint32 *)info->src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
-        srcx = -1;
-        posx = 0x10000L;
-        while (posy >= 0x10000L) {
-            ++srcy;
-            posy -= 0x10000L;
+        while (n >= 4) {
+            vsrcpixel = _mm_loadu_si128((__m128i *)src);
+            vsrcR = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 16), v255);
+            vsrcG = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 8), v255);
+            vsrcB = _mm_and_si128(vsrcpixel, v255);
+            vsrcA = v255;
+            vdstpixel = _mm_loadu_si128((__m128i *)dst);
+            vdstR = _mm_and_si128(_mm_srli_epi32(vdstpixel, 16), v255);
+            vdstG = _mm_and_si128(_mm_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm_and_si128(vdstpixel, v255);
+            vsrcR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vmodulateR), vdiv), 7);
+            vsrcG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vmodulateG), vdiv), 7);
+            vsrcB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vmodulateB), vdiv), 7);
+            vsrcA = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcA, vmodulateA), vdiv), 7);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm_or_si128(_mm_and_si128(vkeep, vdstR), _mm_andnot_si128(vkeep, vsrcR));
+                vdstG = _mm_or_si128(_mm_and_si128(vkeep, vdstG), _mm_andnot_si128(vkeep, vsrcG));
+                vdstB = _mm_or_si128(_mm_and_si128(vkeep, vdstB), _mm_andnot_si128(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm_sub_epi32(v255, vsrcA);
+                vdstR = _mm_add_epi32(vsrcR, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm_add_epi32(vsrcG, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm_add_epi32(vsrcB, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm_min_epi16(_mm_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm_min_epi16(_mm_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm_min_epi16(_mm_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_or_si128(_mm_slli_epi32(vdstR, 16), _mm_slli_epi32(vdstG, 8)), vdstB));
+            src += 4;
+            dst += 4;
+            n -= 4;
         }
         while (n--) {
-            if (posx >= 0x10000L) {
-                while (posx >= 0x10000L) {
-                    ++srcx;
-                    posx -= 0x10000L;
-                }
-                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
-            }
             srcpixel = *src;
             srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel; srcA = 0xFF;
             dstpixel = *dst;
-            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel; dstA = 0xFF;
+            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
             if (flags & SDL_COPY_MODULATE_COLOR) {
                 srcR = (srcR * modulateR) / 255;
                 srcG = (srcG * modulateG) / 255;
@@ -452,65 +890,26 @@ static void SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
             }
             dstpixel = ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
             *dst = dstpixel;
-            posx += incx;
-            ++dst;
-        }
-        posy += incy;
-        info->dst += info->dst_pitch;
-    }
-}
-
-static void SDL_Blit_RGB888_BGR888_Scale(SDL_BlitInfo *info)
-{
-    const int flags = info->flags;
-    Uint32 pixel;
-    Uint32 R, G, B, A;
-    int srcy, srcx;
-    int posy, posx;
-    int incy, incx;
-
-    srcy = 0;
-    posy = 0;
-    incy = (info->src_h << 16) / info->dst_h;
-    incx = (info->src_w << 16) / info->dst_w;
-
-    while (info->dst_h--) {
-        Uint32 *src;
-        Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        srcx = -1;
-        posx = 0x10000L;
-        while (posy >= 0x10000L) {
-            ++srcy;
-            posy -= 0x10000L;
-        }
-        while (n--) {
-            if (posx >= 0x10000L) {
-                while (posx >= 0x10000L) {
-                    ++srcx;
-                    posx -= 0x10000L;
-                }
-                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
-            }
-            pixel = *src;
-            R = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); B = (Uint8)pixel; A = 0xFF;
-            pixel = ((Uint32)B << 16) | ((Uint32)G << 8) | R;
-            *dst = pixel;
-            posx += incx;
+            ++src;
             ++dst;
         }
-        posy += incy;
+        info->src += info->src_pitch;
         info->dst += info->dst_pitch;
     }
 }
+#endif /* defined(__SSE2__) */
 
-static void SDL_Blit_RGB888_BGR888_Blend(SDL_BlitInfo *info)
+static void SDL_Blit_RGB888_RGB888_Modulate_Blend(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
     Uint32 srcpixel;
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
-    Uint32 dstR, dstG, dstB, dstA;
+    Uint32 dstR, dstG, dstB;
 
     while (info->dst_h--) {
         Uint32 *src = (Uint32 *)info->src;
@@ -520,7 +919,15 @@ static void SDL_Blit_RGB888_BGR888_Blend(SDL_BlitInfo *info)
             srcpixel = *src;
             srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel; srcA = 0xFF;
             dstpixel = *dst;
-            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel; dstA = 0xFF;
+            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -553,7 +960,7 @@ static void SDL_Blit_RGB888_BGR888_Blend(SDL_BlitInfo *info)
                 dstB = (srcB * dstB) / 255;
                 break;
             }
-            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
+            dstpixel = ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
             *dst = dstpixel;
             ++src;
             ++dst;
@@ -563,13 +970,17 @@ static void SDL_Blit_RGB888_BGR888_Blend(SDL_BlitInfo *info)
     }
 }
 
-static void SDL_Blit_RGB888_BGR888_Blend_Scale(SDL_BlitInfo *info)
+static void SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
     Uint32 srcpixel;
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
-    Uint32 dstR, dstG, dstB, dstA;
+    Uint32 dstR, dstG, dstB;
     int srcy, srcx;
     int posy, posx;
     int incy, incx;
@@ -600,7 +1011,15 @@ static void SDL_Blit_RGB888_BGR888_Blend_Scale(SDL_BlitInfo *info)
             srcpixel = *src;
             srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel; srcA = 0xFF;
             dstpixel = *dst;
-            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel; dstA = 0xFF;
+            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -633,7 +1052,7 @@ static void SDL_Blit_RGB888_BGR888_Blend_Scale(SDL_BlitInfo *info)
                 dstB = (srcB * dstB) / 255;
                 break;
             }
-            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
+            dstpixel = ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
             *dst = dstpixel;
             posx += incx;
             ++dst;
@@ -643,48 +1062,9 @@ static void SDL_Blit_RGB888_BGR888_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
-static void SDL_Blit_RGB888_BGR888_Modulate(SDL_BlitInfo *info)
-{
-    const int flags = info->flags;
-    const Uint32 modulateR = info->r;
-    const Uint32 modulateG = info->g;
-    const Uint32 modulateB = info->b;
-    const Uint32 modulateA = info->a;
-    Uint32 pixel;
-    Uint32 R, G, B, A;
-
-    while (info->dst_h--) {
-        Uint32 *src = (Uint32 *)info->src;
-        Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        while (n--) {
-            pixel = *src;
-            R = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); B = (Uint8)pixel; A = 0xFF;
-            if (flags & SDL_COPY_MODULATE_COLOR) {
-                R = (R * modulateR) / 255;
-                G = (G * modulateG) / 255;
-                B = (B * modulateB) / 255;
-            }
-            if (flags & SDL_COPY_MODULATE_ALPHA) {
-                A = (A * modulateA) / 255;
-            }
-            pixel = ((Uint32)B << 16) | ((Uint32)G << 8) | R;
-            *dst = pixel;
-            ++src;
-            ++dst;
-        }
-        info->src += info->src_pitch;
-        info->dst += info->dst_pitch;
-    }
-}
-
-static void SDL_Blit_RGB888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
+static void SDL_Blit_RGB888_BGR888_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
-    const Uint32 modulateR = info->r;
-    const Uint32 modulateG = info->g;
-    const Uint32 modulateB = info->b;
-    const Uint32 modulateA = info->a;
     Uint32 pixel;
     Uint32 R, G, B, A;
     int srcy, srcx;
@@ -716,14 +1096,6 @@ static void SDL_Blit_RGB888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
             }
             pixel = *src;
             R = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); B = (Uint8)pixel; A = 0xFF;
-            if (flags & SDL_COPY_MODULATE_COLOR) {
-                R = (R * modulateR) / 255;
-                G = (G * modulateG) / 255;
-                B = (B * modulateB) / 255;
-            }
-            if (flags & SDL_COPY_MODULATE_ALPHA) {
-                A = (A * modulateA) / 255;
-            }
             pixel = ((Uint32)B << 16) | ((Uint32)G << 8) | R;
             *dst = pixel;
             posx += incx;
@@ -734,35 +1106,74 @@ static void SDL_Blit_RGB888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
     }
 }
 
-static void SDL_Blit_RGB888_BGR888_Modulate_Blend(SDL_BlitInfo *info)
+#if SDL_AVX2_BLITTERS
+static void SDL_TARGETING_AVX2 SDL_Blit_RGB888_BGR888_Blend_AVX2(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
-    const Uint32 modulateR = info->r;
-    const Uint32 modulateG = info->g;
-    const Uint32 modulateB = info->b;
-    const Uint32 modulateA = info->a;
+    const __m256i v255 = _mm256_set1_epi32(0xFF);
+    const __m256i vdiv = _mm256_set1_epi32(0x8081);
+    const __m256i vzero = _mm256_setzero_si256();
+    __m256i vkeep, vinvA;
+    __m256i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m256i vdstpixel, vdstR, vdstG, vdstB;
     Uint32 srcpixel;
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
-    Uint32 dstR, dstG, dstB, dstA;
+    Uint32 dstR, dstG, dstB;
 
     while (info->dst_h--) {
         Uint32 *src = (Uint32 *)info->src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
+        while (n >= 8) {
+            vsrcpixel = _mm256_loadu_si256((__m256i *)src);
+            vsrcR = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 16), v255);
+            vsrcG = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 8), v255);
+            vsrcB = _mm256_and_si256(vsrcpixel, v255);
+            vsrcA = v255;
+            vdstpixel = _mm256_loadu_si256((__m256i *)dst);
+            vdstR = _mm256_and_si256(vdstpixel, v255);
+            vdstG = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 16), v255);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm256_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm256_or_si256(_mm256_and_si256(vkeep, vdstR), _mm256_andnot_si256(vkeep, vsrcR));
+                vdstG = _mm256_or_si256(_mm256_and_si256(vkeep, vdstG), _mm256_andnot_si256(vkeep, vsrcG));
+                vdstB = _mm256_or_si256(_mm256_and_si256(vkeep, vdstB), _mm256_andnot_si256(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm256_sub_epi32(v255, vsrcA);
+                vdstR = _mm256_add_epi32(vsrcR, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm256_add_epi32(vsrcG, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm256_add_epi32(vsrcB, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm256_min_epi16(_mm256_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm256_min_epi16(_mm256_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm256_min_epi16(_mm256_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(_mm256_or_si256(vdstR, _mm256_slli_epi32(vdstG, 8)), _mm256_slli_epi32(vdstB, 16)));
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
         while (n--) {
             srcpixel = *src;
             srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel; srcA = 0xFF;
             dstpixel = *dst;
-            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel; dstA = 0xFF;
-            if (flags & SDL_COPY_MODULATE_COLOR) {
-                srcR = (srcR * modulateR) / 255;
-                srcG = (srcG * modulateG) / 255;
-                srcB = (srcB * modulateB) / 255;
-            }
-            if (flags & SDL_COPY_MODULATE_ALPHA) {
-                srcA = (srcA * modulateA) / 255;
-            }
+            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel;
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -804,57 +1215,76 @@ static void SDL_Blit_RGB888_BGR888_Modulate_Blend(SDL_BlitInfo *info)
         info->dst += info->dst_pitch;
     }
 }
+#endif /* SDL_AVX2_BLITTERS */
 
-static void SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
+#if defined(__SSE2__)
+static void SDL_Blit_RGB888_BGR888_Blend_SSE2(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
-    const Uint32 modulateR = info->r;
-    const Uint32 modulateG = info->g;
-    const Uint32 modulateB = info->b;
-    const Uint32 modulateA = info->a;
+    const __m128i v255 = _mm_set1_epi32(0xFF);
+    const __m128i vdiv = _mm_set1_epi32(0x8081);
+    const __m128i vzero = _mm_setzero_si128();
+    __m128i vkeep, vinvA;
+    __m128i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m128i vdstpixel, vdstR, vdstG, vdstB;
     Uint32 srcpixel;
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
-    Uint32 dstR, dstG, dstB, dstA;
-    int srcy, srcx;
-    int posy, posx;
-    int incy, incx;
-
-    srcy = 0;
-    posy = 0;
-    incy = (info->src_h << 16) / info->dst_h;
-    incx = (info->src_w << 16) / info->dst_w;
+    Uint32 dstR, dstG, dstB;
 
     while (info->dst_h--) {
-        Uint32 *src;
+        Uint32 *src = (Uint32 *)info->src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
-        srcx = -1;
-        posx = 0x10000L;
-        while (posy >= 0x10000L) {
-            ++srcy;
-            posy -= 0x10000L;
+        while (n >= 4) {
+            vsrcpixel = _mm_loadu_si128((__m128i *)src);
+            vsrcR = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 16), v255);
+            vsrcG = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 8), v255);
+            vsrcB = _mm_and_si128(vsrcpixel, v255);
+            vsrcA = v255;
+            vdstpixel = _mm_loadu_si128((__m128i *)dst);
+            vdstR = _mm_and_si128(vdstpixel, v255);
+            vdstG = _mm_and_si128(_mm_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm_and_si128(_mm_srli_epi32(vdstpixel, 16), v255);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm_or_si128(_mm_and_si128(vkeep, vdstR), _mm_andnot_si128(vkeep, vsrcR));
+                vdstG = _mm_or_si128(_mm_and_si128(vkeep, vdstG), _mm_andnot_si128(vkeep, vsrcG));
+                vdstB = _mm_or_si128(_mm_and_si128(vkeep, vdstB), _mm_andnot_si128(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm_sub_epi32(v255, vsrcA);
+                vdstR = _mm_add_epi32(vsrcR, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm_add_epi32(vsrcG, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm_add_epi32(vsrcB, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm_min_epi16(_mm_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm_min_epi16(_mm_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm_min_epi16(_mm_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_or_si128(vdstR, _mm_slli_epi32(vdstG, 8)), _mm_slli_epi32(vdstB, 16)));
+            src += 4;
+            dst += 4;
+            n -= 4;
         }
         while (n--) {
-            if (posx >= 0x10000L) {
-                while (posx >= 0x10000L) {
-                    ++srcx;
-                    posx -= 0x10000L;
-                }
-                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
-            }
             srcpixel = *src;
             srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel; srcA = 0xFF;
             dstpixel = *dst;
-            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel; dstA = 0xFF;
-            if (flags & SDL_COPY_MODULATE_COLOR) {
-                srcR = (srcR * modulateR) / 255;
-                srcG = (srcG * modulateG) / 255;
-                srcB = (srcB * modulateB) / 255;
-            }
-            if (flags & SDL_COPY_MODULATE_ALPHA) {
-                srcA = (srcA * modulateA) / 255;
-            }
+            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel;
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -889,81 +1319,38 @@ static void SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
             }
             dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
             *dst = dstpixel;
-            posx += incx;
+            ++src;
             ++dst;
         }
-        posy += incy;
+        info->src += info->src_pitch;
         info->dst += info->dst_pitch;
     }
 }
+#endif /* defined(__SSE2__) */
 
-static void SDL_Blit_RGB888_ARGB8888_Scale(SDL_BlitInfo *info)
+static void SDL_Blit_RGB888_BGR888_Blend(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
-    Uint32 pixel;
-    Uint32 R, G, B, A;
-    int srcy, srcx;
-    int posy, posx;
-    int incy, incx;
-
-    srcy = 0;
-    posy = 0;
-    incy = (info->src_h << 16) / info->dst_h;
-    incx = (info->src_w << 16) / info->dst_w;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
 
     while (info->dst_h--) {
-        Uint32 *src;
+        Uint32 *src = (Uint32 *)info->src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
-        srcx = -1;
-        posx = 0x10000L;
-        while (posy >= 0x10000L) {
-            ++srcy;
-            posy -= 0x10000L;
-        }
         while (n--) {
-            if (posx >= 0x10000L) {
-                while (posx >= 0x10000L) {
-                    ++srcx;
-                    posx -= 0x10000L;
-                }
-                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
-            }
-            pixel = *src;
-            R = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); B = (Uint8)pixel; A = 0xFF;
-            pixel = ((Uint32)A << 24) | ((Uint32)R << 16) | ((Uint32)G << 8) | B;
-            *dst = pixel;
-            posx += incx;
-            ++dst;
-        }
-        posy += incy;
-        info->dst += info->dst_pitch;
-    }
-}
-
-static void SDL_Blit_RGB888_ARGB8888_Blend(SDL_BlitInfo *info)
-{
-    const int flags = info->flags;
-    Uint32 srcpixel;
-    Uint32 srcR, srcG, srcB, srcA;
-    Uint32 dstpixel;
-    Uint32 dstR, dstG, dstB, dstA;
-
-    while (info->dst_h--) {
-        Uint32 *src = (Uint32 *)info->src;
-        Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        while (n--) {
-            srcpixel = *src;
-            srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel; srcA = 0xFF;
-            dstpixel = *dst;
-            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
-            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
-                /* This goes away if we ever use premultiplied alpha */
-                if (srcA < 255) {
-                    srcR = (srcR * srcA) / 255;
-                    srcG = (srcG * srcA) / 255;
-                    srcB = (srcB * srcA) / 255;
+            srcpixel = *src;
+            srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel; srcA = 0xFF;
+            dstpixel = *dst;
+            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel;
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
                 }
             }
             switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
@@ -990,7 +1377,7 @@ static void SDL_Blit_RGB888_ARGB8888_Blend(SDL_BlitInfo *info)
                 dstB = (srcB * dstB) / 255;
                 break;
             }
-            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
             *dst = dstpixel;
             ++src;
             ++dst;
@@ -1000,13 +1387,13 @@ static void SDL_Blit_RGB888_ARGB8888_Blend(SDL_BlitInfo *info)
     }
 }
 
-static void SDL_Blit_RGB888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
+static void SDL_Blit_RGB888_BGR888_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
     Uint32 srcpixel;
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
-    Uint32 dstR, dstG, dstB, dstA;
+    Uint32 dstR, dstG, dstB;
     int srcy, srcx;
     int posy, posx;
     int incy, incx;
@@ -1037,7 +1424,7 @@ static void SDL_Blit_RGB888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
             srcpixel = *src;
             srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel; srcA = 0xFF;
             dstpixel = *dst;
-            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel;
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -1070,7 +1457,7 @@ static void SDL_Blit_RGB888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
                 dstB = (srcB * dstB) / 255;
                 break;
             }
-            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
             *dst = dstpixel;
             posx += incx;
             ++dst;
@@ -1080,13 +1467,21 @@ static void SDL_Blit_RGB888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
-static void SDL_Blit_RGB888_ARGB8888_Modulate(SDL_BlitInfo *info)
+#if SDL_AVX2_BLITTERS
+static void SDL_TARGETING_AVX2 SDL_Blit_RGB888_BGR888_Modulate_AVX2(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
     const Uint32 modulateR = info->r;
     const Uint32 modulateG = info->g;
     const Uint32 modulateB = info->b;
     const Uint32 modulateA = info->a;
+    const __m256i vmodulateR = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m256i vmodulateG = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m256i vmodulateB = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m256i vmodulateA = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m256i v255 = _mm256_set1_epi32(0xFF);
+    const __m256i vdiv = _mm256_set1_epi32(0x8081);
+    __m256i vpixel, vR, vG, vB, vA;
     Uint32 pixel;
     Uint32 R, G, B, A;
 
@@ -1094,6 +1489,21 @@ static void SDL_Blit_RGB888_ARGB8888_Modulate(SDL_BlitInfo *info)
         Uint32 *src = (Uint32 *)info->src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
+        while (n >= 8) {
+            vpixel = _mm256_loadu_si256((__m256i *)src);
+            vR = _mm256_and_si256(_mm256_srli_epi32(vpixel, 16), v255);
+            vG = _mm256_and_si256(_mm256_srli_epi32(vpixel, 8), v255);
+            vB = _mm256_and_si256(vpixel, v255);
+            vA = v255;
+            vR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vR, vmodulateR), vdiv), 7);
+            vG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vG, vmodulateG), vdiv), 7);
+            vB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vB, vmodulateB), vdiv), 7);
+            vA = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vA, vmodulateA), vdiv), 7);
+            _mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(_mm256_or_si256(vR, _mm256_slli_epi32(vG, 8)), _mm256_slli_epi32(vB, 16)));
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
         while (n--) {
             pixel = *src;
             R = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); B = (Uint8)pixel; A = 0xFF;
@@ -1105,7 +1515,7 @@ static void SDL_Blit_RGB888_ARGB8888_Modulate(SDL_BlitInfo *info)
             if (flags & SDL_COPY_MODULATE_ALPHA) {
                 A = (A * modulateA) / 255;
             }
-            pixel = ((Uint32)A << 24) | ((Uint32)R << 16) | ((Uint32)G << 8) | B;
+            pixel = ((Uint32)B << 16) | ((Uint32)G << 8) | R;
             *dst = pixel;
             ++src;
             ++dst;
@@ -1114,8 +1524,103 @@ static void SDL_Blit_RGB888_ARGB8888_Modulate(SDL_BlitInfo *info)
         info->dst += info->dst_pitch;
     }
 }
+#endif /* SDL_AVX2_BLITTERS */
 
-static void SDL_Blit_RGB888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
+#if defined(__SSE2__)
+static void SDL_Blit_RGB888_BGR888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    const __m128i vmodulateR = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m128i vmodulateG = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m128i vmodulateB = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m128i vmodulateA = _mm_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m128i v255 = _mm_set1_epi32(0xFF);
+    const __m128i vdiv = _mm_set1_epi32(0x8081);
+    __m128i vpixel, vR, vG, vB, vA;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            vpixel = _mm_loadu_si128((__m128i *)src);
+            vR = _mm_and_si128(_mm_srli_epi32(vpixel, 16), v255);
+            vG = _mm_and_si128(_mm_srli_epi32(vpixel, 8), v255);
+            vB = _mm_and_si128(vpixel, v255);
+            vA = v255;
+            vR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vR, vmodulateR), vdiv), 7);
+            vG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vG, vmodulateG), vdiv), 7);
+            vB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vB, vmodulateB), vdiv), 7);
+            vA = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vA, vmodulateA), vdiv), 7);
+            _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_or_si128(vR, _mm_slli_epi32(vG, 8)), _mm_slli_epi32(vB, 16)));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            pixel = *src;
+            R = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); B = (Uint8)pixel; A = 0xFF;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = (R * modulateR) / 255;
+                G = (G * modulateG) / 255;
+                B = (B * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = (A * modulateA) / 255;
+            }
+            pixel = ((Uint32)B << 16) | ((Uint32)G << 8) | R;
+            *dst = pixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* defined(__SSE2__) */
+
+static void SDL_Blit_RGB888_BGR888_Modulate(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n--) {
+            pixel = *src;
+            R = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); B = (Uint8)pixel; A = 0xFF;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = (R * modulateR) / 255;
+                G = (G * modulateG) / 255;
+                B = (B * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = (A * modulateA) / 255;
+            }
+            pixel = ((Uint32)B << 16) | ((Uint32)G << 8) | R;
+            *dst = pixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
     const Uint32 modulateR = info->r;
@@ -1161,7 +1666,7 @@ static void SDL_Blit_RGB888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
             if (flags & SDL_COPY_MODULATE_ALPHA) {
                 A = (A * modulateA) / 255;
             }
-            pixel = ((Uint32)A << 24) | ((Uint32)R << 16) | ((Uint32)G << 8) | B;
+            pixel = ((Uint32)B << 16) | ((Uint32)G << 8) | R;
             *dst = pixel;
             posx += incx;
             ++dst;
@@ -1171,27 +1676,86 @@ static void SDL_Blit_RGB888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
     }
 }
 
-static void SDL_Blit_RGB888_ARGB8888_Modulate_Blend(SDL_BlitInfo *info)
+#if SDL_AVX2_BLITTERS
+static void SDL_TARGETING_AVX2 SDL_Blit_RGB888_BGR888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
     const Uint32 modulateR = info->r;
     const Uint32 modulateG = info->g;
     const Uint32 modulateB = info->b;
     const Uint32 modulateA = info->a;
+    const __m256i vmodulateR = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m256i vmodulateG = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m256i vmodulateB = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m256i vmodulateA = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m256i v255 = _mm256_set1_epi32(0xFF);
+    const __m256i vdiv = _mm256_set1_epi32(0x8081);
+    const __m256i vzero = _mm256_setzero_si256();
+    __m256i vkeep, vinvA;
+    __m256i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m256i vdstpixel, vdstR, vdstG, vdstB;
     Uint32 srcpixel;
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
-    Uint32 dstR, dstG, dstB, dstA;
+    Uint32 dstR, dstG, dstB;
 
     while (info->dst_h--) {
         Uint32 *src = (Uint32 *)info->src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
+        while (n >= 8) {
+            vsrcpixel = _mm256_loadu_si256((__m256i *)src);
+            vsrcR = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 16), v255);
+            vsrcG = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 8), v255);
+            vsrcB = _mm256_and_si256(vsrcpixel, v255);
+            vsrcA = v255;
+            vdstpixel = _mm256_loadu_si256((__m256i *)dst);
+            vdstR = _mm256_and_si256(vdstpixel, v255);
+            vdstG = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 16), v255);
+            vsrcR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vmodulateR), vdiv), 7);
+            vsrcG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vmodulateG), vdiv), 7);
+            vsrcB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vmodulateB), vdiv), 7);
+            vsrcA = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcA, vmodulateA), vdiv), 7);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm256_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm256_or_si256(_mm256_and_si256(vkeep, vdstR), _mm256_andnot_si256(vkeep, vsrcR));
+                vdstG = _mm256_or_si256(_mm256_and_si256(vkeep, vdstG), _mm256_andnot_si256(vkeep, vsrcG));
+                vdstB = _mm256_or_si256(_mm256_and_si256(vkeep, vdstB), _mm256_andnot_si256(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm256_sub_epi32(v255, vsrcA);
+                vdstR = _mm256_add_epi32(vsrcR, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm256_add_epi32(vsrcG, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm256_add_epi32(vsrcB, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm256_min_epi16(_mm256_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm256_min_epi16(_mm256_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm256_min_epi16(_mm256_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(_mm256_or_si256(vdstR, _mm256_slli_epi32(vdstG, 8)), _mm256_slli_epi32(vdstB, 16)));
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
         while (n--) {
             srcpixel = *src;
             srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel; srcA = 0xFF;
             dstpixel = *dst;
-            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel;
             if (flags & SDL_COPY_MODULATE_COLOR) {
                 srcR = (srcR * modulateR) / 255;
                 srcG = (srcG * modulateG) / 255;
@@ -1232,7 +1796,7 @@ static void SDL_Blit_RGB888_ARGB8888_Modulate_Blend(SDL_BlitInfo *info)
                 dstB = (srcB * dstB) / 255;
                 break;
             }
-            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
             *dst = dstpixel;
             ++src;
             ++dst;
@@ -1241,49 +1805,88 @@ static void SDL_Blit_RGB888_ARGB8888_Modulate_Blend(SDL_BlitInfo *info)
         info->dst += info->dst_pitch;
     }
 }
+#endif /* SDL_AVX2_BLITTERS */
 
-static void SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
+#if defined(__SSE2__)
+static void SDL_Blit_RGB888_BGR888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
     const Uint32 modulateR = info->r;
     const Uint32 modulateG = info->g;
     const Uint32 modulateB = info->b;
     const Uint32 modulateA = info->a;
+    const __m128i vmodulateR = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m128i vmodulateG = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m128i vmodulateB = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m128i vmodulateA = _mm_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m128i v255 = _mm_set1_epi32(0xFF);
+    const __m128i vdiv = _mm_set1_epi32(0x8081);
+    const __m128i vzero = _mm_setzero_si128();
+    __m128i vkeep, vinvA;
+    __m128i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m128i vdstpixel, vdstR, vdstG, vdstB;
     Uint32 srcpixel;
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
-    Uint32 dstR, dstG, dstB, dstA;
-    int srcy, srcx;
-    int posy, posx;
-    int incy, incx;
-
-    srcy = 0;
-    posy = 0;
-    incy = (info->src_h << 16) / info->dst_h;
-    incx = (info->src_w << 16) / info->dst_w;
+    Uint32 dstR, dstG, dstB;
 
     while (info->dst_h--) {
-        Uint32 *src;
+        Uint32 *src = (Uint32 *)info->src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
-        srcx = -1;
-        posx = 0x10000L;
-        while (posy >= 0x10000L) {
-            ++srcy;
-            posy -= 0x10000L;
+        while (n >= 4) {
+            vsrcpixel = _mm_loadu_si128((__m128i *)src);
+            vsrcR = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 16), v255);
+            vsrcG = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 8), v255);
+            vsrcB = _mm_and_si128(vsrcpixel, v255);
+            vsrcA = v255;
+            vdstpixel = _mm_loadu_si128((__m128i *)dst);
+            vdstR = _mm_and_si128(vdstpixel, v255);
+            vdstG = _mm_and_si128(_mm_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm_and_si128(_mm_srli_epi32(vdstpixel, 16), v255);
+            vsrcR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vmodulateR), vdiv), 7);
+            vsrcG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vmodulateG), vdiv), 7);
+            vsrcB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vmodulateB), vdiv), 7);
+            vsrcA = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcA, vmodulateA), vdiv), 7);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm_or_si128(_mm_and_si128(vkeep, vdstR), _mm_andnot_si128(vkeep, vsrcR));
+                vdstG = _mm_or_si128(_mm_and_si128(vkeep, vdstG), _mm_andnot_si128(vkeep, vsrcG));
+                vdstB = _mm_or_si128(_mm_and_si128(vkeep, vdstB), _mm_andnot_si128(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm_sub_epi32(v255, vsrcA);
+                vdstR = _mm_add_epi32(vsrcR, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm_add_epi32(vsrcG, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm_add_epi32(vsrcB, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm_min_epi16(_mm_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm_min_epi16(_mm_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm_min_epi16(_mm_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_or_si128(vdstR, _mm_slli_epi32(vdstG, 8)), _mm_slli_epi32(vdstB, 16)));
+            src += 4;
+            dst += 4;
+            n -= 4;
         }
         while (n--) {
-            if (posx >= 0x10000L) {
-                while (posx >= 0x10000L) {
-                    ++srcx;
-                    posx -= 0x10000L;
-                }
-                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
-            }
             srcpixel = *src;
             srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel; srcA = 0xFF;
             dstpixel = *dst;
-            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel;
             if (flags & SDL_COPY_MODULATE_COLOR) {
                 srcR = (srcR * modulateR) / 255;
                 srcG = (srcG * modulateG) / 255;
@@ -1324,67 +1927,28 @@ static void SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
                 dstB = (srcB * dstB) / 255;
                 break;
             }
-            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
             *dst = dstpixel;
-            posx += incx;
-            ++dst;
-        }
-        posy += incy;
-        info->dst += info->dst_pitch;
-    }
-}
-
-static void SDL_Blit_BGR888_RGB888_Scale(SDL_BlitInfo *info)
-{
-    const int flags = info->flags;
-    Uint32 pixel;
-    Uint32 R, G, B, A;
-    int srcy, srcx;
-    int posy, posx;
-    int incy, incx;
-
-    srcy = 0;
-    posy = 0;
-    incy = (info->src_h << 16) / info->dst_h;
-    incx = (info->src_w << 16) / info->dst_w;
-
-    while (info->dst_h--) {
-        Uint32 *src;
-        Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        srcx = -1;
-        posx = 0x10000L;
-        while (posy >= 0x10000L) {
-            ++srcy;
-            posy -= 0x10000L;
-        }
-        while (n--) {
-            if (posx >= 0x10000L) {
-                while (posx >= 0x10000L) {
-                    ++srcx;
-                    posx -= 0x10000L;
-                }
-                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
-            }
-            pixel = *src;
-            B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel; A = 0xFF;
-            pixel = ((Uint32)R << 16) | ((Uint32)G << 8) | B;
-            *dst = pixel;
-            posx += incx;
+            ++src;
             ++dst;
         }
-        posy += incy;
+        info->src += info->src_pitch;
         info->dst += info->dst_pitch;
     }
 }
+#endif /* defined(__SSE2__) */
 
-static void SDL_Blit_BGR888_RGB888_Blend(SDL_BlitInfo *info)
+static void SDL_Blit_RGB888_BGR888_Modulate_Blend(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
     Uint32 srcpixel;
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
-    Uint32 dstR, dstG, dstB, dstA;
+    Uint32 dstR, dstG, dstB;
 
     while (info->dst_h--) {
         Uint32 *src = (Uint32 *)info->src;
@@ -1392,9 +1956,17 @@ static void SDL_Blit_BGR888_RGB888_Blend(SDL_BlitInfo *info)
         int n = info->dst_w;
         while (n--) {
             srcpixel = *src;
-            srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel; srcA = 0xFF;
+            srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel; srcA = 0xFF;
             dstpixel = *dst;
-            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel; dstA = 0xFF;
+            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -1427,7 +1999,7 @@ static void SDL_Blit_BGR888_RGB888_Blend(SDL_BlitInfo *info)
                 dstB = (srcB * dstB) / 255;
                 break;
             }
-            dstpixel = ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
             *dst = dstpixel;
             ++src;
             ++dst;
@@ -1437,13 +2009,17 @@ static void SDL_Blit_BGR888_RGB888_Blend(SDL_BlitInfo *info)
     }
 }
 
-static void SDL_Blit_BGR888_RGB888_Blend_Scale(SDL_BlitInfo *info)
+static void SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
     Uint32 srcpixel;
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
-    Uint32 dstR, dstG, dstB, dstA;
+    Uint32 dstR, dstG, dstB;
     int srcy, srcx;
     int posy, posx;
     int incy, incx;
@@ -1472,13 +2048,21 @@ static void SDL_Blit_BGR888_RGB888_Blend_Scale(SDL_BlitInfo *info)
                 src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
             }
             srcpixel = *src;
-            srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel; srcA = 0xFF;
+            srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel; srcA = 0xFF;
             dstpixel = *dst;
-            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel; dstA = 0xFF;
-            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
-                /* This goes away if we ever use premultiplied alpha */
-                if (srcA < 255) {
-                    srcR = (srcR * srcA) / 255;
+            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
                     srcG = (srcG * srcA) / 255;
                     srcB = (srcB * srcA) / 255;
                 }
@@ -1507,7 +2091,7 @@ static void SDL_Blit_BGR888_RGB888_Blend_Scale(SDL_BlitInfo *info)
                 dstB = (srcB * dstB) / 255;
                 break;
             }
-            dstpixel = ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
             *dst = dstpixel;
             posx += incx;
             ++dst;
@@ -1517,48 +2101,9 @@ static void SDL_Blit_BGR888_RGB888_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
-static void SDL_Blit_BGR888_RGB888_Modulate(SDL_BlitInfo *info)
-{
-    const int flags = info->flags;
-    const Uint32 modulateR = info->r;
-    const Uint32 modulateG = info->g;
-    const Uint32 modulateB = info->b;
-    const Uint32 modulateA = info->a;
-    Uint32 pixel;
-    Uint32 R, G, B, A;
-
-    while (info->dst_h--) {
-        Uint32 *src = (Uint32 *)info->src;
-        Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        while (n--) {
-            pixel = *src;
-            B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel; A = 0xFF;
-            if (flags & SDL_COPY_MODULATE_COLOR) {
-                R = (R * modulateR) / 255;
-                G = (G * modulateG) / 255;
-                B = (B * modulateB) / 255;
-            }
-            if (flags & SDL_COPY_MODULATE_ALPHA) {
-                A = (A * modulateA) / 255;
-            }
-            pixel = ((Uint32)R << 16) | ((Uint32)G << 8) | B;
-            *dst = pixel;
-            ++src;
-            ++dst;
-        }
-        info->src += info->src_pitch;
-        info->dst += info->dst_pitch;
-    }
-}
-
-static void SDL_Blit_BGR888_RGB888_Modulate_Scale(SDL_BlitInfo *info)
+static void SDL_Blit_RGB888_ARGB8888_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
-    const Uint32 modulateR = info->r;
-    const Uint32 modulateG = info->g;
-    const Uint32 modulateB = info->b;
-    const Uint32 modulateA = info->a;
     Uint32 pixel;
     Uint32 R, G, B, A;
     int srcy, srcx;
@@ -1589,16 +2134,8 @@ static void SDL_Blit_BGR888_RGB888_Modulate_Scale(SDL_BlitInfo *info)
                 src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
             }
             pixel = *src;
-            B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel; A = 0xFF;
-            if (flags & SDL_COPY_MODULATE_COLOR) {
-                R = (R * modulateR) / 255;
-                G = (G * modulateG) / 255;
-                B = (B * modulateB) / 255;
-            }
-            if (flags & SDL_COPY_MODULATE_ALPHA) {
-                A = (A * modulateA) / 255;
-            }
-            pixel = ((Uint32)R << 16) | ((Uint32)G << 8) | B;
+            R = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); B = (Uint8)pixel; A = 0xFF;
+            pixel = ((Uint32)A << 24) | ((Uint32)R << 16) | ((Uint32)G << 8) | B;
             *dst = pixel;
             posx += incx;
             ++dst;
@@ -1608,13 +2145,16 @@ static void SDL_Blit_BGR888_RGB888_Modulate_Scale(SDL_BlitInfo *info)
     }
 }
 
-static void SDL_Blit_BGR888_RGB888_Modulate_Blend(SDL_BlitInfo *info)
+#if SDL_AVX2_BLITTERS
+static void SDL_TARGETING_AVX2 SDL_Blit_RGB888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
-    const Uint32 modulateR = info->r;
-    const Uint32 modulateG = info->g;
-    const Uint32 modulateB = info->b;
-    const Uint32 modulateA = info->a;
+    const __m256i v255 = _mm256_set1_epi32(0xFF);
+    const __m256i vdiv = _mm256_set1_epi32(0x8081);
+    const __m256i vzero = _mm256_setzero_si256();
+    __m256i vkeep, vinvA;
+    __m256i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m256i vdstpixel, vdstR, vdstG, vdstB, vdstA;
     Uint32 srcpixel;
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
@@ -1624,19 +2164,56 @@ static void SDL_Blit_BGR888_RGB888_Modulate_Blend(SDL_BlitInfo *info)
         Uint32 *src = (Uint32 *)info->src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
+        while (n >= 8) {
+            vsrcpixel = _mm256_loadu_si256((__m256i *)src);
+            vsrcR = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 16), v255);
+            vsrcG = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 8), v255);
+            vsrcB = _mm256_and_si256(vsrcpixel, v255);
+            vsrcA = v255;
+            vdstpixel = _mm256_loadu_si256((__m256i *)dst);
+            vdstR = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 16), v255);
+            vdstG = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm256_and_si256(vdstpixel, v255);
+            vdstA = _mm256_srli_epi32(vdstpixel, 24);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm256_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm256_or_si256(_mm256_and_si256(vkeep, vdstR), _mm256_andnot_si256(vkeep, vsrcR));
+                vdstG = _mm256_or_si256(_mm256_and_si256(vkeep, vdstG), _mm256_andnot_si256(vkeep, vsrcG));
+                vdstB = _mm256_or_si256(_mm256_and_si256(vkeep, vdstB), _mm256_andnot_si256(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm256_sub_epi32(v255, vsrcA);
+                vdstR = _mm256_add_epi32(vsrcR, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm256_add_epi32(vsrcG, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm256_add_epi32(vsrcB, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm256_min_epi16(_mm256_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm256_min_epi16(_mm256_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm256_min_epi16(_mm256_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(vdstR, 16), _mm256_slli_epi32(vdstG, 8)), vdstB), _mm256_slli_epi32(vdstA, 24)));
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
         while (n--) {
             srcpixel = *src;
-            srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel; srcA = 0xFF;
+            srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel; srcA = 0xFF;
             dstpixel = *dst;
-            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel; dstA = 0xFF;
-            if (flags & SDL_COPY_MODULATE_COLOR) {
-                srcR = (srcR * modulateR) / 255;
-                srcG = (srcG * modulateG) / 255;
-                srcB = (srcB * modulateB) / 255;
-            }
-            if (flags & SDL_COPY_MODULATE_ALPHA) {
-                srcA = (srcA * modulateA) / 255;
-            }
+            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -1669,7 +2246,7 @@ static void SDL_Blit_BGR888_RGB888_Modulate_Blend(SDL_BlitInfo *info)
                 dstB = (srcB * dstB) / 255;
                 break;
             }
-            dstpixel = ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
             *dst = dstpixel;
             ++src;
             ++dst;
@@ -1678,57 +2255,77 @@ static void SDL_Blit_BGR888_RGB888_Modulate_Blend(SDL_BlitInfo *info)
         info->dst += info->dst_pitch;
     }
 }
+#endif /* SDL_AVX2_BLITTERS */
 
-static void SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
+#if defined(__SSE2__)
+static void SDL_Blit_RGB888_ARGB8888_Blend_SSE2(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
-    const Uint32 modulateR = info->r;
-    const Uint32 modulateG = info->g;
-    const Uint32 modulateB = info->b;
-    const Uint32 modulateA = info->a;
+    const __m128i v255 = _mm_set1_epi32(0xFF);
+    const __m128i vdiv = _mm_set1_epi32(0x8081);
+    const __m128i vzero = _mm_setzero_si128();
+    __m128i vkeep, vinvA;
+    __m128i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m128i vdstpixel, vdstR, vdstG, vdstB, vdstA;
     Uint32 srcpixel;
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB, dstA;
-    int srcy, srcx;
-    int posy, posx;
-    int incy, incx;
-
-    srcy = 0;
-    posy = 0;
-    incy = (info->src_h << 16) / info->dst_h;
-    incx = (info->src_w << 16) / info->dst_w;
 
     while (info->dst_h--) {
-        Uint32 *src;
+        Uint32 *src = (Uint32 *)info->src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
-        srcx = -1;
-        posx = 0x10000L;
-        while (posy >= 0x10000L) {
-            ++srcy;
-            posy -= 0x10000L;
+        while (n >= 4) {
+            vsrcpixel = _mm_loadu_si128((__m128i *)src);
+            vsrcR = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 16), v255);
+            vsrcG = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 8), v255);
+            vsrcB = _mm_and_si128(vsrcpixel, v255);
+            vsrcA = v255;
+            vdstpixel = _mm_loadu_si128((__m128i *)dst);
+            vdstR = _mm_and_si128(_mm_srli_epi32(vdstpixel, 16), v255);
+            vdstG = _mm_and_si128(_mm_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm_and_si128(vdstpixel, v255);
+            vdstA = _mm_srli_epi32(vdstpixel, 24);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm_or_si128(_mm_and_si128(vkeep, vdstR), _mm_andnot_si128(vkeep, vsrcR));
+                vdstG = _mm_or_si128(_mm_and_si128(vkeep, vdstG), _mm_andnot_si128(vkeep, vsrcG));
+                vdstB = _mm_or_si128(_mm_and_si128(vkeep, vdstB), _mm_andnot_si128(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm_sub_epi32(v255, vsrcA);
+                vdstR = _mm_add_epi32(vsrcR, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm_add_epi32(vsrcG, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm_add_epi32(vsrcB, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm_min_epi16(_mm_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm_min_epi16(_mm_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm_min_epi16(_mm_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(vdstR, 16), _mm_slli_epi32(vdstG, 8)), vdstB), _mm_slli_epi32(vdstA, 24)));
+            src += 4;
+            dst += 4;
+            n -= 4;
         }
         while (n--) {
-            if (posx >= 0x10000L) {
-                while (posx >= 0x10000L) {
-                    ++srcx;
-                    posx -= 0x10000L;
-                }
-                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
-            }
             srcpixel = *src;
-            srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel; srcA = 0xFF;
+            srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel; srcA = 0xFF;
             dstpixel = *dst;
-            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel; dstA = 0xFF;
-            if (flags & SDL_COPY_MODULATE_COLOR) {
-                srcR = (srcR * modulateR) / 255;
-                srcG = (srcG * modulateG) / 255;
-                srcB = (srcB * modulateB) / 255;
-            }
-            if (flags & SDL_COPY_MODULATE_ALPHA) {
-                srcA = (srcA * modulateA) / 255;
-            }
+            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -1761,56 +2358,18 @@ static void SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
                 dstB = (srcB * dstB) / 255;
                 break;
             }
-            dstpixel = ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
             *dst = dstpixel;
-            posx += incx;
-            ++dst;
-        }
-        posy += incy;
-        info->dst += info->dst_pitch;
-    }
-}
-
-static void SDL_Blit_BGR888_BGR888_Scale(SDL_BlitInfo *info)
-{
-    const int flags = info->flags;
-    int srcy, srcx;
-    int posy, posx;
-    int incy, incx;
-
-    srcy = 0;
-    posy = 0;
-    incy = (info->src_h << 16) / info->dst_h;
-    incx = (info->src_w << 16) / info->dst_w;
-
-    while (info->dst_h--) {
-        Uint32 *src;
-        Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        srcx = -1;
-        posx = 0x10000L;
-        while (posy >= 0x10000L) {
-            ++srcy;
-            posy -= 0x10000L;
-        }
-        while (n--) {
-            if (posx >= 0x10000L) {
-                while (posx >= 0x10000L) {
-                    ++srcx;
-                    posx -= 0x10000L;
-                }
-                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
-            }
-            *dst = *src;
-            posx += incx;
+            ++src;
             ++dst;
         }
-        posy += incy;
+        info->src += info->src_pitch;
         info->dst += info->dst_pitch;
     }
 }
+#endif /* defined(__SSE2__) */
 
-static void SDL_Blit_BGR888_BGR888_Blend(SDL_BlitInfo *info)
+static void SDL_Blit_RGB888_ARGB8888_Blend(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
     Uint32 srcpixel;
@@ -1824,9 +2383,9 @@ static void SDL_Blit_BGR888_BGR888_Blend(SDL_BlitInfo *info)
         int n = info->dst_w;
         while (n--) {
             srcpixel = *src;
-            srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel; srcA = 0xFF;
+            srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel; srcA = 0xFF;
             dstpixel = *dst;
-            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel; dstA = 0xFF;
+            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -1859,7 +2418,7 @@ static void SDL_Blit_BGR888_BGR888_Blend(SDL_BlitInfo *info)
                 dstB = (srcB * dstB) / 255;
                 break;
             }
-            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
+            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
             *dst = dstpixel;
             ++src;
             ++dst;
@@ -1869,7 +2428,7 @@ static void SDL_Blit_BGR888_BGR888_Blend(SDL_BlitInfo *info)
     }
 }
 
-static void SDL_Blit_BGR888_BGR888_Blend_Scale(SDL_BlitInfo *info)
+static void SDL_Blit_RGB888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
     Uint32 srcpixel;
@@ -1904,9 +2463,9 @@ static void SDL_Blit_BGR888_BGR888_Blend_Scale(SDL_BlitInfo *info)
                 src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
             }
             srcpixel = *src;
-            srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel; srcA = 0xFF;
+            srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel; srcA = 0xFF;
             dstpixel = *dst;
-            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel; dstA = 0xFF;
+            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -1939,7 +2498,7 @@ static void SDL_Blit_BGR888_BGR888_Blend_Scale(SDL_BlitInfo *info)
                 dstB = (srcB * dstB) / 255;
                 break;
             }
-            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
+            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
             *dst = dstpixel;
             posx += incx;
             ++dst;
@@ -1949,13 +2508,21 @@ static void SDL_Blit_BGR888_BGR888_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
-static void SDL_Blit_BGR888_BGR888_Modulate(SDL_BlitInfo *info)
+#if SDL_AVX2_BLITTERS
+static void SDL_TARGETING_AVX2 SDL_Blit_RGB888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
     const Uint32 modulateR = info->r;
     const Uint32 modulateG = info->g;
     const Uint32 modulateB = info->b;
     const Uint32 modulateA = info->a;
+    const __m256i vmodulateR = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m256i vmodulateG = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m256i vmodulateB = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m256i vmodulateA = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m256i v255 = _mm256_set1_epi32(0xFF);
+    const __m256i vdiv = _mm256_set1_epi32(0x8081);
+    __m256i vpixel, vR, vG, vB, vA;
     Uint32 pixel;
     Uint32 R, G, B, A;
 
@@ -1963,9 +2530,24 @@ static void SDL_Blit_BGR888_BGR888_Modulate(SDL_BlitInfo *info)
         Uint32 *src = (Uint32 *)info->src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
+        while (n >= 8) {
+            vpixel = _mm256_loadu_si256((__m256i *)src);
+            vR = _mm256_and_si256(_mm256_srli_epi32(vpixel, 16), v255);
+            vG = _mm256_and_si256(_mm256_srli_epi32(vpixel, 8), v255);
+            vB = _mm256_and_si256(vpixel, v255);
+            vA = v255;
+            vR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vR, vmodulateR), vdiv), 7);
+            vG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vG, vmodulateG), vdiv), 7);
+            vB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vB, vmodulateB), vdiv), 7);
+            vA = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vA, vmodulateA), vdiv), 7);
+            _mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(vR, 16), _mm256_slli_epi32(vG, 8)), vB), _mm256_slli_epi32(vA, 24)));
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
         while (n--) {
             pixel = *src;
-            B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel; A = 0xFF;
+            R = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); B = (Uint8)pixel; A = 0xFF;
             if (flags & SDL_COPY_MODULATE_COLOR) {
                 R = (R * modulateR) / 255;
                 G = (G * modulateG) / 255;
@@ -1974,7 +2556,7 @@ static void SDL_Blit_BGR888_BGR888_Modulate(SDL_BlitInfo *info)
             if (flags & SDL_COPY_MODULATE_ALPHA) {
                 A = (A * modulateA) / 255;
             }
-            pixel = ((Uint32)B << 16) | ((Uint32)G << 8) | R;
+            pixel = ((Uint32)A << 24) | ((Uint32)R << 16) | ((Uint32)G << 8) | B;
             *dst = pixel;
             ++src;
             ++dst;
@@ -1983,45 +2565,48 @@ static void SDL_Blit_BGR888_BGR888_Modulate(SDL_BlitInfo *info)
         info->dst += info->dst_pitch;
     }
 }
+#endif /* SDL_AVX2_BLITTERS */
 
-static void SDL_Blit_BGR888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
+#if defined(__SSE2__)
+static void SDL_Blit_RGB888_ARGB8888_Modulate_SSE2(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
     const Uint32 modulateR = info->r;
     const Uint32 modulateG = info->g;
     const Uint32 modulateB = info->b;
     const Uint32 modulateA = info->a;
+    const __m128i vmodulateR = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m128i vmodulateG = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m128i vmodulateB = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m128i vmodulateA = _mm_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m128i v255 = _mm_set1_epi32(0xFF);
+    const __m128i vdiv = _mm_set1_epi32(0x8081);
+    __m128i vpixel, vR, vG, vB, vA;
     Uint32 pixel;
     Uint32 R, G, B, A;
-    int srcy, srcx;
-    int posy, posx;
-    int incy, incx;
-
-    srcy = 0;
-    posy = 0;
-    incy = (info->src_h << 16) / info->dst_h;
-    incx = (info->src_w << 16) / info->dst_w;
 
     while (info->dst_h--) {
-        Uint32 *src;
+        Uint32 *src = (Uint32 *)info->src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
-        srcx = -1;
-        posx = 0x10000L;
-        while (posy >= 0x10000L) {
-            ++srcy;
-            posy -= 0x10000L;
+        while (n >= 4) {
+            vpixel = _mm_loadu_si128((__m128i *)src);
+            vR = _mm_and_si128(_mm_srli_epi32(vpixel, 16), v255);
+            vG = _mm_and_si128(_mm_srli_epi32(vpixel, 8), v255);
+            vB = _mm_and_si128(vpixel, v255);
+            vA = v255;
+            vR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vR, vmodulateR), vdiv), 7);
+            vG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vG, vmodulateG), vdiv), 7);
+            vB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vB, vmodulateB), vdiv), 7);
+            vA = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vA, vmodulateA), vdiv), 7);
+            _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(vR, 16), _mm_slli_epi32(vG, 8)), vB), _mm_slli_epi32(vA, 24)));
+            src += 4;
+            dst += 4;
+            n -= 4;
         }
         while (n--) {
-            if (posx >= 0x10000L) {
-                while (posx >= 0x10000L) {
-                    ++srcx;
-                    posx -= 0x10000L;
-                }
-                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
-            }
             pixel = *src;
-            B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel; A = 0xFF;
+            R = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); B = (Uint8)pixel; A = 0xFF;
             if (flags & SDL_COPY_MODULATE_COLOR) {
                 R = (R * modulateR) / 255;
                 G = (G * modulateG) / 255;
@@ -2030,38 +2615,190 @@ static void SDL_Blit_BGR888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
             if (flags & SDL_COPY_MODULATE_ALPHA) {
                 A = (A * modulateA) / 255;
             }
-            pixel = ((Uint32)B << 16) | ((Uint32)G << 8) | R;
+            pixel = ((Uint32)A << 24) | ((Uint32)R << 16) | ((Uint32)G << 8) | B;
             *dst = pixel;
-            posx += incx;
+            ++src;
             ++dst;
         }
-        posy += incy;
+        info->src += info->src_pitch;
         info->dst += info->dst_pitch;
     }
 }
+#endif /* defined(__SSE2__) */
 
-static void SDL_Blit_BGR888_BGR888_Modulate_Blend(SDL_BlitInfo *info)
+static void SDL_Blit_RGB888_ARGB8888_Modulate(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
     const Uint32 modulateR = info->r;
     const Uint32 modulateG = info->g;
     const Uint32 modulateB = info->b;
     const Uint32 modulateA = info->a;
-    Uint32 srcpixel;
-    Uint32 srcR, srcG, srcB, srcA;
-    Uint32 dstpixel;
-    Uint32 dstR, dstG, dstB, dstA;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
 
     while (info->dst_h--) {
         Uint32 *src = (Uint32 *)info->src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         while (n--) {
-            srcpixel = *src;
-            srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel; srcA = 0xFF;
-            dstpixel = *dst;
-            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel; dstA = 0xFF;
-            if (flags & SDL_COPY_MODULATE_COLOR) {
+            pixel = *src;
+            R = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); B = (Uint8)pixel; A = 0xFF;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = (R * modulateR) / 255;
+                G = (G * modulateG) / 255;
+                B = (B * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = (A * modulateA) / 255;
+            }
+            pixel = ((Uint32)A << 24) | ((Uint32)R << 16) | ((Uint32)G << 8) | B;
+            *dst = pixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        Uint32 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        while (n--) {
+            if (posx >= 0x10000L) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            }
+            pixel = *src;
+            R = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); B = (Uint8)pixel; A = 0xFF;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = (R * modulateR) / 255;
+                G = (G * modulateG) / 255;
+                B = (B * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = (A * modulateA) / 255;
+            }
+            pixel = ((Uint32)A << 24) | ((Uint32)R << 16) | ((Uint32)G << 8) | B;
+            *dst = pixel;
+            posx += incx;
+            ++dst;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+#if SDL_AVX2_BLITTERS
+static void SDL_TARGETING_AVX2 SDL_Blit_RGB888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    const __m256i vmodulateR = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m256i vmodulateG = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m256i vmodulateB = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m256i vmodulateA = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m256i v255 = _mm256_set1_epi32(0xFF);
+    const __m256i vdiv = _mm256_set1_epi32(0x8081);
+    const __m256i vzero = _mm256_setzero_si256();
+    __m256i vkeep, vinvA;
+    __m256i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m256i vdstpixel, vdstR, vdstG, vdstB, vdstA;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB, dstA;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            vsrcpixel = _mm256_loadu_si256((__m256i *)src);
+            vsrcR = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 16), v255);
+            vsrcG = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 8), v255);
+            vsrcB = _mm256_and_si256(vsrcpixel, v255);
+            vsrcA = v255;
+            vdstpixel = _mm256_loadu_si256((__m256i *)dst);
+            vdstR = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 16), v255);
+            vdstG = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm256_and_si256(vdstpixel, v255);
+            vdstA = _mm256_srli_epi32(vdstpixel, 24);
+            vsrcR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vmodulateR), vdiv), 7);
+            vsrcG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vmodulateG), vdiv), 7);
+            vsrcB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vmodulateB), vdiv), 7);
+            vsrcA = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcA, vmodulateA), vdiv), 7);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm256_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm256_or_si256(_mm256_and_si256(vkeep, vdstR), _mm256_andnot_si256(vkeep, vsrcR));
+                vdstG = _mm256_or_si256(_mm256_and_si256(vkeep, vdstG), _mm256_andnot_si256(vkeep, vsrcG));
+                vdstB = _mm256_or_si256(_mm256_and_si256(vkeep, vdstB), _mm256_andnot_si256(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm256_sub_epi32(v255, vsrcA);
+                vdstR = _mm256_add_epi32(vsrcR, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm256_add_epi32(vsrcG, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm256_add_epi32(vsrcB, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm256_min_epi16(_mm256_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm256_min_epi16(_mm256_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm256_min_epi16(_mm256_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(vdstR, 16), _mm256_slli_epi32(vdstG, 8)), vdstB), _mm256_slli_epi32(vdstA, 24)));
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            srcpixel = *src;
+            srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel; srcA = 0xFF;
+            dstpixel = *dst;
+            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
                 srcR = (srcR * modulateR) / 255;
                 srcG = (srcG * modulateG) / 255;
                 srcB = (srcB * modulateB) / 255;
@@ -2101,7 +2838,7 @@ static void SDL_Blit_BGR888_BGR888_Modulate_Blend(SDL_BlitInfo *info)
                 dstB = (srcB * dstB) / 255;
                 break;
             }
-            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
+            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
             *dst = dstpixel;
             ++src;
             ++dst;
@@ -2110,49 +2847,89 @@ static void SDL_Blit_BGR888_BGR888_Modulate_Blend(SDL_BlitInfo *info)
         info->dst += info->dst_pitch;
     }
 }
+#endif /* SDL_AVX2_BLITTERS */
 
-static void SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
+#if defined(__SSE2__)
+static void SDL_Blit_RGB888_ARGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
     const Uint32 modulateR = info->r;
     const Uint32 modulateG = info->g;
     const Uint32 modulateB = info->b;
     const Uint32 modulateA = info->a;
+    const __m128i vmodulateR = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m128i vmodulateG = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m128i vmodulateB = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m128i vmodulateA = _mm_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m128i v255 = _mm_set1_epi32(0xFF);
+    const __m128i vdiv = _mm_set1_epi32(0x8081);
+    const __m128i vzero = _mm_setzero_si128();
+    __m128i vkeep, vinvA;
+    __m128i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m128i vdstpixel, vdstR, vdstG, vdstB, vdstA;
     Uint32 srcpixel;
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB, dstA;
-    int srcy, srcx;
-    int posy, posx;
-    int incy, incx;
-
-    srcy = 0;
-    posy = 0;
-    incy = (info->src_h << 16) / info->dst_h;
-    incx = (info->src_w << 16) / info->dst_w;
 
     while (info->dst_h--) {
-        Uint32 *src;
+        Uint32 *src = (Uint32 *)info->src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
-        srcx = -1;
-        posx = 0x10000L;
-        while (posy >= 0x10000L) {
-            ++srcy;
-            posy -= 0x10000L;
+        while (n >= 4) {
+            vsrcpixel = _mm_loadu_si128((__m128i *)src);
+            vsrcR = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 16), v255);
+            vsrcG = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 8), v255);
+            vsrcB = _mm_and_si128(vsrcpixel, v255);
+            vsrcA = v255;
+            vdstpixel = _mm_loadu_si128((__m128i *)dst);
+            vdstR = _mm_and_si128(_mm_srli_epi32(vdstpixel, 16), v255);
+            vdstG = _mm_and_si128(_mm_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm_and_si128(vdstpixel, v255);
+            vdstA = _mm_srli_epi32(vdstpixel, 24);
+            vsrcR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vmodulateR), vdiv), 7);
+            vsrcG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vmodulateG), vdiv), 7);
+            vsrcB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vmodulateB), vdiv), 7);
+            vsrcA = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcA, vmodulateA), vdiv), 7);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm_or_si128(_mm_and_si128(vkeep, vdstR), _mm_andnot_si128(vkeep, vsrcR));
+                vdstG = _mm_or_si128(_mm_and_si128(vkeep, vdstG), _mm_andnot_si128(vkeep, vsrcG));
+                vdstB = _mm_or_si128(_mm_and_si128(vkeep, vdstB), _mm_andnot_si128(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm_sub_epi32(v255, vsrcA);
+                vdstR = _mm_add_epi32(vsrcR, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm_add_epi32(vsrcG, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm_add_epi32(vsrcB, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm_min_epi16(_mm_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm_min_epi16(_mm_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm_min_epi16(_mm_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(vdstR, 16), _mm_slli_epi32(vdstG, 8)), vdstB), _mm_slli_epi32(vdstA, 24)));
+            src += 4;
+            dst += 4;
+            n -= 4;
         }
         while (n--) {
-            if (posx >= 0x10000L) {
-                while (posx >= 0x10000L) {
-                    ++srcx;
-                    posx -= 0x10000L;
-                }
-                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
-            }
             srcpixel = *src;
-            srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel; srcA = 0xFF;
+            srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel; srcA = 0xFF;
             dstpixel = *dst;
-            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel; dstA = 0xFF;
+            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
             if (flags & SDL_COPY_MODULATE_COLOR) {
                 srcR = (srcR * modulateR) / 255;
                 srcG = (srcG * modulateG) / 255;
@@ -2193,63 +2970,24 @@ static void SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
                 dstB = (srcB * dstB) / 255;
                 break;
             }
-            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
+            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
             *dst = dstpixel;
-            posx += incx;
-            ++dst;
-        }
-        posy += incy;
-        info->dst += info->dst_pitch;
-    }
-}
-
-static void SDL_Blit_BGR888_ARGB8888_Scale(SDL_BlitInfo *info)
-{
-    const int flags = info->flags;
-    Uint32 pixel;
-    Uint32 R, G, B, A;
-    int srcy, srcx;
-    int posy, posx;
-    int incy, incx;
-
-    srcy = 0;
-    posy = 0;
-    incy = (info->src_h << 16) / info->dst_h;
-    incx = (info->src_w << 16) / info->dst_w;
-
-    while (info->dst_h--) {
-        Uint32 *src;
-        Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        srcx = -1;
-        posx = 0x10000L;
-        while (posy >= 0x10000L) {
-            ++srcy;
-            posy -= 0x10000L;
-        }
-        while (n--) {
-            if (posx >= 0x10000L) {
-                while (posx >= 0x10000L) {
-                    ++srcx;
-                    posx -= 0x10000L;
-                }
-                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
-            }
-            pixel = *src;
-            B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel; A = 0xFF;
-            pixel = ((Uint32)A << 24) | ((Uint32)R << 16) | ((Uint32)G << 8) | B;
-            *dst = pixel;
-            posx += incx;
+            ++src;
             ++dst;
         }
-        posy += incy;
+        info->src += info->src_pitch;
         info->dst += info->dst_pitch;
     }
 }
+#endif /* defined(__SSE2__) */
 
-static void SDL_Blit_BGR888_ARGB8888_Blend(SDL_BlitInfo *info)
+static void SDL_Blit_RGB888_ARGB8888_Modulate_Blend(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
     Uint32 srcpixel;
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
@@ -2261,9 +2999,17 @@ static void SDL_Blit_BGR888_ARGB8888_Blend(SDL_BlitInfo *info)
         int n = info->dst_w;
         while (n--) {
             srcpixel = *src;
-            srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel; srcA = 0xFF;
+            srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel; srcA = 0xFF;
             dstpixel = *dst;
             dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -2306,9 +3052,13 @@ static void SDL_Blit_BGR888_ARGB8888_Blend(SDL_BlitInfo *info)
     }
 }
 
-static void SDL_Blit_BGR888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
+static void SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
     Uint32 srcpixel;
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
@@ -2341,9 +3091,17 @@ static void SDL_Blit_BGR888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
                 src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
             }
             srcpixel = *src;
-            srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel; srcA = 0xFF;
+            srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel; srcA = 0xFF;
             dstpixel = *dst;
             dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -2386,69 +3144,30 @@ static void SDL_Blit_BGR888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
-static void SDL_Blit_BGR888_ARGB8888_Modulate(SDL_BlitInfo *info)
+static void SDL_Blit_BGR888_RGB888_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
-    const Uint32 modulateR = info->r;
-    const Uint32 modulateG = info->g;
-    const Uint32 modulateB = info->b;
-    const Uint32 modulateA = info->a;
     Uint32 pixel;
     Uint32 R, G, B, A;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
 
     while (info->dst_h--) {
-        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
-        while (n--) {
-            pixel = *src;
-            B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel; A = 0xFF;
-            if (flags & SDL_COPY_MODULATE_COLOR) {
-                R = (R * modulateR) / 255;
-                G = (G * modulateG) / 255;
-                B = (B * modulateB) / 255;
-            }
-            if (flags & SDL_COPY_MODULATE_ALPHA) {
-                A = (A * modulateA) / 255;
-            }
-            pixel = ((Uint32)A << 24) | ((Uint32)R << 16) | ((Uint32)G << 8) | B;
-            *dst = pixel;
-            ++src;
-            ++dst;
-        }
-        info->src += info->src_pitch;
-        info->dst += info->dst_pitch;
-    }
-}
-
-static void SDL_Blit_BGR888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
-{
-    const int flags = info->flags;
-    const Uint32 modulateR = info->r;
-    const Uint32 modulateG = info->g;
-    const Uint32 modulateB = info->b;
-    const Uint32 modulateA = info->a;
-    Uint32 pixel;
-    Uint32 R, G, B, A;
-    int srcy, srcx;
-    int posy, posx;
-    int incy, incx;
-
-    srcy = 0;
-    posy = 0;
-    incy = (info->src_h << 16) / info->dst_h;
-    incx = (info->src_w << 16) / info->dst_w;
-
-    while (info->dst_h--) {
-        Uint32 *src;
-        Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        srcx = -1;
-        posx = 0x10000L;
-        while (posy >= 0x10000L) {
-            ++srcy;
-            posy -= 0x10000L;
-        }
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
         while (n--) {
             if (posx >= 0x10000L) {
                 while (posx >= 0x10000L) {
@@ -2459,15 +3178,7 @@ static void SDL_Blit_BGR888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
             }
             pixel = *src;
             B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel; A = 0xFF;
-            if (flags & SDL_COPY_MODULATE_COLOR) {
-                R = (R * modulateR) / 255;
-                G = (G * modulateG) / 255;
-                B = (B * modulateB) / 255;
-            }
-            if (flags & SDL_COPY_MODULATE_ALPHA) {
-                A = (A * modulateA) / 255;
-            }
-            pixel = ((Uint32)A << 24) | ((Uint32)R << 16) | ((Uint32)G << 8) | B;
+            pixel = ((Uint32)R << 16) | ((Uint32)G << 8) | B;
             *dst = pixel;
             posx += incx;
             ++dst;
@@ -2477,35 +3188,74 @@ static void SDL_Blit_BGR888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
     }
 }
 
-static void SDL_Blit_BGR888_ARGB8888_Modulate_Blend(SDL_BlitInfo *info)
+#if SDL_AVX2_BLITTERS
+static void SDL_TARGETING_AVX2 SDL_Blit_BGR888_RGB888_Blend_AVX2(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
-    const Uint32 modulateR = info->r;
-    const Uint32 modulateG = info->g;
-    const Uint32 modulateB = info->b;
-    const Uint32 modulateA = info->a;
+    const __m256i v255 = _mm256_set1_epi32(0xFF);
+    const __m256i vdiv = _mm256_set1_epi32(0x8081);
+    const __m256i vzero = _mm256_setzero_si256();
+    __m256i vkeep, vinvA;
+    __m256i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m256i vdstpixel, vdstR, vdstG, vdstB;
     Uint32 srcpixel;
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
-    Uint32 dstR, dstG, dstB, dstA;
+    Uint32 dstR, dstG, dstB;
 
     while (info->dst_h--) {
         Uint32 *src = (Uint32 *)info->src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
+        while (n >= 8) {
+            vsrcpixel = _mm256_loadu_si256((__m256i *)src);
+            vsrcR = _mm256_and_si256(vsrcpixel, v255);
+            vsrcG = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 8), v255);
+            vsrcB = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 16), v255);
+            vsrcA = v255;
+            vdstpixel = _mm256_loadu_si256((__m256i *)dst);
+            vdstR = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 16), v255);
+            vdstG = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm256_and_si256(vdstpixel, v255);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm256_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm256_or_si256(_mm256_and_si256(vkeep, vdstR), _mm256_andnot_si256(vkeep, vsrcR));
+                vdstG = _mm256_or_si256(_mm256_and_si256(vkeep, vdstG), _mm256_andnot_si256(vkeep, vsrcG));
+                vdstB = _mm256_or_si256(_mm256_and_si256(vkeep, vdstB), _mm256_andnot_si256(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm256_sub_epi32(v255, vsrcA);
+                vdstR = _mm256_add_epi32(vsrcR, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm256_add_epi32(vsrcG, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm256_add_epi32(vsrcB, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm256_min_epi16(_mm256_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm256_min_epi16(_mm256_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm256_min_epi16(_mm256_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(vdstR, 16), _mm256_slli_epi32(vdstG, 8)), vdstB));
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
         while (n--) {
             srcpixel = *src;
             srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel; srcA = 0xFF;
             dstpixel = *dst;
-            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
-            if (flags & SDL_COPY_MODULATE_COLOR) {
-                srcR = (srcR * modulateR) / 255;
-                srcG = (srcG * modulateG) / 255;
-                srcB = (srcB * modulateB) / 255;
-            }
-            if (flags & SDL_COPY_MODULATE_ALPHA) {
-                srcA = (srcA * modulateA) / 255;
-            }
+            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -2538,7 +3288,7 @@ static void SDL_Blit_BGR888_ARGB8888_Modulate_Blend(SDL_BlitInfo *info)
                 dstB = (srcB * dstB) / 255;
                 break;
             }
-            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            dstpixel = ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
             *dst = dstpixel;
             ++src;
             ++dst;
@@ -2547,57 +3297,76 @@ static void SDL_Blit_BGR888_ARGB8888_Modulate_Blend(SDL_BlitInfo *info)
         info->dst += info->dst_pitch;
     }
 }
+#endif /* SDL_AVX2_BLITTERS */
 
-static void SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
+#if defined(__SSE2__)
+static void SDL_Blit_BGR888_RGB888_Blend_SSE2(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
-    const Uint32 modulateR = info->r;
-    const Uint32 modulateG = info->g;
-    const Uint32 modulateB = info->b;
-    const Uint32 modulateA = info->a;
+    const __m128i v255 = _mm_set1_epi32(0xFF);
+    const __m128i vdiv = _mm_set1_epi32(0x8081);
+    const __m128i vzero = _mm_setzero_si128();
+    __m128i vkeep, vinvA;
+    __m128i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m128i vdstpixel, vdstR, vdstG, vdstB;
     Uint32 srcpixel;
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
-    Uint32 dstR, dstG, dstB, dstA;
-    int srcy, srcx;
-    int posy, posx;
-    int incy, incx;
-
-    srcy = 0;
-    posy = 0;
-    incy = (info->src_h << 16) / info->dst_h;
-    incx = (info->src_w << 16) / info->dst_w;
+    Uint32 dstR, dstG, dstB;
 
     while (info->dst_h--) {
-        Uint32 *src;
+        Uint32 *src = (Uint32 *)info->src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
-        srcx = -1;
-        posx = 0x10000L;
-        while (posy >= 0x10000L) {
-            ++srcy;
-            posy -= 0x10000L;
+        while (n >= 4) {
+            vsrcpixel = _mm_loadu_si128((__m128i *)src);
+            vsrcR = _mm_and_si128(vsrcpixel, v255);
+            vsrcG = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 8), v255);
+            vsrcB = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 16), v255);
+            vsrcA = v255;
+            vdstpixel = _mm_loadu_si128((__m128i *)dst);
+            vdstR = _mm_and_si128(_mm_srli_epi32(vdstpixel, 16), v255);
+            vdstG = _mm_and_si128(_mm_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm_and_si128(vdstpixel, v255);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm_or_si128(_mm_and_si128(vkeep, vdstR), _mm_andnot_si128(vkeep, vsrcR));
+                vdstG = _mm_or_si128(_mm_and_si128(vkeep, vdstG), _mm_andnot_si128(vkeep, vsrcG));
+                vdstB = _mm_or_si128(_mm_and_si128(vkeep, vdstB), _mm_andnot_si128(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm_sub_epi32(v255, vsrcA);
+                vdstR = _mm_add_epi32(vsrcR, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm_add_epi32(vsrcG, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm_add_epi32(vsrcB, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm_min_epi16(_mm_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm_min_epi16(_mm_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm_min_epi16(_mm_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_or_si128(_mm_slli_epi32(vdstR, 16), _mm_slli_epi32(vdstG, 8)), vdstB));
+            src += 4;
+            dst += 4;
+            n -= 4;
         }
         while (n--) {
-            if (posx >= 0x10000L) {
-                while (posx >= 0x10000L) {
-                    ++srcx;
-                    posx -= 0x10000L;
-                }
-                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
-            }
             srcpixel = *src;
             srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel; srcA = 0xFF;
             dstpixel = *dst;
-            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
-            if (flags & SDL_COPY_MODULATE_COLOR) {
-                srcR = (srcR * modulateR) / 255;
-                srcG = (srcG * modulateG) / 255;
-                srcB = (srcB * modulateB) / 255;
-            }
-            if (flags & SDL_COPY_MODULATE_ALPHA) {
-                srcA = (srcA * modulateA) / 255;
-            }
+            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -2630,67 +3399,24 @@ static void SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
                 dstB = (srcB * dstB) / 255;
                 break;
             }
-            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            dstpixel = ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
             *dst = dstpixel;
-            posx += incx;
-            ++dst;
-        }
-        posy += incy;
-        info->dst += info->dst_pitch;
-    }
-}
-
-static void SDL_Blit_ARGB8888_RGB888_Scale(SDL_BlitInfo *info)
-{
-    const int flags = info->flags;
-    Uint32 pixel;
-    Uint32 R, G, B, A;
-    int srcy, srcx;
-    int posy, posx;
-    int incy, incx;
-
-    srcy = 0;
-    posy = 0;
-    incy = (info->src_h << 16) / info->dst_h;
-    incx = (info->src_w << 16) / info->dst_w;
-
-    while (info->dst_h--) {
-        Uint32 *src;
-        Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        srcx = -1;
-        posx = 0x10000L;
-        while (posy >= 0x10000L) {
-            ++srcy;
-            posy -= 0x10000L;
-        }
-        while (n--) {
-            if (posx >= 0x10000L) {
-                while (posx >= 0x10000L) {
-                    ++srcx;
-                    posx -= 0x10000L;
-                }
-                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
-            }
-            pixel = *src;
-            A = (Uint8)(pixel >> 24); R = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); B = (Uint8)pixel;
-            pixel = ((Uint32)R << 16) | ((Uint32)G << 8) | B;
-            *dst = pixel;
-            posx += incx;
+            ++src;
             ++dst;
         }
-        posy += incy;
+        info->src += info->src_pitch;
         info->dst += info->dst_pitch;
     }
 }
+#endif /* defined(__SSE2__) */
 
-static void SDL_Blit_ARGB8888_RGB888_Blend(SDL_BlitInfo *info)
+static void SDL_Blit_BGR888_RGB888_Blend(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
     Uint32 srcpixel;
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
-    Uint32 dstR, dstG, dstB, dstA;
+    Uint32 dstR, dstG, dstB;
 
     while (info->dst_h--) {
         Uint32 *src = (Uint32 *)info->src;
@@ -2698,9 +3424,9 @@ static void SDL_Blit_ARGB8888_RGB888_Blend(SDL_BlitInfo *info)
         int n = info->dst_w;
         while (n--) {
             srcpixel = *src;
-            srcA = (Uint8)(srcpixel >> 24); srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel;
+            srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel; srcA = 0xFF;
             dstpixel = *dst;
-            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel; dstA = 0xFF;
+            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -2743,13 +3469,13 @@ static void SDL_Blit_ARGB8888_RGB888_Blend(SDL_BlitInfo *info)
     }
 }
 
-static void SDL_Blit_ARGB8888_RGB888_Blend_Scale(SDL_BlitInfo *info)
+static void SDL_Blit_BGR888_RGB888_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
     Uint32 srcpixel;
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
-    Uint32 dstR, dstG, dstB, dstA;
+    Uint32 dstR, dstG, dstB;
     int srcy, srcx;
     int posy, posx;
     int incy, incx;
@@ -2778,9 +3504,9 @@ static void SDL_Blit_ARGB8888_RGB888_Blend_Scale(SDL_BlitInfo *info)
                 src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
             }
             srcpixel = *src;
-            srcA = (Uint8)(srcpixel >> 24); srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel;
+            srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel; srcA = 0xFF;
             dstpixel = *dst;
-            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel; dstA = 0xFF;
+            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -2823,13 +3549,21 @@ static void SDL_Blit_ARGB8888_RGB888_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
-static void SDL_Blit_ARGB8888_RGB888_Modulate(SDL_BlitInfo *info)
+#if SDL_AVX2_BLITTERS
+static void SDL_TARGETING_AVX2 SDL_Blit_BGR888_RGB888_Modulate_AVX2(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
     const Uint32 modulateR = info->r;
     const Uint32 modulateG = info->g;
     const Uint32 modulateB = info->b;
     const Uint32 modulateA = info->a;
+    const __m256i vmodulateR = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m256i vmodulateG = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m256i vmodulateB = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m256i vmodulateA = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m256i v255 = _mm256_set1_epi32(0xFF);
+    const __m256i vdiv = _mm256_set1_epi32(0x8081);
+    __m256i vpixel, vR, vG, vB, vA;
     Uint32 pixel;
     Uint32 R, G, B, A;
 
@@ -2837,9 +3571,24 @@ static void SDL_Blit_ARGB8888_RGB888_Modulate(SDL_BlitInfo *info)
         Uint32 *src = (Uint32 *)info->src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
+        while (n >= 8) {
+            vpixel = _mm256_loadu_si256((__m256i *)src);
+            vR = _mm256_and_si256(vpixel, v255);
+            vG = _mm256_and_si256(_mm256_srli_epi32(vpixel, 8), v255);
+            vB = _mm256_and_si256(_mm256_srli_epi32(vpixel, 16), v255);
+            vA = v255;
+            vR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vR, vmodulateR), vdiv), 7);
+            vG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vG, vmodulateG), vdiv), 7);
+            vB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vB, vmodulateB), vdiv), 7);
+            vA = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vA, vmodulateA), vdiv), 7);
+            _mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(vR, 16), _mm256_slli_epi32(vG, 8)), vB));
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
         while (n--) {
             pixel = *src;
-            A = (Uint8)(pixel >> 24); R = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); B = (Uint8)pixel;
+            B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel; A = 0xFF;
             if (flags & SDL_COPY_MODULATE_COLOR) {
                 R = (R * modulateR) / 255;
                 G = (G * modulateG) / 255;
@@ -2857,45 +3606,48 @@ static void SDL_Blit_ARGB8888_RGB888_Modulate(SDL_BlitInfo *info)
         info->dst += info->dst_pitch;
     }
 }
+#endif /* SDL_AVX2_BLITTERS */
 
-static void SDL_Blit_ARGB8888_RGB888_Modulate_Scale(SDL_BlitInfo *info)
+#if defined(__SSE2__)
+static void SDL_Blit_BGR888_RGB888_Modulate_SSE2(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
     const Uint32 modulateR = info->r;
     const Uint32 modulateG = info->g;
     const Uint32 modulateB = info->b;
     const Uint32 modulateA = info->a;
+    const __m128i vmodulateR = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m128i vmodulateG = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m128i vmodulateB = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m128i vmodulateA = _mm_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m128i v255 = _mm_set1_epi32(0xFF);
+    const __m128i vdiv = _mm_set1_epi32(0x8081);
+    __m128i vpixel, vR, vG, vB, vA;
     Uint32 pixel;
     Uint32 R, G, B, A;
-    int srcy, srcx;
-    int posy, posx;
-    int incy, incx;
-
-    srcy = 0;
-    posy = 0;
-    incy = (info->src_h << 16) / info->dst_h;
-    incx = (info->src_w << 16) / info->dst_w;
 
     while (info->dst_h--) {
-        Uint32 *src;
+        Uint32 *src = (Uint32 *)info->src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
-        srcx = -1;
-        posx = 0x10000L;
-        while (posy >= 0x10000L) {
-            ++srcy;
-            posy -= 0x10000L;
+        while (n >= 4) {
+            vpixel = _mm_loadu_si128((__m128i *)src);
+            vR = _mm_and_si128(vpixel, v255);
+            vG = _mm_and_si128(_mm_srli_epi32(vpixel, 8), v255);
+            vB = _mm_and_si128(_mm_srli_epi32(vpixel, 16), v255);
+            vA = v255;
+            vR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vR, vmodulateR), vdiv), 7);
+            vG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vG, vmodulateG), vdiv), 7);
+            vB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vB, vmodulateB), vdiv), 7);
+            vA = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vA, vmodulateA), vdiv), 7);
+            _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_or_si128(_mm_slli_epi32(vR, 16), _mm_slli_epi32(vG, 8)), vB));
+            src += 4;
+            dst += 4;
+            n -= 4;
         }
         while (n--) {
-            if (posx >= 0x10000L) {
-                while (posx >= 0x10000L) {
-                    ++srcx;
-                    posx -= 0x10000L;
-                }
-                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
-            }
             pixel = *src;
-            A = (Uint8)(pixel >> 24); R = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); B = (Uint8)pixel;
+            B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel; A = 0xFF;
             if (flags & SDL_COPY_MODULATE_COLOR) {
                 R = (R * modulateR) / 255;
                 G = (G * modulateG) / 255;
@@ -2906,77 +3658,42 @@ static void SDL_Blit_ARGB8888_RGB888_Modulate_Scale(SDL_BlitInfo *info)
             }
             pixel = ((Uint32)R << 16) | ((Uint32)G << 8) | B;
             *dst = pixel;
-            posx += incx;
+            ++src;
             ++dst;
         }
-        posy += incy;
+        info->src += info->src_pitch;
         info->dst += info->dst_pitch;
     }
 }
+#endif /* defined(__SSE2__) */
 
-static void SDL_Blit_ARGB8888_RGB888_Modulate_Blend(SDL_BlitInfo *info)
+static void SDL_Blit_BGR888_RGB888_Modulate(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
     const Uint32 modulateR = info->r;
     const Uint32 modulateG = info->g;
     const Uint32 modulateB = info->b;
     const Uint32 modulateA = info->a;
-    Uint32 srcpixel;
-    Uint32 srcR, srcG, srcB, srcA;
-    Uint32 dstpixel;
-    Uint32 dstR, dstG, dstB, dstA;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
 
     while (info->dst_h--) {
         Uint32 *src = (Uint32 *)info->src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         while (n--) {
-            srcpixel = *src;
-            srcA = (Uint8)(srcpixel >> 24); srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel;
-            dstpixel = *dst;
-            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel; dstA = 0xFF;
+            pixel = *src;
+            B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel; A = 0xFF;
             if (flags & SDL_COPY_MODULATE_COLOR) {
-                srcR = (srcR * modulateR) / 255;
-                srcG = (srcG * modulateG) / 255;
-                srcB = (srcB * modulateB) / 255;
+                R = (R * modulateR) / 255;
+                G = (G * modulateG) / 255;
+                B = (B * modulateB) / 255;
             }
             if (flags & SDL_COPY_MODULATE_ALPHA) {
-                srcA = (srcA * modulateA) / 255;
+                A = (A * modulateA) / 255;
             }
-            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
-                /* This goes away if we ever use premultiplied alpha */
-                if (srcA < 255) {
-                    srcR = (srcR * srcA) / 255;
-                    srcG = (srcG * srcA) / 255;
-                    srcB = (srcB * srcA) / 255;
-                }
-            }
-            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
-            case SDL_COPY_MASK:
-                if (srcA) {
-                    dstR = srcR;
-                    dstG = srcG;
-                    dstB = srcB;
-                }
-                break;
-            case SDL_COPY_BLEND:
-                dstR = srcR + ((255 - srcA) * dstR) / 255;
-                dstG = srcG + ((255 - srcA) * dstG) / 255;
-                dstB = srcB + ((255 - srcA) * dstB) / 255;
-                break;
-            case SDL_COPY_ADD:
-                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
-                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
-                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
-                break;
-            case SDL_COPY_MOD:
-                dstR = (srcR * dstR) / 255;
-                dstG = (srcG * dstG) / 255;
-                dstB = (srcB * dstB) / 255;
-                break;
-            }
-            dstpixel = ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
-            *dst = dstpixel;
+            pixel = ((Uint32)R << 16) | ((Uint32)G << 8) | B;
+            *dst = pixel;
             ++src;
             ++dst;
         }
@@ -2985,17 +3702,15 @@ static void SDL_Blit_ARGB8888_RGB888_Modulate_Blend(SDL_BlitInfo *info)
     }
 }
 
-static void SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
+static void SDL_Blit_BGR888_RGB888_Modulate_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
     const Uint32 modulateR = info->r;
     const Uint32 modulateG = info->g;
     const Uint32 modulateB = info->b;
     const Uint32 modulateA = info->a;
-    Uint32 srcpixel;
-    Uint32 srcR, srcG, srcB, srcA;
-    Uint32 dstpixel;
-    Uint32 dstR, dstG, dstB, dstA;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
     int srcy, srcx;
     int posy, posx;
     int incy, incx;
@@ -3023,10 +3738,106 @@ static void SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
                 }
                 src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
             }
+            pixel = *src;
+            B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel; A = 0xFF;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = (R * modulateR) / 255;
+                G = (G * modulateG) / 255;
+                B = (B * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = (A * modulateA) / 255;
+            }
+            pixel = ((Uint32)R << 16) | ((Uint32)G << 8) | B;
+            *dst = pixel;
+            posx += incx;
+            ++dst;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+#if SDL_AVX2_BLITTERS
+static void SDL_TARGETING_AVX2 SDL_Blit_BGR888_RGB888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    const __m256i vmodulateR = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m256i vmodulateG = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m256i vmodulateB = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m256i vmodulateA = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m256i v255 = _mm256_set1_epi32(0xFF);
+    const __m256i vdiv = _mm256_set1_epi32(0x8081);
+    const __m256i vzero = _mm256_setzero_si256();
+    __m256i vkeep, vinvA;
+    __m256i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m256i vdstpixel, vdstR, vdstG, vdstB;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            vsrcpixel = _mm256_loadu_si256((__m256i *)src);
+            vsrcR = _mm256_and_si256(vsrcpixel, v255);
+            vsrcG = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 8), v255);
+            vsrcB = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 16), v255);
+            vsrcA = v255;
+            vdstpixel = _mm256_loadu_si256((__m256i *)dst);
+            vdstR = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 16), v255);
+            vdstG = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm256_and_si256(vdstpixel, v255);
+            vsrcR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vmodulateR), vdiv), 7);
+            vsrcG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vmodulateG), vdiv), 7);
+            vsrcB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vmodulateB), vdiv), 7);
+            vsrcA = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcA, vmodulateA), vdiv), 7);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm256_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm256_or_si256(_mm256_and_si256(vkeep, vdstR), _mm256_andnot_si256(vkeep, vsrcR));
+                vdstG = _mm256_or_si256(_mm256_and_si256(vkeep, vdstG), _mm256_andnot_si256(vkeep, vsrcG));
+                vdstB = _mm256_or_si256(_mm256_and_si256(vkeep, vdstB), _mm256_andnot_si256(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm256_sub_epi32(v255, vsrcA);
+                vdstR = _mm256_add_epi32(vsrcR, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm256_add_epi32(vsrcG, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm256_add_epi32(vsrcB, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm256_min_epi16(_mm256_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm256_min_epi16(_mm256_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm256_min_epi16(_mm256_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(vdstR, 16), _mm256_slli_epi32(vdstG, 8)), vdstB));
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
             srcpixel = *src;
-            srcA = (Uint8)(srcpixel >> 24); srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel;
+            srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel; srcA = 0xFF;
             dstpixel = *dst;
-            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel; dstA = 0xFF;
+            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
             if (flags & SDL_COPY_MODULATE_COLOR) {
                 srcR = (srcR * modulateR) / 255;
                 srcG = (srcG * modulateG) / 255;
@@ -3069,65 +3880,157 @@ static void SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
             }
             dstpixel = ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
             *dst = dstpixel;
-            posx += incx;
+            ++src;
             ++dst;
         }
-        posy += incy;
+        info->src += info->src_pitch;
         info->dst += info->dst_pitch;
     }
 }
+#endif /* SDL_AVX2_BLITTERS */
 
-static void SDL_Blit_ARGB8888_BGR888_Scale(SDL_BlitInfo *info)
+#if defined(__SSE2__)
+static void SDL_Blit_BGR888_RGB888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
-    Uint32 pixel;
-    Uint32 R, G, B, A;
-    int srcy, srcx;
-    int posy, posx;
-    int incy, incx;
-
-    srcy = 0;
-    posy = 0;
-    incy = (info->src_h << 16) / info->dst_h;
-    incx = (info->src_w << 16) / info->dst_w;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    const __m128i vmodulateR = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m128i vmodulateG = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m128i vmodulateB = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m128i vmodulateA = _mm_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m128i v255 = _mm_set1_epi32(0xFF);
+    const __m128i vdiv = _mm_set1_epi32(0x8081);
+    const __m128i vzero = _mm_setzero_si128();
+    __m128i vkeep, vinvA;
+    __m128i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m128i vdstpixel, vdstR, vdstG, vdstB;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
 
     while (info->dst_h--) {
-        Uint32 *src;
+        Uint32 *src = (Uint32 *)info->src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
-        srcx = -1;
-        posx = 0x10000L;
-        while (posy >= 0x10000L) {
-            ++srcy;
-            posy -= 0x10000L;
+        while (n >= 4) {
+            vsrcpixel = _mm_loadu_si128((__m128i *)src);
+            vsrcR = _mm_and_si128(vsrcpixel, v255);
+            vsrcG = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 8), v255);
+            vsrcB = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 16), v255);
+            vsrcA = v255;
+            vdstpixel = _mm_loadu_si128((__m128i *)dst);
+            vdstR = _mm_and_si128(_mm_srli_epi32(vdstpixel, 16), v255);
+            vdstG = _mm_and_si128(_mm_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm_and_si128(vdstpixel, v255);
+            vsrcR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vmodulateR), vdiv), 7);
+            vsrcG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vmodulateG), vdiv), 7);
+            vsrcB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vmodulateB), vdiv), 7);
+            vsrcA = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcA, vmodulateA), vdiv), 7);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm_or_si128(_mm_and_si128(vkeep, vdstR), _mm_andnot_si128(vkeep, vsrcR));
+                vdstG = _mm_or_si128(_mm_and_si128(vkeep, vdstG), _mm_andnot_si128(vkeep, vsrcG));
+                vdstB = _mm_or_si128(_mm_and_si128(vkeep, vdstB), _mm_andnot_si128(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm_sub_epi32(v255, vsrcA);
+                vdstR = _mm_add_epi32(vsrcR, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm_add_epi32(vsrcG, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm_add_epi32(vsrcB, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm_min_epi16(_mm_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm_min_epi16(_mm_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm_min_epi16(_mm_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_or_si128(_mm_slli_epi32(vdstR, 16), _mm_slli_epi32(vdstG, 8)), vdstB));
+            src += 4;
+            dst += 4;
+            n -= 4;
         }
         while (n--) {
-            if (posx >= 0x10000L) {
-                while (posx >= 0x10000L) {
-                    ++srcx;
-                    posx -= 0x10000L;
+            srcpixel = *src;
+            srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel; srcA = 0xFF;
+            dstpixel = *dst;
+            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
                 }
-                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
             }
-            pixel = *src;
-            A = (Uint8)(pixel >> 24); R = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); B = (Uint8)pixel;
-            pixel = ((Uint32)B << 16) | ((Uint32)G << 8) | R;
-            *dst = pixel;
-            posx += incx;
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            *dst = dstpixel;
+            ++src;
             ++dst;
         }
-        posy += incy;
+        info->src += info->src_pitch;
         info->dst += info->dst_pitch;
     }
 }
+#endif /* defined(__SSE2__) */
 
-static void SDL_Blit_ARGB8888_BGR888_Blend(SDL_BlitInfo *info)
+static void SDL_Blit_BGR888_RGB888_Modulate_Blend(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
     Uint32 srcpixel;
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
-    Uint32 dstR, dstG, dstB, dstA;
+    Uint32 dstR, dstG, dstB;
 
     while (info->dst_h--) {
         Uint32 *src = (Uint32 *)info->src;
@@ -3135,9 +4038,17 @@ static void SDL_Blit_ARGB8888_BGR888_Blend(SDL_BlitInfo *info)
         int n = info->dst_w;
         while (n--) {
             srcpixel = *src;
-            srcA = (Uint8)(srcpixel >> 24); srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel;
+            srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel; srcA = 0xFF;
             dstpixel = *dst;
-            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel; dstA = 0xFF;
+            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -3170,7 +4081,7 @@ static void SDL_Blit_ARGB8888_BGR888_Blend(SDL_BlitInfo *info)
                 dstB = (srcB * dstB) / 255;
                 break;
             }
-            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
+            dstpixel = ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
             *dst = dstpixel;
             ++src;
             ++dst;
@@ -3180,13 +4091,17 @@ static void SDL_Blit_ARGB8888_BGR888_Blend(SDL_BlitInfo *info)
     }
 }
 
-static void SDL_Blit_ARGB8888_BGR888_Blend_Scale(SDL_BlitInfo *info)
+static void SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
     Uint32 srcpixel;
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
-    Uint32 dstR, dstG, dstB, dstA;
+    Uint32 dstR, dstG, dstB;
     int srcy, srcx;
     int posy, posx;
     int incy, incx;
@@ -3215,9 +4130,17 @@ static void SDL_Blit_ARGB8888_BGR888_Blend_Scale(SDL_BlitInfo *info)
                 src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
             }
             srcpixel = *src;
-            srcA = (Uint8)(srcpixel >> 24); srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel;
+            srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel; srcA = 0xFF;
             dstpixel = *dst;
-            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel; dstA = 0xFF;
+            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -3250,7 +4173,7 @@ static void SDL_Blit_ARGB8888_BGR888_Blend_Scale(SDL_BlitInfo *info)
                 dstB = (srcB * dstB) / 255;
                 break;
             }
-            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
+            dstpixel = ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
             *dst = dstpixel;
             posx += incx;
             ++dst;
@@ -3260,69 +4183,28 @@ static void SDL_Blit_ARGB8888_BGR888_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
-static void SDL_Blit_ARGB8888_BGR888_Modulate(SDL_BlitInfo *info)
+static void SDL_Blit_BGR888_BGR888_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
-    const Uint32 modulateR = info->r;
-    const Uint32 modulateG = info->g;
-    const Uint32 modulateB = info->b;
-    const Uint32 modulateA = info->a;
-    Uint32 pixel;
-    Uint32 R, G, B, A;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
 
     while (info->dst_h--) {
-        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
-        while (n--) {
-            pixel = *src;
-            A = (Uint8)(pixel >> 24); R = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); B = (Uint8)pixel;
-            if (flags & SDL_COPY_MODULATE_COLOR) {
-                R = (R * modulateR) / 255;
-                G = (G * modulateG) / 255;
-                B = (B * modulateB) / 255;
-            }
-            if (flags & SDL_COPY_MODULATE_ALPHA) {
-                A = (A * modulateA) / 255;
-            }
-            pixel = ((Uint32)B << 16) | ((Uint32)G << 8) | R;
-            *dst = pixel;
-            ++src;
-            ++dst;
-        }
-        info->src += info->src_pitch;
-        info->dst += info->dst_pitch;
-    }
-}
-
-static void SDL_Blit_ARGB8888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
-{
-    const int flags = info->flags;
-    const Uint32 modulateR = info->r;
-    const Uint32 modulateG = info->g;
-    const Uint32 modulateB = info->b;
-    const Uint32 modulateA = info->a;
-    Uint32 pixel;
-    Uint32 R, G, B, A;
-    int srcy, srcx;
-    int posy, posx;
-    int incy, incx;
-
-    srcy = 0;
-    posy = 0;
-    incy = (info->src_h << 16) / info->dst_h;
-    incx = (info->src_w << 16) / info->dst_w;
-
-    while (info->dst_h--) {
-        Uint32 *src;
-        Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        srcx = -1;
-        posx = 0x10000L;
-        while (posy >= 0x10000L) {
-            ++srcy;
-            posy -= 0x10000L;
-        }
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
         while (n--) {
             if (posx >= 0x10000L) {
                 while (posx >= 0x10000L) {
@@ -3331,18 +4213,7 @@ static void SDL_Blit_ARGB8888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
                 }
                 src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
             }
-            pixel = *src;
-            A = (Uint8)(pixel >> 24); R = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); B = (Uint8)pixel;
-            if (flags & SDL_COPY_MODULATE_COLOR) {
-                R = (R * modulateR) / 255;
-                G = (G * modulateG) / 255;
-                B = (B * modulateB) / 255;
-            }
-            if (flags & SDL_COPY_MODULATE_ALPHA) {
-                A = (A * modulateA) / 255;
-            }
-            pixel = ((Uint32)B << 16) | ((Uint32)G << 8) | R;
-            *dst = pixel;
+            *dst = *src;
             posx += incx;
             ++dst;
         }
@@ -3351,35 +4222,74 @@ static void SDL_Blit_ARGB8888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
     }
 }
 
-static void SDL_Blit_ARGB8888_BGR888_Modulate_Blend(SDL_BlitInfo *info)
+#if SDL_AVX2_BLITTERS
+static void SDL_TARGETING_AVX2 SDL_Blit_BGR888_BGR888_Blend_AVX2(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
-    const Uint32 modulateR = info->r;
-    const Uint32 modulateG = info->g;
-    const Uint32 modulateB = info->b;
-    const Uint32 modulateA = info->a;
+    const __m256i v255 = _mm256_set1_epi32(0xFF);
+    const __m256i vdiv = _mm256_set1_epi32(0x8081);
+    const __m256i vzero = _mm256_setzero_si256();
+    __m256i vkeep, vinvA;
+    __m256i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m256i vdstpixel, vdstR, vdstG, vdstB;
     Uint32 srcpixel;
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
-    Uint32 dstR, dstG, dstB, dstA;
+    Uint32 dstR, dstG, dstB;
 
     while (info->dst_h--) {
         Uint32 *src = (Uint32 *)info->src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
+        while (n >= 8) {
+            vsrcpixel = _mm256_loadu_si256((__m256i *)src);
+            vsrcR = _mm256_and_si256(vsrcpixel, v255);
+            vsrcG = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 8), v255);
+            vsrcB = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 16), v255);
+            vsrcA = v255;
+            vdstpixel = _mm256_loadu_si256((__m256i *)dst);
+            vdstR = _mm256_and_si256(vdstpixel, v255);
+            vdstG = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 16), v255);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm256_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm256_or_si256(_mm256_and_si256(vkeep, vdstR), _mm256_andnot_si256(vkeep, vsrcR));
+                vdstG = _mm256_or_si256(_mm256_and_si256(vkeep, vdstG), _mm256_andnot_si256(vkeep, vsrcG));
+                vdstB = _mm256_or_si256(_mm256_and_si256(vkeep, vdstB), _mm256_andnot_si256(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm256_sub_epi32(v255, vsrcA);
+                vdstR = _mm256_add_epi32(vsrcR, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm256_add_epi32(vsrcG, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm256_add_epi32(vsrcB, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm256_min_epi16(_mm256_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm256_min_epi16(_mm256_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm256_min_epi16(_mm256_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(_mm256_or_si256(vdstR, _mm256_slli_epi32(vdstG, 8)), _mm256_slli_epi32(vdstB, 16)));
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
         while (n--) {
             srcpixel = *src;
-            srcA = (Uint8)(srcpixel >> 24); srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel;
+            srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel; srcA = 0xFF;
             dstpixel = *dst;
-            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel; dstA = 0xFF;
-            if (flags & SDL_COPY_MODULATE_COLOR) {
-                srcR = (srcR * modulateR) / 255;
-                srcG = (srcG * modulateG) / 255;
-                srcB = (srcB * modulateB) / 255;
-            }
-            if (flags & SDL_COPY_MODULATE_ALPHA) {
-                srcA = (srcA * modulateA) / 255;
-            }
+            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel;
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -3421,57 +4331,76 @@ static void SDL_Blit_ARGB8888_BGR888_Modulate_Blend(SDL_BlitInfo *info)
         info->dst += info->dst_pitch;
     }
 }
+#endif /* SDL_AVX2_BLITTERS */
 
-static void SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
+#if defined(__SSE2__)
+static void SDL_Blit_BGR888_BGR888_Blend_SSE2(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
-    const Uint32 modulateR = info->r;
-    const Uint32 modulateG = info->g;
-    const Uint32 modulateB = info->b;
-    const Uint32 modulateA = info->a;
+    const __m128i v255 = _mm_set1_epi32(0xFF);
+    const __m128i vdiv = _mm_set1_epi32(0x8081);
+    const __m128i vzero = _mm_setzero_si128();
+    __m128i vkeep, vinvA;
+    __m128i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m128i vdstpixel, vdstR, vdstG, vdstB;
     Uint32 srcpixel;
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
-    Uint32 dstR, dstG, dstB, dstA;
-    int srcy, srcx;
-    int posy, posx;
-    int incy, incx;
-
-    srcy = 0;
-    posy = 0;
-    incy = (info->src_h << 16) / info->dst_h;
-    incx = (info->src_w << 16) / info->dst_w;
+    Uint32 dstR, dstG, dstB;
 
     while (info->dst_h--) {
-        Uint32 *src;
+        Uint32 *src = (Uint32 *)info->src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
-        srcx = -1;
-        posx = 0x10000L;
-        while (posy >= 0x10000L) {
-            ++srcy;
-            posy -= 0x10000L;
+        while (n >= 4) {
+            vsrcpixel = _mm_loadu_si128((__m128i *)src);
+            vsrcR = _mm_and_si128(vsrcpixel, v255);
+            vsrcG = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 8), v255);
+            vsrcB = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 16), v255);
+            vsrcA = v255;
+            vdstpixel = _mm_loadu_si128((__m128i *)dst);
+            vdstR = _mm_and_si128(vdstpixel, v255);
+            vdstG = _mm_and_si128(_mm_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm_and_si128(_mm_srli_epi32(vdstpixel, 16), v255);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm_or_si128(_mm_and_si128(vkeep, vdstR), _mm_andnot_si128(vkeep, vsrcR));
+                vdstG = _mm_or_si128(_mm_and_si128(vkeep, vdstG), _mm_andnot_si128(vkeep, vsrcG));
+                vdstB = _mm_or_si128(_mm_and_si128(vkeep, vdstB), _mm_andnot_si128(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm_sub_epi32(v255, vsrcA);
+                vdstR = _mm_add_epi32(vsrcR, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm_add_epi32(vsrcG, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm_add_epi32(vsrcB, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm_min_epi16(_mm_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm_min_epi16(_mm_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm_min_epi16(_mm_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_or_si128(vdstR, _mm_slli_epi32(vdstG, 8)), _mm_slli_epi32(vdstB, 16)));
+            src += 4;
+            dst += 4;
+            n -= 4;
         }
         while (n--) {
-            if (posx >= 0x10000L) {
-                while (posx >= 0x10000L) {
-                    ++srcx;
-                    posx -= 0x10000L;
-                }
-                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
-            }
             srcpixel = *src;
-            srcA = (Uint8)(srcpixel >> 24); srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel;
+            srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel; srcA = 0xFF;
             dstpixel = *dst;
-            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel; dstA = 0xFF;
-            if (flags & SDL_COPY_MODULATE_COLOR) {
-                srcR = (srcR * modulateR) / 255;
-                srcG = (srcG * modulateG) / 255;
-                srcB = (srcB * modulateB) / 255;
-            }
-            if (flags & SDL_COPY_MODULATE_ALPHA) {
-                srcA = (srcA * modulateA) / 255;
-            }
+            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel;
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -3506,60 +4435,22 @@ static void SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
             }
             dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
             *dst = dstpixel;
-            posx += incx;
-            ++dst;
-        }
-        posy += incy;
-        info->dst += info->dst_pitch;
-    }
-}
-
-static void SDL_Blit_ARGB8888_ARGB8888_Scale(SDL_BlitInfo *info)
-{
-    const int flags = info->flags;
-    int srcy, srcx;
-    int posy, posx;
-    int incy, incx;
-
-    srcy = 0;
-    posy = 0;
-    incy = (info->src_h << 16) / info->dst_h;
-    incx = (info->src_w << 16) / info->dst_w;
-
-    while (info->dst_h--) {
-        Uint32 *src;
-        Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        srcx = -1;
-        posx = 0x10000L;
-        while (posy >= 0x10000L) {
-            ++srcy;
-            posy -= 0x10000L;
-        }
-        while (n--) {
-            if (posx >= 0x10000L) {
-                while (posx >= 0x10000L) {
-                    ++srcx;
-                    posx -= 0x10000L;
-                }
-                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
-            }
-            *dst = *src;
-            posx += incx;
+            ++src;
             ++dst;
         }
-        posy += incy;
+        info->src += info->src_pitch;
         info->dst += info->dst_pitch;
     }
 }
+#endif /* defined(__SSE2__) */
 
-static void SDL_Blit_ARGB8888_ARGB8888_Blend(SDL_BlitInfo *info)
+static void SDL_Blit_BGR888_BGR888_Blend(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
     Uint32 srcpixel;
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
-    Uint32 dstR, dstG, dstB, dstA;
+    Uint32 dstR, dstG, dstB;
 
     while (info->dst_h--) {
         Uint32 *src = (Uint32 *)info->src;
@@ -3567,9 +4458,9 @@ static void SDL_Blit_ARGB8888_ARGB8888_Blend(SDL_BlitInfo *info)
         int n = info->dst_w;
         while (n--) {
             srcpixel = *src;
-            srcA = (Uint8)(srcpixel >> 24); srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel;
+            srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel; srcA = 0xFF;
             dstpixel = *dst;
-            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel;
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -3602,7 +4493,7 @@ static void SDL_Blit_ARGB8888_ARGB8888_Blend(SDL_BlitInfo *info)
                 dstB = (srcB * dstB) / 255;
                 break;
             }
-            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
             *dst = dstpixel;
             ++src;
             ++dst;
@@ -3612,13 +4503,13 @@ static void SDL_Blit_ARGB8888_ARGB8888_Blend(SDL_BlitInfo *info)
     }
 }
 
-static void SDL_Blit_ARGB8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
+static void SDL_Blit_BGR888_BGR888_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
     Uint32 srcpixel;
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
-    Uint32 dstR, dstG, dstB, dstA;
+    Uint32 dstR, dstG, dstB;
     int srcy, srcx;
     int posy, posx;
     int incy, incx;
@@ -3647,9 +4538,9 @@ static void SDL_Blit_ARGB8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
                 src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
             }
             srcpixel = *src;
-            srcA = (Uint8)(srcpixel >> 24); srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel;
+            srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel; srcA = 0xFF;
             dstpixel = *dst;
-            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel;
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -3682,7 +4573,7 @@ static void SDL_Blit_ARGB8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
                 dstB = (srcB * dstB) / 255;
                 break;
             }
-            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
             *dst = dstpixel;
             posx += incx;
             ++dst;
@@ -3692,13 +4583,21 @@ static void SDL_Blit_ARGB8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
-static void SDL_Blit_ARGB8888_ARGB8888_Modulate(SDL_BlitInfo *info)
+#if SDL_AVX2_BLITTERS
+static void SDL_TARGETING_AVX2 SDL_Blit_BGR888_BGR888_Modulate_AVX2(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
     const Uint32 modulateR = info->r;
     const Uint32 modulateG = info->g;
     const Uint32 modulateB = info->b;
     const Uint32 modulateA = info->a;
+    const __m256i vmodulateR = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m256i vmodulateG = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m256i vmodulateB = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m256i vmodulateA = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m256i v255 = _mm256_set1_epi32(0xFF);
+    const __m256i vdiv = _mm256_set1_epi32(0x8081);
+    __m256i vpixel, vR, vG, vB, vA;
     Uint32 pixel;
     Uint32 R, G, B, A;
 
@@ -3706,9 +4605,24 @@ static void SDL_Blit_ARGB8888_ARGB8888_Modulate(SDL_BlitInfo *info)
         Uint32 *src = (Uint32 *)info->src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
+        while (n >= 8) {
+            vpixel = _mm256_loadu_si256((__m256i *)src);
+            vR = _mm256_and_si256(vpixel, v255);
+            vG = _mm256_and_si256(_mm256_srli_epi32(vpixel, 8), v255);
+            vB = _mm256_and_si256(_mm256_srli_epi32(vpixel, 16), v255);
+            vA = v255;
+            vR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vR, vmodulateR), vdiv), 7);
+            vG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vG, vmodulateG), vdiv), 7);
+            vB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vB, vmodulateB), vdiv), 7);
+            vA = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vA, vmodulateA), vdiv), 7);
+            _mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(_mm256_or_si256(vR, _mm256_slli_epi32(vG, 8)), _mm256_slli_epi32(vB, 16)));
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
         while (n--) {
             pixel = *src;
-            A = (Uint8)(pixel >> 24); R = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); B = (Uint8)pixel;
+            B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel; A = 0xFF;
             if (flags & SDL_COPY_MODULATE_COLOR) {
                 R = (R * modulateR) / 255;
                 G = (G * modulateG) / 255;
@@ -3717,7 +4631,7 @@ static void SDL_Blit_ARGB8888_ARGB8888_Modulate(SDL_BlitInfo *info)
             if (flags & SDL_COPY_MODULATE_ALPHA) {
                 A = (A * modulateA) / 255;
             }
-            pixel = ((Uint32)A << 24) | ((Uint32)R << 16) | ((Uint32)G << 8) | B;
+            pixel = ((Uint32)B << 16) | ((Uint32)G << 8) | R;
             *dst = pixel;
             ++src;
             ++dst;
@@ -3726,45 +4640,48 @@ static void SDL_Blit_ARGB8888_ARGB8888_Modulate(SDL_BlitInfo *info)
         info->dst += info->dst_pitch;
     }
 }
+#endif /* SDL_AVX2_BLITTERS */
 
-static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
+#if defined(__SSE2__)
+static void SDL_Blit_BGR888_BGR888_Modulate_SSE2(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
     const Uint32 modulateR = info->r;
     const Uint32 modulateG = info->g;
     const Uint32 modulateB = info->b;
     const Uint32 modulateA = info->a;
+    const __m128i vmodulateR = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m128i vmodulateG = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m128i vmodulateB = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m128i vmodulateA = _mm_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m128i v255 = _mm_set1_epi32(0xFF);
+    const __m128i vdiv = _mm_set1_epi32(0x8081);
+    __m128i vpixel, vR, vG, vB, vA;
     Uint32 pixel;
     Uint32 R, G, B, A;
-    int srcy, srcx;
-    int posy, posx;
-    int incy, incx;
-
-    srcy = 0;
-    posy = 0;
-    incy = (info->src_h << 16) / info->dst_h;
-    incx = (info->src_w << 16) / info->dst_w;
 
     while (info->dst_h--) {
-        Uint32 *src;
+        Uint32 *src = (Uint32 *)info->src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
-        srcx = -1;
-        posx = 0x10000L;
-        while (posy >= 0x10000L) {
-            ++srcy;
-            posy -= 0x10000L;
+        while (n >= 4) {
+            vpixel = _mm_loadu_si128((__m128i *)src);
+            vR = _mm_and_si128(vpixel, v255);
+            vG = _mm_and_si128(_mm_srli_epi32(vpixel, 8), v255);
+            vB = _mm_and_si128(_mm_srli_epi32(vpixel, 16), v255);
+            vA = v255;
+            vR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vR, vmodulateR), vdiv), 7);
+            vG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vG, vmodulateG), vdiv), 7);
+            vB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vB, vmodulateB), vdiv), 7);
+            vA = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vA, vmodulateA), vdiv), 7);
+            _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_or_si128(vR, _mm_slli_epi32(vG, 8)), _mm_slli_epi32(vB, 16)));
+            src += 4;
+            dst += 4;
+            n -= 4;
         }
         while (n--) {
-            if (posx >= 0x10000L) {
-                while (posx >= 0x10000L) {
-                    ++srcx;
-                    posx -= 0x10000L;
-                }
-                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
-            }
             pixel = *src;
-            A = (Uint8)(pixel >> 24); R = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); B = (Uint8)pixel;
+            B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel; A = 0xFF;
             if (flags & SDL_COPY_MODULATE_COLOR) {
                 R = (R * modulateR) / 255;
                 G = (G * modulateG) / 255;
@@ -3773,79 +4690,44 @@ static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
             if (flags & SDL_COPY_MODULATE_ALPHA) {
                 A = (A * modulateA) / 255;
             }
-            pixel = ((Uint32)A << 24) | ((Uint32)R << 16) | ((Uint32)G << 8) | B;
+            pixel = ((Uint32)B << 16) | ((Uint32)G << 8) | R;
             *dst = pixel;
-            posx += incx;
+            ++src;
             ++dst;
         }
-        posy += incy;
+        info->src += info->src_pitch;
         info->dst += info->dst_pitch;
     }
 }
+#endif /* defined(__SSE2__) */
 
-static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend(SDL_BlitInfo *info)
+static void SDL_Blit_BGR888_BGR888_Modulate(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
     const Uint32 modulateR = info->r;
     const Uint32 modulateG = info->g;
     const Uint32 modulateB = info->b;
     const Uint32 modulateA = info->a;
-    Uint32 srcpixel;
-    Uint32 srcR, srcG, srcB, srcA;
-    Uint32 dstpixel;
-    Uint32 dstR, dstG, dstB, dstA;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
 
     while (info->dst_h--) {
         Uint32 *src = (Uint32 *)info->src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         while (n--) {
-            srcpixel = *src;
-            srcA = (Uint8)(srcpixel >> 24); srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel;
-            dstpixel = *dst;
-            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            pixel = *src;
+            B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel; A = 0xFF;
             if (flags & SDL_COPY_MODULATE_COLOR) {
-                srcR = (srcR * modulateR) / 255;
-                srcG = (srcG * modulateG) / 255;
-                srcB = (srcB * modulateB) / 255;
+                R = (R * modulateR) / 255;
+                G = (G * modulateG) / 255;
+                B = (B * modulateB) / 255;
             }
             if (flags & SDL_COPY_MODULATE_ALPHA) {
-                srcA = (srcA * modulateA) / 255;
+                A = (A * modulateA) / 255;
             }
-            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
-                /* This goes away if we ever use premultiplied alpha */
-                if (srcA < 255) {
-                    srcR = (srcR * srcA) / 255;
-                    srcG = (srcG * srcA) / 255;
-                    srcB = (srcB * srcA) / 255;
-                }
-            }
-            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
-            case SDL_COPY_MASK:
-                if (srcA) {
-                    dstR = srcR;
-                    dstG = srcG;
-                    dstB = srcB;
-                }
-                break;
-            case SDL_COPY_BLEND:
-                dstR = srcR + ((255 - srcA) * dstR) / 255;
-                dstG = srcG + ((255 - srcA) * dstG) / 255;
-                dstB = srcB + ((255 - srcA) * dstB) / 255;
-                break;
-            case SDL_COPY_ADD:
-                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
-                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
-                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
-                break;
-            case SDL_COPY_MOD:
-                dstR = (srcR * dstR) / 255;
-                dstG = (srcG * dstG) / 255;
-                dstB = (srcB * dstB) / 255;
-                break;
-            }
-            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
-            *dst = dstpixel;
+            pixel = ((Uint32)B << 16) | ((Uint32)G << 8) | R;
+            *dst = pixel;
             ++src;
             ++dst;
         }
@@ -3854,17 +4736,15 @@ static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend(SDL_BlitInfo *info)
     }
 }
 
-static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
+static void SDL_Blit_BGR888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
     const Uint32 modulateR = info->r;
     const Uint32 modulateG = info->g;
     const Uint32 modulateB = info->b;
     const Uint32 modulateA = info->a;
-    Uint32 srcpixel;
-    Uint32 srcR, srcG, srcB, srcA;
-    Uint32 dstpixel;
-    Uint32 dstR, dstG, dstB, dstA;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
     int srcy, srcx;
     int posy, posx;
     int incy, incx;
@@ -3892,10 +4772,106 @@ static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
                 }
                 src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
             }
+            pixel = *src;
+            B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel; A = 0xFF;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = (R * modulateR) / 255;
+                G = (G * modulateG) / 255;
+                B = (B * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = (A * modulateA) / 255;
+            }
+            pixel = ((Uint32)B << 16) | ((Uint32)G << 8) | R;
+            *dst = pixel;
+            posx += incx;
+            ++dst;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+#if SDL_AVX2_BLITTERS
+static void SDL_TARGETING_AVX2 SDL_Blit_BGR888_BGR888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    const __m256i vmodulateR = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m256i vmodulateG = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m256i vmodulateB = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m256i vmodulateA = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m256i v255 = _mm256_set1_epi32(0xFF);
+    const __m256i vdiv = _mm256_set1_epi32(0x8081);
+    const __m256i vzero = _mm256_setzero_si256();
+    __m256i vkeep, vinvA;
+    __m256i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m256i vdstpixel, vdstR, vdstG, vdstB;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            vsrcpixel = _mm256_loadu_si256((__m256i *)src);
+            vsrcR = _mm256_and_si256(vsrcpixel, v255);
+            vsrcG = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 8), v255);
+            vsrcB = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 16), v255);
+            vsrcA = v255;
+            vdstpixel = _mm256_loadu_si256((__m256i *)dst);
+            vdstR = _mm256_and_si256(vdstpixel, v255);
+            vdstG = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 16), v255);
+            vsrcR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vmodulateR), vdiv), 7);
+            vsrcG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vmodulateG), vdiv), 7);
+            vsrcB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vmodulateB), vdiv), 7);
+            vsrcA = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcA, vmodulateA), vdiv), 7);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm256_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm256_or_si256(_mm256_and_si256(vkeep, vdstR), _mm256_andnot_si256(vkeep, vsrcR));
+                vdstG = _mm256_or_si256(_mm256_and_si256(vkeep, vdstG), _mm256_andnot_si256(vkeep, vsrcG));
+                vdstB = _mm256_or_si256(_mm256_and_si256(vkeep, vdstB), _mm256_andnot_si256(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm256_sub_epi32(v255, vsrcA);
+                vdstR = _mm256_add_epi32(vsrcR, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm256_add_epi32(vsrcG, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm256_add_epi32(vsrcB, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm256_min_epi16(_mm256_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm256_min_epi16(_mm256_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm256_min_epi16(_mm256_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(_mm256_or_si256(vdstR, _mm256_slli_epi32(vdstG, 8)), _mm256_slli_epi32(vdstB, 16)));
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
             srcpixel = *src;
-            srcA = (Uint8)(srcpixel >> 24); srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel;
+            srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel; srcA = 0xFF;
             dstpixel = *dst;
-            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel;
             if (flags & SDL_COPY_MODULATE_COLOR) {
                 srcR = (srcR * modulateR) / 255;
                 srcG = (srcG * modulateG) / 255;
@@ -3936,67 +4912,159 @@ static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
                 dstB = (srcB * dstB) / 255;
                 break;
             }
-            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
             *dst = dstpixel;
-            posx += incx;
+            ++src;
             ++dst;
         }
-        posy += incy;
+        info->src += info->src_pitch;
         info->dst += info->dst_pitch;
     }
 }
+#endif /* SDL_AVX2_BLITTERS */
 
-static void SDL_Blit_RGBA8888_RGB888_Scale(SDL_BlitInfo *info)
+#if defined(__SSE2__)
+static void SDL_Blit_BGR888_BGR888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
-    Uint32 pixel;
-    Uint32 R, G, B, A;
-    int srcy, srcx;
-    int posy, posx;
-    int incy, incx;
-
-    srcy = 0;
-    posy = 0;
-    incy = (info->src_h << 16) / info->dst_h;
-    incx = (info->src_w << 16) / info->dst_w;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    const __m128i vmodulateR = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m128i vmodulateG = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m128i vmodulateB = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m128i vmodulateA = _mm_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m128i v255 = _mm_set1_epi32(0xFF);
+    const __m128i vdiv = _mm_set1_epi32(0x8081);
+    const __m128i vzero = _mm_setzero_si128();
+    __m128i vkeep, vinvA;
+    __m128i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m128i vdstpixel, vdstR, vdstG, vdstB;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
 
     while (info->dst_h--) {
-        Uint32 *src;
+        Uint32 *src = (Uint32 *)info->src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
-        srcx = -1;
-        posx = 0x10000L;
-        while (posy >= 0x10000L) {
-            ++srcy;
-            posy -= 0x10000L;
+        while (n >= 4) {
+            vsrcpixel = _mm_loadu_si128((__m128i *)src);
+            vsrcR = _mm_and_si128(vsrcpixel, v255);
+            vsrcG = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 8), v255);
+            vsrcB = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 16), v255);
+            vsrcA = v255;
+            vdstpixel = _mm_loadu_si128((__m128i *)dst);
+            vdstR = _mm_and_si128(vdstpixel, v255);
+            vdstG = _mm_and_si128(_mm_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm_and_si128(_mm_srli_epi32(vdstpixel, 16), v255);
+            vsrcR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vmodulateR), vdiv), 7);
+            vsrcG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vmodulateG), vdiv), 7);
+            vsrcB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vmodulateB), vdiv), 7);
+            vsrcA = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcA, vmodulateA), vdiv), 7);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm_or_si128(_mm_and_si128(vkeep, vdstR), _mm_andnot_si128(vkeep, vsrcR));
+                vdstG = _mm_or_si128(_mm_and_si128(vkeep, vdstG), _mm_andnot_si128(vkeep, vsrcG));
+                vdstB = _mm_or_si128(_mm_and_si128(vkeep, vdstB), _mm_andnot_si128(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm_sub_epi32(v255, vsrcA);
+                vdstR = _mm_add_epi32(vsrcR, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm_add_epi32(vsrcG, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm_add_epi32(vsrcB, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm_min_epi16(_mm_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm_min_epi16(_mm_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm_min_epi16(_mm_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_or_si128(vdstR, _mm_slli_epi32(vdstG, 8)), _mm_slli_epi32(vdstB, 16)));
+            src += 4;
+            dst += 4;
+            n -= 4;
         }
         while (n--) {
-            if (posx >= 0x10000L) {
-                while (posx >= 0x10000L) {
-                    ++srcx;
-                    posx -= 0x10000L;
+            srcpixel = *src;
+            srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel; srcA = 0xFF;
+            dstpixel = *dst;
+            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
                 }
-                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
             }
-            pixel = *src;
-            R = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); B = (Uint8)(pixel >> 8); A = (Uint8)pixel;
-            pixel = ((Uint32)R << 16) | ((Uint32)G << 8) | B;
-            *dst = pixel;
-            posx += incx;
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
+            *dst = dstpixel;
+            ++src;
             ++dst;
         }
-        posy += incy;
+        info->src += info->src_pitch;
         info->dst += info->dst_pitch;
     }
 }
+#endif /* defined(__SSE2__) */
 
-static void SDL_Blit_RGBA8888_RGB888_Blend(SDL_BlitInfo *info)
+static void SDL_Blit_BGR888_BGR888_Modulate_Blend(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
     Uint32 srcpixel;
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
-    Uint32 dstR, dstG, dstB, dstA;
+    Uint32 dstR, dstG, dstB;
 
     while (info->dst_h--) {
         Uint32 *src = (Uint32 *)info->src;
@@ -4004,9 +5072,17 @@ static void SDL_Blit_RGBA8888_RGB888_Blend(SDL_BlitInfo *info)
         int n = info->dst_w;
         while (n--) {
             srcpixel = *src;
-            srcR = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcB = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel; srcA = 0xFF;
             dstpixel = *dst;
-            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel; dstA = 0xFF;
+            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -4039,7 +5115,7 @@ static void SDL_Blit_RGBA8888_RGB888_Blend(SDL_BlitInfo *info)
                 dstB = (srcB * dstB) / 255;
                 break;
             }
-            dstpixel = ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
             *dst = dstpixel;
             ++src;
             ++dst;
@@ -4049,13 +5125,17 @@ static void SDL_Blit_RGBA8888_RGB888_Blend(SDL_BlitInfo *info)
     }
 }
 
-static void SDL_Blit_RGBA8888_RGB888_Blend_Scale(SDL_BlitInfo *info)
+static void SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
     Uint32 srcpixel;
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
-    Uint32 dstR, dstG, dstB, dstA;
+    Uint32 dstR, dstG, dstB;
     int srcy, srcx;
     int posy, posx;
     int incy, incx;
@@ -4084,9 +5164,17 @@ static void SDL_Blit_RGBA8888_RGB888_Blend_Scale(SDL_BlitInfo *info)
                 src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
             }
             srcpixel = *src;
-            srcR = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcB = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel; srcA = 0xFF;
             dstpixel = *dst;
-            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel; dstA = 0xFF;
+            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -4119,7 +5207,7 @@ static void SDL_Blit_RGBA8888_RGB888_Blend_Scale(SDL_BlitInfo *info)
                 dstB = (srcB * dstB) / 255;
                 break;
             }
-            dstpixel = ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
             *dst = dstpixel;
             posx += incx;
             ++dst;
@@ -4129,88 +5217,41 @@ static void SDL_Blit_RGBA8888_RGB888_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
-static void SDL_Blit_RGBA8888_RGB888_Modulate(SDL_BlitInfo *info)
+static void SDL_Blit_BGR888_ARGB8888_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
-    const Uint32 modulateR = info->r;
-    const Uint32 modulateG = info->g;
-    const Uint32 modulateB = info->b;
-    const Uint32 modulateA = info->a;
     Uint32 pixel;
     Uint32 R, G, B, A;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
 
     while (info->dst_h--) {
-        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
         while (n--) {
+            if (posx >= 0x10000L) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            }
             pixel = *src;
-            R = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); B = (Uint8)(pixel >> 8); A = (Uint8)pixel;
-            if (flags & SDL_COPY_MODULATE_COLOR) {
-                R = (R * modulateR) / 255;
-                G = (G * modulateG) / 255;
-                B = (B * modulateB) / 255;
-            }
-            if (flags & SDL_COPY_MODULATE_ALPHA) {
-                A = (A * modulateA) / 255;
-            }
-            pixel = ((Uint32)R << 16) | ((Uint32)G << 8) | B;
-            *dst = pixel;
-            ++src;
-            ++dst;
-        }
-        info->src += info->src_pitch;
-        info->dst += info->dst_pitch;
-    }
-}
-
-static void SDL_Blit_RGBA8888_RGB888_Modulate_Scale(SDL_BlitInfo *info)
-{
-    const int flags = info->flags;
-    const Uint32 modulateR = info->r;
-    const Uint32 modulateG = info->g;
-    const Uint32 modulateB = info->b;
-    const Uint32 modulateA = info->a;
-    Uint32 pixel;
-    Uint32 R, G, B, A;
-    int srcy, srcx;
-    int posy, posx;
-    int incy, incx;
-
-    srcy = 0;
-    posy = 0;
-    incy = (info->src_h << 16) / info->dst_h;
-    incx = (info->src_w << 16) / info->dst_w;
-
-    while (info->dst_h--) {
-        Uint32 *src;
-        Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        srcx = -1;
-        posx = 0x10000L;
-        while (posy >= 0x10000L) {
-            ++srcy;
-            posy -= 0x10000L;
-        }
-        while (n--) {
-            if (posx >= 0x10000L) {
-                while (posx >= 0x10000L) {
-                    ++srcx;
-                    posx -= 0x10000L;
-                }
-                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
-            }
-            pixel = *src;
-            R = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); B = (Uint8)(pixel >> 8); A = (Uint8)pixel;
-            if (flags & SDL_COPY_MODULATE_COLOR) {
-                R = (R * modulateR) / 255;
-                G = (G * modulateG) / 255;
-                B = (B * modulateB) / 255;
-            }
-            if (flags & SDL_COPY_MODULATE_ALPHA) {
-                A = (A * modulateA) / 255;
-            }
-            pixel = ((Uint32)R << 16) | ((Uint32)G << 8) | B;
+            B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel; A = 0xFF;
+            pixel = ((Uint32)A << 24) | ((Uint32)R << 16) | ((Uint32)G << 8) | B;
             *dst = pixel;
             posx += incx;
             ++dst;
@@ -4220,13 +5261,16 @@ static void SDL_Blit_RGBA8888_RGB888_Modulate_Scale(SDL_BlitInfo *info)
     }
 }
 
-static void SDL_Blit_RGBA8888_RGB888_Modulate_Blend(SDL_BlitInfo *info)
+#if SDL_AVX2_BLITTERS
+static void SDL_TARGETING_AVX2 SDL_Blit_BGR888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
-    const Uint32 modulateR = info->r;
-    const Uint32 modulateG = info->g;
-    const Uint32 modulateB = info->b;
-    const Uint32 modulateA = info->a;
+    const __m256i v255 = _mm256_set1_epi32(0xFF);
+    const __m256i vdiv = _mm256_set1_epi32(0x8081);
+    const __m256i vzero = _mm256_setzero_si256();
+    __m256i vkeep, vinvA;
+    __m256i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m256i vdstpixel, vdstR, vdstG, vdstB, vdstA;
     Uint32 srcpixel;
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
@@ -4236,19 +5280,56 @@ static void SDL_Blit_RGBA8888_RGB888_Modulate_Blend(SDL_BlitInfo *info)
         Uint32 *src = (Uint32 *)info->src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
+        while (n >= 8) {
+            vsrcpixel = _mm256_loadu_si256((__m256i *)src);
+            vsrcR = _mm256_and_si256(vsrcpixel, v255);
+            vsrcG = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 8), v255);
+            vsrcB = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 16), v255);
+            vsrcA = v255;
+            vdstpixel = _mm256_loadu_si256((__m256i *)dst);
+            vdstR = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 16), v255);
+            vdstG = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm256_and_si256(vdstpixel, v255);
+            vdstA = _mm256_srli_epi32(vdstpixel, 24);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm256_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm256_or_si256(_mm256_and_si256(vkeep, vdstR), _mm256_andnot_si256(vkeep, vsrcR));
+                vdstG = _mm256_or_si256(_mm256_and_si256(vkeep, vdstG), _mm256_andnot_si256(vkeep, vsrcG));
+                vdstB = _mm256_or_si256(_mm256_and_si256(vkeep, vdstB), _mm256_andnot_si256(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm256_sub_epi32(v255, vsrcA);
+                vdstR = _mm256_add_epi32(vsrcR, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm256_add_epi32(vsrcG, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm256_add_epi32(vsrcB, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm256_min_epi16(_mm256_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm256_min_epi16(_mm256_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm256_min_epi16(_mm256_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(vdstR, 16), _mm256_slli_epi32(vdstG, 8)), vdstB), _mm256_slli_epi32(vdstA, 24)));
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
         while (n--) {
             srcpixel = *src;
-            srcR = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcB = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel; srcA = 0xFF;
             dstpixel = *dst;
-            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel; dstA = 0xFF;
-            if (flags & SDL_COPY_MODULATE_COLOR) {
-                srcR = (srcR * modulateR) / 255;
-                srcG = (srcG * modulateG) / 255;
-                srcB = (srcB * modulateB) / 255;
-            }
-            if (flags & SDL_COPY_MODULATE_ALPHA) {
-                srcA = (srcA * modulateA) / 255;
-            }
+            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -4281,7 +5362,7 @@ static void SDL_Blit_RGBA8888_RGB888_Modulate_Blend(SDL_BlitInfo *info)
                 dstB = (srcB * dstB) / 255;
                 break;
             }
-            dstpixel = ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
             *dst = dstpixel;
             ++src;
             ++dst;
@@ -4290,57 +5371,77 @@ static void SDL_Blit_RGBA8888_RGB888_Modulate_Blend(SDL_BlitInfo *info)
         info->dst += info->dst_pitch;
     }
 }
+#endif /* SDL_AVX2_BLITTERS */
 
-static void SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
+#if defined(__SSE2__)
+static void SDL_Blit_BGR888_ARGB8888_Blend_SSE2(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
-    const Uint32 modulateR = info->r;
-    const Uint32 modulateG = info->g;
-    const Uint32 modulateB = info->b;
-    const Uint32 modulateA = info->a;
+    const __m128i v255 = _mm_set1_epi32(0xFF);
+    const __m128i vdiv = _mm_set1_epi32(0x8081);
+    const __m128i vzero = _mm_setzero_si128();
+    __m128i vkeep, vinvA;
+    __m128i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m128i vdstpixel, vdstR, vdstG, vdstB, vdstA;
     Uint32 srcpixel;
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB, dstA;
-    int srcy, srcx;
-    int posy, posx;
-    int incy, incx;
-
-    srcy = 0;
-    posy = 0;
-    incy = (info->src_h << 16) / info->dst_h;
-    incx = (info->src_w << 16) / info->dst_w;
 
     while (info->dst_h--) {
-        Uint32 *src;
+        Uint32 *src = (Uint32 *)info->src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
-        srcx = -1;
-        posx = 0x10000L;
-        while (posy >= 0x10000L) {
-            ++srcy;
-            posy -= 0x10000L;
+        while (n >= 4) {
+            vsrcpixel = _mm_loadu_si128((__m128i *)src);
+            vsrcR = _mm_and_si128(vsrcpixel, v255);
+            vsrcG = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 8), v255);
+            vsrcB = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 16), v255);
+            vsrcA = v255;
+            vdstpixel = _mm_loadu_si128((__m128i *)dst);
+            vdstR = _mm_and_si128(_mm_srli_epi32(vdstpixel, 16), v255);
+            vdstG = _mm_and_si128(_mm_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm_and_si128(vdstpixel, v255);
+            vdstA = _mm_srli_epi32(vdstpixel, 24);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm_or_si128(_mm_and_si128(vkeep, vdstR), _mm_andnot_si128(vkeep, vsrcR));
+                vdstG = _mm_or_si128(_mm_and_si128(vkeep, vdstG), _mm_andnot_si128(vkeep, vsrcG));
+                vdstB = _mm_or_si128(_mm_and_si128(vkeep, vdstB), _mm_andnot_si128(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm_sub_epi32(v255, vsrcA);
+                vdstR = _mm_add_epi32(vsrcR, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm_add_epi32(vsrcG, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm_add_epi32(vsrcB, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm_min_epi16(_mm_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm_min_epi16(_mm_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm_min_epi16(_mm_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(vdstR, 16), _mm_slli_epi32(vdstG, 8)), vdstB), _mm_slli_epi32(vdstA, 24)));
+            src += 4;
+            dst += 4;
+            n -= 4;
         }
         while (n--) {
-            if (posx >= 0x10000L) {
-                while (posx >= 0x10000L) {
-                    ++srcx;
-                    posx -= 0x10000L;
-                }
-                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
-            }
             srcpixel = *src;
-            srcR = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcB = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel; srcA = 0xFF;
             dstpixel = *dst;
-            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel; dstA = 0xFF;
-            if (flags & SDL_COPY_MODULATE_COLOR) {
-                srcR = (srcR * modulateR) / 255;
-                srcG = (srcG * modulateG) / 255;
-                srcB = (srcB * modulateB) / 255;
-            }
-            if (flags & SDL_COPY_MODULATE_ALPHA) {
-                srcA = (srcA * modulateA) / 255;
-            }
+            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -4373,61 +5474,18 @@ static void SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
                 dstB = (srcB * dstB) / 255;
                 break;
             }
-            dstpixel = ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
             *dst = dstpixel;
-            posx += incx;
-            ++dst;
-        }
-        posy += incy;
-        info->dst += info->dst_pitch;
-    }
-}
-
-static void SDL_Blit_RGBA8888_BGR888_Scale(SDL_BlitInfo *info)
-{
-    const int flags = info->flags;
-    Uint32 pixel;
-    Uint32 R, G, B, A;
-    int srcy, srcx;
-    int posy, posx;
-    int incy, incx;
-
-    srcy = 0;
-    posy = 0;
-    incy = (info->src_h << 16) / info->dst_h;
-    incx = (info->src_w << 16) / info->dst_w;
-
-    while (info->dst_h--) {
-        Uint32 *src;
-        Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        srcx = -1;
-        posx = 0x10000L;
-        while (posy >= 0x10000L) {
-            ++srcy;
-            posy -= 0x10000L;
-        }
-        while (n--) {
-            if (posx >= 0x10000L) {
-                while (posx >= 0x10000L) {
-                    ++srcx;
-                    posx -= 0x10000L;
-                }
-                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
-            }
-            pixel = *src;
-            R = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); B = (Uint8)(pixel >> 8); A = (Uint8)pixel;
-            pixel = ((Uint32)B << 16) | ((Uint32)G << 8) | R;
-            *dst = pixel;
-            posx += incx;
+            ++src;
             ++dst;
         }
-        posy += incy;
+        info->src += info->src_pitch;
         info->dst += info->dst_pitch;
     }
 }
+#endif /* defined(__SSE2__) */
 
-static void SDL_Blit_RGBA8888_BGR888_Blend(SDL_BlitInfo *info)
+static void SDL_Blit_BGR888_ARGB8888_Blend(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
     Uint32 srcpixel;
@@ -4441,9 +5499,9 @@ static void SDL_Blit_RGBA8888_BGR888_Blend(SDL_BlitInfo *info)
         int n = info->dst_w;
         while (n--) {
             srcpixel = *src;
-            srcR = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcB = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel; srcA = 0xFF;
             dstpixel = *dst;
-            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel; dstA = 0xFF;
+            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -4476,7 +5534,7 @@ static void SDL_Blit_RGBA8888_BGR888_Blend(SDL_BlitInfo *info)
                 dstB = (srcB * dstB) / 255;
                 break;
             }
-            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
+            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
             *dst = dstpixel;
             ++src;
             ++dst;
@@ -4486,7 +5544,7 @@ static void SDL_Blit_RGBA8888_BGR888_Blend(SDL_BlitInfo *info)
     }
 }
 
-static void SDL_Blit_RGBA8888_BGR888_Blend_Scale(SDL_BlitInfo *info)
+static void SDL_Blit_BGR888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
     Uint32 srcpixel;
@@ -4521,9 +5579,9 @@ static void SDL_Blit_RGBA8888_BGR888_Blend_Scale(SDL_BlitInfo *info)
                 src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
             }
             srcpixel = *src;
-            srcR = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcB = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel; srcA = 0xFF;
             dstpixel = *dst;
-            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel; dstA = 0xFF;
+            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -4556,7 +5614,7 @@ static void SDL_Blit_RGBA8888_BGR888_Blend_Scale(SDL_BlitInfo *info)
                 dstB = (srcB * dstB) / 255;
                 break;
             }
-            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
+            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
             *dst = dstpixel;
             posx += incx;
             ++dst;
@@ -4566,13 +5624,21 @@ static void SDL_Blit_RGBA8888_BGR888_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
-static void SDL_Blit_RGBA8888_BGR888_Modulate(SDL_BlitInfo *info)
+#if SDL_AVX2_BLITTERS
+static void SDL_TARGETING_AVX2 SDL_Blit_BGR888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
     const Uint32 modulateR = info->r;
     const Uint32 modulateG = info->g;
     const Uint32 modulateB = info->b;
     const Uint32 modulateA = info->a;
+    const __m256i vmodulateR = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m256i vmodulateG = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m256i vmodulateB = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m256i vmodulateA = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m256i v255 = _mm256_set1_epi32(0xFF);
+    const __m256i vdiv = _mm256_set1_epi32(0x8081);
+    __m256i vpixel, vR, vG, vB, vA;
     Uint32 pixel;
     Uint32 R, G, B, A;
 
@@ -4580,9 +5646,24 @@ static void SDL_Blit_RGBA8888_BGR888_Modulate(SDL_BlitInfo *info)
         Uint32 *src = (Uint32 *)info->src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
+        while (n >= 8) {
+            vpixel = _mm256_loadu_si256((__m256i *)src);
+            vR = _mm256_and_si256(vpixel, v255);
+            vG = _mm256_and_si256(_mm256_srli_epi32(vpixel, 8), v255);
+            vB = _mm256_and_si256(_mm256_srli_epi32(vpixel, 16), v255);
+            vA = v255;
+            vR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vR, vmodulateR), vdiv), 7);
+            vG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vG, vmodulateG), vdiv), 7);
+            vB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vB, vmodulateB), vdiv), 7);
+            vA = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vA, vmodulateA), vdiv), 7);
+            _mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(vR, 16), _mm256_slli_epi32(vG, 8)), vB), _mm256_slli_epi32(vA, 24)));
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
         while (n--) {
             pixel = *src;
-            R = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); B = (Uint8)(pixel >> 8); A = (Uint8)pixel;
+            B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel; A = 0xFF;
             if (flags & SDL_COPY_MODULATE_COLOR) {
                 R = (R * modulateR) / 255;
                 G = (G * modulateG) / 255;
@@ -4591,7 +5672,7 @@ static void SDL_Blit_RGBA8888_BGR888_Modulate(SDL_BlitInfo *info)
             if (flags & SDL_COPY_MODULATE_ALPHA) {
                 A = (A * modulateA) / 255;
             }
-            pixel = ((Uint32)B << 16) | ((Uint32)G << 8) | R;
+            pixel = ((Uint32)A << 24) | ((Uint32)R << 16) | ((Uint32)G << 8) | B;
             *dst = pixel;
             ++src;
             ++dst;
@@ -4600,45 +5681,48 @@ static void SDL_Blit_RGBA8888_BGR888_Modulate(SDL_BlitInfo *info)
         info->dst += info->dst_pitch;
     }
 }
+#endif /* SDL_AVX2_BLITTERS */
 
-static void SDL_Blit_RGBA8888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
+#if defined(__SSE2__)
+static void SDL_Blit_BGR888_ARGB8888_Modulate_SSE2(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
     const Uint32 modulateR = info->r;
     const Uint32 modulateG = info->g;
     const Uint32 modulateB = info->b;
     const Uint32 modulateA = info->a;
+    const __m128i vmodulateR = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m128i vmodulateG = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m128i vmodulateB = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m128i vmodulateA = _mm_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m128i v255 = _mm_set1_epi32(0xFF);
+    const __m128i vdiv = _mm_set1_epi32(0x8081);
+    __m128i vpixel, vR, vG, vB, vA;
     Uint32 pixel;
     Uint32 R, G, B, A;
-    int srcy, srcx;
-    int posy, posx;
-    int incy, incx;
-
-    srcy = 0;
-    posy = 0;
-    incy = (info->src_h << 16) / info->dst_h;
-    incx = (info->src_w << 16) / info->dst_w;
 
     while (info->dst_h--) {
-        Uint32 *src;
+        Uint32 *src = (Uint32 *)info->src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
-        srcx = -1;
-        posx = 0x10000L;
-        while (posy >= 0x10000L) {
-            ++srcy;
-            posy -= 0x10000L;
+        while (n >= 4) {
+            vpixel = _mm_loadu_si128((__m128i *)src);
+            vR = _mm_and_si128(vpixel, v255);
+            vG = _mm_and_si128(_mm_srli_epi32(vpixel, 8), v255);
+            vB = _mm_and_si128(_mm_srli_epi32(vpixel, 16), v255);
+            vA = v255;
+            vR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vR, vmodulateR), vdiv), 7);
+            vG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vG, vmodulateG), vdiv), 7);
+            vB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vB, vmodulateB), vdiv), 7);
+            vA = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vA, vmodulateA), vdiv), 7);
+            _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(vR, 16), _mm_slli_epi32(vG, 8)), vB), _mm_slli_epi32(vA, 24)));
+            src += 4;
+            dst += 4;
+            n -= 4;
         }
         while (n--) {
-            if (posx >= 0x10000L) {
-                while (posx >= 0x10000L) {
-                    ++srcx;
-                    posx -= 0x10000L;
-                }
-                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
-            }
             pixel = *src;
-            R = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); B = (Uint8)(pixel >> 8); A = (Uint8)pixel;
+            B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel; A = 0xFF;
             if (flags & SDL_COPY_MODULATE_COLOR) {
                 R = (R * modulateR) / 255;
                 G = (G * modulateG) / 255;
@@ -4647,37 +5731,189 @@ static void SDL_Blit_RGBA8888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
             if (flags & SDL_COPY_MODULATE_ALPHA) {
                 A = (A * modulateA) / 255;
             }
-            pixel = ((Uint32)B << 16) | ((Uint32)G << 8) | R;
+            pixel = ((Uint32)A << 24) | ((Uint32)R << 16) | ((Uint32)G << 8) | B;
             *dst = pixel;
-            posx += incx;
+            ++src;
             ++dst;
         }
-        posy += incy;
+        info->src += info->src_pitch;
         info->dst += info->dst_pitch;
     }
 }
+#endif /* defined(__SSE2__) */
 
-static void SDL_Blit_RGBA8888_BGR888_Modulate_Blend(SDL_BlitInfo *info)
+static void SDL_Blit_BGR888_ARGB8888_Modulate(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
     const Uint32 modulateR = info->r;
     const Uint32 modulateG = info->g;
     const Uint32 modulateB = info->b;
     const Uint32 modulateA = info->a;
-    Uint32 srcpixel;
-    Uint32 srcR, srcG, srcB, srcA;
-    Uint32 dstpixel;
-    Uint32 dstR, dstG, dstB, dstA;
-
+    Uint32 pixel;
+    Uint32 R, G, B, A;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n--) {
+            pixel = *src;
+            B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel; A = 0xFF;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = (R * modulateR) / 255;
+                G = (G * modulateG) / 255;
+                B = (B * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = (A * modulateA) / 255;
+            }
+            pixel = ((Uint32)A << 24) | ((Uint32)R << 16) | ((Uint32)G << 8) | B;
+            *dst = pixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        Uint32 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        while (n--) {
+            if (posx >= 0x10000L) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            }
+            pixel = *src;
+            B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel; A = 0xFF;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = (R * modulateR) / 255;
+                G = (G * modulateG) / 255;
+                B = (B * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = (A * modulateA) / 255;
+            }
+            pixel = ((Uint32)A << 24) | ((Uint32)R << 16) | ((Uint32)G << 8) | B;
+            *dst = pixel;
+            posx += incx;
+            ++dst;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+#if SDL_AVX2_BLITTERS
+static void SDL_TARGETING_AVX2 SDL_Blit_BGR888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    const __m256i vmodulateR = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m256i vmodulateG = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m256i vmodulateB = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m256i vmodulateA = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m256i v255 = _mm256_set1_epi32(0xFF);
+    const __m256i vdiv = _mm256_set1_epi32(0x8081);
+    const __m256i vzero = _mm256_setzero_si256();
+    __m256i vkeep, vinvA;
+    __m256i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m256i vdstpixel, vdstR, vdstG, vdstB, vdstA;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB, dstA;
+
     while (info->dst_h--) {
         Uint32 *src = (Uint32 *)info->src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
+        while (n >= 8) {
+            vsrcpixel = _mm256_loadu_si256((__m256i *)src);
+            vsrcR = _mm256_and_si256(vsrcpixel, v255);
+            vsrcG = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 8), v255);
+            vsrcB = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 16), v255);
+            vsrcA = v255;
+            vdstpixel = _mm256_loadu_si256((__m256i *)dst);
+            vdstR = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 16), v255);
+            vdstG = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm256_and_si256(vdstpixel, v255);
+            vdstA = _mm256_srli_epi32(vdstpixel, 24);
+            vsrcR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vmodulateR), vdiv), 7);
+            vsrcG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vmodulateG), vdiv), 7);
+            vsrcB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vmodulateB), vdiv), 7);
+            vsrcA = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcA, vmodulateA), vdiv), 7);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm256_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm256_or_si256(_mm256_and_si256(vkeep, vdstR), _mm256_andnot_si256(vkeep, vsrcR));
+                vdstG = _mm256_or_si256(_mm256_and_si256(vkeep, vdstG), _mm256_andnot_si256(vkeep, vsrcG));
+                vdstB = _mm256_or_si256(_mm256_and_si256(vkeep, vdstB), _mm256_andnot_si256(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm256_sub_epi32(v255, vsrcA);
+                vdstR = _mm256_add_epi32(vsrcR, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm256_add_epi32(vsrcG, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm256_add_epi32(vsrcB, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm256_min_epi16(_mm256_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm256_min_epi16(_mm256_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm256_min_epi16(_mm256_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(vdstR, 16), _mm256_slli_epi32(vdstG, 8)), vdstB), _mm256_slli_epi32(vdstA, 24)));
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
         while (n--) {
             srcpixel = *src;
-            srcR = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcB = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel; srcA = 0xFF;
             dstpixel = *dst;
-            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel; dstA = 0xFF;
+            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
             if (flags & SDL_COPY_MODULATE_COLOR) {
                 srcR = (srcR * modulateR) / 255;
                 srcG = (srcG * modulateG) / 255;
@@ -4718,7 +5954,7 @@ static void SDL_Blit_RGBA8888_BGR888_Modulate_Blend(SDL_BlitInfo *info)
                 dstB = (srcB * dstB) / 255;
                 break;
             }
-            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
+            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
             *dst = dstpixel;
             ++src;
             ++dst;
@@ -4727,49 +5963,89 @@ static void SDL_Blit_RGBA8888_BGR888_Modulate_Blend(SDL_BlitInfo *info)
         info->dst += info->dst_pitch;
     }
 }
+#endif /* SDL_AVX2_BLITTERS */
 
-static void SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
+#if defined(__SSE2__)
+static void SDL_Blit_BGR888_ARGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
     const Uint32 modulateR = info->r;
     const Uint32 modulateG = info->g;
     const Uint32 modulateB = info->b;
     const Uint32 modulateA = info->a;
+    const __m128i vmodulateR = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m128i vmodulateG = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m128i vmodulateB = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m128i vmodulateA = _mm_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m128i v255 = _mm_set1_epi32(0xFF);
+    const __m128i vdiv = _mm_set1_epi32(0x8081);
+    const __m128i vzero = _mm_setzero_si128();
+    __m128i vkeep, vinvA;
+    __m128i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m128i vdstpixel, vdstR, vdstG, vdstB, vdstA;
     Uint32 srcpixel;
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB, dstA;
-    int srcy, srcx;
-    int posy, posx;
-    int incy, incx;
-
-    srcy = 0;
-    posy = 0;
-    incy = (info->src_h << 16) / info->dst_h;
-    incx = (info->src_w << 16) / info->dst_w;
 
     while (info->dst_h--) {
-        Uint32 *src;
+        Uint32 *src = (Uint32 *)info->src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
-        srcx = -1;
-        posx = 0x10000L;
-        while (posy >= 0x10000L) {
-            ++srcy;
-            posy -= 0x10000L;
+        while (n >= 4) {
+            vsrcpixel = _mm_loadu_si128((__m128i *)src);
+            vsrcR = _mm_and_si128(vsrcpixel, v255);
+            vsrcG = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 8), v255);
+            vsrcB = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 16), v255);
+            vsrcA = v255;
+            vdstpixel = _mm_loadu_si128((__m128i *)dst);
+            vdstR = _mm_and_si128(_mm_srli_epi32(vdstpixel, 16), v255);
+            vdstG = _mm_and_si128(_mm_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm_and_si128(vdstpixel, v255);
+            vdstA = _mm_srli_epi32(vdstpixel, 24);
+            vsrcR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vmodulateR), vdiv), 7);
+            vsrcG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vmodulateG), vdiv), 7);
+            vsrcB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vmodulateB), vdiv), 7);
+            vsrcA = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcA, vmodulateA), vdiv), 7);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm_or_si128(_mm_and_si128(vkeep, vdstR), _mm_andnot_si128(vkeep, vsrcR));
+                vdstG = _mm_or_si128(_mm_and_si128(vkeep, vdstG), _mm_andnot_si128(vkeep, vsrcG));
+                vdstB = _mm_or_si128(_mm_and_si128(vkeep, vdstB), _mm_andnot_si128(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm_sub_epi32(v255, vsrcA);
+                vdstR = _mm_add_epi32(vsrcR, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm_add_epi32(vsrcG, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm_add_epi32(vsrcB, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm_min_epi16(_mm_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm_min_epi16(_mm_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm_min_epi16(_mm_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(vdstR, 16), _mm_slli_epi32(vdstG, 8)), vdstB), _mm_slli_epi32(vdstA, 24)));
+            src += 4;
+            dst += 4;
+            n -= 4;
         }
         while (n--) {
-            if (posx >= 0x10000L) {
-                while (posx >= 0x10000L) {
-                    ++srcx;
-                    posx -= 0x10000L;
-                }
-                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
-            }
             srcpixel = *src;
-            srcR = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcB = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel; srcA = 0xFF;
             dstpixel = *dst;
-            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel; dstA = 0xFF;
+            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
             if (flags & SDL_COPY_MODULATE_COLOR) {
                 srcR = (srcR * modulateR) / 255;
                 srcG = (srcG * modulateG) / 255;
@@ -4810,63 +6086,24 @@ static void SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
                 dstB = (srcB * dstB) / 255;
                 break;
             }
-            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
+            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
             *dst = dstpixel;
-            posx += incx;
-            ++dst;
-        }
-        posy += incy;
-        info->dst += info->dst_pitch;
-    }
-}
-
-static void SDL_Blit_RGBA8888_ARGB8888_Scale(SDL_BlitInfo *info)
-{
-    const int flags = info->flags;
-    Uint32 pixel;
-    Uint32 R, G, B, A;
-    int srcy, srcx;
-    int posy, posx;
-    int incy, incx;
-
-    srcy = 0;
-    posy = 0;
-    incy = (info->src_h << 16) / info->dst_h;
-    incx = (info->src_w << 16) / info->dst_w;
-
-    while (info->dst_h--) {
-        Uint32 *src;
-        Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        srcx = -1;
-        posx = 0x10000L;
-        while (posy >= 0x10000L) {
-            ++srcy;
-            posy -= 0x10000L;
-        }
-        while (n--) {
-            if (posx >= 0x10000L) {
-                while (posx >= 0x10000L) {
-                    ++srcx;
-                    posx -= 0x10000L;
-                }
-                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
-            }
-            pixel = *src;
-            R = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); B = (Uint8)(pixel >> 8); A = (Uint8)pixel;
-            pixel = ((Uint32)A << 24) | ((Uint32)R << 16) | ((Uint32)G << 8) | B;
-            *dst = pixel;
-            posx += incx;
+            ++src;
             ++dst;
         }
-        posy += incy;
+        info->src += info->src_pitch;
         info->dst += info->dst_pitch;
     }
 }
+#endif /* defined(__SSE2__) */
 
-static void SDL_Blit_RGBA8888_ARGB8888_Blend(SDL_BlitInfo *info)
+static void SDL_Blit_BGR888_ARGB8888_Modulate_Blend(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
     Uint32 srcpixel;
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
@@ -4878,9 +6115,17 @@ static void SDL_Blit_RGBA8888_ARGB8888_Blend(SDL_BlitInfo *info)
         int n = info->dst_w;
         while (n--) {
             srcpixel = *src;
-            srcR = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcB = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel; srcA = 0xFF;
             dstpixel = *dst;
             dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -4923,9 +6168,13 @@ static void SDL_Blit_RGBA8888_ARGB8888_Blend(SDL_BlitInfo *info)
     }
 }
 
-static void SDL_Blit_RGBA8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
+static void SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
     Uint32 srcpixel;
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
@@ -4958,9 +6207,17 @@ static void SDL_Blit_RGBA8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
                 src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
             }
             srcpixel = *src;
-            srcR = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcB = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel; srcA = 0xFF;
             dstpixel = *dst;
             dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -5003,69 +6260,30 @@ static void SDL_Blit_RGBA8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
-static void SDL_Blit_RGBA8888_ARGB8888_Modulate(SDL_BlitInfo *info)
+static void SDL_Blit_ARGB8888_RGB888_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
-    const Uint32 modulateR = info->r;
-    const Uint32 modulateG = info->g;
-    const Uint32 modulateB = info->b;
-    const Uint32 modulateA = info->a;
     Uint32 pixel;
     Uint32 R, G, B, A;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
 
     while (info->dst_h--) {
-        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
-        while (n--) {
-            pixel = *src;
-            R = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); B = (Uint8)(pixel >> 8); A = (Uint8)pixel;
-            if (flags & SDL_COPY_MODULATE_COLOR) {
-                R = (R * modulateR) / 255;
-                G = (G * modulateG) / 255;
-                B = (B * modulateB) / 255;
-            }
-            if (flags & SDL_COPY_MODULATE_ALPHA) {
-                A = (A * modulateA) / 255;
-            }
-            pixel = ((Uint32)A << 24) | ((Uint32)R << 16) | ((Uint32)G << 8) | B;
-            *dst = pixel;
-            ++src;
-            ++dst;
-        }
-        info->src += info->src_pitch;
-        info->dst += info->dst_pitch;
-    }
-}
-
-static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
-{
-    const int flags = info->flags;
-    const Uint32 modulateR = info->r;
-    const Uint32 modulateG = info->g;
-    const Uint32 modulateB = info->b;
-    const Uint32 modulateA = info->a;
-    Uint32 pixel;
-    Uint32 R, G, B, A;
-    int srcy, srcx;
-    int posy, posx;
-    int incy, incx;
-
-    srcy = 0;
-    posy = 0;
-    incy = (info->src_h << 16) / info->dst_h;
-    incx = (info->src_w << 16) / info->dst_w;
-
-    while (info->dst_h--) {
-        Uint32 *src;
-        Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        srcx = -1;
-        posx = 0x10000L;
-        while (posy >= 0x10000L) {
-            ++srcy;
-            posy -= 0x10000L;
-        }
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
         while (n--) {
             if (posx >= 0x10000L) {
                 while (posx >= 0x10000L) {
@@ -5075,16 +6293,8 @@ static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
                 src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
             }
             pixel = *src;
-            R = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); B = (Uint8)(pixel >> 8); A = (Uint8)pixel;
-            if (flags & SDL_COPY_MODULATE_COLOR) {
-                R = (R * modulateR) / 255;
-                G = (G * modulateG) / 255;
-                B = (B * modulateB) / 255;
-            }
-            if (flags & SDL_COPY_MODULATE_ALPHA) {
-                A = (A * modulateA) / 255;
-            }
-            pixel = ((Uint32)A << 24) | ((Uint32)R << 16) | ((Uint32)G << 8) | B;
+            A = (Uint8)(pixel >> 24); R = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); B = (Uint8)pixel;
+            pixel = ((Uint32)R << 16) | ((Uint32)G << 8) | B;
             *dst = pixel;
             posx += incx;
             ++dst;
@@ -5094,35 +6304,74 @@ static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
     }
 }
 
-static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend(SDL_BlitInfo *info)
+#if SDL_AVX2_BLITTERS
+static void SDL_TARGETING_AVX2 SDL_Blit_ARGB8888_RGB888_Blend_AVX2(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
-    const Uint32 modulateR = info->r;
-    const Uint32 modulateG = info->g;
-    const Uint32 modulateB = info->b;
-    const Uint32 modulateA = info->a;
+    const __m256i v255 = _mm256_set1_epi32(0xFF);
+    const __m256i vdiv = _mm256_set1_epi32(0x8081);
+    const __m256i vzero = _mm256_setzero_si256();
+    __m256i vkeep, vinvA;
+    __m256i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m256i vdstpixel, vdstR, vdstG, vdstB;
     Uint32 srcpixel;
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
-    Uint32 dstR, dstG, dstB, dstA;
+    Uint32 dstR, dstG, dstB;
 
     while (info->dst_h--) {
         Uint32 *src = (Uint32 *)info->src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
+        while (n >= 8) {
+            vsrcpixel = _mm256_loadu_si256((__m256i *)src);
+            vsrcR = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 16), v255);
+            vsrcG = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 8), v255);
+            vsrcB = _mm256_and_si256(vsrcpixel, v255);
+            vsrcA = _mm256_srli_epi32(vsrcpixel, 24);
+            vdstpixel = _mm256_loadu_si256((__m256i *)dst);
+            vdstR = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 16), v255);
+            vdstG = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm256_and_si256(vdstpixel, v255);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm256_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm256_or_si256(_mm256_and_si256(vkeep, vdstR), _mm256_andnot_si256(vkeep, vsrcR));
+                vdstG = _mm256_or_si256(_mm256_and_si256(vkeep, vdstG), _mm256_andnot_si256(vkeep, vsrcG));
+                vdstB = _mm256_or_si256(_mm256_and_si256(vkeep, vdstB), _mm256_andnot_si256(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm256_sub_epi32(v255, vsrcA);
+                vdstR = _mm256_add_epi32(vsrcR, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm256_add_epi32(vsrcG, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm256_add_epi32(vsrcB, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm256_min_epi16(_mm256_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm256_min_epi16(_mm256_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm256_min_epi16(_mm256_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(vdstR, 16), _mm256_slli_epi32(vdstG, 8)), vdstB));
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
         while (n--) {
             srcpixel = *src;
-            srcR = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcB = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            srcA = (Uint8)(srcpixel >> 24); srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel;
             dstpixel = *dst;
-            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
-            if (flags & SDL_COPY_MODULATE_COLOR) {
-                srcR = (srcR * modulateR) / 255;
-                srcG = (srcG * modulateG) / 255;
-                srcB = (srcB * modulateB) / 255;
-            }
-            if (flags & SDL_COPY_MODULATE_ALPHA) {
-                srcA = (srcA * modulateA) / 255;
-            }
+            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -5155,7 +6404,7 @@ static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend(SDL_BlitInfo *info)
                 dstB = (srcB * dstB) / 255;
                 break;
             }
-            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            dstpixel = ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
             *dst = dstpixel;
             ++src;
             ++dst;
@@ -5164,57 +6413,76 @@ static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend(SDL_BlitInfo *info)
         info->dst += info->dst_pitch;
     }
 }
+#endif /* SDL_AVX2_BLITTERS */
 
-static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
+#if defined(__SSE2__)
+static void SDL_Blit_ARGB8888_RGB888_Blend_SSE2(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
-    const Uint32 modulateR = info->r;
-    const Uint32 modulateG = info->g;
-    const Uint32 modulateB = info->b;
-    const Uint32 modulateA = info->a;
+    const __m128i v255 = _mm_set1_epi32(0xFF);
+    const __m128i vdiv = _mm_set1_epi32(0x8081);
+    const __m128i vzero = _mm_setzero_si128();
+    __m128i vkeep, vinvA;
+    __m128i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m128i vdstpixel, vdstR, vdstG, vdstB;
     Uint32 srcpixel;
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
-    Uint32 dstR, dstG, dstB, dstA;
-    int srcy, srcx;
-    int posy, posx;
-    int incy, incx;
-
-    srcy = 0;
-    posy = 0;
-    incy = (info->src_h << 16) / info->dst_h;
-    incx = (info->src_w << 16) / info->dst_w;
+    Uint32 dstR, dstG, dstB;
 
     while (info->dst_h--) {
-        Uint32 *src;
+        Uint32 *src = (Uint32 *)info->src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
-        srcx = -1;
-        posx = 0x10000L;
-        while (posy >= 0x10000L) {
-            ++srcy;
-            posy -= 0x10000L;
+        while (n >= 4) {
+            vsrcpixel = _mm_loadu_si128((__m128i *)src);
+            vsrcR = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 16), v255);
+            vsrcG = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 8), v255);
+            vsrcB = _mm_and_si128(vsrcpixel, v255);
+            vsrcA = _mm_srli_epi32(vsrcpixel, 24);
+            vdstpixel = _mm_loadu_si128((__m128i *)dst);
+            vdstR = _mm_and_si128(_mm_srli_epi32(vdstpixel, 16), v255);
+            vdstG = _mm_and_si128(_mm_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm_and_si128(vdstpixel, v255);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm_or_si128(_mm_and_si128(vkeep, vdstR), _mm_andnot_si128(vkeep, vsrcR));
+                vdstG = _mm_or_si128(_mm_and_si128(vkeep, vdstG), _mm_andnot_si128(vkeep, vsrcG));
+                vdstB = _mm_or_si128(_mm_and_si128(vkeep, vdstB), _mm_andnot_si128(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm_sub_epi32(v255, vsrcA);
+                vdstR = _mm_add_epi32(vsrcR, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm_add_epi32(vsrcG, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm_add_epi32(vsrcB, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm_min_epi16(_mm_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm_min_epi16(_mm_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm_min_epi16(_mm_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_or_si128(_mm_slli_epi32(vdstR, 16), _mm_slli_epi32(vdstG, 8)), vdstB));
+            src += 4;
+            dst += 4;
+            n -= 4;
         }
         while (n--) {
-            if (posx >= 0x10000L) {
-                while (posx >= 0x10000L) {
-                    ++srcx;
-                    posx -= 0x10000L;
-                }
-                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
-            }
             srcpixel = *src;
-            srcR = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcB = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            srcA = (Uint8)(srcpixel >> 24); srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel;
             dstpixel = *dst;
-            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
-            if (flags & SDL_COPY_MODULATE_COLOR) {
-                srcR = (srcR * modulateR) / 255;
-                srcG = (srcG * modulateG) / 255;
-                srcB = (srcB * modulateB) / 255;
-            }
-            if (flags & SDL_COPY_MODULATE_ALPHA) {
-                srcA = (srcA * modulateA) / 255;
-            }
+            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -5247,67 +6515,24 @@ static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
                 dstB = (srcB * dstB) / 255;
                 break;
             }
-            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            dstpixel = ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
             *dst = dstpixel;
-            posx += incx;
-            ++dst;
-        }
-        posy += incy;
-        info->dst += info->dst_pitch;
-    }
-}
-
-static void SDL_Blit_ABGR8888_RGB888_Scale(SDL_BlitInfo *info)
-{
-    const int flags = info->flags;
-    Uint32 pixel;
-    Uint32 R, G, B, A;
-    int srcy, srcx;
-    int posy, posx;
-    int incy, incx;
-
-    srcy = 0;
-    posy = 0;
-    incy = (info->src_h << 16) / info->dst_h;
-    incx = (info->src_w << 16) / info->dst_w;
-
-    while (info->dst_h--) {
-        Uint32 *src;
-        Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        srcx = -1;
-        posx = 0x10000L;
-        while (posy >= 0x10000L) {
-            ++srcy;
-            posy -= 0x10000L;
-        }
-        while (n--) {
-            if (posx >= 0x10000L) {
-                while (posx >= 0x10000L) {
-                    ++srcx;
-                    posx -= 0x10000L;
-                }
-                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
-            }
-            pixel = *src;
-            A = (Uint8)(pixel >> 24); B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel;
-            pixel = ((Uint32)R << 16) | ((Uint32)G << 8) | B;
-            *dst = pixel;
-            posx += incx;
+            ++src;
             ++dst;
         }
-        posy += incy;
+        info->src += info->src_pitch;
         info->dst += info->dst_pitch;
     }
 }
+#endif /* defined(__SSE2__) */
 
-static void SDL_Blit_ABGR8888_RGB888_Blend(SDL_BlitInfo *info)
+static void SDL_Blit_ARGB8888_RGB888_Blend(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
     Uint32 srcpixel;
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
-    Uint32 dstR, dstG, dstB, dstA;
+    Uint32 dstR, dstG, dstB;
 
     while (info->dst_h--) {
         Uint32 *src = (Uint32 *)info->src;
@@ -5315,9 +6540,9 @@ static void SDL_Blit_ABGR8888_RGB888_Blend(SDL_BlitInfo *info)
         int n = info->dst_w;
         while (n--) {
             srcpixel = *src;
-            srcA = (Uint8)(srcpixel >> 24); srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel;
+            srcA = (Uint8)(srcpixel >> 24); srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel;
             dstpixel = *dst;
-            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel; dstA = 0xFF;
+            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -5360,13 +6585,13 @@ static void SDL_Blit_ABGR8888_RGB888_Blend(SDL_BlitInfo *info)
     }
 }
 
-static void SDL_Blit_ABGR8888_RGB888_Blend_Scale(SDL_BlitInfo *info)
+static void SDL_Blit_ARGB8888_RGB888_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
     Uint32 srcpixel;
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
-    Uint32 dstR, dstG, dstB, dstA;
+    Uint32 dstR, dstG, dstB;
     int srcy, srcx;
     int posy, posx;
     int incy, incx;
@@ -5395,9 +6620,9 @@ static void SDL_Blit_ABGR8888_RGB888_Blend_Scale(SDL_BlitInfo *info)
                 src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
             }
             srcpixel = *src;
-            srcA = (Uint8)(srcpixel >> 24); srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel;
+            srcA = (Uint8)(srcpixel >> 24); srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel;
             dstpixel = *dst;
-            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel; dstA = 0xFF;
+            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -5440,13 +6665,21 @@ static void SDL_Blit_ABGR8888_RGB888_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
-static void SDL_Blit_ABGR8888_RGB888_Modulate(SDL_BlitInfo *info)
+#if SDL_AVX2_BLITTERS
+static void SDL_TARGETING_AVX2 SDL_Blit_ARGB8888_RGB888_Modulate_AVX2(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
     const Uint32 modulateR = info->r;
     const Uint32 modulateG = info->g;
     const Uint32 modulateB = info->b;
     const Uint32 modulateA = info->a;
+    const __m256i vmodulateR = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m256i vmodulateG = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m256i vmodulateB = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m256i vmodulateA = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m256i v255 = _mm256_set1_epi32(0xFF);
+    const __m256i vdiv = _mm256_set1_epi32(0x8081);
+    __m256i vpixel, vR, vG, vB, vA;
     Uint32 pixel;
     Uint32 R, G, B, A;
 
@@ -5454,9 +6687,24 @@ static void SDL_Blit_ABGR8888_RGB888_Modulate(SDL_BlitInfo *info)
         Uint32 *src = (Uint32 *)info->src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
+        while (n >= 8) {
+            vpixel = _mm256_loadu_si256((__m256i *)src);
+            vR = _mm256_and_si256(_mm256_srli_epi32(vpixel, 16), v255);
+            vG = _mm256_and_si256(_mm256_srli_epi32(vpixel, 8), v255);
+            vB = _mm256_and_si256(vpixel, v255);
+            vA = _mm256_srli_epi32(vpixel, 24);
+            vR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vR, vmodulateR), vdiv), 7);
+            vG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vG, vmodulateG), vdiv), 7);
+            vB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vB, vmodulateB), vdiv), 7);
+            vA = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vA, vmodulateA), vdiv), 7);
+            _mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(vR, 16), _mm256_slli_epi32(vG, 8)), vB));
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
         while (n--) {
             pixel = *src;
-            A = (Uint8)(pixel >> 24); B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel;
+            A = (Uint8)(pixel >> 24); R = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); B = (Uint8)pixel;
             if (flags & SDL_COPY_MODULATE_COLOR) {
                 R = (R * modulateR) / 255;
                 G = (G * modulateG) / 255;
@@ -5474,45 +6722,48 @@ static void SDL_Blit_ABGR8888_RGB888_Modulate(SDL_BlitInfo *info)
         info->dst += info->dst_pitch;
     }
 }
+#endif /* SDL_AVX2_BLITTERS */
 
-static void SDL_Blit_ABGR8888_RGB888_Modulate_Scale(SDL_BlitInfo *info)
+#if defined(__SSE2__)
+static void SDL_Blit_ARGB8888_RGB888_Modulate_SSE2(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
     const Uint32 modulateR = info->r;
     const Uint32 modulateG = info->g;
     const Uint32 modulateB = info->b;
     const Uint32 modulateA = info->a;
+    const __m128i vmodulateR = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m128i vmodulateG = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m128i vmodulateB = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m128i vmodulateA = _mm_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m128i v255 = _mm_set1_epi32(0xFF);
+    const __m128i vdiv = _mm_set1_epi32(0x8081);
+    __m128i vpixel, vR, vG, vB, vA;
     Uint32 pixel;
     Uint32 R, G, B, A;
-    int srcy, srcx;
-    int posy, posx;
-    int incy, incx;
-
-    srcy = 0;
-    posy = 0;
-    incy = (info->src_h << 16) / info->dst_h;
-    incx = (info->src_w << 16) / info->dst_w;
 
     while (info->dst_h--) {
-        Uint32 *src;
+        Uint32 *src = (Uint32 *)info->src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
-        srcx = -1;
-        posx = 0x10000L;
-        while (posy >= 0x10000L) {
-            ++srcy;
-            posy -= 0x10000L;
+        while (n >= 4) {
+            vpixel = _mm_loadu_si128((__m128i *)src);
+            vR = _mm_and_si128(_mm_srli_epi32(vpixel, 16), v255);
+            vG = _mm_and_si128(_mm_srli_epi32(vpixel, 8), v255);
+            vB = _mm_and_si128(vpixel, v255);
+            vA = _mm_srli_epi32(vpixel, 24);
+            vR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vR, vmodulateR), vdiv), 7);
+            vG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vG, vmodulateG), vdiv), 7);
+            vB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vB, vmodulateB), vdiv), 7);
+            vA = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vA, vmodulateA), vdiv), 7);
+            _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_or_si128(_mm_slli_epi32(vR, 16), _mm_slli_epi32(vG, 8)), vB));
+            src += 4;
+            dst += 4;
+            n -= 4;
         }
         while (n--) {
-            if (posx >= 0x10000L) {
-                while (posx >= 0x10000L) {
-                    ++srcx;
-                    posx -= 0x10000L;
-                }
-                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
-            }
             pixel = *src;
-            A = (Uint8)(pixel >> 24); B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel;
+            A = (Uint8)(pixel >> 24); R = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); B = (Uint8)pixel;
             if (flags & SDL_COPY_MODULATE_COLOR) {
                 R = (R * modulateR) / 255;
                 G = (G * modulateG) / 255;
@@ -5523,77 +6774,42 @@ static void SDL_Blit_ABGR8888_RGB888_Modulate_Scale(SDL_BlitInfo *info)
             }
             pixel = ((Uint32)R << 16) | ((Uint32)G << 8) | B;
             *dst = pixel;
-            posx += incx;
+            ++src;
             ++dst;
         }
-        posy += incy;
+        info->src += info->src_pitch;
         info->dst += info->dst_pitch;
     }
 }
+#endif /* defined(__SSE2__) */
 
-static void SDL_Blit_ABGR8888_RGB888_Modulate_Blend(SDL_BlitInfo *info)
+static void SDL_Blit_ARGB8888_RGB888_Modulate(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
     const Uint32 modulateR = info->r;
     const Uint32 modulateG = info->g;
     const Uint32 modulateB = info->b;
     const Uint32 modulateA = info->a;
-    Uint32 srcpixel;
-    Uint32 srcR, srcG, srcB, srcA;
-    Uint32 dstpixel;
-    Uint32 dstR, dstG, dstB, dstA;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
 
     while (info->dst_h--) {
         Uint32 *src = (Uint32 *)info->src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         while (n--) {
-            srcpixel = *src;
-            srcA = (Uint8)(srcpixel >> 24); srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel;
-            dstpixel = *dst;
-            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel; dstA = 0xFF;
+            pixel = *src;
+            A = (Uint8)(pixel >> 24); R = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); B = (Uint8)pixel;
             if (flags & SDL_COPY_MODULATE_COLOR) {
-                srcR = (srcR * modulateR) / 255;
-                srcG = (srcG * modulateG) / 255;
-                srcB = (srcB * modulateB) / 255;
+                R = (R * modulateR) / 255;
+                G = (G * modulateG) / 255;
+                B = (B * modulateB) / 255;
             }
             if (flags & SDL_COPY_MODULATE_ALPHA) {
-                srcA = (srcA * modulateA) / 255;
-            }
-            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
-                /* This goes away if we ever use premultiplied alpha */
-                if (srcA < 255) {
-                    srcR = (srcR * srcA) / 255;
-                    srcG = (srcG * srcA) / 255;
-                    srcB = (srcB * srcA) / 255;
-                }
-            }
-            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
-            case SDL_COPY_MASK:
-                if (srcA) {
-                    dstR = srcR;
-                    dstG = srcG;
-                    dstB = srcB;
-                }
-                break;
-            case SDL_COPY_BLEND:
-                dstR = srcR + ((255 - srcA) * dstR) / 255;
-                dstG = srcG + ((255 - srcA) * dstG) / 255;
-                dstB = srcB + ((255 - srcA) * dstB) / 255;
-                break;
-            case SDL_COPY_ADD:
-                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
-                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
-                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
-                break;
-            case SDL_COPY_MOD:
-                dstR = (srcR * dstR) / 255;
-                dstG = (srcG * dstG) / 255;
-                dstB = (srcB * dstB) / 255;
-                break;
+                A = (A * modulateA) / 255;
             }
-            dstpixel = ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
-            *dst = dstpixel;
+            pixel = ((Uint32)R << 16) | ((Uint32)G << 8) | B;
+            *dst = pixel;
             ++src;
             ++dst;
         }
@@ -5602,17 +6818,15 @@ static void SDL_Blit_ABGR8888_RGB888_Modulate_Blend(SDL_BlitInfo *info)
     }
 }
 
-static void SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
+static void SDL_Blit_ARGB8888_RGB888_Modulate_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
     const Uint32 modulateR = info->r;
     const Uint32 modulateG = info->g;
     const Uint32 modulateB = info->b;
     const Uint32 modulateA = info->a;
-    Uint32 srcpixel;
-    Uint32 srcR, srcG, srcB, srcA;
-    Uint32 dstpixel;
-    Uint32 dstR, dstG, dstB, dstA;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
     int srcy, srcx;
     int posy, posx;
     int incy, incx;
@@ -5640,10 +6854,106 @@ static void SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
                 }
                 src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
             }
+            pixel = *src;
+            A = (Uint8)(pixel >> 24); R = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); B = (Uint8)pixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = (R * modulateR) / 255;
+                G = (G * modulateG) / 255;
+                B = (B * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = (A * modulateA) / 255;
+            }
+            pixel = ((Uint32)R << 16) | ((Uint32)G << 8) | B;
+            *dst = pixel;
+            posx += incx;
+            ++dst;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+#if SDL_AVX2_BLITTERS
+static void SDL_TARGETING_AVX2 SDL_Blit_ARGB8888_RGB888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    const __m256i vmodulateR = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m256i vmodulateG = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m256i vmodulateB = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m256i vmodulateA = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m256i v255 = _mm256_set1_epi32(0xFF);
+    const __m256i vdiv = _mm256_set1_epi32(0x8081);
+    const __m256i vzero = _mm256_setzero_si256();
+    __m256i vkeep, vinvA;
+    __m256i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m256i vdstpixel, vdstR, vdstG, vdstB;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            vsrcpixel = _mm256_loadu_si256((__m256i *)src);
+            vsrcR = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 16), v255);
+            vsrcG = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 8), v255);
+            vsrcB = _mm256_and_si256(vsrcpixel, v255);
+            vsrcA = _mm256_srli_epi32(vsrcpixel, 24);
+            vdstpixel = _mm256_loadu_si256((__m256i *)dst);
+            vdstR = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 16), v255);
+            vdstG = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm256_and_si256(vdstpixel, v255);
+            vsrcR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vmodulateR), vdiv), 7);
+            vsrcG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vmodulateG), vdiv), 7);
+            vsrcB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vmodulateB), vdiv), 7);
+            vsrcA = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcA, vmodulateA), vdiv), 7);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm256_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm256_or_si256(_mm256_and_si256(vkeep, vdstR), _mm256_andnot_si256(vkeep, vsrcR));
+                vdstG = _mm256_or_si256(_mm256_and_si256(vkeep, vdstG), _mm256_andnot_si256(vkeep, vsrcG));
+                vdstB = _mm256_or_si256(_mm256_and_si256(vkeep, vdstB), _mm256_andnot_si256(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm256_sub_epi32(v255, vsrcA);
+                vdstR = _mm256_add_epi32(vsrcR, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm256_add_epi32(vsrcG, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm256_add_epi32(vsrcB, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm256_min_epi16(_mm256_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm256_min_epi16(_mm256_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm256_min_epi16(_mm256_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(vdstR, 16), _mm256_slli_epi32(vdstG, 8)), vdstB));
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
             srcpixel = *src;
-            srcA = (Uint8)(srcpixel >> 24); srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel;
+            srcA = (Uint8)(srcpixel >> 24); srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel;
             dstpixel = *dst;
-            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel; dstA = 0xFF;
+            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
             if (flags & SDL_COPY_MODULATE_COLOR) {
                 srcR = (srcR * modulateR) / 255;
                 srcG = (srcG * modulateG) / 255;
@@ -5686,65 +6996,157 @@ static void SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
             }
             dstpixel = ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
             *dst = dstpixel;
-            posx += incx;
+            ++src;
             ++dst;
         }
-        posy += incy;
+        info->src += info->src_pitch;
         info->dst += info->dst_pitch;
     }
 }
+#endif /* SDL_AVX2_BLITTERS */
 
-static void SDL_Blit_ABGR8888_BGR888_Scale(SDL_BlitInfo *info)
+#if defined(__SSE2__)
+static void SDL_Blit_ARGB8888_RGB888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
-    Uint32 pixel;
-    Uint32 R, G, B, A;
-    int srcy, srcx;
-    int posy, posx;
-    int incy, incx;
-
-    srcy = 0;
-    posy = 0;
-    incy = (info->src_h << 16) / info->dst_h;
-    incx = (info->src_w << 16) / info->dst_w;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    const __m128i vmodulateR = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m128i vmodulateG = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m128i vmodulateB = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m128i vmodulateA = _mm_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m128i v255 = _mm_set1_epi32(0xFF);
+    const __m128i vdiv = _mm_set1_epi32(0x8081);
+    const __m128i vzero = _mm_setzero_si128();
+    __m128i vkeep, vinvA;
+    __m128i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m128i vdstpixel, vdstR, vdstG, vdstB;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
 
     while (info->dst_h--) {
-        Uint32 *src;
+        Uint32 *src = (Uint32 *)info->src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
-        srcx = -1;
-        posx = 0x10000L;
-        while (posy >= 0x10000L) {
-            ++srcy;
-            posy -= 0x10000L;
+        while (n >= 4) {
+            vsrcpixel = _mm_loadu_si128((__m128i *)src);
+            vsrcR = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 16), v255);
+            vsrcG = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 8), v255);
+            vsrcB = _mm_and_si128(vsrcpixel, v255);
+            vsrcA = _mm_srli_epi32(vsrcpixel, 24);
+            vdstpixel = _mm_loadu_si128((__m128i *)dst);
+            vdstR = _mm_and_si128(_mm_srli_epi32(vdstpixel, 16), v255);
+            vdstG = _mm_and_si128(_mm_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm_and_si128(vdstpixel, v255);
+            vsrcR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vmodulateR), vdiv), 7);
+            vsrcG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vmodulateG), vdiv), 7);
+            vsrcB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vmodulateB), vdiv), 7);
+            vsrcA = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcA, vmodulateA), vdiv), 7);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm_or_si128(_mm_and_si128(vkeep, vdstR), _mm_andnot_si128(vkeep, vsrcR));
+                vdstG = _mm_or_si128(_mm_and_si128(vkeep, vdstG), _mm_andnot_si128(vkeep, vsrcG));
+                vdstB = _mm_or_si128(_mm_and_si128(vkeep, vdstB), _mm_andnot_si128(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm_sub_epi32(v255, vsrcA);
+                vdstR = _mm_add_epi32(vsrcR, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm_add_epi32(vsrcG, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm_add_epi32(vsrcB, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm_min_epi16(_mm_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm_min_epi16(_mm_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm_min_epi16(_mm_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_or_si128(_mm_slli_epi32(vdstR, 16), _mm_slli_epi32(vdstG, 8)), vdstB));
+            src += 4;
+            dst += 4;
+            n -= 4;
         }
         while (n--) {
-            if (posx >= 0x10000L) {
-                while (posx >= 0x10000L) {
-                    ++srcx;
-                    posx -= 0x10000L;
+            srcpixel = *src;
+            srcA = (Uint8)(srcpixel >> 24); srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
                 }
-                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
             }
-            pixel = *src;
-            A = (Uint8)(pixel >> 24); B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel;
-            pixel = ((Uint32)B << 16) | ((Uint32)G << 8) | R;
-            *dst = pixel;
-            posx += incx;
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            *dst = dstpixel;
+            ++src;
             ++dst;
         }
-        posy += incy;
+        info->src += info->src_pitch;
         info->dst += info->dst_pitch;
     }
 }
+#endif /* defined(__SSE2__) */
 
-static void SDL_Blit_ABGR8888_BGR888_Blend(SDL_BlitInfo *info)
+static void SDL_Blit_ARGB8888_RGB888_Modulate_Blend(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
     Uint32 srcpixel;
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
-    Uint32 dstR, dstG, dstB, dstA;
+    Uint32 dstR, dstG, dstB;
 
     while (info->dst_h--) {
         Uint32 *src = (Uint32 *)info->src;
@@ -5752,9 +7154,17 @@ static void SDL_Blit_ABGR8888_BGR888_Blend(SDL_BlitInfo *info)
         int n = info->dst_w;
         while (n--) {
             srcpixel = *src;
-            srcA = (Uint8)(srcpixel >> 24); srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel;
+            srcA = (Uint8)(srcpixel >> 24); srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel;
             dstpixel = *dst;
-            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel; dstA = 0xFF;
+            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -5787,7 +7197,7 @@ static void SDL_Blit_ABGR8888_BGR888_Blend(SDL_BlitInfo *info)
                 dstB = (srcB * dstB) / 255;
                 break;
             }
-            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
+            dstpixel = ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
             *dst = dstpixel;
             ++src;
             ++dst;
@@ -5797,13 +7207,17 @@ static void SDL_Blit_ABGR8888_BGR888_Blend(SDL_BlitInfo *info)
     }
 }
 
-static void SDL_Blit_ABGR8888_BGR888_Blend_Scale(SDL_BlitInfo *info)
+static void SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
     Uint32 srcpixel;
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
-    Uint32 dstR, dstG, dstB, dstA;
+    Uint32 dstR, dstG, dstB;
     int srcy, srcx;
     int posy, posx;
     int incy, incx;
@@ -5832,9 +7246,17 @@ static void SDL_Blit_ABGR8888_BGR888_Blend_Scale(SDL_BlitInfo *info)
                 src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
             }
             srcpixel = *src;
-            srcA = (Uint8)(srcpixel >> 24); srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel;
+            srcA = (Uint8)(srcpixel >> 24); srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel;
             dstpixel = *dst;
-            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel; dstA = 0xFF;
+            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -5867,7 +7289,7 @@ static void SDL_Blit_ABGR8888_BGR888_Blend_Scale(SDL_BlitInfo *info)
                 dstB = (srcB * dstB) / 255;
                 break;
             }
-            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
+            dstpixel = ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
             *dst = dstpixel;
             posx += incx;
             ++dst;
@@ -5877,69 +7299,30 @@ static void SDL_Blit_ABGR8888_BGR888_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
-static void SDL_Blit_ABGR8888_BGR888_Modulate(SDL_BlitInfo *info)
+static void SDL_Blit_ARGB8888_BGR888_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
-    const Uint32 modulateR = info->r;
-    const Uint32 modulateG = info->g;
-    const Uint32 modulateB = info->b;
-    const Uint32 modulateA = info->a;
     Uint32 pixel;
     Uint32 R, G, B, A;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
 
     while (info->dst_h--) {
-        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
-        while (n--) {
-            pixel = *src;
-            A = (Uint8)(pixel >> 24); B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel;
-            if (flags & SDL_COPY_MODULATE_COLOR) {
-                R = (R * modulateR) / 255;
-                G = (G * modulateG) / 255;
-                B = (B * modulateB) / 255;
-            }
-            if (flags & SDL_COPY_MODULATE_ALPHA) {
-                A = (A * modulateA) / 255;
-            }
-            pixel = ((Uint32)B << 16) | ((Uint32)G << 8) | R;
-            *dst = pixel;
-            ++src;
-            ++dst;
-        }
-        info->src += info->src_pitch;
-        info->dst += info->dst_pitch;
-    }
-}
-
-static void SDL_Blit_ABGR8888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
-{
-    const int flags = info->flags;
-    const Uint32 modulateR = info->r;
-    const Uint32 modulateG = info->g;
-    const Uint32 modulateB = info->b;
-    const Uint32 modulateA = info->a;
-    Uint32 pixel;
-    Uint32 R, G, B, A;
-    int srcy, srcx;
-    int posy, posx;
-    int incy, incx;
-
-    srcy = 0;
-    posy = 0;
-    incy = (info->src_h << 16) / info->dst_h;
-    incx = (info->src_w << 16) / info->dst_w;
-
-    while (info->dst_h--) {
-        Uint32 *src;
-        Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        srcx = -1;
-        posx = 0x10000L;
-        while (posy >= 0x10000L) {
-            ++srcy;
-            posy -= 0x10000L;
-        }
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
         while (n--) {
             if (posx >= 0x10000L) {
                 while (posx >= 0x10000L) {
@@ -5949,15 +7332,7 @@ static void SDL_Blit_ABGR8888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
                 src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
             }
             pixel = *src;
-            A = (Uint8)(pixel >> 24); B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel;
-            if (flags & SDL_COPY_MODULATE_COLOR) {
-                R = (R * modulateR) / 255;
-                G = (G * modulateG) / 255;
-                B = (B * modulateB) / 255;
-            }
-            if (flags & SDL_COPY_MODULATE_ALPHA) {
-                A = (A * modulateA) / 255;
-            }
+            A = (Uint8)(pixel >> 24); R = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); B = (Uint8)pixel;
             pixel = ((Uint32)B << 16) | ((Uint32)G << 8) | R;
             *dst = pixel;
             posx += incx;
@@ -5968,35 +7343,74 @@ static void SDL_Blit_ABGR8888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
     }
 }
 
-static void SDL_Blit_ABGR8888_BGR888_Modulate_Blend(SDL_BlitInfo *info)
+#if SDL_AVX2_BLITTERS
+static void SDL_TARGETING_AVX2 SDL_Blit_ARGB8888_BGR888_Blend_AVX2(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
-    const Uint32 modulateR = info->r;
-    const Uint32 modulateG = info->g;
-    const Uint32 modulateB = info->b;
-    const Uint32 modulateA = info->a;
+    const __m256i v255 = _mm256_set1_epi32(0xFF);
+    const __m256i vdiv = _mm256_set1_epi32(0x8081);
+    const __m256i vzero = _mm256_setzero_si256();
+    __m256i vkeep, vinvA;
+    __m256i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m256i vdstpixel, vdstR, vdstG, vdstB;
     Uint32 srcpixel;
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
-    Uint32 dstR, dstG, dstB, dstA;
+    Uint32 dstR, dstG, dstB;
 
     while (info->dst_h--) {
         Uint32 *src = (Uint32 *)info->src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
+        while (n >= 8) {
+            vsrcpixel = _mm256_loadu_si256((__m256i *)src);
+            vsrcR = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 16), v255);
+            vsrcG = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 8), v255);
+            vsrcB = _mm256_and_si256(vsrcpixel, v255);
+            vsrcA = _mm256_srli_epi32(vsrcpixel, 24);
+            vdstpixel = _mm256_loadu_si256((__m256i *)dst);
+            vdstR = _mm256_and_si256(vdstpixel, v255);
+            vdstG = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 16), v255);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm256_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm256_or_si256(_mm256_and_si256(vkeep, vdstR), _mm256_andnot_si256(vkeep, vsrcR));
+                vdstG = _mm256_or_si256(_mm256_and_si256(vkeep, vdstG), _mm256_andnot_si256(vkeep, vsrcG));
+                vdstB = _mm256_or_si256(_mm256_and_si256(vkeep, vdstB), _mm256_andnot_si256(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm256_sub_epi32(v255, vsrcA);
+                vdstR = _mm256_add_epi32(vsrcR, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm256_add_epi32(vsrcG, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm256_add_epi32(vsrcB, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm256_min_epi16(_mm256_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm256_min_epi16(_mm256_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm256_min_epi16(_mm256_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(_mm256_or_si256(vdstR, _mm256_slli_epi32(vdstG, 8)), _mm256_slli_epi32(vdstB, 16)));
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
         while (n--) {
             srcpixel = *src;
-            srcA = (Uint8)(srcpixel >> 24); srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel;
+            srcA = (Uint8)(srcpixel >> 24); srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel;
             dstpixel = *dst;
-            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel; dstA = 0xFF;
-            if (flags & SDL_COPY_MODULATE_COLOR) {
-                srcR = (srcR * modulateR) / 255;
-                srcG = (srcG * modulateG) / 255;
-                srcB = (srcB * modulateB) / 255;
-            }
-            if (flags & SDL_COPY_MODULATE_ALPHA) {
-                srcA = (srcA * modulateA) / 255;
-            }
+            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel;
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -6038,57 +7452,76 @@ static void SDL_Blit_ABGR8888_BGR888_Modulate_Blend(SDL_BlitInfo *info)
         info->dst += info->dst_pitch;
     }
 }
+#endif /* SDL_AVX2_BLITTERS */
 
-static void SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
+#if defined(__SSE2__)
+static void SDL_Blit_ARGB8888_BGR888_Blend_SSE2(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
-    const Uint32 modulateR = info->r;
-    const Uint32 modulateG = info->g;
-    const Uint32 modulateB = info->b;
-    const Uint32 modulateA = info->a;
+    const __m128i v255 = _mm_set1_epi32(0xFF);
+    const __m128i vdiv = _mm_set1_epi32(0x8081);
+    const __m128i vzero = _mm_setzero_si128();
+    __m128i vkeep, vinvA;
+    __m128i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m128i vdstpixel, vdstR, vdstG, vdstB;
     Uint32 srcpixel;
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
-    Uint32 dstR, dstG, dstB, dstA;
-    int srcy, srcx;
-    int posy, posx;
-    int incy, incx;
-
-    srcy = 0;
-    posy = 0;
-    incy = (info->src_h << 16) / info->dst_h;
-    incx = (info->src_w << 16) / info->dst_w;
+    Uint32 dstR, dstG, dstB;
 
     while (info->dst_h--) {
-        Uint32 *src;
+        Uint32 *src = (Uint32 *)info->src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
-        srcx = -1;
-        posx = 0x10000L;
-        while (posy >= 0x10000L) {
-            ++srcy;
-            posy -= 0x10000L;
+        while (n >= 4) {
+            vsrcpixel = _mm_loadu_si128((__m128i *)src);
+            vsrcR = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 16), v255);
+            vsrcG = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 8), v255);
+            vsrcB = _mm_and_si128(vsrcpixel, v255);
+            vsrcA = _mm_srli_epi32(vsrcpixel, 24);
+            vdstpixel = _mm_loadu_si128((__m128i *)dst);
+            vdstR = _mm_and_si128(vdstpixel, v255);
+            vdstG = _mm_and_si128(_mm_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm_and_si128(_mm_srli_epi32(vdstpixel, 16), v255);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm_or_si128(_mm_and_si128(vkeep, vdstR), _mm_andnot_si128(vkeep, vsrcR));
+                vdstG = _mm_or_si128(_mm_and_si128(vkeep, vdstG), _mm_andnot_si128(vkeep, vsrcG));
+                vdstB = _mm_or_si128(_mm_and_si128(vkeep, vdstB), _mm_andnot_si128(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm_sub_epi32(v255, vsrcA);
+                vdstR = _mm_add_epi32(vsrcR, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm_add_epi32(vsrcG, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm_add_epi32(vsrcB, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm_min_epi16(_mm_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm_min_epi16(_mm_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm_min_epi16(_mm_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_or_si128(vdstR, _mm_slli_epi32(vdstG, 8)), _mm_slli_epi32(vdstB, 16)));
+            src += 4;
+            dst += 4;
+            n -= 4;
         }
         while (n--) {
-            if (posx >= 0x10000L) {
-                while (posx >= 0x10000L) {
-                    ++srcx;
-                    posx -= 0x10000L;
-                }
-                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
-            }
             srcpixel = *src;
-            srcA = (Uint8)(srcpixel >> 24); srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel;
+            srcA = (Uint8)(srcpixel >> 24); srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel;
             dstpixel = *dst;
-            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel; dstA = 0xFF;
-            if (flags & SDL_COPY_MODULATE_COLOR) {
-                srcR = (srcR * modulateR) / 255;
-                srcG = (srcG * modulateG) / 255;
-                srcB = (srcB * modulateB) / 255;
-            }
-            if (flags & SDL_COPY_MODULATE_ALPHA) {
-                srcA = (srcA * modulateA) / 255;
-            }
+            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel;
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -6123,65 +7556,22 @@ static void SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
             }
             dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
             *dst = dstpixel;
-            posx += incx;
-            ++dst;
-        }
-        posy += incy;
-        info->dst += info->dst_pitch;
-    }
-}
-
-static void SDL_Blit_ABGR8888_ARGB8888_Scale(SDL_BlitInfo *info)
-{
-    const int flags = info->flags;
-    Uint32 pixel;
-    Uint32 R, G, B, A;
-    int srcy, srcx;
-    int posy, posx;
-    int incy, incx;
-
-    srcy = 0;
-    posy = 0;
-    incy = (info->src_h << 16) / info->dst_h;
-    incx = (info->src_w << 16) / info->dst_w;
-
-    while (info->dst_h--) {
-        Uint32 *src;
-        Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        srcx = -1;
-        posx = 0x10000L;
-        while (posy >= 0x10000L) {
-            ++srcy;
-            posy -= 0x10000L;
-        }
-        while (n--) {
-            if (posx >= 0x10000L) {
-                while (posx >= 0x10000L) {
-                    ++srcx;
-                    posx -= 0x10000L;
-                }
-                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
-            }
-            pixel = *src;
-            A = (Uint8)(pixel >> 24); B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel;
-            pixel = ((Uint32)A << 24) | ((Uint32)R << 16) | ((Uint32)G << 8) | B;
-            *dst = pixel;
-            posx += incx;
+            ++src;
             ++dst;
         }
-        posy += incy;
+        info->src += info->src_pitch;
         info->dst += info->dst_pitch;
     }
 }
+#endif /* defined(__SSE2__) */
 
-static void SDL_Blit_ABGR8888_ARGB8888_Blend(SDL_BlitInfo *info)
+static void SDL_Blit_ARGB8888_BGR888_Blend(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
     Uint32 srcpixel;
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
-    Uint32 dstR, dstG, dstB, dstA;
+    Uint32 dstR, dstG, dstB;
 
     while (info->dst_h--) {
         Uint32 *src = (Uint32 *)info->src;
@@ -6189,9 +7579,9 @@ static void SDL_Blit_ABGR8888_ARGB8888_Blend(SDL_BlitInfo *info)
         int n = info->dst_w;
         while (n--) {
             srcpixel = *src;
-            srcA = (Uint8)(srcpixel >> 24); srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel;
+            srcA = (Uint8)(srcpixel >> 24); srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel;
             dstpixel = *dst;
-            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel;
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -6224,7 +7614,7 @@ static void SDL_Blit_ABGR8888_ARGB8888_Blend(SDL_BlitInfo *info)
                 dstB = (srcB * dstB) / 255;
                 break;
             }
-            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
             *dst = dstpixel;
             ++src;
             ++dst;
@@ -6234,13 +7624,13 @@ static void SDL_Blit_ABGR8888_ARGB8888_Blend(SDL_BlitInfo *info)
     }
 }
 
-static void SDL_Blit_ABGR8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
+static void SDL_Blit_ARGB8888_BGR888_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
     Uint32 srcpixel;
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
-    Uint32 dstR, dstG, dstB, dstA;
+    Uint32 dstR, dstG, dstB;
     int srcy, srcx;
     int posy, posx;
     int incy, incx;
@@ -6269,9 +7659,9 @@ static void SDL_Blit_ABGR8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
                 src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
             }
             srcpixel = *src;
-            srcA = (Uint8)(srcpixel >> 24); srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel;
+            srcA = (Uint8)(srcpixel >> 24); srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel;
             dstpixel = *dst;
-            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel;
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -6304,7 +7694,7 @@ static void SDL_Blit_ABGR8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
                 dstB = (srcB * dstB) / 255;
                 break;
             }
-            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
             *dst = dstpixel;
             posx += incx;
             ++dst;
@@ -6314,13 +7704,21 @@ static void SDL_Blit_ABGR8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
-static void SDL_Blit_ABGR8888_ARGB8888_Modulate(SDL_BlitInfo *info)
+#if SDL_AVX2_BLITTERS
+static void SDL_TARGETING_AVX2 SDL_Blit_ARGB8888_BGR888_Modulate_AVX2(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
     const Uint32 modulateR = info->r;
     const Uint32 modulateG = info->g;
     const Uint32 modulateB = info->b;
     const Uint32 modulateA = info->a;
+    const __m256i vmodulateR = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m256i vmodulateG = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m256i vmodulateB = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m256i vmodulateA = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m256i v255 = _mm256_set1_epi32(0xFF);
+    const __m256i vdiv = _mm256_set1_epi32(0x8081);
+    __m256i vpixel, vR, vG, vB, vA;
     Uint32 pixel;
     Uint32 R, G, B, A;
 
@@ -6328,9 +7726,24 @@ static void SDL_Blit_ABGR8888_ARGB8888_Modulate(SDL_BlitInfo *info)
         Uint32 *src = (Uint32 *)info->src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
+        while (n >= 8) {
+            vpixel = _mm256_loadu_si256((__m256i *)src);
+            vR = _mm256_and_si256(_mm256_srli_epi32(vpixel, 16), v255);
+            vG = _mm256_and_si256(_mm256_srli_epi32(vpixel, 8), v255);
+            vB = _mm256_and_si256(vpixel, v255);
+            vA = _mm256_srli_epi32(vpixel, 24);
+            vR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vR, vmodulateR), vdiv), 7);
+            vG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vG, vmodulateG), vdiv), 7);
+            vB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vB, vmodulateB), vdiv), 7);
+            vA = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vA, vmodulateA), vdiv), 7);
+            _mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(_mm256_or_si256(vR, _mm256_slli_epi32(vG, 8)), _mm256_slli_epi32(vB, 16)));
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
         while (n--) {
             pixel = *src;
-            A = (Uint8)(pixel >> 24); B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel;
+            A = (Uint8)(pixel >> 24); R = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); B = (Uint8)pixel;
             if (flags & SDL_COPY_MODULATE_COLOR) {
                 R = (R * modulateR) / 255;
                 G = (G * modulateG) / 255;
@@ -6339,7 +7752,7 @@ static void SDL_Blit_ABGR8888_ARGB8888_Modulate(SDL_BlitInfo *info)
             if (flags & SDL_COPY_MODULATE_ALPHA) {
                 A = (A * modulateA) / 255;
             }
-            pixel = ((Uint32)A << 24) | ((Uint32)R << 16) | ((Uint32)G << 8) | B;
+            pixel = ((Uint32)B << 16) | ((Uint32)G << 8) | R;
             *dst = pixel;
             ++src;
             ++dst;
@@ -6348,45 +7761,48 @@ static void SDL_Blit_ABGR8888_ARGB8888_Modulate(SDL_BlitInfo *info)
         info->dst += info->dst_pitch;
     }
 }
+#endif /* SDL_AVX2_BLITTERS */
 
-static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
+#if defined(__SSE2__)
+static void SDL_Blit_ARGB8888_BGR888_Modulate_SSE2(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
     const Uint32 modulateR = info->r;
     const Uint32 modulateG = info->g;
     const Uint32 modulateB = info->b;
     const Uint32 modulateA = info->a;
+    const __m128i vmodulateR = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m128i vmodulateG = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m128i vmodulateB = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m128i vmodulateA = _mm_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m128i v255 = _mm_set1_epi32(0xFF);
+    const __m128i vdiv = _mm_set1_epi32(0x8081);
+    __m128i vpixel, vR, vG, vB, vA;
     Uint32 pixel;
     Uint32 R, G, B, A;
-    int srcy, srcx;
-    int posy, posx;
-    int incy, incx;
-
-    srcy = 0;
-    posy = 0;
-    incy = (info->src_h << 16) / info->dst_h;
-    incx = (info->src_w << 16) / info->dst_w;
 
     while (info->dst_h--) {
-        Uint32 *src;
+        Uint32 *src = (Uint32 *)info->src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
-        srcx = -1;
-        posx = 0x10000L;
-        while (posy >= 0x10000L) {
-            ++srcy;
-            posy -= 0x10000L;
+        while (n >= 4) {
+            vpixel = _mm_loadu_si128((__m128i *)src);
+            vR = _mm_and_si128(_mm_srli_epi32(vpixel, 16), v255);
+            vG = _mm_and_si128(_mm_srli_epi32(vpixel, 8), v255);
+            vB = _mm_and_si128(vpixel, v255);
+            vA = _mm_srli_epi32(vpixel, 24);
+            vR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vR, vmodulateR), vdiv), 7);
+            vG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vG, vmodulateG), vdiv), 7);
+            vB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vB, vmodulateB), vdiv), 7);
+            vA = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vA, vmodulateA), vdiv), 7);
+            _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_or_si128(vR, _mm_slli_epi32(vG, 8)), _mm_slli_epi32(vB, 16)));
+            src += 4;
+            dst += 4;
+            n -= 4;
         }
         while (n--) {
-            if (posx >= 0x10000L) {
-                while (posx >= 0x10000L) {
-                    ++srcx;
-                    posx -= 0x10000L;
-                }
-                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
-            }
             pixel = *src;
-            A = (Uint8)(pixel >> 24); B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel;
+            A = (Uint8)(pixel >> 24); R = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); B = (Uint8)pixel;
             if (flags & SDL_COPY_MODULATE_COLOR) {
                 R = (R * modulateR) / 255;
                 G = (G * modulateG) / 255;
@@ -6395,79 +7811,44 @@ static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
             if (flags & SDL_COPY_MODULATE_ALPHA) {
                 A = (A * modulateA) / 255;
             }
-            pixel = ((Uint32)A << 24) | ((Uint32)R << 16) | ((Uint32)G << 8) | B;
+            pixel = ((Uint32)B << 16) | ((Uint32)G << 8) | R;
             *dst = pixel;
-            posx += incx;
+            ++src;
             ++dst;
         }
-        posy += incy;
+        info->src += info->src_pitch;
         info->dst += info->dst_pitch;
     }
 }
+#endif /* defined(__SSE2__) */
 
-static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend(SDL_BlitInfo *info)
+static void SDL_Blit_ARGB8888_BGR888_Modulate(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
     const Uint32 modulateR = info->r;
     const Uint32 modulateG = info->g;
     const Uint32 modulateB = info->b;
     const Uint32 modulateA = info->a;
-    Uint32 srcpixel;
-    Uint32 srcR, srcG, srcB, srcA;
-    Uint32 dstpixel;
-    Uint32 dstR, dstG, dstB, dstA;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
 
     while (info->dst_h--) {
         Uint32 *src = (Uint32 *)info->src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         while (n--) {
-            srcpixel = *src;
-            srcA = (Uint8)(srcpixel >> 24); srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel;
-            dstpixel = *dst;
-            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            pixel = *src;
+            A = (Uint8)(pixel >> 24); R = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); B = (Uint8)pixel;
             if (flags & SDL_COPY_MODULATE_COLOR) {
-                srcR = (srcR * modulateR) / 255;
-                srcG = (srcG * modulateG) / 255;
-                srcB = (srcB * modulateB) / 255;
+                R = (R * modulateR) / 255;
+                G = (G * modulateG) / 255;
+                B = (B * modulateB) / 255;
             }
             if (flags & SDL_COPY_MODULATE_ALPHA) {
-                srcA = (srcA * modulateA) / 255;
-            }
-            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
-                /* This goes away if we ever use premultiplied alpha */
-                if (srcA < 255) {
-                    srcR = (srcR * srcA) / 255;
-                    srcG = (srcG * srcA) / 255;
-                    srcB = (srcB * srcA) / 255;
-                }
-            }
-            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
-            case SDL_COPY_MASK:
-                if (srcA) {
-                    dstR = srcR;
-                    dstG = srcG;
-                    dstB = srcB;
-                }
-                break;
-            case SDL_COPY_BLEND:
-                dstR = srcR + ((255 - srcA) * dstR) / 255;
-                dstG = srcG + ((255 - srcA) * dstG) / 255;
-                dstB = srcB + ((255 - srcA) * dstB) / 255;
-                break;
-            case SDL_COPY_ADD:
-                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
-                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
-                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
-                break;
-            case SDL_COPY_MOD:
-                dstR = (srcR * dstR) / 255;
-                dstG = (srcG * dstG) / 255;
-                dstB = (srcB * dstB) / 255;
-                break;
+                A = (A * modulateA) / 255;
             }
-            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
-            *dst = dstpixel;
+            pixel = ((Uint32)B << 16) | ((Uint32)G << 8) | R;
+            *dst = pixel;
             ++src;
             ++dst;
         }
@@ -6476,17 +7857,15 @@ static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend(SDL_BlitInfo *info)
     }
 }
 
-static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
+static void SDL_Blit_ARGB8888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
     const Uint32 modulateR = info->r;
     const Uint32 modulateG = info->g;
     const Uint32 modulateB = info->b;
     const Uint32 modulateA = info->a;
-    Uint32 srcpixel;
-    Uint32 srcR, srcG, srcB, srcA;
-    Uint32 dstpixel;
-    Uint32 dstR, dstG, dstB, dstA;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
     int srcy, srcx;
     int posy, posx;
     int incy, incx;
@@ -6514,10 +7893,106 @@ static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
                 }
                 src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
             }
+            pixel = *src;
+            A = (Uint8)(pixel >> 24); R = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); B = (Uint8)pixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = (R * modulateR) / 255;
+                G = (G * modulateG) / 255;
+                B = (B * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = (A * modulateA) / 255;
+            }
+            pixel = ((Uint32)B << 16) | ((Uint32)G << 8) | R;
+            *dst = pixel;
+            posx += incx;
+            ++dst;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+#if SDL_AVX2_BLITTERS
+static void SDL_TARGETING_AVX2 SDL_Blit_ARGB8888_BGR888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    const __m256i vmodulateR = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m256i vmodulateG = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m256i vmodulateB = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m256i vmodulateA = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m256i v255 = _mm256_set1_epi32(0xFF);
+    const __m256i vdiv = _mm256_set1_epi32(0x8081);
+    const __m256i vzero = _mm256_setzero_si256();
+    __m256i vkeep, vinvA;
+    __m256i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m256i vdstpixel, vdstR, vdstG, vdstB;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            vsrcpixel = _mm256_loadu_si256((__m256i *)src);
+            vsrcR = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 16), v255);
+            vsrcG = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 8), v255);
+            vsrcB = _mm256_and_si256(vsrcpixel, v255);
+            vsrcA = _mm256_srli_epi32(vsrcpixel, 24);
+            vdstpixel = _mm256_loadu_si256((__m256i *)dst);
+            vdstR = _mm256_and_si256(vdstpixel, v255);
+            vdstG = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 16), v255);
+            vsrcR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vmodulateR), vdiv), 7);
+            vsrcG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vmodulateG), vdiv), 7);
+            vsrcB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vmodulateB), vdiv), 7);
+            vsrcA = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcA, vmodulateA), vdiv), 7);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm256_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm256_or_si256(_mm256_and_si256(vkeep, vdstR), _mm256_andnot_si256(vkeep, vsrcR));
+                vdstG = _mm256_or_si256(_mm256_and_si256(vkeep, vdstG), _mm256_andnot_si256(vkeep, vsrcG));
+                vdstB = _mm256_or_si256(_mm256_and_si256(vkeep, vdstB), _mm256_andnot_si256(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm256_sub_epi32(v255, vsrcA);
+                vdstR = _mm256_add_epi32(vsrcR, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm256_add_epi32(vsrcG, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm256_add_epi32(vsrcB, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm256_min_epi16(_mm256_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm256_min_epi16(_mm256_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm256_min_epi16(_mm256_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(_mm256_or_si256(vdstR, _mm256_slli_epi32(vdstG, 8)), _mm256_slli_epi32(vdstB, 16)));
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
             srcpixel = *src;
-            srcA = (Uint8)(srcpixel >> 24); srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel;
+            srcA = (Uint8)(srcpixel >> 24); srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel;
             dstpixel = *dst;
-            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel;
             if (flags & SDL_COPY_MODULATE_COLOR) {
                 srcR = (srcR * modulateR) / 255;
                 srcG = (srcG * modulateG) / 255;
@@ -6558,67 +8033,159 @@ static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
                 dstB = (srcB * dstB) / 255;
                 break;
             }
-            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
             *dst = dstpixel;
-            posx += incx;
+            ++src;
             ++dst;
         }
-        posy += incy;
+        info->src += info->src_pitch;
         info->dst += info->dst_pitch;
     }
 }
+#endif /* SDL_AVX2_BLITTERS */
 
-static void SDL_Blit_BGRA8888_RGB888_Scale(SDL_BlitInfo *info)
+#if defined(__SSE2__)
+static void SDL_Blit_ARGB8888_BGR888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
-    Uint32 pixel;
-    Uint32 R, G, B, A;
-    int srcy, srcx;
-    int posy, posx;
-    int incy, incx;
-
-    srcy = 0;
-    posy = 0;
-    incy = (info->src_h << 16) / info->dst_h;
-    incx = (info->src_w << 16) / info->dst_w;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    const __m128i vmodulateR = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m128i vmodulateG = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m128i vmodulateB = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m128i vmodulateA = _mm_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m128i v255 = _mm_set1_epi32(0xFF);
+    const __m128i vdiv = _mm_set1_epi32(0x8081);
+    const __m128i vzero = _mm_setzero_si128();
+    __m128i vkeep, vinvA;
+    __m128i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m128i vdstpixel, vdstR, vdstG, vdstB;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
 
     while (info->dst_h--) {
-        Uint32 *src;
+        Uint32 *src = (Uint32 *)info->src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
-        srcx = -1;
-        posx = 0x10000L;
-        while (posy >= 0x10000L) {
-            ++srcy;
-            posy -= 0x10000L;
+        while (n >= 4) {
+            vsrcpixel = _mm_loadu_si128((__m128i *)src);
+            vsrcR = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 16), v255);
+            vsrcG = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 8), v255);
+            vsrcB = _mm_and_si128(vsrcpixel, v255);
+            vsrcA = _mm_srli_epi32(vsrcpixel, 24);
+            vdstpixel = _mm_loadu_si128((__m128i *)dst);
+            vdstR = _mm_and_si128(vdstpixel, v255);
+            vdstG = _mm_and_si128(_mm_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm_and_si128(_mm_srli_epi32(vdstpixel, 16), v255);
+            vsrcR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vmodulateR), vdiv), 7);
+            vsrcG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vmodulateG), vdiv), 7);
+            vsrcB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vmodulateB), vdiv), 7);
+            vsrcA = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcA, vmodulateA), vdiv), 7);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm_or_si128(_mm_and_si128(vkeep, vdstR), _mm_andnot_si128(vkeep, vsrcR));
+                vdstG = _mm_or_si128(_mm_and_si128(vkeep, vdstG), _mm_andnot_si128(vkeep, vsrcG));
+                vdstB = _mm_or_si128(_mm_and_si128(vkeep, vdstB), _mm_andnot_si128(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm_sub_epi32(v255, vsrcA);
+                vdstR = _mm_add_epi32(vsrcR, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm_add_epi32(vsrcG, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm_add_epi32(vsrcB, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm_min_epi16(_mm_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm_min_epi16(_mm_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm_min_epi16(_mm_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_or_si128(vdstR, _mm_slli_epi32(vdstG, 8)), _mm_slli_epi32(vdstB, 16)));
+            src += 4;
+            dst += 4;
+            n -= 4;
         }
         while (n--) {
-            if (posx >= 0x10000L) {
-                while (posx >= 0x10000L) {
-                    ++srcx;
-                    posx -= 0x10000L;
+            srcpixel = *src;
+            srcA = (Uint8)(srcpixel >> 24); srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
                 }
-                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
             }
-            pixel = *src;
-            B = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); R = (Uint8)(pixel >> 8); A = (Uint8)pixel;
-            pixel = ((Uint32)R << 16) | ((Uint32)G << 8) | B;
-            *dst = pixel;
-            posx += incx;
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
+            *dst = dstpixel;
+            ++src;
             ++dst;
         }
-        posy += incy;
+        info->src += info->src_pitch;
         info->dst += info->dst_pitch;
     }
 }
+#endif /* defined(__SSE2__) */
 
-static void SDL_Blit_BGRA8888_RGB888_Blend(SDL_BlitInfo *info)
+static void SDL_Blit_ARGB8888_BGR888_Modulate_Blend(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
     Uint32 srcpixel;
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
-    Uint32 dstR, dstG, dstB, dstA;
+    Uint32 dstR, dstG, dstB;
 
     while (info->dst_h--) {
         Uint32 *src = (Uint32 *)info->src;
@@ -6626,9 +8193,17 @@ static void SDL_Blit_BGRA8888_RGB888_Blend(SDL_BlitInfo *info)
         int n = info->dst_w;
         while (n--) {
             srcpixel = *src;
-            srcB = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcR = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            srcA = (Uint8)(srcpixel >> 24); srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel;
             dstpixel = *dst;
-            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel; dstA = 0xFF;
+            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -6661,7 +8236,7 @@ static void SDL_Blit_BGRA8888_RGB888_Blend(SDL_BlitInfo *info)
                 dstB = (srcB * dstB) / 255;
                 break;
             }
-            dstpixel = ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
             *dst = dstpixel;
             ++src;
             ++dst;
@@ -6671,13 +8246,17 @@ static void SDL_Blit_BGRA8888_RGB888_Blend(SDL_BlitInfo *info)
     }
 }
 
-static void SDL_Blit_BGRA8888_RGB888_Blend_Scale(SDL_BlitInfo *info)
+static void SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
     Uint32 srcpixel;
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
-    Uint32 dstR, dstG, dstB, dstA;
+    Uint32 dstR, dstG, dstB;
     int srcy, srcx;
     int posy, posx;
     int incy, incx;
@@ -6706,9 +8285,17 @@ static void SDL_Blit_BGRA8888_RGB888_Blend_Scale(SDL_BlitInfo *info)
                 src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
             }
             srcpixel = *src;
-            srcB = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcR = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            srcA = (Uint8)(srcpixel >> 24); srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel;
             dstpixel = *dst;
-            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel; dstA = 0xFF;
+            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -6741,7 +8328,7 @@ static void SDL_Blit_BGRA8888_RGB888_Blend_Scale(SDL_BlitInfo *info)
                 dstB = (srcB * dstB) / 255;
                 break;
             }
-            dstpixel = ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
             *dst = dstpixel;
             posx += incx;
             ++dst;
@@ -6751,61 +8338,20 @@ static void SDL_Blit_BGRA8888_RGB888_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
-static void SDL_Blit_BGRA8888_RGB888_Modulate(SDL_BlitInfo *info)
+static void SDL_Blit_ARGB8888_ARGB8888_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
-    const Uint32 modulateR = info->r;
-    const Uint32 modulateG = info->g;
-    const Uint32 modulateB = info->b;
-    const Uint32 modulateA = info->a;
-    Uint32 pixel;
-    Uint32 R, G, B, A;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
 
     while (info->dst_h--) {
-        Uint32 *src = (Uint32 *)info->src;
-        Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        while (n--) {
-            pixel = *src;
-            B = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); R = (Uint8)(pixel >> 8); A = (Uint8)pixel;
-            if (flags & SDL_COPY_MODULATE_COLOR) {
-                R = (R * modulateR) / 255;
-                G = (G * modulateG) / 255;
-                B = (B * modulateB) / 255;
-            }
-            if (flags & SDL_COPY_MODULATE_ALPHA) {
-                A = (A * modulateA) / 255;
-            }
-            pixel = ((Uint32)R << 16) | ((Uint32)G << 8) | B;
-            *dst = pixel;
-            ++src;
-            ++dst;
-        }
-        info->src += info->src_pitch;
-        info->dst += info->dst_pitch;
-    }
-}
-
-static void SDL_Blit_BGRA8888_RGB888_Modulate_Scale(SDL_BlitInfo *info)
-{
-    const int flags = info->flags;
-    const Uint32 modulateR = info->r;
-    const Uint32 modulateG = info->g;
-    const Uint32 modulateB = info->b;
-    const Uint32 modulateA = info->a;
-    Uint32 pixel;
-    Uint32 R, G, B, A;
-    int srcy, srcx;
-    int posy, posx;
-    int incy, incx;
-
-    srcy = 0;
-    posy = 0;
-    incy = (info->src_h << 16) / info->dst_h;
-    incx = (info->src_w << 16) / info->dst_w;
-
-    while (info->dst_h--) {
-        Uint32 *src;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         srcx = -1;
@@ -6822,18 +8368,7 @@ static void SDL_Blit_BGRA8888_RGB888_Modulate_Scale(SDL_BlitInfo *info)
                 }
                 src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
             }
-            pixel = *src;
-            B = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); R = (Uint8)(pixel >> 8); A = (Uint8)pixel;
-            if (flags & SDL_COPY_MODULATE_COLOR) {
-                R = (R * modulateR) / 255;
-                G = (G * modulateG) / 255;
-                B = (B * modulateB) / 255;
-            }
-            if (flags & SDL_COPY_MODULATE_ALPHA) {
-                A = (A * modulateA) / 255;
-            }
-            pixel = ((Uint32)R << 16) | ((Uint32)G << 8) | B;
-            *dst = pixel;
+            *dst = *src;
             posx += incx;
             ++dst;
         }
@@ -6842,13 +8377,16 @@ static void SDL_Blit_BGRA8888_RGB888_Modulate_Scale(SDL_BlitInfo *info)
     }
 }
 
-static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend(SDL_BlitInfo *info)
+#if SDL_AVX2_BLITTERS
+static void SDL_TARGETING_AVX2 SDL_Blit_ARGB8888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
-    const Uint32 modulateR = info->r;
-    const Uint32 modulateG = info->g;
-    const Uint32 modulateB = info->b;
-    const Uint32 modulateA = info->a;
+    const __m256i v255 = _mm256_set1_epi32(0xFF);
+    const __m256i vdiv = _mm256_set1_epi32(0x8081);
+    const __m256i vzero = _mm256_setzero_si256();
+    __m256i vkeep, vinvA;
+    __m256i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m256i vdstpixel, vdstR, vdstG, vdstB, vdstA;
     Uint32 srcpixel;
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
@@ -6858,19 +8396,56 @@ static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend(SDL_BlitInfo *info)
         Uint32 *src = (Uint32 *)info->src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
+        while (n >= 8) {
+            vsrcpixel = _mm256_loadu_si256((__m256i *)src);
+            vsrcR = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 16), v255);
+            vsrcG = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 8), v255);
+            vsrcB = _mm256_and_si256(vsrcpixel, v255);
+            vsrcA = _mm256_srli_epi32(vsrcpixel, 24);
+            vdstpixel = _mm256_loadu_si256((__m256i *)dst);
+            vdstR = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 16), v255);
+            vdstG = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm256_and_si256(vdstpixel, v255);
+            vdstA = _mm256_srli_epi32(vdstpixel, 24);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm256_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm256_or_si256(_mm256_and_si256(vkeep, vdstR), _mm256_andnot_si256(vkeep, vsrcR));
+                vdstG = _mm256_or_si256(_mm256_and_si256(vkeep, vdstG), _mm256_andnot_si256(vkeep, vsrcG));
+                vdstB = _mm256_or_si256(_mm256_and_si256(vkeep, vdstB), _mm256_andnot_si256(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm256_sub_epi32(v255, vsrcA);
+                vdstR = _mm256_add_epi32(vsrcR, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm256_add_epi32(vsrcG, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm256_add_epi32(vsrcB, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm256_min_epi16(_mm256_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm256_min_epi16(_mm256_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm256_min_epi16(_mm256_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(vdstR, 16), _mm256_slli_epi32(vdstG, 8)), vdstB), _mm256_slli_epi32(vdstA, 24)));
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
         while (n--) {
             srcpixel = *src;
-            srcB = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcR = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            srcA = (Uint8)(srcpixel >> 24); srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel;
             dstpixel = *dst;
-            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel; dstA = 0xFF;
-            if (flags & SDL_COPY_MODULATE_COLOR) {
-                srcR = (srcR * modulateR) / 255;
-                srcG = (srcG * modulateG) / 255;
-                srcB = (srcB * modulateB) / 255;
-            }
-            if (flags & SDL_COPY_MODULATE_ALPHA) {
-                srcA = (srcA * modulateA) / 255;
-            }
+            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -6903,7 +8478,7 @@ static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend(SDL_BlitInfo *info)
                 dstB = (srcB * dstB) / 255;
                 break;
             }
-            dstpixel = ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
             *dst = dstpixel;
             ++src;
             ++dst;
@@ -6912,57 +8487,77 @@ static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend(SDL_BlitInfo *info)
         info->dst += info->dst_pitch;
     }
 }
+#endif /* SDL_AVX2_BLITTERS */
 
-static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
+#if defined(__SSE2__)
+static void SDL_Blit_ARGB8888_ARGB8888_Blend_SSE2(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
-    const Uint32 modulateR = info->r;
-    const Uint32 modulateG = info->g;
-    const Uint32 modulateB = info->b;
-    const Uint32 modulateA = info->a;
+    const __m128i v255 = _mm_set1_epi32(0xFF);
+    const __m128i vdiv = _mm_set1_epi32(0x8081);
+    const __m128i vzero = _mm_setzero_si128();
+    __m128i vkeep, vinvA;
+    __m128i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m128i vdstpixel, vdstR, vdstG, vdstB, vdstA;
     Uint32 srcpixel;
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB, dstA;
-    int srcy, srcx;
-    int posy, posx;
-    int incy, incx;
-
-    srcy = 0;
-    posy = 0;
-    incy = (info->src_h << 16) / info->dst_h;
-    incx = (info->src_w << 16) / info->dst_w;
 
     while (info->dst_h--) {
-        Uint32 *src;
+        Uint32 *src = (Uint32 *)info->src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
-        srcx = -1;
-        posx = 0x10000L;
-        while (posy >= 0x10000L) {
-            ++srcy;
-            posy -= 0x10000L;
+        while (n >= 4) {
+            vsrcpixel = _mm_loadu_si128((__m128i *)src);
+            vsrcR = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 16), v255);
+            vsrcG = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 8), v255);
+            vsrcB = _mm_and_si128(vsrcpixel, v255);
+            vsrcA = _mm_srli_epi32(vsrcpixel, 24);
+            vdstpixel = _mm_loadu_si128((__m128i *)dst);
+            vdstR = _mm_and_si128(_mm_srli_epi32(vdstpixel, 16), v255);
+            vdstG = _mm_and_si128(_mm_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm_and_si128(vdstpixel, v255);
+            vdstA = _mm_srli_epi32(vdstpixel, 24);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm_or_si128(_mm_and_si128(vkeep, vdstR), _mm_andnot_si128(vkeep, vsrcR));
+                vdstG = _mm_or_si128(_mm_and_si128(vkeep, vdstG), _mm_andnot_si128(vkeep, vsrcG));
+                vdstB = _mm_or_si128(_mm_and_si128(vkeep, vdstB), _mm_andnot_si128(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm_sub_epi32(v255, vsrcA);
+                vdstR = _mm_add_epi32(vsrcR, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm_add_epi32(vsrcG, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm_add_epi32(vsrcB, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm_min_epi16(_mm_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm_min_epi16(_mm_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm_min_epi16(_mm_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(vdstR, 16), _mm_slli_epi32(vdstG, 8)), vdstB), _mm_slli_epi32(vdstA, 24)));
+            src += 4;
+            dst += 4;
+            n -= 4;
         }
         while (n--) {
-            if (posx >= 0x10000L) {
-                while (posx >= 0x10000L) {
-                    ++srcx;
-                    posx -= 0x10000L;
-                }
-                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
-            }
             srcpixel = *src;
-            srcB = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcR = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            srcA = (Uint8)(srcpixel >> 24); srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel;
             dstpixel = *dst;
-            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel; dstA = 0xFF;
-            if (flags & SDL_COPY_MODULATE_COLOR) {
-                srcR = (srcR * modulateR) / 255;
-                srcG = (srcG * modulateG) / 255;
-                srcB = (srcB * modulateB) / 255;
-            }
-            if (flags & SDL_COPY_MODULATE_ALPHA) {
-                srcA = (srcA * modulateA) / 255;
-            }
+            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -6995,61 +8590,18 @@ static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
                 dstB = (srcB * dstB) / 255;
                 break;
             }
-            dstpixel = ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
             *dst = dstpixel;
-            posx += incx;
-            ++dst;
-        }
-        posy += incy;
-        info->dst += info->dst_pitch;
-    }
-}
-
-static void SDL_Blit_BGRA8888_BGR888_Scale(SDL_BlitInfo *info)
-{
-    const int flags = info->flags;
-    Uint32 pixel;
-    Uint32 R, G, B, A;
-    int srcy, srcx;
-    int posy, posx;
-    int incy, incx;
-
-    srcy = 0;
-    posy = 0;
-    incy = (info->src_h << 16) / info->dst_h;
-    incx = (info->src_w << 16) / info->dst_w;
-
-    while (info->dst_h--) {
-        Uint32 *src;
-        Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        srcx = -1;
-        posx = 0x10000L;
-        while (posy >= 0x10000L) {
-            ++srcy;
-            posy -= 0x10000L;
-        }
-        while (n--) {
-            if (posx >= 0x10000L) {
-                while (posx >= 0x10000L) {
-                    ++srcx;
-                    posx -= 0x10000L;
-                }
-                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
-            }
-            pixel = *src;
-            B = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); R = (Uint8)(pixel >> 8); A = (Uint8)pixel;
-            pixel = ((Uint32)B << 16) | ((Uint32)G << 8) | R;
-            *dst = pixel;
-            posx += incx;
+            ++src;
             ++dst;
         }
-        posy += incy;
+        info->src += info->src_pitch;
         info->dst += info->dst_pitch;
     }
 }
+#endif /* defined(__SSE2__) */
 
-static void SDL_Blit_BGRA8888_BGR888_Blend(SDL_BlitInfo *info)
+static void SDL_Blit_ARGB8888_ARGB8888_Blend(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
     Uint32 srcpixel;
@@ -7063,9 +8615,9 @@ static void SDL_Blit_BGRA8888_BGR888_Blend(SDL_BlitInfo *info)
         int n = info->dst_w;
         while (n--) {
             srcpixel = *src;
-            srcB = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcR = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            srcA = (Uint8)(srcpixel >> 24); srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel;
             dstpixel = *dst;
-            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel; dstA = 0xFF;
+            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -7098,7 +8650,7 @@ static void SDL_Blit_BGRA8888_BGR888_Blend(SDL_BlitInfo *info)
                 dstB = (srcB * dstB) / 255;
                 break;
             }
-            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
+            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
             *dst = dstpixel;
             ++src;
             ++dst;
@@ -7108,7 +8660,7 @@ static void SDL_Blit_BGRA8888_BGR888_Blend(SDL_BlitInfo *info)
     }
 }
 
-static void SDL_Blit_BGRA8888_BGR888_Blend_Scale(SDL_BlitInfo *info)
+static void SDL_Blit_ARGB8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
     Uint32 srcpixel;
@@ -7143,9 +8695,9 @@ static void SDL_Blit_BGRA8888_BGR888_Blend_Scale(SDL_BlitInfo *info)
                 src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
             }
             srcpixel = *src;
-            srcB = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcR = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            srcA = (Uint8)(srcpixel >> 24); srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel;
             dstpixel = *dst;
-            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel; dstA = 0xFF;
+            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -7178,7 +8730,7 @@ static void SDL_Blit_BGRA8888_BGR888_Blend_Scale(SDL_BlitInfo *info)
                 dstB = (srcB * dstB) / 255;
                 break;
             }
-            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
+            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
             *dst = dstpixel;
             posx += incx;
             ++dst;
@@ -7188,13 +8740,21 @@ static void SDL_Blit_BGRA8888_BGR888_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
-static void SDL_Blit_BGRA8888_BGR888_Modulate(SDL_BlitInfo *info)
+#if SDL_AVX2_BLITTERS
+static void SDL_TARGETING_AVX2 SDL_Blit_ARGB8888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
     const Uint32 modulateR = info->r;
     const Uint32 modulateG = info->g;
     const Uint32 modulateB = info->b;
     const Uint32 modulateA = info->a;
+    const __m256i vmodulateR = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m256i vmodulateG = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m256i vmodulateB = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m256i vmodulateA = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m256i v255 = _mm256_set1_epi32(0xFF);
+    const __m256i vdiv = _mm256_set1_epi32(0x8081);
+    __m256i vpixel, vR, vG, vB, vA;
     Uint32 pixel;
     Uint32 R, G, B, A;
 
@@ -7202,9 +8762,24 @@ static void SDL_Blit_BGRA8888_BGR888_Modulate(SDL_BlitInfo *info)
         Uint32 *src = (Uint32 *)info->src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
+        while (n >= 8) {
+            vpixel = _mm256_loadu_si256((__m256i *)src);
+            vR = _mm256_and_si256(_mm256_srli_epi32(vpixel, 16), v255);
+            vG = _mm256_and_si256(_mm256_srli_epi32(vpixel, 8), v255);
+            vB = _mm256_and_si256(vpixel, v255);
+            vA = _mm256_srli_epi32(vpixel, 24);
+            vR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vR, vmodulateR), vdiv), 7);
+            vG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vG, vmodulateG), vdiv), 7);
+            vB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vB, vmodulateB), vdiv), 7);
+            vA = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vA, vmodulateA), vdiv), 7);
+            _mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(vR, 16), _mm256_slli_epi32(vG, 8)), vB), _mm256_slli_epi32(vA, 24)));
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
         while (n--) {
             pixel = *src;
-            B = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); R = (Uint8)(pixel >> 8); A = (Uint8)pixel;
+            A = (Uint8)(pixel >> 24); R = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); B = (Uint8)pixel;
             if (flags & SDL_COPY_MODULATE_COLOR) {
                 R = (R * modulateR) / 255;
                 G = (G * modulateG) / 255;
@@ -7213,7 +8788,7 @@ static void SDL_Blit_BGRA8888_BGR888_Modulate(SDL_BlitInfo *info)
             if (flags & SDL_COPY_MODULATE_ALPHA) {
                 A = (A * modulateA) / 255;
             }
-            pixel = ((Uint32)B << 16) | ((Uint32)G << 8) | R;
+            pixel = ((Uint32)A << 24) | ((Uint32)R << 16) | ((Uint32)G << 8) | B;
             *dst = pixel;
             ++src;
             ++dst;
@@ -7222,45 +8797,48 @@ static void SDL_Blit_BGRA8888_BGR888_Modulate(SDL_BlitInfo *info)
         info->dst += info->dst_pitch;
     }
 }
+#endif /* SDL_AVX2_BLITTERS */
 
-static void SDL_Blit_BGRA8888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
+#if defined(__SSE2__)
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_SSE2(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
     const Uint32 modulateR = info->r;
     const Uint32 modulateG = info->g;
     const Uint32 modulateB = info->b;
     const Uint32 modulateA = info->a;
+    const __m128i vmodulateR = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m128i vmodulateG = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m128i vmodulateB = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m128i vmodulateA = _mm_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m128i v255 = _mm_set1_epi32(0xFF);
+    const __m128i vdiv = _mm_set1_epi32(0x8081);
+    __m128i vpixel, vR, vG, vB, vA;
     Uint32 pixel;
     Uint32 R, G, B, A;
-    int srcy, srcx;
-    int posy, posx;
-    int incy, incx;
-
-    srcy = 0;
-    posy = 0;
-    incy = (info->src_h << 16) / info->dst_h;
-    incx = (info->src_w << 16) / info->dst_w;
 
     while (info->dst_h--) {
-        Uint32 *src;
+        Uint32 *src = (Uint32 *)info->src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
-        srcx = -1;
-        posx = 0x10000L;
-        while (posy >= 0x10000L) {
-            ++srcy;
-            posy -= 0x10000L;
+        while (n >= 4) {
+            vpixel = _mm_loadu_si128((__m128i *)src);
+            vR = _mm_and_si128(_mm_srli_epi32(vpixel, 16), v255);
+            vG = _mm_and_si128(_mm_srli_epi32(vpixel, 8), v255);
+            vB = _mm_and_si128(vpixel, v255);
+            vA = _mm_srli_epi32(vpixel, 24);
+            vR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vR, vmodulateR), vdiv), 7);
+            vG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vG, vmodulateG), vdiv), 7);
+            vB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vB, vmodulateB), vdiv), 7);
+            vA = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vA, vmodulateA), vdiv), 7);
+            _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(vR, 16), _mm_slli_epi32(vG, 8)), vB), _mm_slli_epi32(vA, 24)));
+            src += 4;
+            dst += 4;
+            n -= 4;
         }
         while (n--) {
-            if (posx >= 0x10000L) {
-                while (posx >= 0x10000L) {
-                    ++srcx;
-                    posx -= 0x10000L;
-                }
-                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
-            }
             pixel = *src;
-            B = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); R = (Uint8)(pixel >> 8); A = (Uint8)pixel;
+            A = (Uint8)(pixel >> 24); R = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); B = (Uint8)pixel;
             if (flags & SDL_COPY_MODULATE_COLOR) {
                 R = (R * modulateR) / 255;
                 G = (G * modulateG) / 255;
@@ -7269,79 +8847,44 @@ static void SDL_Blit_BGRA8888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
             if (flags & SDL_COPY_MODULATE_ALPHA) {
                 A = (A * modulateA) / 255;
             }
-            pixel = ((Uint32)B << 16) | ((Uint32)G << 8) | R;
+            pixel = ((Uint32)A << 24) | ((Uint32)R << 16) | ((Uint32)G << 8) | B;
             *dst = pixel;
-            posx += incx;
+            ++src;
             ++dst;
         }
-        posy += incy;
+        info->src += info->src_pitch;
         info->dst += info->dst_pitch;
     }
 }
+#endif /* defined(__SSE2__) */
 
-static void SDL_Blit_BGRA8888_BGR888_Modulate_Blend(SDL_BlitInfo *info)
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
     const Uint32 modulateR = info->r;
     const Uint32 modulateG = info->g;
     const Uint32 modulateB = info->b;
     const Uint32 modulateA = info->a;
-    Uint32 srcpixel;
-    Uint32 srcR, srcG, srcB, srcA;
-    Uint32 dstpixel;
-    Uint32 dstR, dstG, dstB, dstA;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
 
     while (info->dst_h--) {
         Uint32 *src = (Uint32 *)info->src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         while (n--) {
-            srcpixel = *src;
-            srcB = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcR = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
-            dstpixel = *dst;
-            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel; dstA = 0xFF;
+            pixel = *src;
+            A = (Uint8)(pixel >> 24); R = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); B = (Uint8)pixel;
             if (flags & SDL_COPY_MODULATE_COLOR) {
-                srcR = (srcR * modulateR) / 255;
-                srcG = (srcG * modulateG) / 255;
-                srcB = (srcB * modulateB) / 255;
+                R = (R * modulateR) / 255;
+                G = (G * modulateG) / 255;
+                B = (B * modulateB) / 255;
             }
             if (flags & SDL_COPY_MODULATE_ALPHA) {
-                srcA = (srcA * modulateA) / 255;
+                A = (A * modulateA) / 255;
             }
-            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
-                /* This goes away if we ever use premultiplied alpha */
-                if (srcA < 255) {
-                    srcR = (srcR * srcA) / 255;
-                    srcG = (srcG * srcA) / 255;
-                    srcB = (srcB * srcA) / 255;
-                }
-            }
-            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
-            case SDL_COPY_MASK:
-                if (srcA) {
-                    dstR = srcR;
-                    dstG = srcG;
-                    dstB = srcB;
-                }
-                break;
-            case SDL_COPY_BLEND:
-                dstR = srcR + ((255 - srcA) * dstR) / 255;
-                dstG = srcG + ((255 - srcA) * dstG) / 255;
-                dstB = srcB + ((255 - srcA) * dstB) / 255;
-                break;
-            case SDL_COPY_ADD:
-                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
-                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
-                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
-                break;
-            case SDL_COPY_MOD:
-                dstR = (srcR * dstR) / 255;
-                dstG = (srcG * dstG) / 255;
-                dstB = (srcB * dstB) / 255;
-                break;
-            }
-            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
-            *dst = dstpixel;
+            pixel = ((Uint32)A << 24) | ((Uint32)R << 16) | ((Uint32)G << 8) | B;
+            *dst = pixel;
             ++src;
             ++dst;
         }
@@ -7350,17 +8893,15 @@ static void SDL_Blit_BGRA8888_BGR888_Modulate_Blend(SDL_BlitInfo *info)
     }
 }
 
-static void SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
     const Uint32 modulateR = info->r;
     const Uint32 modulateG = info->g;
     const Uint32 modulateB = info->b;
     const Uint32 modulateA = info->a;
-    Uint32 srcpixel;
-    Uint32 srcR, srcG, srcB, srcA;
-    Uint32 dstpixel;
-    Uint32 dstR, dstG, dstB, dstA;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
     int srcy, srcx;
     int posy, posx;
     int incy, incx;
@@ -7388,10 +8929,107 @@ static void SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
                 }
                 src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
             }
+            pixel = *src;
+            A = (Uint8)(pixel >> 24); R = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); B = (Uint8)pixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = (R * modulateR) / 255;
+                G = (G * modulateG) / 255;
+                B = (B * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = (A * modulateA) / 255;
+            }
+            pixel = ((Uint32)A << 24) | ((Uint32)R << 16) | ((Uint32)G << 8) | B;
+            *dst = pixel;
+            posx += incx;
+            ++dst;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+#if SDL_AVX2_BLITTERS
+static void SDL_TARGETING_AVX2 SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    const __m256i vmodulateR = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m256i vmodulateG = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m256i vmodulateB = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m256i vmodulateA = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m256i v255 = _mm256_set1_epi32(0xFF);
+    const __m256i vdiv = _mm256_set1_epi32(0x8081);
+    const __m256i vzero = _mm256_setzero_si256();
+    __m256i vkeep, vinvA;
+    __m256i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m256i vdstpixel, vdstR, vdstG, vdstB, vdstA;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB, dstA;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            vsrcpixel = _mm256_loadu_si256((__m256i *)src);
+            vsrcR = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 16), v255);
+            vsrcG = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 8), v255);
+            vsrcB = _mm256_and_si256(vsrcpixel, v255);
+            vsrcA = _mm256_srli_epi32(vsrcpixel, 24);
+            vdstpixel = _mm256_loadu_si256((__m256i *)dst);
+            vdstR = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 16), v255);
+            vdstG = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm256_and_si256(vdstpixel, v255);
+            vdstA = _mm256_srli_epi32(vdstpixel, 24);
+            vsrcR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vmodulateR), vdiv), 7);
+            vsrcG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vmodulateG), vdiv), 7);
+            vsrcB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vmodulateB), vdiv), 7);
+            vsrcA = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcA, vmodulateA), vdiv), 7);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm256_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm256_or_si256(_mm256_and_si256(vkeep, vdstR), _mm256_andnot_si256(vkeep, vsrcR));
+                vdstG = _mm256_or_si256(_mm256_and_si256(vkeep, vdstG), _mm256_andnot_si256(vkeep, vsrcG));
+                vdstB = _mm256_or_si256(_mm256_and_si256(vkeep, vdstB), _mm256_andnot_si256(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm256_sub_epi32(v255, vsrcA);
+                vdstR = _mm256_add_epi32(vsrcR, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm256_add_epi32(vsrcG, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm256_add_epi32(vsrcB, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm256_min_epi16(_mm256_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm256_min_epi16(_mm256_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm256_min_epi16(_mm256_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(vdstR, 16), _mm256_slli_epi32(vdstG, 8)), vdstB), _mm256_slli_epi32(vdstA, 24)));
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
             srcpixel = *src;
-            srcB = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcR = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            srcA = (Uint8)(srcpixel >> 24); srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel;
             dstpixel = *dst;
-            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel; dstA = 0xFF;
+            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
             if (flags & SDL_COPY_MODULATE_COLOR) {
                 srcR = (srcR * modulateR) / 255;
                 srcG = (srcG * modulateG) / 255;
@@ -7432,63 +9070,156 @@ static void SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
                 dstB = (srcB * dstB) / 255;
                 break;
             }
-            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
+            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
             *dst = dstpixel;
-            posx += incx;
+            ++src;
             ++dst;
         }
-        posy += incy;
+        info->src += info->src_pitch;
         info->dst += info->dst_pitch;
     }
 }
+#endif /* SDL_AVX2_BLITTERS */
 
-static void SDL_Blit_BGRA8888_ARGB8888_Scale(SDL_BlitInfo *info)
+#if defined(__SSE2__)
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
-    Uint32 pixel;
-    Uint32 R, G, B, A;
-    int srcy, srcx;
-    int posy, posx;
-    int incy, incx;
-
-    srcy = 0;
-    posy = 0;
-    incy = (info->src_h << 16) / info->dst_h;
-    incx = (info->src_w << 16) / info->dst_w;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    const __m128i vmodulateR = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m128i vmodulateG = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m128i vmodulateB = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m128i vmodulateA = _mm_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m128i v255 = _mm_set1_epi32(0xFF);
+    const __m128i vdiv = _mm_set1_epi32(0x8081);
+    const __m128i vzero = _mm_setzero_si128();
+    __m128i vkeep, vinvA;
+    __m128i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m128i vdstpixel, vdstR, vdstG, vdstB, vdstA;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB, dstA;
 
     while (info->dst_h--) {
-        Uint32 *src;
+        Uint32 *src = (Uint32 *)info->src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
-        srcx = -1;
-        posx = 0x10000L;
-        while (posy >= 0x10000L) {
-            ++srcy;
-            posy -= 0x10000L;
+        while (n >= 4) {
+            vsrcpixel = _mm_loadu_si128((__m128i *)src);
+            vsrcR = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 16), v255);
+            vsrcG = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 8), v255);
+            vsrcB = _mm_and_si128(vsrcpixel, v255);
+            vsrcA = _mm_srli_epi32(vsrcpixel, 24);
+            vdstpixel = _mm_loadu_si128((__m128i *)dst);
+            vdstR = _mm_and_si128(_mm_srli_epi32(vdstpixel, 16), v255);
+            vdstG = _mm_and_si128(_mm_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm_and_si128(vdstpixel, v255);
+            vdstA = _mm_srli_epi32(vdstpixel, 24);
+            vsrcR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vmodulateR), vdiv), 7);
+            vsrcG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vmodulateG), vdiv), 7);
+            vsrcB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vmodulateB), vdiv), 7);
+            vsrcA = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcA, vmodulateA), vdiv), 7);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm_or_si128(_mm_and_si128(vkeep, vdstR), _mm_andnot_si128(vkeep, vsrcR));
+                vdstG = _mm_or_si128(_mm_and_si128(vkeep, vdstG), _mm_andnot_si128(vkeep, vsrcG));
+                vdstB = _mm_or_si128(_mm_and_si128(vkeep, vdstB), _mm_andnot_si128(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm_sub_epi32(v255, vsrcA);
+                vdstR = _mm_add_epi32(vsrcR, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm_add_epi32(vsrcG, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm_add_epi32(vsrcB, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm_min_epi16(_mm_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm_min_epi16(_mm_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm_min_epi16(_mm_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(vdstR, 16), _mm_slli_epi32(vdstG, 8)), vdstB), _mm_slli_epi32(vdstA, 24)));
+            src += 4;
+            dst += 4;
+            n -= 4;
         }
         while (n--) {
-            if (posx >= 0x10000L) {
-                while (posx >= 0x10000L) {
-                    ++srcx;
-                    posx -= 0x10000L;
+            srcpixel = *src;
+            srcA = (Uint8)(srcpixel >> 24); srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
                 }
-                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
             }
-            pixel = *src;
-            B = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); R = (Uint8)(pixel >> 8); A = (Uint8)pixel;
-            pixel = ((Uint32)A << 24) | ((Uint32)R << 16) | ((Uint32)G << 8) | B;
-            *dst = pixel;
-            posx += incx;
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            *dst = dstpixel;
+            ++src;
             ++dst;
         }
-        posy += incy;
+        info->src += info->src_pitch;
         info->dst += info->dst_pitch;
     }
 }
+#endif /* defined(__SSE2__) */
 
-static void SDL_Blit_BGRA8888_ARGB8888_Blend(SDL_BlitInfo *info)
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
     Uint32 srcpixel;
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
@@ -7500,9 +9231,17 @@ static void SDL_Blit_BGRA8888_ARGB8888_Blend(SDL_BlitInfo *info)
         int n = info->dst_w;
         while (n--) {
             srcpixel = *src;
-            srcB = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcR = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            srcA = (Uint8)(srcpixel >> 24); srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel;
             dstpixel = *dst;
             dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -7545,9 +9284,13 @@ static void SDL_Blit_BGRA8888_ARGB8888_Blend(SDL_BlitInfo *info)
     }
 }
 
-static void SDL_Blit_BGRA8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
     Uint32 srcpixel;
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
@@ -7580,9 +9323,17 @@ static void SDL_Blit_BGRA8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
                 src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
             }
             srcpixel = *src;
-            srcB = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcR = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            srcA = (Uint8)(srcpixel >> 24); srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel;
             dstpixel = *dst;
             dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -7625,18 +9376,8863 @@ static void SDL_Blit_BGRA8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
-static void SDL_Blit_BGRA8888_ARGB8888_Modulate(SDL_BlitInfo *info)
+static void SDL_Blit_RGBA8888_RGB888_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
-    const Uint32 modulateR = info->r;
-    const Uint32 modulateG = info->g;
-    const Uint32 modulateB = info->b;
-    const Uint32 modulateA = info->a;
     Uint32 pixel;
     Uint32 R, G, B, A;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
 
     while (info->dst_h--) {
-        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        while (n--) {
+            if (posx >= 0x10000L) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            }
+            pixel = *src;
+            R = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); B = (Uint8)(pixel >> 8); A = (Uint8)pixel;
+            pixel = ((Uint32)R << 16) | ((Uint32)G << 8) | B;
+            *dst = pixel;
+            posx += incx;
+            ++dst;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+#if SDL_AVX2_BLITTERS
+static void SDL_TARGETING_AVX2 SDL_Blit_RGBA8888_RGB888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i v255 = _mm256_set1_epi32(0xFF);
+    const __m256i vdiv = _mm256_set1_epi32(0x8081);
+    const __m256i vzero = _mm256_setzero_si256();
+    __m256i vkeep, vinvA;
+    __m256i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m256i vdstpixel, vdstR, vdstG, vdstB;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            vsrcpixel = _mm256_loadu_si256((__m256i *)src);
+            vsrcR = _mm256_srli_epi32(vsrcpixel, 24);
+            vsrcG = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 16), v255);
+            vsrcB = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 8), v255);
+            vsrcA = _mm256_and_si256(vsrcpixel, v255);
+            vdstpixel = _mm256_loadu_si256((__m256i *)dst);
+            vdstR = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 16), v255);
+            vdstG = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm256_and_si256(vdstpixel, v255);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm256_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm256_or_si256(_mm256_and_si256(vkeep, vdstR), _mm256_andnot_si256(vkeep, vsrcR));
+                vdstG = _mm256_or_si256(_mm256_and_si256(vkeep, vdstG), _mm256_andnot_si256(vkeep, vsrcG));
+                vdstB = _mm256_or_si256(_mm256_and_si256(vkeep, vdstB), _mm256_andnot_si256(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm256_sub_epi32(v255, vsrcA);
+                vdstR = _mm256_add_epi32(vsrcR, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm256_add_epi32(vsrcG, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm256_add_epi32(vsrcB, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm256_min_epi16(_mm256_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm256_min_epi16(_mm256_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm256_min_epi16(_mm256_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(vdstR, 16), _mm256_slli_epi32(vdstG, 8)), vdstB));
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            srcpixel = *src;
+            srcR = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcB = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            *dst = dstpixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* SDL_AVX2_BLITTERS */
+
+#if defined(__SSE2__)
+static void SDL_Blit_RGBA8888_RGB888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i v255 = _mm_set1_epi32(0xFF);
+    const __m128i vdiv = _mm_set1_epi32(0x8081);
+    const __m128i vzero = _mm_setzero_si128();
+    __m128i vkeep, vinvA;
+    __m128i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m128i vdstpixel, vdstR, vdstG, vdstB;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            vsrcpixel = _mm_loadu_si128((__m128i *)src);
+            vsrcR = _mm_srli_epi32(vsrcpixel, 24);
+            vsrcG = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 16), v255);
+            vsrcB = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 8), v255);
+            vsrcA = _mm_and_si128(vsrcpixel, v255);
+            vdstpixel = _mm_loadu_si128((__m128i *)dst);
+            vdstR = _mm_and_si128(_mm_srli_epi32(vdstpixel, 16), v255);
+            vdstG = _mm_and_si128(_mm_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm_and_si128(vdstpixel, v255);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm_or_si128(_mm_and_si128(vkeep, vdstR), _mm_andnot_si128(vkeep, vsrcR));
+                vdstG = _mm_or_si128(_mm_and_si128(vkeep, vdstG), _mm_andnot_si128(vkeep, vsrcG));
+                vdstB = _mm_or_si128(_mm_and_si128(vkeep, vdstB), _mm_andnot_si128(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm_sub_epi32(v255, vsrcA);
+                vdstR = _mm_add_epi32(vsrcR, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm_add_epi32(vsrcG, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm_add_epi32(vsrcB, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm_min_epi16(_mm_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm_min_epi16(_mm_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm_min_epi16(_mm_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_or_si128(_mm_slli_epi32(vdstR, 16), _mm_slli_epi32(vdstG, 8)), vdstB));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixel = *src;
+            srcR = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcB = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            *dst = dstpixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* defined(__SSE2__) */
+
+static void SDL_Blit_RGBA8888_RGB888_Blend(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n--) {
+            srcpixel = *src;
+            srcR = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcB = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            *dst = dstpixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Blend_Scale(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        Uint32 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        while (n--) {
+            if (posx >= 0x10000L) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            }
+            srcpixel = *src;
+            srcR = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcB = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            *dst = dstpixel;
+            posx += incx;
+            ++dst;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+#if SDL_AVX2_BLITTERS
+static void SDL_TARGETING_AVX2 SDL_Blit_RGBA8888_RGB888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    const __m256i vmodulateR = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m256i vmodulateG = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m256i vmodulateB = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m256i vmodulateA = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m256i v255 = _mm256_set1_epi32(0xFF);
+    const __m256i vdiv = _mm256_set1_epi32(0x8081);
+    __m256i vpixel, vR, vG, vB, vA;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            vpixel = _mm256_loadu_si256((__m256i *)src);
+            vR = _mm256_srli_epi32(vpixel, 24);
+            vG = _mm256_and_si256(_mm256_srli_epi32(vpixel, 16), v255);
+            vB = _mm256_and_si256(_mm256_srli_epi32(vpixel, 8), v255);
+            vA = _mm256_and_si256(vpixel, v255);
+            vR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vR, vmodulateR), vdiv), 7);
+            vG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vG, vmodulateG), vdiv), 7);
+            vB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vB, vmodulateB), vdiv), 7);
+            vA = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vA, vmodulateA), vdiv), 7);
+            _mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(vR, 16), _mm256_slli_epi32(vG, 8)), vB));
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            pixel = *src;
+            R = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); B = (Uint8)(pixel >> 8); A = (Uint8)pixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = (R * modulateR) / 255;
+                G = (G * modulateG) / 255;
+                B = (B * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = (A * modulateA) / 255;
+            }
+            pixel = ((Uint32)R << 16) | ((Uint32)G << 8) | B;
+            *dst = pixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* SDL_AVX2_BLITTERS */
+
+#if defined(__SSE2__)
+static void SDL_Blit_RGBA8888_RGB888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    const __m128i vmodulateR = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m128i vmodulateG = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m128i vmodulateB = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m128i vmodulateA = _mm_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m128i v255 = _mm_set1_epi32(0xFF);
+    const __m128i vdiv = _mm_set1_epi32(0x8081);
+    __m128i vpixel, vR, vG, vB, vA;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            vpixel = _mm_loadu_si128((__m128i *)src);
+            vR = _mm_srli_epi32(vpixel, 24);
+            vG = _mm_and_si128(_mm_srli_epi32(vpixel, 16), v255);
+            vB = _mm_and_si128(_mm_srli_epi32(vpixel, 8), v255);
+            vA = _mm_and_si128(vpixel, v255);
+            vR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vR, vmodulateR), vdiv), 7);
+            vG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vG, vmodulateG), vdiv), 7);
+            vB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vB, vmodulateB), vdiv), 7);
+            vA = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vA, vmodulateA), vdiv), 7);
+            _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_or_si128(_mm_slli_epi32(vR, 16), _mm_slli_epi32(vG, 8)), vB));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            pixel = *src;
+            R = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); B = (Uint8)(pixel >> 8); A = (Uint8)pixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = (R * modulateR) / 255;
+                G = (G * modulateG) / 255;
+                B = (B * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = (A * modulateA) / 255;
+            }
+            pixel = ((Uint32)R << 16) | ((Uint32)G << 8) | B;
+            *dst = pixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* defined(__SSE2__) */
+
+static void SDL_Blit_RGBA8888_RGB888_Modulate(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n--) {
+            pixel = *src;
+            R = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); B = (Uint8)(pixel >> 8); A = (Uint8)pixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = (R * modulateR) / 255;
+                G = (G * modulateG) / 255;
+                B = (B * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = (A * modulateA) / 255;
+            }
+            pixel = ((Uint32)R << 16) | ((Uint32)G << 8) | B;
+            *dst = pixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Modulate_Scale(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        Uint32 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        while (n--) {
+            if (posx >= 0x10000L) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            }
+            pixel = *src;
+            R = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); B = (Uint8)(pixel >> 8); A = (Uint8)pixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = (R * modulateR) / 255;
+                G = (G * modulateG) / 255;
+                B = (B * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = (A * modulateA) / 255;
+            }
+            pixel = ((Uint32)R << 16) | ((Uint32)G << 8) | B;
+            *dst = pixel;
+            posx += incx;
+            ++dst;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+#if SDL_AVX2_BLITTERS
+static void SDL_TARGETING_AVX2 SDL_Blit_RGBA8888_RGB888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    const __m256i vmodulateR = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m256i vmodulateG = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m256i vmodulateB = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m256i vmodulateA = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m256i v255 = _mm256_set1_epi32(0xFF);
+    const __m256i vdiv = _mm256_set1_epi32(0x8081);
+    const __m256i vzero = _mm256_setzero_si256();
+    __m256i vkeep, vinvA;
+    __m256i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m256i vdstpixel, vdstR, vdstG, vdstB;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            vsrcpixel = _mm256_loadu_si256((__m256i *)src);
+            vsrcR = _mm256_srli_epi32(vsrcpixel, 24);
+            vsrcG = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 16), v255);
+            vsrcB = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 8), v255);
+            vsrcA = _mm256_and_si256(vsrcpixel, v255);
+            vdstpixel = _mm256_loadu_si256((__m256i *)dst);
+            vdstR = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 16), v255);
+            vdstG = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm256_and_si256(vdstpixel, v255);
+            vsrcR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vmodulateR), vdiv), 7);
+            vsrcG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vmodulateG), vdiv), 7);
+            vsrcB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vmodulateB), vdiv), 7);
+            vsrcA = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcA, vmodulateA), vdiv), 7);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm256_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm256_or_si256(_mm256_and_si256(vkeep, vdstR), _mm256_andnot_si256(vkeep, vsrcR));
+                vdstG = _mm256_or_si256(_mm256_and_si256(vkeep, vdstG), _mm256_andnot_si256(vkeep, vsrcG));
+                vdstB = _mm256_or_si256(_mm256_and_si256(vkeep, vdstB), _mm256_andnot_si256(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm256_sub_epi32(v255, vsrcA);
+                vdstR = _mm256_add_epi32(vsrcR, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm256_add_epi32(vsrcG, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm256_add_epi32(vsrcB, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm256_min_epi16(_mm256_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm256_min_epi16(_mm256_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm256_min_epi16(_mm256_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(vdstR, 16), _mm256_slli_epi32(vdstG, 8)), vdstB));
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            srcpixel = *src;
+            srcR = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcB = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            *dst = dstpixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* SDL_AVX2_BLITTERS */
+
+#if defined(__SSE2__)
+static void SDL_Blit_RGBA8888_RGB888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    const __m128i vmodulateR = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m128i vmodulateG = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m128i vmodulateB = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m128i vmodulateA = _mm_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m128i v255 = _mm_set1_epi32(0xFF);
+    const __m128i vdiv = _mm_set1_epi32(0x8081);
+    const __m128i vzero = _mm_setzero_si128();
+    __m128i vkeep, vinvA;
+    __m128i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m128i vdstpixel, vdstR, vdstG, vdstB;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            vsrcpixel = _mm_loadu_si128((__m128i *)src);
+            vsrcR = _mm_srli_epi32(vsrcpixel, 24);
+            vsrcG = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 16), v255);
+            vsrcB = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 8), v255);
+            vsrcA = _mm_and_si128(vsrcpixel, v255);
+            vdstpixel = _mm_loadu_si128((__m128i *)dst);
+            vdstR = _mm_and_si128(_mm_srli_epi32(vdstpixel, 16), v255);
+            vdstG = _mm_and_si128(_mm_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm_and_si128(vdstpixel, v255);
+            vsrcR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vmodulateR), vdiv), 7);
+            vsrcG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vmodulateG), vdiv), 7);
+            vsrcB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vmodulateB), vdiv), 7);
+            vsrcA = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcA, vmodulateA), vdiv), 7);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm_or_si128(_mm_and_si128(vkeep, vdstR), _mm_andnot_si128(vkeep, vsrcR));
+                vdstG = _mm_or_si128(_mm_and_si128(vkeep, vdstG), _mm_andnot_si128(vkeep, vsrcG));
+                vdstB = _mm_or_si128(_mm_and_si128(vkeep, vdstB), _mm_andnot_si128(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm_sub_epi32(v255, vsrcA);
+                vdstR = _mm_add_epi32(vsrcR, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm_add_epi32(vsrcG, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm_add_epi32(vsrcB, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm_min_epi16(_mm_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm_min_epi16(_mm_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm_min_epi16(_mm_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_or_si128(_mm_slli_epi32(vdstR, 16), _mm_slli_epi32(vdstG, 8)), vdstB));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixel = *src;
+            srcR = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcB = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            *dst = dstpixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* defined(__SSE2__) */
+
+static void SDL_Blit_RGBA8888_RGB888_Modulate_Blend(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n--) {
+            srcpixel = *src;
+            srcR = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcB = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            *dst = dstpixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        Uint32 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        while (n--) {
+            if (posx >= 0x10000L) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            }
+            srcpixel = *src;
+            srcR = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcB = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            *dst = dstpixel;
+            posx += incx;
+            ++dst;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Scale(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        Uint32 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        while (n--) {
+            if (posx >= 0x10000L) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            }
+            pixel = *src;
+            R = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); B = (Uint8)(pixel >> 8); A = (Uint8)pixel;
+            pixel = ((Uint32)B << 16) | ((Uint32)G << 8) | R;
+            *dst = pixel;
+            posx += incx;
+            ++dst;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+#if SDL_AVX2_BLITTERS
+static void SDL_TARGETING_AVX2 SDL_Blit_RGBA8888_BGR888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i v255 = _mm256_set1_epi32(0xFF);
+    const __m256i vdiv = _mm256_set1_epi32(0x8081);
+    const __m256i vzero = _mm256_setzero_si256();
+    __m256i vkeep, vinvA;
+    __m256i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m256i vdstpixel, vdstR, vdstG, vdstB;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            vsrcpixel = _mm256_loadu_si256((__m256i *)src);
+            vsrcR = _mm256_srli_epi32(vsrcpixel, 24);
+            vsrcG = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 16), v255);
+            vsrcB = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 8), v255);
+            vsrcA = _mm256_and_si256(vsrcpixel, v255);
+            vdstpixel = _mm256_loadu_si256((__m256i *)dst);
+            vdstR = _mm256_and_si256(vdstpixel, v255);
+            vdstG = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 16), v255);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm256_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm256_or_si256(_mm256_and_si256(vkeep, vdstR), _mm256_andnot_si256(vkeep, vsrcR));
+                vdstG = _mm256_or_si256(_mm256_and_si256(vkeep, vdstG), _mm256_andnot_si256(vkeep, vsrcG));
+                vdstB = _mm256_or_si256(_mm256_and_si256(vkeep, vdstB), _mm256_andnot_si256(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm256_sub_epi32(v255, vsrcA);
+                vdstR = _mm256_add_epi32(vsrcR, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm256_add_epi32(vsrcG, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm256_add_epi32(vsrcB, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm256_min_epi16(_mm256_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm256_min_epi16(_mm256_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm256_min_epi16(_mm256_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(_mm256_or_si256(vdstR, _mm256_slli_epi32(vdstG, 8)), _mm256_slli_epi32(vdstB, 16)));
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            srcpixel = *src;
+            srcR = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcB = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel;
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
+            *dst = dstpixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* SDL_AVX2_BLITTERS */
+
+#if defined(__SSE2__)
+static void SDL_Blit_RGBA8888_BGR888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i v255 = _mm_set1_epi32(0xFF);
+    const __m128i vdiv = _mm_set1_epi32(0x8081);
+    const __m128i vzero = _mm_setzero_si128();
+    __m128i vkeep, vinvA;
+    __m128i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m128i vdstpixel, vdstR, vdstG, vdstB;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            vsrcpixel = _mm_loadu_si128((__m128i *)src);
+            vsrcR = _mm_srli_epi32(vsrcpixel, 24);
+            vsrcG = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 16), v255);
+            vsrcB = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 8), v255);
+            vsrcA = _mm_and_si128(vsrcpixel, v255);
+            vdstpixel = _mm_loadu_si128((__m128i *)dst);
+            vdstR = _mm_and_si128(vdstpixel, v255);
+            vdstG = _mm_and_si128(_mm_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm_and_si128(_mm_srli_epi32(vdstpixel, 16), v255);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm_or_si128(_mm_and_si128(vkeep, vdstR), _mm_andnot_si128(vkeep, vsrcR));
+                vdstG = _mm_or_si128(_mm_and_si128(vkeep, vdstG), _mm_andnot_si128(vkeep, vsrcG));
+                vdstB = _mm_or_si128(_mm_and_si128(vkeep, vdstB), _mm_andnot_si128(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm_sub_epi32(v255, vsrcA);
+                vdstR = _mm_add_epi32(vsrcR, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm_add_epi32(vsrcG, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm_add_epi32(vsrcB, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm_min_epi16(_mm_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm_min_epi16(_mm_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm_min_epi16(_mm_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_or_si128(vdstR, _mm_slli_epi32(vdstG, 8)), _mm_slli_epi32(vdstB, 16)));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixel = *src;
+            srcR = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcB = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel;
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
+            *dst = dstpixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* defined(__SSE2__) */
+
+static void SDL_Blit_RGBA8888_BGR888_Blend(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n--) {
+            srcpixel = *src;
+            srcR = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcB = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel;
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
+            *dst = dstpixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Blend_Scale(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        Uint32 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        while (n--) {
+            if (posx >= 0x10000L) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            }
+            srcpixel = *src;
+            srcR = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcB = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel;
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
+            *dst = dstpixel;
+            posx += incx;
+            ++dst;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+#if SDL_AVX2_BLITTERS
+static void SDL_TARGETING_AVX2 SDL_Blit_RGBA8888_BGR888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    const __m256i vmodulateR = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m256i vmodulateG = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m256i vmodulateB = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m256i vmodulateA = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m256i v255 = _mm256_set1_epi32(0xFF);
+    const __m256i vdiv = _mm256_set1_epi32(0x8081);
+    __m256i vpixel, vR, vG, vB, vA;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            vpixel = _mm256_loadu_si256((__m256i *)src);
+            vR = _mm256_srli_epi32(vpixel, 24);
+            vG = _mm256_and_si256(_mm256_srli_epi32(vpixel, 16), v255);
+            vB = _mm256_and_si256(_mm256_srli_epi32(vpixel, 8), v255);
+            vA = _mm256_and_si256(vpixel, v255);
+            vR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vR, vmodulateR), vdiv), 7);
+            vG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vG, vmodulateG), vdiv), 7);
+            vB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vB, vmodulateB), vdiv), 7);
+            vA = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vA, vmodulateA), vdiv), 7);
+            _mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(_mm256_or_si256(vR, _mm256_slli_epi32(vG, 8)), _mm256_slli_epi32(vB, 16)));
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            pixel = *src;
+            R = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); B = (Uint8)(pixel >> 8); A = (Uint8)pixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = (R * modulateR) / 255;
+                G = (G * modulateG) / 255;
+                B = (B * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = (A * modulateA) / 255;
+            }
+            pixel = ((Uint32)B << 16) | ((Uint32)G << 8) | R;
+            *dst = pixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* SDL_AVX2_BLITTERS */
+
+#if defined(__SSE2__)
+static void SDL_Blit_RGBA8888_BGR888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    const __m128i vmodulateR = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m128i vmodulateG = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m128i vmodulateB = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m128i vmodulateA = _mm_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m128i v255 = _mm_set1_epi32(0xFF);
+    const __m128i vdiv = _mm_set1_epi32(0x8081);
+    __m128i vpixel, vR, vG, vB, vA;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            vpixel = _mm_loadu_si128((__m128i *)src);
+            vR = _mm_srli_epi32(vpixel, 24);
+            vG = _mm_and_si128(_mm_srli_epi32(vpixel, 16), v255);
+            vB = _mm_and_si128(_mm_srli_epi32(vpixel, 8), v255);
+            vA = _mm_and_si128(vpixel, v255);
+            vR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vR, vmodulateR), vdiv), 7);
+            vG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vG, vmodulateG), vdiv), 7);
+            vB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vB, vmodulateB), vdiv), 7);
+            vA = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vA, vmodulateA), vdiv), 7);
+            _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_or_si128(vR, _mm_slli_epi32(vG, 8)), _mm_slli_epi32(vB, 16)));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            pixel = *src;
+            R = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); B = (Uint8)(pixel >> 8); A = (Uint8)pixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = (R * modulateR) / 255;
+                G = (G * modulateG) / 255;
+                B = (B * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = (A * modulateA) / 255;
+            }
+            pixel = ((Uint32)B << 16) | ((Uint32)G << 8) | R;
+            *dst = pixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* defined(__SSE2__) */
+
+static void SDL_Blit_RGBA8888_BGR888_Modulate(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n--) {
+            pixel = *src;
+            R = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); B = (Uint8)(pixel >> 8); A = (Uint8)pixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = (R * modulateR) / 255;
+                G = (G * modulateG) / 255;
+                B = (B * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = (A * modulateA) / 255;
+            }
+            pixel = ((Uint32)B << 16) | ((Uint32)G << 8) | R;
+            *dst = pixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        Uint32 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        while (n--) {
+            if (posx >= 0x10000L) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            }
+            pixel = *src;
+            R = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); B = (Uint8)(pixel >> 8); A = (Uint8)pixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = (R * modulateR) / 255;
+                G = (G * modulateG) / 255;
+                B = (B * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = (A * modulateA) / 255;
+            }
+            pixel = ((Uint32)B << 16) | ((Uint32)G << 8) | R;
+            *dst = pixel;
+            posx += incx;
+            ++dst;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+#if SDL_AVX2_BLITTERS
+static void SDL_TARGETING_AVX2 SDL_Blit_RGBA8888_BGR888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    const __m256i vmodulateR = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m256i vmodulateG = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m256i vmodulateB = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m256i vmodulateA = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m256i v255 = _mm256_set1_epi32(0xFF);
+    const __m256i vdiv = _mm256_set1_epi32(0x8081);
+    const __m256i vzero = _mm256_setzero_si256();
+    __m256i vkeep, vinvA;
+    __m256i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m256i vdstpixel, vdstR, vdstG, vdstB;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            vsrcpixel = _mm256_loadu_si256((__m256i *)src);
+            vsrcR = _mm256_srli_epi32(vsrcpixel, 24);
+            vsrcG = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 16), v255);
+            vsrcB = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 8), v255);
+            vsrcA = _mm256_and_si256(vsrcpixel, v255);
+            vdstpixel = _mm256_loadu_si256((__m256i *)dst);
+            vdstR = _mm256_and_si256(vdstpixel, v255);
+            vdstG = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 16), v255);
+            vsrcR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vmodulateR), vdiv), 7);
+            vsrcG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vmodulateG), vdiv), 7);
+            vsrcB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vmodulateB), vdiv), 7);
+            vsrcA = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcA, vmodulateA), vdiv), 7);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm256_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm256_or_si256(_mm256_and_si256(vkeep, vdstR), _mm256_andnot_si256(vkeep, vsrcR));
+                vdstG = _mm256_or_si256(_mm256_and_si256(vkeep, vdstG), _mm256_andnot_si256(vkeep, vsrcG));
+                vdstB = _mm256_or_si256(_mm256_and_si256(vkeep, vdstB), _mm256_andnot_si256(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm256_sub_epi32(v255, vsrcA);
+                vdstR = _mm256_add_epi32(vsrcR, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm256_add_epi32(vsrcG, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm256_add_epi32(vsrcB, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm256_min_epi16(_mm256_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm256_min_epi16(_mm256_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm256_min_epi16(_mm256_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(_mm256_or_si256(vdstR, _mm256_slli_epi32(vdstG, 8)), _mm256_slli_epi32(vdstB, 16)));
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            srcpixel = *src;
+            srcR = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcB = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
+            *dst = dstpixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* SDL_AVX2_BLITTERS */
+
+#if defined(__SSE2__)
+static void SDL_Blit_RGBA8888_BGR888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    const __m128i vmodulateR = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m128i vmodulateG = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m128i vmodulateB = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m128i vmodulateA = _mm_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m128i v255 = _mm_set1_epi32(0xFF);
+    const __m128i vdiv = _mm_set1_epi32(0x8081);
+    const __m128i vzero = _mm_setzero_si128();
+    __m128i vkeep, vinvA;
+    __m128i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m128i vdstpixel, vdstR, vdstG, vdstB;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            vsrcpixel = _mm_loadu_si128((__m128i *)src);
+            vsrcR = _mm_srli_epi32(vsrcpixel, 24);
+            vsrcG = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 16), v255);
+            vsrcB = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 8), v255);
+            vsrcA = _mm_and_si128(vsrcpixel, v255);
+            vdstpixel = _mm_loadu_si128((__m128i *)dst);
+            vdstR = _mm_and_si128(vdstpixel, v255);
+            vdstG = _mm_and_si128(_mm_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm_and_si128(_mm_srli_epi32(vdstpixel, 16), v255);
+            vsrcR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vmodulateR), vdiv), 7);
+            vsrcG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vmodulateG), vdiv), 7);
+            vsrcB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vmodulateB), vdiv), 7);
+            vsrcA = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcA, vmodulateA), vdiv), 7);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm_or_si128(_mm_and_si128(vkeep, vdstR), _mm_andnot_si128(vkeep, vsrcR));
+                vdstG = _mm_or_si128(_mm_and_si128(vkeep, vdstG), _mm_andnot_si128(vkeep, vsrcG));
+                vdstB = _mm_or_si128(_mm_and_si128(vkeep, vdstB), _mm_andnot_si128(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm_sub_epi32(v255, vsrcA);
+                vdstR = _mm_add_epi32(vsrcR, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm_add_epi32(vsrcG, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm_add_epi32(vsrcB, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm_min_epi16(_mm_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm_min_epi16(_mm_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm_min_epi16(_mm_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_or_si128(vdstR, _mm_slli_epi32(vdstG, 8)), _mm_slli_epi32(vdstB, 16)));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixel = *src;
+            srcR = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcB = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
+            *dst = dstpixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* defined(__SSE2__) */
+
+static void SDL_Blit_RGBA8888_BGR888_Modulate_Blend(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n--) {
+            srcpixel = *src;
+            srcR = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcB = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
+            *dst = dstpixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        Uint32 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        while (n--) {
+            if (posx >= 0x10000L) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            }
+            srcpixel = *src;
+            srcR = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcB = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
+            *dst = dstpixel;
+            posx += incx;
+            ++dst;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Scale(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        Uint32 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        while (n--) {
+            if (posx >= 0x10000L) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            }
+            pixel = *src;
+            R = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); B = (Uint8)(pixel >> 8); A = (Uint8)pixel;
+            pixel = ((Uint32)A << 24) | ((Uint32)R << 16) | ((Uint32)G << 8) | B;
+            *dst = pixel;
+            posx += incx;
+            ++dst;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+#if SDL_AVX2_BLITTERS
+static void SDL_TARGETING_AVX2 SDL_Blit_RGBA8888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i v255 = _mm256_set1_epi32(0xFF);
+    const __m256i vdiv = _mm256_set1_epi32(0x8081);
+    const __m256i vzero = _mm256_setzero_si256();
+    __m256i vkeep, vinvA;
+    __m256i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m256i vdstpixel, vdstR, vdstG, vdstB, vdstA;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB, dstA;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            vsrcpixel = _mm256_loadu_si256((__m256i *)src);
+            vsrcR = _mm256_srli_epi32(vsrcpixel, 24);
+            vsrcG = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 16), v255);
+            vsrcB = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 8), v255);
+            vsrcA = _mm256_and_si256(vsrcpixel, v255);
+            vdstpixel = _mm256_loadu_si256((__m256i *)dst);
+            vdstR = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 16), v255);
+            vdstG = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm256_and_si256(vdstpixel, v255);
+            vdstA = _mm256_srli_epi32(vdstpixel, 24);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm256_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm256_or_si256(_mm256_and_si256(vkeep, vdstR), _mm256_andnot_si256(vkeep, vsrcR));
+                vdstG = _mm256_or_si256(_mm256_and_si256(vkeep, vdstG), _mm256_andnot_si256(vkeep, vsrcG));
+                vdstB = _mm256_or_si256(_mm256_and_si256(vkeep, vdstB), _mm256_andnot_si256(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm256_sub_epi32(v255, vsrcA);
+                vdstR = _mm256_add_epi32(vsrcR, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm256_add_epi32(vsrcG, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm256_add_epi32(vsrcB, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm256_min_epi16(_mm256_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm256_min_epi16(_mm256_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm256_min_epi16(_mm256_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(vdstR, 16), _mm256_slli_epi32(vdstG, 8)), vdstB), _mm256_slli_epi32(vdstA, 24)));
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            srcpixel = *src;
+            srcR = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcB = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            *dst = dstpixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* SDL_AVX2_BLITTERS */
+
+#if defined(__SSE2__)
+static void SDL_Blit_RGBA8888_ARGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i v255 = _mm_set1_epi32(0xFF);
+    const __m128i vdiv = _mm_set1_epi32(0x8081);
+    const __m128i vzero = _mm_setzero_si128();
+    __m128i vkeep, vinvA;
+    __m128i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m128i vdstpixel, vdstR, vdstG, vdstB, vdstA;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB, dstA;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            vsrcpixel = _mm_loadu_si128((__m128i *)src);
+            vsrcR = _mm_srli_epi32(vsrcpixel, 24);
+            vsrcG = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 16), v255);
+            vsrcB = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 8), v255);
+            vsrcA = _mm_and_si128(vsrcpixel, v255);
+            vdstpixel = _mm_loadu_si128((__m128i *)dst);
+            vdstR = _mm_and_si128(_mm_srli_epi32(vdstpixel, 16), v255);
+            vdstG = _mm_and_si128(_mm_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm_and_si128(vdstpixel, v255);
+            vdstA = _mm_srli_epi32(vdstpixel, 24);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm_or_si128(_mm_and_si128(vkeep, vdstR), _mm_andnot_si128(vkeep, vsrcR));
+                vdstG = _mm_or_si128(_mm_and_si128(vkeep, vdstG), _mm_andnot_si128(vkeep, vsrcG));
+                vdstB = _mm_or_si128(_mm_and_si128(vkeep, vdstB), _mm_andnot_si128(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm_sub_epi32(v255, vsrcA);
+                vdstR = _mm_add_epi32(vsrcR, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm_add_epi32(vsrcG, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm_add_epi32(vsrcB, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm_min_epi16(_mm_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm_min_epi16(_mm_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm_min_epi16(_mm_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(vdstR, 16), _mm_slli_epi32(vdstG, 8)), vdstB), _mm_slli_epi32(vdstA, 24)));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixel = *src;
+            srcR = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcB = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            *dst = dstpixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* defined(__SSE2__) */
+
+static void SDL_Blit_RGBA8888_ARGB8888_Blend(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB, dstA;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n--) {
+            srcpixel = *src;
+            srcR = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcB = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            *dst = dstpixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB, dstA;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        Uint32 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        while (n--) {
+            if (posx >= 0x10000L) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            }
+            srcpixel = *src;
+            srcR = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcB = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            *dst = dstpixel;
+            posx += incx;
+            ++dst;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+#if SDL_AVX2_BLITTERS
+static void SDL_TARGETING_AVX2 SDL_Blit_RGBA8888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    const __m256i vmodulateR = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m256i vmodulateG = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m256i vmodulateB = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m256i vmodulateA = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m256i v255 = _mm256_set1_epi32(0xFF);
+    const __m256i vdiv = _mm256_set1_epi32(0x8081);
+    __m256i vpixel, vR, vG, vB, vA;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            vpixel = _mm256_loadu_si256((__m256i *)src);
+            vR = _mm256_srli_epi32(vpixel, 24);
+            vG = _mm256_and_si256(_mm256_srli_epi32(vpixel, 16), v255);
+            vB = _mm256_and_si256(_mm256_srli_epi32(vpixel, 8), v255);
+            vA = _mm256_and_si256(vpixel, v255);
+            vR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vR, vmodulateR), vdiv), 7);
+            vG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vG, vmodulateG), vdiv), 7);
+            vB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vB, vmodulateB), vdiv), 7);
+            vA = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vA, vmodulateA), vdiv), 7);
+            _mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(vR, 16), _mm256_slli_epi32(vG, 8)), vB), _mm256_slli_epi32(vA, 24)));
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            pixel = *src;
+            R = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); B = (Uint8)(pixel >> 8); A = (Uint8)pixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = (R * modulateR) / 255;
+                G = (G * modulateG) / 255;
+                B = (B * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = (A * modulateA) / 255;
+            }
+            pixel = ((Uint32)A << 24) | ((Uint32)R << 16) | ((Uint32)G << 8) | B;
+            *dst = pixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* SDL_AVX2_BLITTERS */
+
+#if defined(__SSE2__)
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    const __m128i vmodulateR = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m128i vmodulateG = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m128i vmodulateB = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m128i vmodulateA = _mm_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m128i v255 = _mm_set1_epi32(0xFF);
+    const __m128i vdiv = _mm_set1_epi32(0x8081);
+    __m128i vpixel, vR, vG, vB, vA;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            vpixel = _mm_loadu_si128((__m128i *)src);
+            vR = _mm_srli_epi32(vpixel, 24);
+            vG = _mm_and_si128(_mm_srli_epi32(vpixel, 16), v255);
+            vB = _mm_and_si128(_mm_srli_epi32(vpixel, 8), v255);
+            vA = _mm_and_si128(vpixel, v255);
+            vR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vR, vmodulateR), vdiv), 7);
+            vG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vG, vmodulateG), vdiv), 7);
+            vB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vB, vmodulateB), vdiv), 7);
+            vA = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vA, vmodulateA), vdiv), 7);
+            _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(vR, 16), _mm_slli_epi32(vG, 8)), vB), _mm_slli_epi32(vA, 24)));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            pixel = *src;
+            R = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); B = (Uint8)(pixel >> 8); A = (Uint8)pixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = (R * modulateR) / 255;
+                G = (G * modulateG) / 255;
+                B = (B * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = (A * modulateA) / 255;
+            }
+            pixel = ((Uint32)A << 24) | ((Uint32)R << 16) | ((Uint32)G << 8) | B;
+            *dst = pixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* defined(__SSE2__) */
+
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n--) {
+            pixel = *src;
+            R = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); B = (Uint8)(pixel >> 8); A = (Uint8)pixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = (R * modulateR) / 255;
+                G = (G * modulateG) / 255;
+                B = (B * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = (A * modulateA) / 255;
+            }
+            pixel = ((Uint32)A << 24) | ((Uint32)R << 16) | ((Uint32)G << 8) | B;
+            *dst = pixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        Uint32 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        while (n--) {
+            if (posx >= 0x10000L) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            }
+            pixel = *src;
+            R = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); B = (Uint8)(pixel >> 8); A = (Uint8)pixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = (R * modulateR) / 255;
+                G = (G * modulateG) / 255;
+                B = (B * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = (A * modulateA) / 255;
+            }
+            pixel = ((Uint32)A << 24) | ((Uint32)R << 16) | ((Uint32)G << 8) | B;
+            *dst = pixel;
+            posx += incx;
+            ++dst;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+#if SDL_AVX2_BLITTERS
+static void SDL_TARGETING_AVX2 SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    const __m256i vmodulateR = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m256i vmodulateG = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m256i vmodulateB = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m256i vmodulateA = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m256i v255 = _mm256_set1_epi32(0xFF);
+    const __m256i vdiv = _mm256_set1_epi32(0x8081);
+    const __m256i vzero = _mm256_setzero_si256();
+    __m256i vkeep, vinvA;
+    __m256i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m256i vdstpixel, vdstR, vdstG, vdstB, vdstA;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB, dstA;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            vsrcpixel = _mm256_loadu_si256((__m256i *)src);
+            vsrcR = _mm256_srli_epi32(vsrcpixel, 24);
+            vsrcG = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 16), v255);
+            vsrcB = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 8), v255);
+            vsrcA = _mm256_and_si256(vsrcpixel, v255);
+            vdstpixel = _mm256_loadu_si256((__m256i *)dst);
+            vdstR = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 16), v255);
+            vdstG = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm256_and_si256(vdstpixel, v255);
+            vdstA = _mm256_srli_epi32(vdstpixel, 24);
+            vsrcR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vmodulateR), vdiv), 7);
+            vsrcG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vmodulateG), vdiv), 7);
+            vsrcB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vmodulateB), vdiv), 7);
+            vsrcA = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcA, vmodulateA), vdiv), 7);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm256_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm256_or_si256(_mm256_and_si256(vkeep, vdstR), _mm256_andnot_si256(vkeep, vsrcR));
+                vdstG = _mm256_or_si256(_mm256_and_si256(vkeep, vdstG), _mm256_andnot_si256(vkeep, vsrcG));
+                vdstB = _mm256_or_si256(_mm256_and_si256(vkeep, vdstB), _mm256_andnot_si256(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm256_sub_epi32(v255, vsrcA);
+                vdstR = _mm256_add_epi32(vsrcR, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm256_add_epi32(vsrcG, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm256_add_epi32(vsrcB, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm256_min_epi16(_mm256_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm256_min_epi16(_mm256_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm256_min_epi16(_mm256_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(vdstR, 16), _mm256_slli_epi32(vdstG, 8)), vdstB), _mm256_slli_epi32(vdstA, 24)));
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            srcpixel = *src;
+            srcR = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcB = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            *dst = dstpixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* SDL_AVX2_BLITTERS */
+
+#if defined(__SSE2__)
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    const __m128i vmodulateR = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m128i vmodulateG = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m128i vmodulateB = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m128i vmodulateA = _mm_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m128i v255 = _mm_set1_epi32(0xFF);
+    const __m128i vdiv = _mm_set1_epi32(0x8081);
+    const __m128i vzero = _mm_setzero_si128();
+    __m128i vkeep, vinvA;
+    __m128i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m128i vdstpixel, vdstR, vdstG, vdstB, vdstA;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB, dstA;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            vsrcpixel = _mm_loadu_si128((__m128i *)src);
+            vsrcR = _mm_srli_epi32(vsrcpixel, 24);
+            vsrcG = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 16), v255);
+            vsrcB = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 8), v255);
+            vsrcA = _mm_and_si128(vsrcpixel, v255);
+            vdstpixel = _mm_loadu_si128((__m128i *)dst);
+            vdstR = _mm_and_si128(_mm_srli_epi32(vdstpixel, 16), v255);
+            vdstG = _mm_and_si128(_mm_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm_and_si128(vdstpixel, v255);
+            vdstA = _mm_srli_epi32(vdstpixel, 24);
+            vsrcR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vmodulateR), vdiv), 7);
+            vsrcG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vmodulateG), vdiv), 7);
+            vsrcB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vmodulateB), vdiv), 7);
+            vsrcA = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcA, vmodulateA), vdiv), 7);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm_or_si128(_mm_and_si128(vkeep, vdstR), _mm_andnot_si128(vkeep, vsrcR));
+                vdstG = _mm_or_si128(_mm_and_si128(vkeep, vdstG), _mm_andnot_si128(vkeep, vsrcG));
+                vdstB = _mm_or_si128(_mm_and_si128(vkeep, vdstB), _mm_andnot_si128(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm_sub_epi32(v255, vsrcA);
+                vdstR = _mm_add_epi32(vsrcR, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm_add_epi32(vsrcG, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm_add_epi32(vsrcB, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm_min_epi16(_mm_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm_min_epi16(_mm_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm_min_epi16(_mm_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(vdstR, 16), _mm_slli_epi32(vdstG, 8)), vdstB), _mm_slli_epi32(vdstA, 24)));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixel = *src;
+            srcR = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcB = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            *dst = dstpixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* defined(__SSE2__) */
+
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB, dstA;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n--) {
+            srcpixel = *src;
+            srcR = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcB = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            *dst = dstpixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB, dstA;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        Uint32 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        while (n--) {
+            if (posx >= 0x10000L) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            }
+            srcpixel = *src;
+            srcR = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcB = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            *dst = dstpixel;
+            posx += incx;
+            ++dst;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Scale(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        Uint32 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        while (n--) {
+            if (posx >= 0x10000L) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            }
+            pixel = *src;
+            A = (Uint8)(pixel >> 24); B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel;
+            pixel = ((Uint32)R << 16) | ((Uint32)G << 8) | B;
+            *dst = pixel;
+            posx += incx;
+            ++dst;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+#if SDL_AVX2_BLITTERS
+static void SDL_TARGETING_AVX2 SDL_Blit_ABGR8888_RGB888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i v255 = _mm256_set1_epi32(0xFF);
+    const __m256i vdiv = _mm256_set1_epi32(0x8081);
+    const __m256i vzero = _mm256_setzero_si256();
+    __m256i vkeep, vinvA;
+    __m256i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m256i vdstpixel, vdstR, vdstG, vdstB;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            vsrcpixel = _mm256_loadu_si256((__m256i *)src);
+            vsrcR = _mm256_and_si256(vsrcpixel, v255);
+            vsrcG = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 8), v255);
+            vsrcB = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 16), v255);
+            vsrcA = _mm256_srli_epi32(vsrcpixel, 24);
+            vdstpixel = _mm256_loadu_si256((__m256i *)dst);
+            vdstR = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 16), v255);
+            vdstG = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm256_and_si256(vdstpixel, v255);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm256_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm256_or_si256(_mm256_and_si256(vkeep, vdstR), _mm256_andnot_si256(vkeep, vsrcR));
+                vdstG = _mm256_or_si256(_mm256_and_si256(vkeep, vdstG), _mm256_andnot_si256(vkeep, vsrcG));
+                vdstB = _mm256_or_si256(_mm256_and_si256(vkeep, vdstB), _mm256_andnot_si256(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm256_sub_epi32(v255, vsrcA);
+                vdstR = _mm256_add_epi32(vsrcR, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm256_add_epi32(vsrcG, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm256_add_epi32(vsrcB, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm256_min_epi16(_mm256_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm256_min_epi16(_mm256_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm256_min_epi16(_mm256_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(vdstR, 16), _mm256_slli_epi32(vdstG, 8)), vdstB));
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            srcpixel = *src;
+            srcA = (Uint8)(srcpixel >> 24); srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            *dst = dstpixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* SDL_AVX2_BLITTERS */
+
+#if defined(__SSE2__)
+static void SDL_Blit_ABGR8888_RGB888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i v255 = _mm_set1_epi32(0xFF);
+    const __m128i vdiv = _mm_set1_epi32(0x8081);
+    const __m128i vzero = _mm_setzero_si128();
+    __m128i vkeep, vinvA;
+    __m128i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m128i vdstpixel, vdstR, vdstG, vdstB;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            vsrcpixel = _mm_loadu_si128((__m128i *)src);
+            vsrcR = _mm_and_si128(vsrcpixel, v255);
+            vsrcG = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 8), v255);
+            vsrcB = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 16), v255);
+            vsrcA = _mm_srli_epi32(vsrcpixel, 24);
+            vdstpixel = _mm_loadu_si128((__m128i *)dst);
+            vdstR = _mm_and_si128(_mm_srli_epi32(vdstpixel, 16), v255);
+            vdstG = _mm_and_si128(_mm_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm_and_si128(vdstpixel, v255);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm_or_si128(_mm_and_si128(vkeep, vdstR), _mm_andnot_si128(vkeep, vsrcR));
+                vdstG = _mm_or_si128(_mm_and_si128(vkeep, vdstG), _mm_andnot_si128(vkeep, vsrcG));
+                vdstB = _mm_or_si128(_mm_and_si128(vkeep, vdstB), _mm_andnot_si128(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm_sub_epi32(v255, vsrcA);
+                vdstR = _mm_add_epi32(vsrcR, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm_add_epi32(vsrcG, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm_add_epi32(vsrcB, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm_min_epi16(_mm_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm_min_epi16(_mm_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm_min_epi16(_mm_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_or_si128(_mm_slli_epi32(vdstR, 16), _mm_slli_epi32(vdstG, 8)), vdstB));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixel = *src;
+            srcA = (Uint8)(srcpixel >> 24); srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            *dst = dstpixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* defined(__SSE2__) */
+
+static void SDL_Blit_ABGR8888_RGB888_Blend(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n--) {
+            srcpixel = *src;
+            srcA = (Uint8)(srcpixel >> 24); srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            *dst = dstpixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Blend_Scale(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        Uint32 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        while (n--) {
+            if (posx >= 0x10000L) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            }
+            srcpixel = *src;
+            srcA = (Uint8)(srcpixel >> 24); srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            *dst = dstpixel;
+            posx += incx;
+            ++dst;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+#if SDL_AVX2_BLITTERS
+static void SDL_TARGETING_AVX2 SDL_Blit_ABGR8888_RGB888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    const __m256i vmodulateR = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m256i vmodulateG = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m256i vmodulateB = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m256i vmodulateA = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m256i v255 = _mm256_set1_epi32(0xFF);
+    const __m256i vdiv = _mm256_set1_epi32(0x8081);
+    __m256i vpixel, vR, vG, vB, vA;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            vpixel = _mm256_loadu_si256((__m256i *)src);
+            vR = _mm256_and_si256(vpixel, v255);
+            vG = _mm256_and_si256(_mm256_srli_epi32(vpixel, 8), v255);
+            vB = _mm256_and_si256(_mm256_srli_epi32(vpixel, 16), v255);
+            vA = _mm256_srli_epi32(vpixel, 24);
+            vR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vR, vmodulateR), vdiv), 7);
+            vG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vG, vmodulateG), vdiv), 7);
+            vB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vB, vmodulateB), vdiv), 7);
+            vA = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vA, vmodulateA), vdiv), 7);
+            _mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(vR, 16), _mm256_slli_epi32(vG, 8)), vB));
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            pixel = *src;
+            A = (Uint8)(pixel >> 24); B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = (R * modulateR) / 255;
+                G = (G * modulateG) / 255;
+                B = (B * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = (A * modulateA) / 255;
+            }
+            pixel = ((Uint32)R << 16) | ((Uint32)G << 8) | B;
+            *dst = pixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* SDL_AVX2_BLITTERS */
+
+#if defined(__SSE2__)
+static void SDL_Blit_ABGR8888_RGB888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    const __m128i vmodulateR = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m128i vmodulateG = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m128i vmodulateB = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m128i vmodulateA = _mm_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m128i v255 = _mm_set1_epi32(0xFF);
+    const __m128i vdiv = _mm_set1_epi32(0x8081);
+    __m128i vpixel, vR, vG, vB, vA;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            vpixel = _mm_loadu_si128((__m128i *)src);
+            vR = _mm_and_si128(vpixel, v255);
+            vG = _mm_and_si128(_mm_srli_epi32(vpixel, 8), v255);
+            vB = _mm_and_si128(_mm_srli_epi32(vpixel, 16), v255);
+            vA = _mm_srli_epi32(vpixel, 24);
+            vR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vR, vmodulateR), vdiv), 7);
+            vG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vG, vmodulateG), vdiv), 7);
+            vB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vB, vmodulateB), vdiv), 7);
+            vA = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vA, vmodulateA), vdiv), 7);
+            _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_or_si128(_mm_slli_epi32(vR, 16), _mm_slli_epi32(vG, 8)), vB));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            pixel = *src;
+            A = (Uint8)(pixel >> 24); B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = (R * modulateR) / 255;
+                G = (G * modulateG) / 255;
+                B = (B * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = (A * modulateA) / 255;
+            }
+            pixel = ((Uint32)R << 16) | ((Uint32)G << 8) | B;
+            *dst = pixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* defined(__SSE2__) */
+
+static void SDL_Blit_ABGR8888_RGB888_Modulate(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n--) {
+            pixel = *src;
+            A = (Uint8)(pixel >> 24); B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = (R * modulateR) / 255;
+                G = (G * modulateG) / 255;
+                B = (B * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = (A * modulateA) / 255;
+            }
+            pixel = ((Uint32)R << 16) | ((Uint32)G << 8) | B;
+            *dst = pixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Modulate_Scale(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        Uint32 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        while (n--) {
+            if (posx >= 0x10000L) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            }
+            pixel = *src;
+            A = (Uint8)(pixel >> 24); B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = (R * modulateR) / 255;
+                G = (G * modulateG) / 255;
+                B = (B * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = (A * modulateA) / 255;
+            }
+            pixel = ((Uint32)R << 16) | ((Uint32)G << 8) | B;
+            *dst = pixel;
+            posx += incx;
+            ++dst;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+#if SDL_AVX2_BLITTERS
+static void SDL_TARGETING_AVX2 SDL_Blit_ABGR8888_RGB888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    const __m256i vmodulateR = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m256i vmodulateG = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m256i vmodulateB = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m256i vmodulateA = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m256i v255 = _mm256_set1_epi32(0xFF);
+    const __m256i vdiv = _mm256_set1_epi32(0x8081);
+    const __m256i vzero = _mm256_setzero_si256();
+    __m256i vkeep, vinvA;
+    __m256i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m256i vdstpixel, vdstR, vdstG, vdstB;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            vsrcpixel = _mm256_loadu_si256((__m256i *)src);
+            vsrcR = _mm256_and_si256(vsrcpixel, v255);
+            vsrcG = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 8), v255);
+            vsrcB = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 16), v255);
+            vsrcA = _mm256_srli_epi32(vsrcpixel, 24);
+            vdstpixel = _mm256_loadu_si256((__m256i *)dst);
+            vdstR = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 16), v255);
+            vdstG = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm256_and_si256(vdstpixel, v255);
+            vsrcR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vmodulateR), vdiv), 7);
+            vsrcG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vmodulateG), vdiv), 7);
+            vsrcB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vmodulateB), vdiv), 7);
+            vsrcA = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcA, vmodulateA), vdiv), 7);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm256_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm256_or_si256(_mm256_and_si256(vkeep, vdstR), _mm256_andnot_si256(vkeep, vsrcR));
+                vdstG = _mm256_or_si256(_mm256_and_si256(vkeep, vdstG), _mm256_andnot_si256(vkeep, vsrcG));
+                vdstB = _mm256_or_si256(_mm256_and_si256(vkeep, vdstB), _mm256_andnot_si256(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm256_sub_epi32(v255, vsrcA);
+                vdstR = _mm256_add_epi32(vsrcR, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm256_add_epi32(vsrcG, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm256_add_epi32(vsrcB, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm256_min_epi16(_mm256_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm256_min_epi16(_mm256_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm256_min_epi16(_mm256_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(vdstR, 16), _mm256_slli_epi32(vdstG, 8)), vdstB));
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            srcpixel = *src;
+            srcA = (Uint8)(srcpixel >> 24); srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            *dst = dstpixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* SDL_AVX2_BLITTERS */
+
+#if defined(__SSE2__)
+static void SDL_Blit_ABGR8888_RGB888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    const __m128i vmodulateR = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m128i vmodulateG = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m128i vmodulateB = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m128i vmodulateA = _mm_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m128i v255 = _mm_set1_epi32(0xFF);
+    const __m128i vdiv = _mm_set1_epi32(0x8081);
+    const __m128i vzero = _mm_setzero_si128();
+    __m128i vkeep, vinvA;
+    __m128i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m128i vdstpixel, vdstR, vdstG, vdstB;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            vsrcpixel = _mm_loadu_si128((__m128i *)src);
+            vsrcR = _mm_and_si128(vsrcpixel, v255);
+            vsrcG = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 8), v255);
+            vsrcB = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 16), v255);
+            vsrcA = _mm_srli_epi32(vsrcpixel, 24);
+            vdstpixel = _mm_loadu_si128((__m128i *)dst);
+            vdstR = _mm_and_si128(_mm_srli_epi32(vdstpixel, 16), v255);
+            vdstG = _mm_and_si128(_mm_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm_and_si128(vdstpixel, v255);
+            vsrcR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vmodulateR), vdiv), 7);
+            vsrcG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vmodulateG), vdiv), 7);
+            vsrcB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vmodulateB), vdiv), 7);
+            vsrcA = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcA, vmodulateA), vdiv), 7);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm_or_si128(_mm_and_si128(vkeep, vdstR), _mm_andnot_si128(vkeep, vsrcR));
+                vdstG = _mm_or_si128(_mm_and_si128(vkeep, vdstG), _mm_andnot_si128(vkeep, vsrcG));
+                vdstB = _mm_or_si128(_mm_and_si128(vkeep, vdstB), _mm_andnot_si128(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm_sub_epi32(v255, vsrcA);
+                vdstR = _mm_add_epi32(vsrcR, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm_add_epi32(vsrcG, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm_add_epi32(vsrcB, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm_min_epi16(_mm_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm_min_epi16(_mm_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm_min_epi16(_mm_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_or_si128(_mm_slli_epi32(vdstR, 16), _mm_slli_epi32(vdstG, 8)), vdstB));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixel = *src;
+            srcA = (Uint8)(srcpixel >> 24); srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            *dst = dstpixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* defined(__SSE2__) */
+
+static void SDL_Blit_ABGR8888_RGB888_Modulate_Blend(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n--) {
+            srcpixel = *src;
+            srcA = (Uint8)(srcpixel >> 24); srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            *dst = dstpixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        Uint32 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        while (n--) {
+            if (posx >= 0x10000L) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            }
+            srcpixel = *src;
+            srcA = (Uint8)(srcpixel >> 24); srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            *dst = dstpixel;
+            posx += incx;
+            ++dst;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Scale(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        Uint32 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        while (n--) {
+            if (posx >= 0x10000L) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            }
+            pixel = *src;
+            A = (Uint8)(pixel >> 24); B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel;
+            pixel = ((Uint32)B << 16) | ((Uint32)G << 8) | R;
+            *dst = pixel;
+            posx += incx;
+            ++dst;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+#if SDL_AVX2_BLITTERS
+static void SDL_TARGETING_AVX2 SDL_Blit_ABGR8888_BGR888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i v255 = _mm256_set1_epi32(0xFF);
+    const __m256i vdiv = _mm256_set1_epi32(0x8081);
+    const __m256i vzero = _mm256_setzero_si256();
+    __m256i vkeep, vinvA;
+    __m256i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m256i vdstpixel, vdstR, vdstG, vdstB;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            vsrcpixel = _mm256_loadu_si256((__m256i *)src);
+            vsrcR = _mm256_and_si256(vsrcpixel, v255);
+            vsrcG = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 8), v255);
+            vsrcB = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 16), v255);
+            vsrcA = _mm256_srli_epi32(vsrcpixel, 24);
+            vdstpixel = _mm256_loadu_si256((__m256i *)dst);
+            vdstR = _mm256_and_si256(vdstpixel, v255);
+            vdstG = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 16), v255);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm256_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm256_or_si256(_mm256_and_si256(vkeep, vdstR), _mm256_andnot_si256(vkeep, vsrcR));
+                vdstG = _mm256_or_si256(_mm256_and_si256(vkeep, vdstG), _mm256_andnot_si256(vkeep, vsrcG));
+                vdstB = _mm256_or_si256(_mm256_and_si256(vkeep, vdstB), _mm256_andnot_si256(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm256_sub_epi32(v255, vsrcA);
+                vdstR = _mm256_add_epi32(vsrcR, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm256_add_epi32(vsrcG, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm256_add_epi32(vsrcB, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm256_min_epi16(_mm256_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm256_min_epi16(_mm256_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm256_min_epi16(_mm256_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(_mm256_or_si256(vdstR, _mm256_slli_epi32(vdstG, 8)), _mm256_slli_epi32(vdstB, 16)));
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            srcpixel = *src;
+            srcA = (Uint8)(srcpixel >> 24); srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel;
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
+            *dst = dstpixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* SDL_AVX2_BLITTERS */
+
+#if defined(__SSE2__)
+static void SDL_Blit_ABGR8888_BGR888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i v255 = _mm_set1_epi32(0xFF);
+    const __m128i vdiv = _mm_set1_epi32(0x8081);
+    const __m128i vzero = _mm_setzero_si128();
+    __m128i vkeep, vinvA;
+    __m128i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m128i vdstpixel, vdstR, vdstG, vdstB;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            vsrcpixel = _mm_loadu_si128((__m128i *)src);
+            vsrcR = _mm_and_si128(vsrcpixel, v255);
+            vsrcG = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 8), v255);
+            vsrcB = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 16), v255);
+            vsrcA = _mm_srli_epi32(vsrcpixel, 24);
+            vdstpixel = _mm_loadu_si128((__m128i *)dst);
+            vdstR = _mm_and_si128(vdstpixel, v255);
+            vdstG = _mm_and_si128(_mm_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm_and_si128(_mm_srli_epi32(vdstpixel, 16), v255);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm_or_si128(_mm_and_si128(vkeep, vdstR), _mm_andnot_si128(vkeep, vsrcR));
+                vdstG = _mm_or_si128(_mm_and_si128(vkeep, vdstG), _mm_andnot_si128(vkeep, vsrcG));
+                vdstB = _mm_or_si128(_mm_and_si128(vkeep, vdstB), _mm_andnot_si128(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm_sub_epi32(v255, vsrcA);
+                vdstR = _mm_add_epi32(vsrcR, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm_add_epi32(vsrcG, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm_add_epi32(vsrcB, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm_min_epi16(_mm_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm_min_epi16(_mm_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm_min_epi16(_mm_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_or_si128(vdstR, _mm_slli_epi32(vdstG, 8)), _mm_slli_epi32(vdstB, 16)));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixel = *src;
+            srcA = (Uint8)(srcpixel >> 24); srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel;
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
+            *dst = dstpixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* defined(__SSE2__) */
+
+static void SDL_Blit_ABGR8888_BGR888_Blend(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n--) {
+            srcpixel = *src;
+            srcA = (Uint8)(srcpixel >> 24); srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel;
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
+            *dst = dstpixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Blend_Scale(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        Uint32 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        while (n--) {
+            if (posx >= 0x10000L) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            }
+            srcpixel = *src;
+            srcA = (Uint8)(srcpixel >> 24); srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel;
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
+            *dst = dstpixel;
+            posx += incx;
+            ++dst;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+#if SDL_AVX2_BLITTERS
+static void SDL_TARGETING_AVX2 SDL_Blit_ABGR8888_BGR888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    const __m256i vmodulateR = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m256i vmodulateG = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m256i vmodulateB = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m256i vmodulateA = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m256i v255 = _mm256_set1_epi32(0xFF);
+    const __m256i vdiv = _mm256_set1_epi32(0x8081);
+    __m256i vpixel, vR, vG, vB, vA;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            vpixel = _mm256_loadu_si256((__m256i *)src);
+            vR = _mm256_and_si256(vpixel, v255);
+            vG = _mm256_and_si256(_mm256_srli_epi32(vpixel, 8), v255);
+            vB = _mm256_and_si256(_mm256_srli_epi32(vpixel, 16), v255);
+            vA = _mm256_srli_epi32(vpixel, 24);
+            vR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vR, vmodulateR), vdiv), 7);
+            vG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vG, vmodulateG), vdiv), 7);
+            vB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vB, vmodulateB), vdiv), 7);
+            vA = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vA, vmodulateA), vdiv), 7);
+            _mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(_mm256_or_si256(vR, _mm256_slli_epi32(vG, 8)), _mm256_slli_epi32(vB, 16)));
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            pixel = *src;
+            A = (Uint8)(pixel >> 24); B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = (R * modulateR) / 255;
+                G = (G * modulateG) / 255;
+                B = (B * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = (A * modulateA) / 255;
+            }
+            pixel = ((Uint32)B << 16) | ((Uint32)G << 8) | R;
+            *dst = pixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* SDL_AVX2_BLITTERS */
+
+#if defined(__SSE2__)
+static void SDL_Blit_ABGR8888_BGR888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    const __m128i vmodulateR = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m128i vmodulateG = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m128i vmodulateB = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m128i vmodulateA = _mm_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m128i v255 = _mm_set1_epi32(0xFF);
+    const __m128i vdiv = _mm_set1_epi32(0x8081);
+    __m128i vpixel, vR, vG, vB, vA;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            vpixel = _mm_loadu_si128((__m128i *)src);
+            vR = _mm_and_si128(vpixel, v255);
+            vG = _mm_and_si128(_mm_srli_epi32(vpixel, 8), v255);
+            vB = _mm_and_si128(_mm_srli_epi32(vpixel, 16), v255);
+            vA = _mm_srli_epi32(vpixel, 24);
+            vR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vR, vmodulateR), vdiv), 7);
+            vG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vG, vmodulateG), vdiv), 7);
+            vB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vB, vmodulateB), vdiv), 7);
+            vA = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vA, vmodulateA), vdiv), 7);
+            _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_or_si128(vR, _mm_slli_epi32(vG, 8)), _mm_slli_epi32(vB, 16)));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            pixel = *src;
+            A = (Uint8)(pixel >> 24); B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = (R * modulateR) / 255;
+                G = (G * modulateG) / 255;
+                B = (B * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = (A * modulateA) / 255;
+            }
+            pixel = ((Uint32)B << 16) | ((Uint32)G << 8) | R;
+            *dst = pixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* defined(__SSE2__) */
+
+static void SDL_Blit_ABGR8888_BGR888_Modulate(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n--) {
+            pixel = *src;
+            A = (Uint8)(pixel >> 24); B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = (R * modulateR) / 255;
+                G = (G * modulateG) / 255;
+                B = (B * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = (A * modulateA) / 255;
+            }
+            pixel = ((Uint32)B << 16) | ((Uint32)G << 8) | R;
+            *dst = pixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        Uint32 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        while (n--) {
+            if (posx >= 0x10000L) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            }
+            pixel = *src;
+            A = (Uint8)(pixel >> 24); B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = (R * modulateR) / 255;
+                G = (G * modulateG) / 255;
+                B = (B * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = (A * modulateA) / 255;
+            }
+            pixel = ((Uint32)B << 16) | ((Uint32)G << 8) | R;
+            *dst = pixel;
+            posx += incx;
+            ++dst;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+#if SDL_AVX2_BLITTERS
+static void SDL_TARGETING_AVX2 SDL_Blit_ABGR8888_BGR888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    const __m256i vmodulateR = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m256i vmodulateG = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m256i vmodulateB = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m256i vmodulateA = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m256i v255 = _mm256_set1_epi32(0xFF);
+    const __m256i vdiv = _mm256_set1_epi32(0x8081);
+    const __m256i vzero = _mm256_setzero_si256();
+    __m256i vkeep, vinvA;
+    __m256i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m256i vdstpixel, vdstR, vdstG, vdstB;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            vsrcpixel = _mm256_loadu_si256((__m256i *)src);
+            vsrcR = _mm256_and_si256(vsrcpixel, v255);
+            vsrcG = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 8), v255);
+            vsrcB = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 16), v255);
+            vsrcA = _mm256_srli_epi32(vsrcpixel, 24);
+            vdstpixel = _mm256_loadu_si256((__m256i *)dst);
+            vdstR = _mm256_and_si256(vdstpixel, v255);
+            vdstG = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 16), v255);
+            vsrcR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vmodulateR), vdiv), 7);
+            vsrcG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vmodulateG), vdiv), 7);
+            vsrcB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vmodulateB), vdiv), 7);
+            vsrcA = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcA, vmodulateA), vdiv), 7);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm256_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm256_or_si256(_mm256_and_si256(vkeep, vdstR), _mm256_andnot_si256(vkeep, vsrcR));
+                vdstG = _mm256_or_si256(_mm256_and_si256(vkeep, vdstG), _mm256_andnot_si256(vkeep, vsrcG));
+                vdstB = _mm256_or_si256(_mm256_and_si256(vkeep, vdstB), _mm256_andnot_si256(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm256_sub_epi32(v255, vsrcA);
+                vdstR = _mm256_add_epi32(vsrcR, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm256_add_epi32(vsrcG, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm256_add_epi32(vsrcB, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm256_min_epi16(_mm256_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm256_min_epi16(_mm256_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm256_min_epi16(_mm256_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(_mm256_or_si256(vdstR, _mm256_slli_epi32(vdstG, 8)), _mm256_slli_epi32(vdstB, 16)));
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            srcpixel = *src;
+            srcA = (Uint8)(srcpixel >> 24); srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
+            *dst = dstpixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* SDL_AVX2_BLITTERS */
+
+#if defined(__SSE2__)
+static void SDL_Blit_ABGR8888_BGR888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    const __m128i vmodulateR = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m128i vmodulateG = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m128i vmodulateB = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m128i vmodulateA = _mm_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m128i v255 = _mm_set1_epi32(0xFF);
+    const __m128i vdiv = _mm_set1_epi32(0x8081);
+    const __m128i vzero = _mm_setzero_si128();
+    __m128i vkeep, vinvA;
+    __m128i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m128i vdstpixel, vdstR, vdstG, vdstB;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            vsrcpixel = _mm_loadu_si128((__m128i *)src);
+            vsrcR = _mm_and_si128(vsrcpixel, v255);
+            vsrcG = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 8), v255);
+            vsrcB = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 16), v255);
+            vsrcA = _mm_srli_epi32(vsrcpixel, 24);
+            vdstpixel = _mm_loadu_si128((__m128i *)dst);
+            vdstR = _mm_and_si128(vdstpixel, v255);
+            vdstG = _mm_and_si128(_mm_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm_and_si128(_mm_srli_epi32(vdstpixel, 16), v255);
+            vsrcR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vmodulateR), vdiv), 7);
+            vsrcG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vmodulateG), vdiv), 7);
+            vsrcB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vmodulateB), vdiv), 7);
+            vsrcA = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcA, vmodulateA), vdiv), 7);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm_or_si128(_mm_and_si128(vkeep, vdstR), _mm_andnot_si128(vkeep, vsrcR));
+                vdstG = _mm_or_si128(_mm_and_si128(vkeep, vdstG), _mm_andnot_si128(vkeep, vsrcG));
+                vdstB = _mm_or_si128(_mm_and_si128(vkeep, vdstB), _mm_andnot_si128(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm_sub_epi32(v255, vsrcA);
+                vdstR = _mm_add_epi32(vsrcR, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm_add_epi32(vsrcG, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm_add_epi32(vsrcB, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm_min_epi16(_mm_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm_min_epi16(_mm_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm_min_epi16(_mm_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_or_si128(vdstR, _mm_slli_epi32(vdstG, 8)), _mm_slli_epi32(vdstB, 16)));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixel = *src;
+            srcA = (Uint8)(srcpixel >> 24); srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
+            *dst = dstpixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* defined(__SSE2__) */
+
+static void SDL_Blit_ABGR8888_BGR888_Modulate_Blend(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n--) {
+            srcpixel = *src;
+            srcA = (Uint8)(srcpixel >> 24); srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
+            *dst = dstpixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        Uint32 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        while (n--) {
+            if (posx >= 0x10000L) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            }
+            srcpixel = *src;
+            srcA = (Uint8)(srcpixel >> 24); srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
+            *dst = dstpixel;
+            posx += incx;
+            ++dst;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Scale(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        Uint32 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        while (n--) {
+            if (posx >= 0x10000L) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            }
+            pixel = *src;
+            A = (Uint8)(pixel >> 24); B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel;
+            pixel = ((Uint32)A << 24) | ((Uint32)R << 16) | ((Uint32)G << 8) | B;
+            *dst = pixel;
+            posx += incx;
+            ++dst;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+#if SDL_AVX2_BLITTERS
+static void SDL_TARGETING_AVX2 SDL_Blit_ABGR8888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i v255 = _mm256_set1_epi32(0xFF);
+    const __m256i vdiv = _mm256_set1_epi32(0x8081);
+    const __m256i vzero = _mm256_setzero_si256();
+    __m256i vkeep, vinvA;
+    __m256i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m256i vdstpixel, vdstR, vdstG, vdstB, vdstA;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB, dstA;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            vsrcpixel = _mm256_loadu_si256((__m256i *)src);
+            vsrcR = _mm256_and_si256(vsrcpixel, v255);
+            vsrcG = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 8), v255);
+            vsrcB = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 16), v255);
+            vsrcA = _mm256_srli_epi32(vsrcpixel, 24);
+            vdstpixel = _mm256_loadu_si256((__m256i *)dst);
+            vdstR = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 16), v255);
+            vdstG = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm256_and_si256(vdstpixel, v255);
+            vdstA = _mm256_srli_epi32(vdstpixel, 24);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm256_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm256_or_si256(_mm256_and_si256(vkeep, vdstR), _mm256_andnot_si256(vkeep, vsrcR));
+                vdstG = _mm256_or_si256(_mm256_and_si256(vkeep, vdstG), _mm256_andnot_si256(vkeep, vsrcG));
+                vdstB = _mm256_or_si256(_mm256_and_si256(vkeep, vdstB), _mm256_andnot_si256(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm256_sub_epi32(v255, vsrcA);
+                vdstR = _mm256_add_epi32(vsrcR, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm256_add_epi32(vsrcG, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm256_add_epi32(vsrcB, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm256_min_epi16(_mm256_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm256_min_epi16(_mm256_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm256_min_epi16(_mm256_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(vdstR, 16), _mm256_slli_epi32(vdstG, 8)), vdstB), _mm256_slli_epi32(vdstA, 24)));
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            srcpixel = *src;
+            srcA = (Uint8)(srcpixel >> 24); srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            *dst = dstpixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* SDL_AVX2_BLITTERS */
+
+#if defined(__SSE2__)
+static void SDL_Blit_ABGR8888_ARGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i v255 = _mm_set1_epi32(0xFF);
+    const __m128i vdiv = _mm_set1_epi32(0x8081);
+    const __m128i vzero = _mm_setzero_si128();
+    __m128i vkeep, vinvA;
+    __m128i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m128i vdstpixel, vdstR, vdstG, vdstB, vdstA;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB, dstA;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            vsrcpixel = _mm_loadu_si128((__m128i *)src);
+            vsrcR = _mm_and_si128(vsrcpixel, v255);
+            vsrcG = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 8), v255);
+            vsrcB = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 16), v255);
+            vsrcA = _mm_srli_epi32(vsrcpixel, 24);
+            vdstpixel = _mm_loadu_si128((__m128i *)dst);
+            vdstR = _mm_and_si128(_mm_srli_epi32(vdstpixel, 16), v255);
+            vdstG = _mm_and_si128(_mm_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm_and_si128(vdstpixel, v255);
+            vdstA = _mm_srli_epi32(vdstpixel, 24);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm_or_si128(_mm_and_si128(vkeep, vdstR), _mm_andnot_si128(vkeep, vsrcR));
+                vdstG = _mm_or_si128(_mm_and_si128(vkeep, vdstG), _mm_andnot_si128(vkeep, vsrcG));
+                vdstB = _mm_or_si128(_mm_and_si128(vkeep, vdstB), _mm_andnot_si128(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm_sub_epi32(v255, vsrcA);
+                vdstR = _mm_add_epi32(vsrcR, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm_add_epi32(vsrcG, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm_add_epi32(vsrcB, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm_min_epi16(_mm_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm_min_epi16(_mm_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm_min_epi16(_mm_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(vdstR, 16), _mm_slli_epi32(vdstG, 8)), vdstB), _mm_slli_epi32(vdstA, 24)));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixel = *src;
+            srcA = (Uint8)(srcpixel >> 24); srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            *dst = dstpixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* defined(__SSE2__) */
+
+static void SDL_Blit_ABGR8888_ARGB8888_Blend(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB, dstA;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n--) {
+            srcpixel = *src;
+            srcA = (Uint8)(srcpixel >> 24); srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            *dst = dstpixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB, dstA;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        Uint32 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        while (n--) {
+            if (posx >= 0x10000L) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            }
+            srcpixel = *src;
+            srcA = (Uint8)(srcpixel >> 24); srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            *dst = dstpixel;
+            posx += incx;
+            ++dst;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+#if SDL_AVX2_BLITTERS
+static void SDL_TARGETING_AVX2 SDL_Blit_ABGR8888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    const __m256i vmodulateR = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m256i vmodulateG = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m256i vmodulateB = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m256i vmodulateA = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m256i v255 = _mm256_set1_epi32(0xFF);
+    const __m256i vdiv = _mm256_set1_epi32(0x8081);
+    __m256i vpixel, vR, vG, vB, vA;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            vpixel = _mm256_loadu_si256((__m256i *)src);
+            vR = _mm256_and_si256(vpixel, v255);
+            vG = _mm256_and_si256(_mm256_srli_epi32(vpixel, 8), v255);
+            vB = _mm256_and_si256(_mm256_srli_epi32(vpixel, 16), v255);
+            vA = _mm256_srli_epi32(vpixel, 24);
+            vR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vR, vmodulateR), vdiv), 7);
+            vG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vG, vmodulateG), vdiv), 7);
+            vB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vB, vmodulateB), vdiv), 7);
+            vA = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vA, vmodulateA), vdiv), 7);
+            _mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(vR, 16), _mm256_slli_epi32(vG, 8)), vB), _mm256_slli_epi32(vA, 24)));
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            pixel = *src;
+            A = (Uint8)(pixel >> 24); B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = (R * modulateR) / 255;
+                G = (G * modulateG) / 255;
+                B = (B * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = (A * modulateA) / 255;
+            }
+            pixel = ((Uint32)A << 24) | ((Uint32)R << 16) | ((Uint32)G << 8) | B;
+            *dst = pixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* SDL_AVX2_BLITTERS */
+
+#if defined(__SSE2__)
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    const __m128i vmodulateR = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m128i vmodulateG = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m128i vmodulateB = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m128i vmodulateA = _mm_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m128i v255 = _mm_set1_epi32(0xFF);
+    const __m128i vdiv = _mm_set1_epi32(0x8081);
+    __m128i vpixel, vR, vG, vB, vA;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            vpixel = _mm_loadu_si128((__m128i *)src);
+            vR = _mm_and_si128(vpixel, v255);
+            vG = _mm_and_si128(_mm_srli_epi32(vpixel, 8), v255);
+            vB = _mm_and_si128(_mm_srli_epi32(vpixel, 16), v255);
+            vA = _mm_srli_epi32(vpixel, 24);
+            vR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vR, vmodulateR), vdiv), 7);
+            vG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vG, vmodulateG), vdiv), 7);
+            vB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vB, vmodulateB), vdiv), 7);
+            vA = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vA, vmodulateA), vdiv), 7);
+            _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(vR, 16), _mm_slli_epi32(vG, 8)), vB), _mm_slli_epi32(vA, 24)));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            pixel = *src;
+            A = (Uint8)(pixel >> 24); B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = (R * modulateR) / 255;
+                G = (G * modulateG) / 255;
+                B = (B * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = (A * modulateA) / 255;
+            }
+            pixel = ((Uint32)A << 24) | ((Uint32)R << 16) | ((Uint32)G << 8) | B;
+            *dst = pixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* defined(__SSE2__) */
+
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n--) {
+            pixel = *src;
+            A = (Uint8)(pixel >> 24); B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = (R * modulateR) / 255;
+                G = (G * modulateG) / 255;
+                B = (B * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = (A * modulateA) / 255;
+            }
+            pixel = ((Uint32)A << 24) | ((Uint32)R << 16) | ((Uint32)G << 8) | B;
+            *dst = pixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        Uint32 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        while (n--) {
+            if (posx >= 0x10000L) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            }
+            pixel = *src;
+            A = (Uint8)(pixel >> 24); B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = (R * modulateR) / 255;
+                G = (G * modulateG) / 255;
+                B = (B * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = (A * modulateA) / 255;
+            }
+            pixel = ((Uint32)A << 24) | ((Uint32)R << 16) | ((Uint32)G << 8) | B;
+            *dst = pixel;
+            posx += incx;
+            ++dst;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+#if SDL_AVX2_BLITTERS
+static void SDL_TARGETING_AVX2 SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    const __m256i vmodulateR = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m256i vmodulateG = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m256i vmodulateB = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m256i vmodulateA = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m256i v255 = _mm256_set1_epi32(0xFF);
+    const __m256i vdiv = _mm256_set1_epi32(0x8081);
+    const __m256i vzero = _mm256_setzero_si256();
+    __m256i vkeep, vinvA;
+    __m256i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m256i vdstpixel, vdstR, vdstG, vdstB, vdstA;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB, dstA;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            vsrcpixel = _mm256_loadu_si256((__m256i *)src);
+            vsrcR = _mm256_and_si256(vsrcpixel, v255);
+            vsrcG = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 8), v255);
+            vsrcB = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 16), v255);
+            vsrcA = _mm256_srli_epi32(vsrcpixel, 24);
+            vdstpixel = _mm256_loadu_si256((__m256i *)dst);
+            vdstR = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 16), v255);
+            vdstG = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm256_and_si256(vdstpixel, v255);
+            vdstA = _mm256_srli_epi32(vdstpixel, 24);
+            vsrcR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vmodulateR), vdiv), 7);
+            vsrcG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vmodulateG), vdiv), 7);
+            vsrcB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vmodulateB), vdiv), 7);
+            vsrcA = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcA, vmodulateA), vdiv), 7);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm256_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm256_or_si256(_mm256_and_si256(vkeep, vdstR), _mm256_andnot_si256(vkeep, vsrcR));
+                vdstG = _mm256_or_si256(_mm256_and_si256(vkeep, vdstG), _mm256_andnot_si256(vkeep, vsrcG));
+                vdstB = _mm256_or_si256(_mm256_and_si256(vkeep, vdstB), _mm256_andnot_si256(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm256_sub_epi32(v255, vsrcA);
+                vdstR = _mm256_add_epi32(vsrcR, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm256_add_epi32(vsrcG, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm256_add_epi32(vsrcB, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm256_min_epi16(_mm256_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm256_min_epi16(_mm256_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm256_min_epi16(_mm256_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(vdstR, 16), _mm256_slli_epi32(vdstG, 8)), vdstB), _mm256_slli_epi32(vdstA, 24)));
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            srcpixel = *src;
+            srcA = (Uint8)(srcpixel >> 24); srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            *dst = dstpixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* SDL_AVX2_BLITTERS */
+
+#if defined(__SSE2__)
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    const __m128i vmodulateR = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m128i vmodulateG = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m128i vmodulateB = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m128i vmodulateA = _mm_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m128i v255 = _mm_set1_epi32(0xFF);
+    const __m128i vdiv = _mm_set1_epi32(0x8081);
+    const __m128i vzero = _mm_setzero_si128();
+    __m128i vkeep, vinvA;
+    __m128i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m128i vdstpixel, vdstR, vdstG, vdstB, vdstA;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB, dstA;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            vsrcpixel = _mm_loadu_si128((__m128i *)src);
+            vsrcR = _mm_and_si128(vsrcpixel, v255);
+            vsrcG = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 8), v255);
+            vsrcB = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 16), v255);
+            vsrcA = _mm_srli_epi32(vsrcpixel, 24);
+            vdstpixel = _mm_loadu_si128((__m128i *)dst);
+            vdstR = _mm_and_si128(_mm_srli_epi32(vdstpixel, 16), v255);
+            vdstG = _mm_and_si128(_mm_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm_and_si128(vdstpixel, v255);
+            vdstA = _mm_srli_epi32(vdstpixel, 24);
+            vsrcR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vmodulateR), vdiv), 7);
+            vsrcG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vmodulateG), vdiv), 7);
+            vsrcB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vmodulateB), vdiv), 7);
+            vsrcA = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcA, vmodulateA), vdiv), 7);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm_or_si128(_mm_and_si128(vkeep, vdstR), _mm_andnot_si128(vkeep, vsrcR));
+                vdstG = _mm_or_si128(_mm_and_si128(vkeep, vdstG), _mm_andnot_si128(vkeep, vsrcG));
+                vdstB = _mm_or_si128(_mm_and_si128(vkeep, vdstB), _mm_andnot_si128(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm_sub_epi32(v255, vsrcA);
+                vdstR = _mm_add_epi32(vsrcR, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm_add_epi32(vsrcG, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm_add_epi32(vsrcB, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm_min_epi16(_mm_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm_min_epi16(_mm_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm_min_epi16(_mm_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(vdstR, 16), _mm_slli_epi32(vdstG, 8)), vdstB), _mm_slli_epi32(vdstA, 24)));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixel = *src;
+            srcA = (Uint8)(srcpixel >> 24); srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            *dst = dstpixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* defined(__SSE2__) */
+
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB, dstA;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n--) {
+            srcpixel = *src;
+            srcA = (Uint8)(srcpixel >> 24); srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            *dst = dstpixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB, dstA;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        Uint32 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        while (n--) {
+            if (posx >= 0x10000L) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            }
+            srcpixel = *src;
+            srcA = (Uint8)(srcpixel >> 24); srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            *dst = dstpixel;
+            posx += incx;
+            ++dst;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Scale(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        Uint32 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        while (n--) {
+            if (posx >= 0x10000L) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            }
+            pixel = *src;
+            B = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); R = (Uint8)(pixel >> 8); A = (Uint8)pixel;
+            pixel = ((Uint32)R << 16) | ((Uint32)G << 8) | B;
+            *dst = pixel;
+            posx += incx;
+            ++dst;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+#if SDL_AVX2_BLITTERS
+static void SDL_TARGETING_AVX2 SDL_Blit_BGRA8888_RGB888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i v255 = _mm256_set1_epi32(0xFF);
+    const __m256i vdiv = _mm256_set1_epi32(0x8081);
+    const __m256i vzero = _mm256_setzero_si256();
+    __m256i vkeep, vinvA;
+    __m256i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m256i vdstpixel, vdstR, vdstG, vdstB;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            vsrcpixel = _mm256_loadu_si256((__m256i *)src);
+            vsrcR = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 8), v255);
+            vsrcG = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 16), v255);
+            vsrcB = _mm256_srli_epi32(vsrcpixel, 24);
+            vsrcA = _mm256_and_si256(vsrcpixel, v255);
+            vdstpixel = _mm256_loadu_si256((__m256i *)dst);
+            vdstR = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 16), v255);
+            vdstG = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm256_and_si256(vdstpixel, v255);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm256_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm256_or_si256(_mm256_and_si256(vkeep, vdstR), _mm256_andnot_si256(vkeep, vsrcR));
+                vdstG = _mm256_or_si256(_mm256_and_si256(vkeep, vdstG), _mm256_andnot_si256(vkeep, vsrcG));
+                vdstB = _mm256_or_si256(_mm256_and_si256(vkeep, vdstB), _mm256_andnot_si256(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm256_sub_epi32(v255, vsrcA);
+                vdstR = _mm256_add_epi32(vsrcR, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm256_add_epi32(vsrcG, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm256_add_epi32(vsrcB, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm256_min_epi16(_mm256_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm256_min_epi16(_mm256_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm256_min_epi16(_mm256_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(vdstR, 16), _mm256_slli_epi32(vdstG, 8)), vdstB));
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            srcpixel = *src;
+            srcB = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcR = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            *dst = dstpixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* SDL_AVX2_BLITTERS */
+
+#if defined(__SSE2__)
+static void SDL_Blit_BGRA8888_RGB888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i v255 = _mm_set1_epi32(0xFF);
+    const __m128i vdiv = _mm_set1_epi32(0x8081);
+    const __m128i vzero = _mm_setzero_si128();
+    __m128i vkeep, vinvA;
+    __m128i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m128i vdstpixel, vdstR, vdstG, vdstB;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            vsrcpixel = _mm_loadu_si128((__m128i *)src);
+            vsrcR = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 8), v255);
+            vsrcG = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 16), v255);
+            vsrcB = _mm_srli_epi32(vsrcpixel, 24);
+            vsrcA = _mm_and_si128(vsrcpixel, v255);
+            vdstpixel = _mm_loadu_si128((__m128i *)dst);
+            vdstR = _mm_and_si128(_mm_srli_epi32(vdstpixel, 16), v255);
+            vdstG = _mm_and_si128(_mm_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm_and_si128(vdstpixel, v255);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm_or_si128(_mm_and_si128(vkeep, vdstR), _mm_andnot_si128(vkeep, vsrcR));
+                vdstG = _mm_or_si128(_mm_and_si128(vkeep, vdstG), _mm_andnot_si128(vkeep, vsrcG));
+                vdstB = _mm_or_si128(_mm_and_si128(vkeep, vdstB), _mm_andnot_si128(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm_sub_epi32(v255, vsrcA);
+                vdstR = _mm_add_epi32(vsrcR, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm_add_epi32(vsrcG, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm_add_epi32(vsrcB, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm_min_epi16(_mm_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm_min_epi16(_mm_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm_min_epi16(_mm_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_or_si128(_mm_slli_epi32(vdstR, 16), _mm_slli_epi32(vdstG, 8)), vdstB));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixel = *src;
+            srcB = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcR = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            *dst = dstpixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* defined(__SSE2__) */
+
+static void SDL_Blit_BGRA8888_RGB888_Blend(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n--) {
+            srcpixel = *src;
+            srcB = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcR = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            *dst = dstpixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Blend_Scale(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        Uint32 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        while (n--) {
+            if (posx >= 0x10000L) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            }
+            srcpixel = *src;
+            srcB = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcR = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            *dst = dstpixel;
+            posx += incx;
+            ++dst;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+#if SDL_AVX2_BLITTERS
+static void SDL_TARGETING_AVX2 SDL_Blit_BGRA8888_RGB888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    const __m256i vmodulateR = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m256i vmodulateG = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m256i vmodulateB = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m256i vmodulateA = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m256i v255 = _mm256_set1_epi32(0xFF);
+    const __m256i vdiv = _mm256_set1_epi32(0x8081);
+    __m256i vpixel, vR, vG, vB, vA;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            vpixel = _mm256_loadu_si256((__m256i *)src);
+            vR = _mm256_and_si256(_mm256_srli_epi32(vpixel, 8), v255);
+            vG = _mm256_and_si256(_mm256_srli_epi32(vpixel, 16), v255);
+            vB = _mm256_srli_epi32(vpixel, 24);
+            vA = _mm256_and_si256(vpixel, v255);
+            vR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vR, vmodulateR), vdiv), 7);
+            vG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vG, vmodulateG), vdiv), 7);
+            vB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vB, vmodulateB), vdiv), 7);
+            vA = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vA, vmodulateA), vdiv), 7);
+            _mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(vR, 16), _mm256_slli_epi32(vG, 8)), vB));
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            pixel = *src;
+            B = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); R = (Uint8)(pixel >> 8); A = (Uint8)pixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = (R * modulateR) / 255;
+                G = (G * modulateG) / 255;
+                B = (B * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = (A * modulateA) / 255;
+            }
+            pixel = ((Uint32)R << 16) | ((Uint32)G << 8) | B;
+            *dst = pixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* SDL_AVX2_BLITTERS */
+
+#if defined(__SSE2__)
+static void SDL_Blit_BGRA8888_RGB888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    const __m128i vmodulateR = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m128i vmodulateG = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m128i vmodulateB = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m128i vmodulateA = _mm_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m128i v255 = _mm_set1_epi32(0xFF);
+    const __m128i vdiv = _mm_set1_epi32(0x8081);
+    __m128i vpixel, vR, vG, vB, vA;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            vpixel = _mm_loadu_si128((__m128i *)src);
+            vR = _mm_and_si128(_mm_srli_epi32(vpixel, 8), v255);
+            vG = _mm_and_si128(_mm_srli_epi32(vpixel, 16), v255);
+            vB = _mm_srli_epi32(vpixel, 24);
+            vA = _mm_and_si128(vpixel, v255);
+            vR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vR, vmodulateR), vdiv), 7);
+            vG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vG, vmodulateG), vdiv), 7);
+            vB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vB, vmodulateB), vdiv), 7);
+            vA = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vA, vmodulateA), vdiv), 7);
+            _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_or_si128(_mm_slli_epi32(vR, 16), _mm_slli_epi32(vG, 8)), vB));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            pixel = *src;
+            B = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); R = (Uint8)(pixel >> 8); A = (Uint8)pixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = (R * modulateR) / 255;
+                G = (G * modulateG) / 255;
+                B = (B * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = (A * modulateA) / 255;
+            }
+            pixel = ((Uint32)R << 16) | ((Uint32)G << 8) | B;
+            *dst = pixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* defined(__SSE2__) */
+
+static void SDL_Blit_BGRA8888_RGB888_Modulate(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n--) {
+            pixel = *src;
+            B = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); R = (Uint8)(pixel >> 8); A = (Uint8)pixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = (R * modulateR) / 255;
+                G = (G * modulateG) / 255;
+                B = (B * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = (A * modulateA) / 255;
+            }
+            pixel = ((Uint32)R << 16) | ((Uint32)G << 8) | B;
+            *dst = pixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Modulate_Scale(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        Uint32 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        while (n--) {
+            if (posx >= 0x10000L) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            }
+            pixel = *src;
+            B = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); R = (Uint8)(pixel >> 8); A = (Uint8)pixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = (R * modulateR) / 255;
+                G = (G * modulateG) / 255;
+                B = (B * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = (A * modulateA) / 255;
+            }
+            pixel = ((Uint32)R << 16) | ((Uint32)G << 8) | B;
+            *dst = pixel;
+            posx += incx;
+            ++dst;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+#if SDL_AVX2_BLITTERS
+static void SDL_TARGETING_AVX2 SDL_Blit_BGRA8888_RGB888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    const __m256i vmodulateR = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m256i vmodulateG = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m256i vmodulateB = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m256i vmodulateA = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m256i v255 = _mm256_set1_epi32(0xFF);
+    const __m256i vdiv = _mm256_set1_epi32(0x8081);
+    const __m256i vzero = _mm256_setzero_si256();
+    __m256i vkeep, vinvA;
+    __m256i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m256i vdstpixel, vdstR, vdstG, vdstB;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            vsrcpixel = _mm256_loadu_si256((__m256i *)src);
+            vsrcR = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 8), v255);
+            vsrcG = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 16), v255);
+            vsrcB = _mm256_srli_epi32(vsrcpixel, 24);
+            vsrcA = _mm256_and_si256(vsrcpixel, v255);
+            vdstpixel = _mm256_loadu_si256((__m256i *)dst);
+            vdstR = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 16), v255);
+            vdstG = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm256_and_si256(vdstpixel, v255);
+            vsrcR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vmodulateR), vdiv), 7);
+            vsrcG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vmodulateG), vdiv), 7);
+            vsrcB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vmodulateB), vdiv), 7);
+            vsrcA = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcA, vmodulateA), vdiv), 7);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm256_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm256_or_si256(_mm256_and_si256(vkeep, vdstR), _mm256_andnot_si256(vkeep, vsrcR));
+                vdstG = _mm256_or_si256(_mm256_and_si256(vkeep, vdstG), _mm256_andnot_si256(vkeep, vsrcG));
+                vdstB = _mm256_or_si256(_mm256_and_si256(vkeep, vdstB), _mm256_andnot_si256(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm256_sub_epi32(v255, vsrcA);
+                vdstR = _mm256_add_epi32(vsrcR, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm256_add_epi32(vsrcG, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm256_add_epi32(vsrcB, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm256_min_epi16(_mm256_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm256_min_epi16(_mm256_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm256_min_epi16(_mm256_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(vdstR, 16), _mm256_slli_epi32(vdstG, 8)), vdstB));
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            srcpixel = *src;
+            srcB = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcR = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            *dst = dstpixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* SDL_AVX2_BLITTERS */
+
+#if defined(__SSE2__)
+static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    const __m128i vmodulateR = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m128i vmodulateG = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m128i vmodulateB = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m128i vmodulateA = _mm_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m128i v255 = _mm_set1_epi32(0xFF);
+    const __m128i vdiv = _mm_set1_epi32(0x8081);
+    const __m128i vzero = _mm_setzero_si128();
+    __m128i vkeep, vinvA;
+    __m128i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m128i vdstpixel, vdstR, vdstG, vdstB;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            vsrcpixel = _mm_loadu_si128((__m128i *)src);
+            vsrcR = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 8), v255);
+            vsrcG = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 16), v255);
+            vsrcB = _mm_srli_epi32(vsrcpixel, 24);
+            vsrcA = _mm_and_si128(vsrcpixel, v255);
+            vdstpixel = _mm_loadu_si128((__m128i *)dst);
+            vdstR = _mm_and_si128(_mm_srli_epi32(vdstpixel, 16), v255);
+            vdstG = _mm_and_si128(_mm_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm_and_si128(vdstpixel, v255);
+            vsrcR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vmodulateR), vdiv), 7);
+            vsrcG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vmodulateG), vdiv), 7);
+            vsrcB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vmodulateB), vdiv), 7);
+            vsrcA = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcA, vmodulateA), vdiv), 7);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm_or_si128(_mm_and_si128(vkeep, vdstR), _mm_andnot_si128(vkeep, vsrcR));
+                vdstG = _mm_or_si128(_mm_and_si128(vkeep, vdstG), _mm_andnot_si128(vkeep, vsrcG));
+                vdstB = _mm_or_si128(_mm_and_si128(vkeep, vdstB), _mm_andnot_si128(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm_sub_epi32(v255, vsrcA);
+                vdstR = _mm_add_epi32(vsrcR, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm_add_epi32(vsrcG, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm_add_epi32(vsrcB, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm_min_epi16(_mm_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm_min_epi16(_mm_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm_min_epi16(_mm_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_or_si128(_mm_slli_epi32(vdstR, 16), _mm_slli_epi32(vdstG, 8)), vdstB));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixel = *src;
+            srcB = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcR = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            *dst = dstpixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* defined(__SSE2__) */
+
+static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n--) {
+            srcpixel = *src;
+            srcB = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcR = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            *dst = dstpixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        Uint32 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        while (n--) {
+            if (posx >= 0x10000L) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            }
+            srcpixel = *src;
+            srcB = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcR = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            *dst = dstpixel;
+            posx += incx;
+            ++dst;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Scale(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        Uint32 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        while (n--) {
+            if (posx >= 0x10000L) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            }
+            pixel = *src;
+            B = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); R = (Uint8)(pixel >> 8); A = (Uint8)pixel;
+            pixel = ((Uint32)B << 16) | ((Uint32)G << 8) | R;
+            *dst = pixel;
+            posx += incx;
+            ++dst;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+#if SDL_AVX2_BLITTERS
+static void SDL_TARGETING_AVX2 SDL_Blit_BGRA8888_BGR888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i v255 = _mm256_set1_epi32(0xFF);
+    const __m256i vdiv = _mm256_set1_epi32(0x8081);
+    const __m256i vzero = _mm256_setzero_si256();
+    __m256i vkeep, vinvA;
+    __m256i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m256i vdstpixel, vdstR, vdstG, vdstB;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            vsrcpixel = _mm256_loadu_si256((__m256i *)src);
+            vsrcR = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 8), v255);
+            vsrcG = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 16), v255);
+            vsrcB = _mm256_srli_epi32(vsrcpixel, 24);
+            vsrcA = _mm256_and_si256(vsrcpixel, v255);
+            vdstpixel = _mm256_loadu_si256((__m256i *)dst);
+            vdstR = _mm256_and_si256(vdstpixel, v255);
+            vdstG = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 16), v255);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm256_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm256_or_si256(_mm256_and_si256(vkeep, vdstR), _mm256_andnot_si256(vkeep, vsrcR));
+                vdstG = _mm256_or_si256(_mm256_and_si256(vkeep, vdstG), _mm256_andnot_si256(vkeep, vsrcG));
+                vdstB = _mm256_or_si256(_mm256_and_si256(vkeep, vdstB), _mm256_andnot_si256(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm256_sub_epi32(v255, vsrcA);
+                vdstR = _mm256_add_epi32(vsrcR, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm256_add_epi32(vsrcG, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm256_add_epi32(vsrcB, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm256_min_epi16(_mm256_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm256_min_epi16(_mm256_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm256_min_epi16(_mm256_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(_mm256_or_si256(vdstR, _mm256_slli_epi32(vdstG, 8)), _mm256_slli_epi32(vdstB, 16)));
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            srcpixel = *src;
+            srcB = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcR = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel;
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
+            *dst = dstpixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* SDL_AVX2_BLITTERS */
+
+#if defined(__SSE2__)
+static void SDL_Blit_BGRA8888_BGR888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i v255 = _mm_set1_epi32(0xFF);
+    const __m128i vdiv = _mm_set1_epi32(0x8081);
+    const __m128i vzero = _mm_setzero_si128();
+    __m128i vkeep, vinvA;
+    __m128i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m128i vdstpixel, vdstR, vdstG, vdstB;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            vsrcpixel = _mm_loadu_si128((__m128i *)src);
+            vsrcR = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 8), v255);
+            vsrcG = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 16), v255);
+            vsrcB = _mm_srli_epi32(vsrcpixel, 24);
+            vsrcA = _mm_and_si128(vsrcpixel, v255);
+            vdstpixel = _mm_loadu_si128((__m128i *)dst);
+            vdstR = _mm_and_si128(vdstpixel, v255);
+            vdstG = _mm_and_si128(_mm_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm_and_si128(_mm_srli_epi32(vdstpixel, 16), v255);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm_or_si128(_mm_and_si128(vkeep, vdstR), _mm_andnot_si128(vkeep, vsrcR));
+                vdstG = _mm_or_si128(_mm_and_si128(vkeep, vdstG), _mm_andnot_si128(vkeep, vsrcG));
+                vdstB = _mm_or_si128(_mm_and_si128(vkeep, vdstB), _mm_andnot_si128(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm_sub_epi32(v255, vsrcA);
+                vdstR = _mm_add_epi32(vsrcR, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm_add_epi32(vsrcG, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm_add_epi32(vsrcB, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm_min_epi16(_mm_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm_min_epi16(_mm_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm_min_epi16(_mm_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_or_si128(vdstR, _mm_slli_epi32(vdstG, 8)), _mm_slli_epi32(vdstB, 16)));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixel = *src;
+            srcB = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcR = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel;
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
+            *dst = dstpixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* defined(__SSE2__) */
+
+static void SDL_Blit_BGRA8888_BGR888_Blend(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n--) {
+            srcpixel = *src;
+            srcB = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcR = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel;
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
+            *dst = dstpixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Blend_Scale(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        Uint32 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        while (n--) {
+            if (posx >= 0x10000L) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            }
+            srcpixel = *src;
+            srcB = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcR = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel;
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
+            *dst = dstpixel;
+            posx += incx;
+            ++dst;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+#if SDL_AVX2_BLITTERS
+static void SDL_TARGETING_AVX2 SDL_Blit_BGRA8888_BGR888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    const __m256i vmodulateR = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m256i vmodulateG = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m256i vmodulateB = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m256i vmodulateA = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m256i v255 = _mm256_set1_epi32(0xFF);
+    const __m256i vdiv = _mm256_set1_epi32(0x8081);
+    __m256i vpixel, vR, vG, vB, vA;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            vpixel = _mm256_loadu_si256((__m256i *)src);
+            vR = _mm256_and_si256(_mm256_srli_epi32(vpixel, 8), v255);
+            vG = _mm256_and_si256(_mm256_srli_epi32(vpixel, 16), v255);
+            vB = _mm256_srli_epi32(vpixel, 24);
+            vA = _mm256_and_si256(vpixel, v255);
+            vR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vR, vmodulateR), vdiv), 7);
+            vG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vG, vmodulateG), vdiv), 7);
+            vB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vB, vmodulateB), vdiv), 7);
+            vA = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vA, vmodulateA), vdiv), 7);
+            _mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(_mm256_or_si256(vR, _mm256_slli_epi32(vG, 8)), _mm256_slli_epi32(vB, 16)));
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            pixel = *src;
+            B = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); R = (Uint8)(pixel >> 8); A = (Uint8)pixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = (R * modulateR) / 255;
+                G = (G * modulateG) / 255;
+                B = (B * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = (A * modulateA) / 255;
+            }
+            pixel = ((Uint32)B << 16) | ((Uint32)G << 8) | R;
+            *dst = pixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* SDL_AVX2_BLITTERS */
+
+#if defined(__SSE2__)
+static void SDL_Blit_BGRA8888_BGR888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    const __m128i vmodulateR = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m128i vmodulateG = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m128i vmodulateB = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m128i vmodulateA = _mm_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m128i v255 = _mm_set1_epi32(0xFF);
+    const __m128i vdiv = _mm_set1_epi32(0x8081);
+    __m128i vpixel, vR, vG, vB, vA;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            vpixel = _mm_loadu_si128((__m128i *)src);
+            vR = _mm_and_si128(_mm_srli_epi32(vpixel, 8), v255);
+            vG = _mm_and_si128(_mm_srli_epi32(vpixel, 16), v255);
+            vB = _mm_srli_epi32(vpixel, 24);
+            vA = _mm_and_si128(vpixel, v255);
+            vR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vR, vmodulateR), vdiv), 7);
+            vG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vG, vmodulateG), vdiv), 7);
+            vB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vB, vmodulateB), vdiv), 7);
+            vA = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vA, vmodulateA), vdiv), 7);
+            _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_or_si128(vR, _mm_slli_epi32(vG, 8)), _mm_slli_epi32(vB, 16)));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            pixel = *src;
+            B = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); R = (Uint8)(pixel >> 8); A = (Uint8)pixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = (R * modulateR) / 255;
+                G = (G * modulateG) / 255;
+                B = (B * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = (A * modulateA) / 255;
+            }
+            pixel = ((Uint32)B << 16) | ((Uint32)G << 8) | R;
+            *dst = pixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* defined(__SSE2__) */
+
+static void SDL_Blit_BGRA8888_BGR888_Modulate(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n--) {
+            pixel = *src;
+            B = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); R = (Uint8)(pixel >> 8); A = (Uint8)pixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = (R * modulateR) / 255;
+                G = (G * modulateG) / 255;
+                B = (B * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = (A * modulateA) / 255;
+            }
+            pixel = ((Uint32)B << 16) | ((Uint32)G << 8) | R;
+            *dst = pixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        Uint32 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        while (n--) {
+            if (posx >= 0x10000L) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            }
+            pixel = *src;
+            B = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); R = (Uint8)(pixel >> 8); A = (Uint8)pixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = (R * modulateR) / 255;
+                G = (G * modulateG) / 255;
+                B = (B * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = (A * modulateA) / 255;
+            }
+            pixel = ((Uint32)B << 16) | ((Uint32)G << 8) | R;
+            *dst = pixel;
+            posx += incx;
+            ++dst;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+#if SDL_AVX2_BLITTERS
+static void SDL_TARGETING_AVX2 SDL_Blit_BGRA8888_BGR888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    const __m256i vmodulateR = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m256i vmodulateG = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m256i vmodulateB = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m256i vmodulateA = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m256i v255 = _mm256_set1_epi32(0xFF);
+    const __m256i vdiv = _mm256_set1_epi32(0x8081);
+    const __m256i vzero = _mm256_setzero_si256();
+    __m256i vkeep, vinvA;
+    __m256i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m256i vdstpixel, vdstR, vdstG, vdstB;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            vsrcpixel = _mm256_loadu_si256((__m256i *)src);
+            vsrcR = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 8), v255);
+            vsrcG = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 16), v255);
+            vsrcB = _mm256_srli_epi32(vsrcpixel, 24);
+            vsrcA = _mm256_and_si256(vsrcpixel, v255);
+            vdstpixel = _mm256_loadu_si256((__m256i *)dst);
+            vdstR = _mm256_and_si256(vdstpixel, v255);
+            vdstG = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 16), v255);
+            vsrcR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vmodulateR), vdiv), 7);
+            vsrcG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vmodulateG), vdiv), 7);
+            vsrcB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vmodulateB), vdiv), 7);
+            vsrcA = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcA, vmodulateA), vdiv), 7);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm256_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm256_or_si256(_mm256_and_si256(vkeep, vdstR), _mm256_andnot_si256(vkeep, vsrcR));
+                vdstG = _mm256_or_si256(_mm256_and_si256(vkeep, vdstG), _mm256_andnot_si256(vkeep, vsrcG));
+                vdstB = _mm256_or_si256(_mm256_and_si256(vkeep, vdstB), _mm256_andnot_si256(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm256_sub_epi32(v255, vsrcA);
+                vdstR = _mm256_add_epi32(vsrcR, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm256_add_epi32(vsrcG, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm256_add_epi32(vsrcB, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm256_min_epi16(_mm256_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm256_min_epi16(_mm256_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm256_min_epi16(_mm256_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(_mm256_or_si256(vdstR, _mm256_slli_epi32(vdstG, 8)), _mm256_slli_epi32(vdstB, 16)));
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            srcpixel = *src;
+            srcB = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcR = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
+            *dst = dstpixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* SDL_AVX2_BLITTERS */
+
+#if defined(__SSE2__)
+static void SDL_Blit_BGRA8888_BGR888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    const __m128i vmodulateR = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m128i vmodulateG = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m128i vmodulateB = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m128i vmodulateA = _mm_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m128i v255 = _mm_set1_epi32(0xFF);
+    const __m128i vdiv = _mm_set1_epi32(0x8081);
+    const __m128i vzero = _mm_setzero_si128();
+    __m128i vkeep, vinvA;
+    __m128i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m128i vdstpixel, vdstR, vdstG, vdstB;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            vsrcpixel = _mm_loadu_si128((__m128i *)src);
+            vsrcR = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 8), v255);
+            vsrcG = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 16), v255);
+            vsrcB = _mm_srli_epi32(vsrcpixel, 24);
+            vsrcA = _mm_and_si128(vsrcpixel, v255);
+            vdstpixel = _mm_loadu_si128((__m128i *)dst);
+            vdstR = _mm_and_si128(vdstpixel, v255);
+            vdstG = _mm_and_si128(_mm_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm_and_si128(_mm_srli_epi32(vdstpixel, 16), v255);
+            vsrcR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vmodulateR), vdiv), 7);
+            vsrcG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vmodulateG), vdiv), 7);
+            vsrcB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vmodulateB), vdiv), 7);
+            vsrcA = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcA, vmodulateA), vdiv), 7);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm_or_si128(_mm_and_si128(vkeep, vdstR), _mm_andnot_si128(vkeep, vsrcR));
+                vdstG = _mm_or_si128(_mm_and_si128(vkeep, vdstG), _mm_andnot_si128(vkeep, vsrcG));
+                vdstB = _mm_or_si128(_mm_and_si128(vkeep, vdstB), _mm_andnot_si128(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm_sub_epi32(v255, vsrcA);
+                vdstR = _mm_add_epi32(vsrcR, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm_add_epi32(vsrcG, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm_add_epi32(vsrcB, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm_min_epi16(_mm_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm_min_epi16(_mm_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm_min_epi16(_mm_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_or_si128(vdstR, _mm_slli_epi32(vdstG, 8)), _mm_slli_epi32(vdstB, 16)));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixel = *src;
+            srcB = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcR = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
+            *dst = dstpixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* defined(__SSE2__) */
+
+static void SDL_Blit_BGRA8888_BGR888_Modulate_Blend(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n--) {
+            srcpixel = *src;
+            srcB = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcR = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
+            *dst = dstpixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        Uint32 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        while (n--) {
+            if (posx >= 0x10000L) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            }
+            srcpixel = *src;
+            srcB = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcR = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstB = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstR = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstB << 16) | ((Uint32)dstG << 8) | dstR;
+            *dst = dstpixel;
+            posx += incx;
+            ++dst;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Scale(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        Uint32 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        while (n--) {
+            if (posx >= 0x10000L) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            }
+            pixel = *src;
+            B = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); R = (Uint8)(pixel >> 8); A = (Uint8)pixel;
+            pixel = ((Uint32)A << 24) | ((Uint32)R << 16) | ((Uint32)G << 8) | B;
+            *dst = pixel;
+            posx += incx;
+            ++dst;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+#if SDL_AVX2_BLITTERS
+static void SDL_TARGETING_AVX2 SDL_Blit_BGRA8888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i v255 = _mm256_set1_epi32(0xFF);
+    const __m256i vdiv = _mm256_set1_epi32(0x8081);
+    const __m256i vzero = _mm256_setzero_si256();
+    __m256i vkeep, vinvA;
+    __m256i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m256i vdstpixel, vdstR, vdstG, vdstB, vdstA;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB, dstA;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            vsrcpixel = _mm256_loadu_si256((__m256i *)src);
+            vsrcR = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 8), v255);
+            vsrcG = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 16), v255);
+            vsrcB = _mm256_srli_epi32(vsrcpixel, 24);
+            vsrcA = _mm256_and_si256(vsrcpixel, v255);
+            vdstpixel = _mm256_loadu_si256((__m256i *)dst);
+            vdstR = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 16), v255);
+            vdstG = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm256_and_si256(vdstpixel, v255);
+            vdstA = _mm256_srli_epi32(vdstpixel, 24);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm256_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm256_or_si256(_mm256_and_si256(vkeep, vdstR), _mm256_andnot_si256(vkeep, vsrcR));
+                vdstG = _mm256_or_si256(_mm256_and_si256(vkeep, vdstG), _mm256_andnot_si256(vkeep, vsrcG));
+                vdstB = _mm256_or_si256(_mm256_and_si256(vkeep, vdstB), _mm256_andnot_si256(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm256_sub_epi32(v255, vsrcA);
+                vdstR = _mm256_add_epi32(vsrcR, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm256_add_epi32(vsrcG, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm256_add_epi32(vsrcB, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm256_min_epi16(_mm256_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm256_min_epi16(_mm256_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm256_min_epi16(_mm256_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(vdstR, 16), _mm256_slli_epi32(vdstG, 8)), vdstB), _mm256_slli_epi32(vdstA, 24)));
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            srcpixel = *src;
+            srcB = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcR = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            *dst = dstpixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* SDL_AVX2_BLITTERS */
+
+#if defined(__SSE2__)
+static void SDL_Blit_BGRA8888_ARGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i v255 = _mm_set1_epi32(0xFF);
+    const __m128i vdiv = _mm_set1_epi32(0x8081);
+    const __m128i vzero = _mm_setzero_si128();
+    __m128i vkeep, vinvA;
+    __m128i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m128i vdstpixel, vdstR, vdstG, vdstB, vdstA;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB, dstA;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            vsrcpixel = _mm_loadu_si128((__m128i *)src);
+            vsrcR = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 8), v255);
+            vsrcG = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 16), v255);
+            vsrcB = _mm_srli_epi32(vsrcpixel, 24);
+            vsrcA = _mm_and_si128(vsrcpixel, v255);
+            vdstpixel = _mm_loadu_si128((__m128i *)dst);
+            vdstR = _mm_and_si128(_mm_srli_epi32(vdstpixel, 16), v255);
+            vdstG = _mm_and_si128(_mm_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm_and_si128(vdstpixel, v255);
+            vdstA = _mm_srli_epi32(vdstpixel, 24);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm_or_si128(_mm_and_si128(vkeep, vdstR), _mm_andnot_si128(vkeep, vsrcR));
+                vdstG = _mm_or_si128(_mm_and_si128(vkeep, vdstG), _mm_andnot_si128(vkeep, vsrcG));
+                vdstB = _mm_or_si128(_mm_and_si128(vkeep, vdstB), _mm_andnot_si128(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm_sub_epi32(v255, vsrcA);
+                vdstR = _mm_add_epi32(vsrcR, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm_add_epi32(vsrcG, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm_add_epi32(vsrcB, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm_min_epi16(_mm_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm_min_epi16(_mm_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm_min_epi16(_mm_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(vdstR, 16), _mm_slli_epi32(vdstG, 8)), vdstB), _mm_slli_epi32(vdstA, 24)));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixel = *src;
+            srcB = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcR = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            *dst = dstpixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* defined(__SSE2__) */
+
+static void SDL_Blit_BGRA8888_ARGB8888_Blend(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB, dstA;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n--) {
+            srcpixel = *src;
+            srcB = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcR = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            *dst = dstpixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB, dstA;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        Uint32 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        while (n--) {
+            if (posx >= 0x10000L) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+            }
+            srcpixel = *src;
+            srcB = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcR = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            *dst = dstpixel;
+            posx += incx;
+            ++dst;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+#if SDL_AVX2_BLITTERS
+static void SDL_TARGETING_AVX2 SDL_Blit_BGRA8888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    const __m256i vmodulateR = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m256i vmodulateG = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m256i vmodulateB = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m256i vmodulateA = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m256i v255 = _mm256_set1_epi32(0xFF);
+    const __m256i vdiv = _mm256_set1_epi32(0x8081);
+    __m256i vpixel, vR, vG, vB, vA;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            vpixel = _mm256_loadu_si256((__m256i *)src);
+            vR = _mm256_and_si256(_mm256_srli_epi32(vpixel, 8), v255);
+            vG = _mm256_and_si256(_mm256_srli_epi32(vpixel, 16), v255);
+            vB = _mm256_srli_epi32(vpixel, 24);
+            vA = _mm256_and_si256(vpixel, v255);
+            vR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vR, vmodulateR), vdiv), 7);
+            vG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vG, vmodulateG), vdiv), 7);
+            vB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vB, vmodulateB), vdiv), 7);
+            vA = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vA, vmodulateA), vdiv), 7);
+            _mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(vR, 16), _mm256_slli_epi32(vG, 8)), vB), _mm256_slli_epi32(vA, 24)));
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            pixel = *src;
+            B = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); R = (Uint8)(pixel >> 8); A = (Uint8)pixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = (R * modulateR) / 255;
+                G = (G * modulateG) / 255;
+                B = (B * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = (A * modulateA) / 255;
+            }
+            pixel = ((Uint32)A << 24) | ((Uint32)R << 16) | ((Uint32)G << 8) | B;
+            *dst = pixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* SDL_AVX2_BLITTERS */
+
+#if defined(__SSE2__)
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    const __m128i vmodulateR = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m128i vmodulateG = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m128i vmodulateB = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m128i vmodulateA = _mm_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m128i v255 = _mm_set1_epi32(0xFF);
+    const __m128i vdiv = _mm_set1_epi32(0x8081);
+    __m128i vpixel, vR, vG, vB, vA;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            vpixel = _mm_loadu_si128((__m128i *)src);
+            vR = _mm_and_si128(_mm_srli_epi32(vpixel, 8), v255);
+            vG = _mm_and_si128(_mm_srli_epi32(vpixel, 16), v255);
+            vB = _mm_srli_epi32(vpixel, 24);
+            vA = _mm_and_si128(vpixel, v255);
+            vR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vR, vmodulateR), vdiv), 7);
+            vG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vG, vmodulateG), vdiv), 7);
+            vB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vB, vmodulateB), vdiv), 7);
+            vA = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vA, vmodulateA), vdiv), 7);
+            _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(vR, 16), _mm_slli_epi32(vG, 8)), vB), _mm_slli_epi32(vA, 24)));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            pixel = *src;
+            B = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); R = (Uint8)(pixel >> 8); A = (Uint8)pixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = (R * modulateR) / 255;
+                G = (G * modulateG) / 255;
+                B = (B * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = (A * modulateA) / 255;
+            }
+            pixel = ((Uint32)A << 24) | ((Uint32)R << 16) | ((Uint32)G << 8) | B;
+            *dst = pixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* defined(__SSE2__) */
+
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
         Uint32 *dst = (Uint32 *)info->dst;
         int n = info->dst_w;
         while (n--) {
@@ -7716,6 +18312,270 @@ static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
     }
 }
 
+#if SDL_AVX2_BLITTERS
+static void SDL_TARGETING_AVX2 SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    const __m256i vmodulateR = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m256i vmodulateG = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m256i vmodulateB = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m256i vmodulateA = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m256i v255 = _mm256_set1_epi32(0xFF);
+    const __m256i vdiv = _mm256_set1_epi32(0x8081);
+    const __m256i vzero = _mm256_setzero_si256();
+    __m256i vkeep, vinvA;
+    __m256i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m256i vdstpixel, vdstR, vdstG, vdstB, vdstA;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB, dstA;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            vsrcpixel = _mm256_loadu_si256((__m256i *)src);
+            vsrcR = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 8), v255);
+            vsrcG = _mm256_and_si256(_mm256_srli_epi32(vsrcpixel, 16), v255);
+            vsrcB = _mm256_srli_epi32(vsrcpixel, 24);
+            vsrcA = _mm256_and_si256(vsrcpixel, v255);
+            vdstpixel = _mm256_loadu_si256((__m256i *)dst);
+            vdstR = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 16), v255);
+            vdstG = _mm256_and_si256(_mm256_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm256_and_si256(vdstpixel, v255);
+            vdstA = _mm256_srli_epi32(vdstpixel, 24);
+            vsrcR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vmodulateR), vdiv), 7);
+            vsrcG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vmodulateG), vdiv), 7);
+            vsrcB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vmodulateB), vdiv), 7);
+            vsrcA = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcA, vmodulateA), vdiv), 7);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm256_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm256_or_si256(_mm256_and_si256(vkeep, vdstR), _mm256_andnot_si256(vkeep, vsrcR));
+                vdstG = _mm256_or_si256(_mm256_and_si256(vkeep, vdstG), _mm256_andnot_si256(vkeep, vsrcG));
+                vdstB = _mm256_or_si256(_mm256_and_si256(vkeep, vdstB), _mm256_andnot_si256(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm256_sub_epi32(v255, vsrcA);
+                vdstR = _mm256_add_epi32(vsrcR, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm256_add_epi32(vsrcG, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm256_add_epi32(vsrcB, _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm256_min_epi16(_mm256_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm256_min_epi16(_mm256_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm256_min_epi16(_mm256_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(vdstR, 16), _mm256_slli_epi32(vdstG, 8)), vdstB), _mm256_slli_epi32(vdstA, 24)));
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            srcpixel = *src;
+            srcB = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcR = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            *dst = dstpixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* SDL_AVX2_BLITTERS */
+
+#if defined(__SSE2__)
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    const __m128i vmodulateR = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const __m128i vmodulateG = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const __m128i vmodulateB = _mm_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const __m128i vmodulateA = _mm_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+    const __m128i v255 = _mm_set1_epi32(0xFF);
+    const __m128i vdiv = _mm_set1_epi32(0x8081);
+    const __m128i vzero = _mm_setzero_si128();
+    __m128i vkeep, vinvA;
+    __m128i vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    __m128i vdstpixel, vdstR, vdstG, vdstB, vdstA;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB, dstA;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            vsrcpixel = _mm_loadu_si128((__m128i *)src);
+            vsrcR = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 8), v255);
+            vsrcG = _mm_and_si128(_mm_srli_epi32(vsrcpixel, 16), v255);
+            vsrcB = _mm_srli_epi32(vsrcpixel, 24);
+            vsrcA = _mm_and_si128(vsrcpixel, v255);
+            vdstpixel = _mm_loadu_si128((__m128i *)dst);
+            vdstR = _mm_and_si128(_mm_srli_epi32(vdstpixel, 16), v255);
+            vdstG = _mm_and_si128(_mm_srli_epi32(vdstpixel, 8), v255);
+            vdstB = _mm_and_si128(vdstpixel, v255);
+            vdstA = _mm_srli_epi32(vdstpixel, 24);
+            vsrcR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vmodulateR), vdiv), 7);
+            vsrcG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vmodulateG), vdiv), 7);
+            vsrcB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vmodulateB), vdiv), 7);
+            vsrcA = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcA, vmodulateA), vdiv), 7);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                vsrcR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vsrcA), vdiv), 7);
+                vsrcG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vsrcA), vdiv), 7);
+                vsrcB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vsrcA), vdiv), 7);
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = _mm_cmpeq_epi32(vsrcA, vzero);
+                vdstR = _mm_or_si128(_mm_and_si128(vkeep, vdstR), _mm_andnot_si128(vkeep, vsrcR));
+                vdstG = _mm_or_si128(_mm_and_si128(vkeep, vdstG), _mm_andnot_si128(vkeep, vsrcG));
+                vdstB = _mm_or_si128(_mm_and_si128(vkeep, vdstB), _mm_andnot_si128(vkeep, vsrcB));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = _mm_sub_epi32(v255, vsrcA);
+                vdstR = _mm_add_epi32(vsrcR, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstR), vdiv), 7));
+                vdstG = _mm_add_epi32(vsrcG, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstG), vdiv), 7));
+                vdstB = _mm_add_epi32(vsrcB, _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vinvA, vdstB), vdiv), 7));
+                break;
+            case SDL_COPY_ADD:
+                vdstR = _mm_min_epi16(_mm_add_epi32(vsrcR, vdstR), v255);
+                vdstG = _mm_min_epi16(_mm_add_epi32(vsrcG, vdstG), v255);
+                vdstB = _mm_min_epi16(_mm_add_epi32(vsrcB, vdstB), v255);
+                break;
+            case SDL_COPY_MOD:
+                vdstR = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcR, vdstR), vdiv), 7);
+                vdstG = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcG, vdstG), vdiv), 7);
+                vdstB = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(vsrcB, vdstB), vdiv), 7);
+                break;
+            }
+            _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(vdstR, 16), _mm_slli_epi32(vdstG, 8)), vdstB), _mm_slli_epi32(vdstA, 24)));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixel = *src;
+            srcB = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcR = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
+            dstpixel = *dst;
+            dstA = (Uint8)(dstpixel >> 24); dstR = (Uint8)(dstpixel >> 16); dstG = (Uint8)(dstpixel >> 8); dstB = (Uint8)dstpixel;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = (srcR * modulateR) / 255;
+                srcG = (srcG * modulateG) / 255;
+                srcB = (srcB * modulateB) / 255;
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = (srcA * modulateA) / 255;
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha */
+                if (srcA < 255) {
+                    srcR = (srcR * srcA) / 255;
+                    srcG = (srcG * srcA) / 255;
+                    srcB = (srcB * srcA) / 255;
+                }
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                if (srcA) {
+                    dstR = srcR;
+                    dstG = srcG;
+                    dstB = srcB;
+                }
+                break;
+            case SDL_COPY_BLEND:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                break;
+            case SDL_COPY_ADD:
+                dstR = srcR + dstR; if (dstR > 255) dstR = 255;
+                dstG = srcG + dstG; if (dstG > 255) dstG = 255;
+                dstB = srcB + dstB; if (dstB > 255) dstB = 255;
+                break;
+            case SDL_COPY_MOD:
+                dstR = (srcR * dstR) / 255;
+                dstG = (srcG * dstG) / 255;
+                dstB = (srcB * dstB) / 255;
+                break;
+            }
+            dstpixel = ((Uint32)dstA << 24) | ((Uint32)dstR << 16) | ((Uint32)dstG << 8) | dstB;
+            *dst = dstpixel;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* defined(__SSE2__) */
+
 static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -7881,129 +18741,453 @@ static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
 
 SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Scale },
+#if SDL_AVX2_BLITTERS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGB888_RGB888_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGB888_RGB888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Blend },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Blend_Scale },
+#if SDL_AVX2_BLITTERS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGB888_RGB888_Modulate_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_RGB888_RGB888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Modulate },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Modulate_Scale },
+#if SDL_AVX2_BLITTERS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGB888_RGB888_Modulate_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGB888_RGB888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Modulate_Blend },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Scale },
+#if SDL_AVX2_BLITTERS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGB888_BGR888_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGB888_BGR888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Blend },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Blend_Scale },
+#if SDL_AVX2_BLITTERS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGB888_BGR888_Modulate_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_RGB888_BGR888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Modulate },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Modulate_Scale },
+#if SDL_AVX2_BLITTERS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGB888_BGR888_Modulate_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGB888_BGR888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Modulate_Blend },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Scale },
+#if SDL_AVX2_BLITTERS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGB888_ARGB8888_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGB888_ARGB8888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Blend },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Blend_Scale },
+#if SDL_AVX2_BLITTERS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGB888_ARGB8888_Modulate_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_RGB888_ARGB8888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Modulate },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Modulate_Scale },
+#if SDL_AVX2_BLITTERS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGB888_ARGB8888_Modulate_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGB888_ARGB8888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Modulate_Blend },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Scale },
+#if SDL_AVX2_BLITTERS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGR888_RGB888_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGR888_RGB888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Blend },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Blend_Scale },
+#if SDL_AVX2_BLITTERS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGR888_RGB888_Modulate_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_BGR888_RGB888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Modulate },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Modulate_Scale },
+#if SDL_AVX2_BLITTERS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGR888_RGB888_Modulate_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGR888_RGB888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Modulate_Blend },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Scale },
+#if SDL_AVX2_BLITTERS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGR888_BGR888_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGR888_BGR888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Blend },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Blend_Scale },
+#if SDL_AVX2_BLITTERS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGR888_BGR888_Modulate_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_BGR888_BGR888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Modulate },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Modulate_Scale },
+#if SDL_AVX2_BLITTERS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGR888_BGR888_Modulate_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGR888_BGR888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Modulate_Blend },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Scale },
+#if SDL_AVX2_BLITTERS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGR888_ARGB8888_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGR888_ARGB8888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Blend },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Blend_Scale },
+#if SDL_AVX2_BLITTERS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGR888_ARGB8888_Modulate_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_BGR888_ARGB8888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Modulate },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Modulate_Scale },
+#if SDL_AVX2_BLITTERS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGR888_ARGB8888_Modulate_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGR888_ARGB8888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Modulate_Blend },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Scale },
+#if SDL_AVX2_BLITTERS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ARGB8888_RGB888_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ARGB8888_RGB888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Blend },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Blend_Scale },
+#if SDL_AVX2_BLITTERS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ARGB8888_RGB888_Modulate_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_ARGB8888_RGB888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Modulate },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Modulate_Scale },
+#if SDL_AVX2_BLITTERS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ARGB8888_RGB888_Modulate_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ARGB8888_RGB888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Modulate_Blend },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Scale },
+#if SDL_AVX2_BLITTERS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ARGB8888_BGR888_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ARGB8888_BGR888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Blend },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Blend_Scale },
+#if SDL_AVX2_BLITTERS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ARGB8888_BGR888_Modulate_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_ARGB8888_BGR888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Modulate },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Modulate_Scale },
+#if SDL_AVX2_BLITTERS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ARGB8888_BGR888_Modulate_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ARGB8888_BGR888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Modulate_Blend },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Scale },
+#if SDL_AVX2_BLITTERS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ARGB8888_ARGB8888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Blend },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Blend_Scale },
+#if SDL_AVX2_BLITTERS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Modulate_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_ARGB8888_ARGB8888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Modulate },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale },
+#if SDL_AVX2_BLITTERS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Scale },
+#if SDL_AVX2_BLITTERS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGBA8888_RGB888_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGBA8888_RGB888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Blend },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Blend_Scale },
+#if SDL_AVX2_BLITTERS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGBA8888_RGB888_Modulate_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_RGBA8888_RGB888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Modulate },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Modulate_Scale },
+#if SDL_AVX2_BLITTERS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGBA8888_RGB888_Modulate_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGBA8888_RGB888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Modulate_Blend },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Scale },
+#if SDL_AVX2_BLITTERS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGBA8888_BGR888_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGBA8888_BGR888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Blend },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Blend_Scale },
+#if SDL_AVX2_BLITTERS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGBA8888_BGR888_Modulate_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_RGBA8888_BGR888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Modulate },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Modulate_Scale },
+#if SDL_AVX2_BLITTERS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGBA8888_BGR888_Modulate_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGBA8888_BGR888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Modulate_Blend },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Scale },
+#if SDL_AVX2_BLITTERS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGBA8888_ARGB8888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Blend },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Blend_Scale },
+#if SDL_AVX2_BLITTERS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Modulate_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_RGBA8888_ARGB8888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Modulate },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale },
+#if SDL_AVX2_BLITTERS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Scale },
+#if SDL_AVX2_BLITTERS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ABGR8888_RGB888_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ABGR8888_RGB888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Blend },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Blend_Scale },
+#if SDL_AVX2_BLITTERS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ABGR8888_RGB888_Modulate_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_ABGR8888_RGB888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Modulate },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Modulate_Scale },
+#if SDL_AVX2_BLITTERS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ABGR8888_RGB888_Modulate_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ABGR8888_RGB888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Modulate_Blend },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Scale },
+#if SDL_AVX2_BLITTERS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ABGR8888_BGR888_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ABGR8888_BGR888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Blend },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Blend_Scale },
+#if SDL_AVX2_BLITTERS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ABGR8888_BGR888_Modulate_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_ABGR8888_BGR888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Modulate },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Modulate_Scale },
+#if SDL_AVX2_BLITTERS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ABGR8888_BGR888_Modulate_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ABGR8888_BGR888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Modulate_Blend },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Scale },
+#if SDL_AVX2_BLITTERS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ABGR8888_ARGB8888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Blend },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Blend_Scale },
+#if SDL_AVX2_BLITTERS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Modulate_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_ABGR8888_ARGB8888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Modulate },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale },
+#if SDL_AVX2_BLITTERS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Scale },
+#if SDL_AVX2_BLITTERS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGRA8888_RGB888_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGRA8888_RGB888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Blend },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Blend_Scale },
+#if SDL_AVX2_BLITTERS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGRA8888_RGB888_Modulate_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_BGRA8888_RGB888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Modulate },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Modulate_Scale },
+#if SDL_AVX2_BLITTERS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGRA8888_RGB888_Modulate_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGRA8888_RGB888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Modulate_Blend },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Scale },
+#if SDL_AVX2_BLITTERS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGRA8888_BGR888_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGRA8888_BGR888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Blend },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Blend_Scale },
+#if SDL_AVX2_BLITTERS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGRA8888_BGR888_Modulate_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_BGRA8888_BGR888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Modulate },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Modulate_Scale },
+#if SDL_AVX2_BLITTERS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGRA8888_BGR888_Modulate_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGRA8888_BGR888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Modulate_Blend },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Scale },
+#if SDL_AVX2_BLITTERS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGRA8888_ARGB8888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Blend },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Blend_Scale },
+#if SDL_AVX2_BLITTERS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Modulate_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_BGRA8888_ARGB8888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Modulate },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale },
+#if SDL_AVX2_BLITTERS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale },
     { 0, 0, 0, 0, NULL }
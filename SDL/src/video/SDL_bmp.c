@@ -59,6 +59,8 @@ SDL_LoadBMP_RW(SDL_RWops * src, int freesrc)
     Uint32 Bmask;
     SDL_Palette *palette;
     Uint8 *bits;
+    const Uint8 *mem;
+    size_t available;
     int ExpandBMP;
 
     /* The Win32 BMP file header (14 bytes) */
@@ -266,9 +268,15 @@ SDL_LoadBMP_RW(SDL_RWops * src, int freesrc)
         pad = (((bmpPitch) % 4) ? (4 - ((bmpPitch) % 4)) : 0);
         break;
     default:
+        bmpPitch = surface->pitch;
         pad = ((surface->pitch % 4) ? (4 - (surface->pitch % 4)) : 0);
         break;
     }
+    /* If the pixels are in memory, read them from there directly */
+    mem = (const Uint8 *) SDL_RWGetPointer(src, &available);
+    if (mem && available < (size_t) (bmpPitch + pad) * surface->h) {
+        mem = NULL;
+    }
     while (bits > (Uint8 *) surface->pixels) {
         bits -= surface->pitch;
         switch (ExpandBMP) {
@@ -279,7 +287,9 @@ SDL_LoadBMP_RW(SDL_RWops * src, int freesrc)
                 int shift = (8 - ExpandBMP);
                 for (i = 0; i < surface->w; ++i) {
                     if (i % (8 / ExpandBMP) == 0) {
-                        if (!SDL_RWread(src, &pixel, 1, 1)) {
+                        if (mem) {
+                            pixel = *mem++;
+                        } else if (!SDL_RWread(src, &pixel, 1, 1)) {
                             SDL_SetError("Error reading from BMP");
                             was_error = 1;
                             goto done;
@@ -292,8 +302,11 @@ SDL_LoadBMP_RW(SDL_RWops * src, int freesrc)
             break;
 
         default:
-            if (SDL_RWread(src, bits, 1, surface->pitch)
-                != surface->pitch) {
+            if (mem) {
+                SDL_memcpy(bits, mem, surface->pitch);
+                mem += surface->pitch;
+            } else if (SDL_RWread(src, bits, 1, surface->pitch)
+                       != surface->pitch) {
                 SDL_Error(SDL_EFREAD);
                 was_error = 1;
                 goto done;
@@ -323,13 +336,18 @@ SDL_LoadBMP_RW(SDL_RWops * src, int freesrc)
             break;
         }
         /* Skip padding bytes, ugh */
-        if (pad) {
+        if (mem) {
+            mem += pad;
+        } else if (pad) {
             Uint8 padbyte;
             for (i = 0; i < pad; ++i) {
                 SDL_RWread(src, &padbyte, 1, 1);
             }
         }
     }
+    if (mem) {
+        SDL_RWseek(src, (bmpPitch + pad) * surface->h, RW_SEEK_CUR);
+    }
   done:
     if (was_error) {
         if (src) {
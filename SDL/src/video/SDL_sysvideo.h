@@ -274,6 +274,11 @@ struct SDL_VideoDevice
      */
     void (*PumpEvents) (_THIS);
 
+    /* Sleep until there is input, SendWakeupEvent() is called, or
+       'timeout' milliseconds pass (-1 to wait forever).  Optional. */
+    void (*WaitEventTimeout) (_THIS, int timeout);
+    void (*SendWakeupEvent) (_THIS);
+
     /* Suspend the screensaver */
     void (*SuspendScreenSaver) (_THIS);
 
@@ -285,6 +285,9 @@ SDL_VideoInit(const char *driver_name, Uint32 flags)
         }
     }
 
+    /* Start the blit worker threads, if SDL_BLIT_THREADS asks for them */
+    SDL_InitBlitThreads();
+
     /* We're ready to go! */
     return 0;
 }
@@ -2510,6 +2513,9 @@ SDL_VideoQuit(void)
     }
     _this->free(_this);
     _this = NULL;
+
+    /* Shut down the blit worker threads */
+    SDL_QuitBlitThreads();
 }
 
 int
@@ -76,6 +76,42 @@ my %set_rgba_string = (
     "BGRA8888" => "_pixel = ((Uint32)_B << 24) | ((Uint32)_G << 16) | ((Uint32)_R << 8) | _A;",
 );
 
+# The shift of each R, G, B, A channel, or -1 if the channel isn't present
+my %format_shifts = (
+    "RGB888" => [ 16, 8, 0, -1 ],
+    "BGR888" => [ 0, 8, 16, -1 ],
+    "ARGB8888" => [ 16, 8, 0, 24 ],
+    "RGBA8888" => [ 24, 16, 8, 0 ],
+    "ABGR8888" => [ 0, 8, 16, 24 ],
+    "BGRA8888" => [ 8, 16, 24, 0 ],
+);
+
+# The SIMD instruction sets we generate unscaled modulate/blend blitters for,
+# in order of preference.  Each channel is kept in its own 32-bit lane so the
+# results match the C blitters bit for bit.
+my @simd_isas = (
+    {
+        name => "AVX2",
+        guard => "SDL_AVX2_BLITTERS",
+        cpu => "SDL_CPU_AVX2",
+        prefix => "static void SDL_TARGETING_AVX2",
+        type => "__m256i",
+        p => "_mm256",
+        si => "si256",
+        width => 8,
+    },
+    {
+        name => "SSE2",
+        guard => "defined(__SSE2__)",
+        cpu => "SDL_CPU_SSE2",
+        prefix => "static void",
+        type => "__m128i",
+        p => "_mm",
+        si => "si128",
+        width => 4,
+    },
+);
+
 sub open_file {
     my $name = shift;
     open(FILE, ">$name.new") || die "Cant' open $name.new: $!";
@@ -141,6 +177,7 @@ sub output_copyfuncname
     my $scale = shift;
     my $args = shift;
     my $suffix = shift;
+    my $isa = shift;
 
     print FILE "$prefix SDL_Blit_${src}_${dst}";
     if ( $modulate ) {
@@ -152,17 +189,30 @@ sub output_copyfuncname
     if ( $scale ) {
         print FILE "_Scale";
     }
+    if ( $isa ) {
+        print FILE "_$isa->{name}";
+    }
     if ( $args ) {
         print FILE "(SDL_BlitInfo *info)";
     }
     print FILE "$suffix";
 }
 
+sub has_alpha
+{
+    my $format = shift;
+    return $format_shifts{$format}[3] >= 0;
+}
+
 sub get_rgba
 {
     my $prefix = shift;
     my $format = shift;
     my $string = $get_rgba_string{$format};
+    if ( $prefix eq "dst" && !has_alpha($format) ) {
+        # The destination alpha is only needed when it's written back
+        $string =~ s/ _A = 0xFF;//;
+    }
     $string =~ s/_/$prefix/g;
     if ( $prefix ne "" ) {
         print FILE <<__EOF__;
@@ -293,11 +343,12 @@ __EOF__
 __EOF__
     }
     if ( $blend ) {
+        my $dstA = has_alpha($dst) ? ", dstA" : "";
         print FILE <<__EOF__;
     Uint32 srcpixel;
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
-    Uint32 dstR, dstG, dstB, dstA;
+    Uint32 dstR, dstG, dstB$dstA;
 __EOF__
     } elsif ( $modulate || $src ne $dst ) {
         print FILE <<__EOF__;
@@ -371,6 +422,240 @@ __EOF__
 __EOF__
 }
 
+sub simd_div255
+{
+    my $isa = shift;
+    my $value = shift;
+    my $p = $isa->{p};
+
+    # (x * 0x8081) >> 23 is exactly x / 255 for all 16-bit x
+    return "${p}_srli_epi16(${p}_mulhi_epu16($value, vdiv), 7)";
+}
+
+sub simd_get_rgba
+{
+    my $isa = shift;
+    my $prefix = shift;
+    my $pointer = shift;
+    my $format = shift;
+    my $p = $isa->{p};
+    my $si = $isa->{si};
+    my @channels = ( "R", "G", "B", "A" );
+
+    print FILE <<__EOF__;
+            v${prefix}pixel = ${p}_loadu_${si}(($isa->{type} *)$pointer);
+__EOF__
+    for (my $i = 0; $i <= 3; ++$i) {
+        my $shift = $format_shifts{$format}[$i];
+        my $value;
+        if ( $shift < 0 && $prefix eq "dst" ) {
+            # Same as get_rgba(), there's no destination alpha to write back
+            next;
+        } elsif ( $shift < 0 ) {
+            $value = "v255";
+        } elsif ( $shift == 24 ) {
+            $value = "${p}_srli_epi32(v${prefix}pixel, 24)";
+        } elsif ( $shift == 0 ) {
+            $value = "${p}_and_${si}(v${prefix}pixel, v255)";
+        } else {
+            $value = "${p}_and_${si}(${p}_srli_epi32(v${prefix}pixel, $shift), v255)";
+        }
+        print FILE <<__EOF__;
+            v${prefix}$channels[$i] = $value;
+__EOF__
+    }
+}
+
+sub simd_set_rgba
+{
+    my $isa = shift;
+    my $prefix = shift;
+    my $format = shift;
+    my $p = $isa->{p};
+    my $si = $isa->{si};
+    my @channels = ( "R", "G", "B", "A" );
+    my $value = "";
+
+    for (my $i = 0; $i <= 3; ++$i) {
+        my $shift = $format_shifts{$format}[$i];
+        my $channel = "v${prefix}$channels[$i]";
+        if ( $shift < 0 ) {
+            next;
+        }
+        if ( $shift > 0 ) {
+            $channel = "${p}_slli_epi32($channel, $shift)";
+        }
+        if ( $value eq "" ) {
+            $value = $channel;
+        } else {
+            $value = "${p}_or_${si}($value, $channel)";
+        }
+    }
+    print FILE <<__EOF__;
+            ${p}_storeu_${si}(($isa->{type} *)dst, $value);
+__EOF__
+}
+
+sub output_simdcore
+{
+    my $isa = shift;
+    my $src = shift;
+    my $dst = shift;
+    my $modulate = shift;
+    my $blend = shift;
+    my $p = $isa->{p};
+    my $si = $isa->{si};
+    my $s = "";
+    my $d = "";
+
+    if ( $blend ) {
+        simd_get_rgba($isa, "src", "src", $src);
+        simd_get_rgba($isa, "dst", "dst", $dst);
+        $s = "src";
+        $d = "dst";
+    } else {
+        simd_get_rgba($isa, "", "src", $src);
+    }
+
+    if ( $modulate ) {
+        # The modulation factors are 255 when disabled, which is a no-op
+        foreach my $c ( "R", "G", "B", "A" ) {
+            my $value = simd_div255($isa, "${p}_mullo_epi16(v${s}$c, vmodulate$c)");
+            print FILE <<__EOF__;
+            v${s}$c = $value;
+__EOF__
+        }
+    }
+    if ( $blend ) {
+        my %premultiply;
+        my %blend;
+        my %mod;
+        foreach my $c ( "R", "G", "B" ) {
+            $premultiply{$c} = simd_div255($isa, "${p}_mullo_epi16(v${s}$c, v${s}A)");
+            $blend{$c} = simd_div255($isa, "${p}_mullo_epi16(vinvA, v${d}$c)");
+            $mod{$c} = simd_div255($isa, "${p}_mullo_epi16(v${s}$c, v${d}$c)");
+        }
+        print FILE <<__EOF__;
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                v${s}R = $premultiply{R};
+                v${s}G = $premultiply{G};
+                v${s}B = $premultiply{B};
+            }
+            switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            case SDL_COPY_MASK:
+                vkeep = ${p}_cmpeq_epi32(v${s}A, vzero);
+                v${d}R = ${p}_or_${si}(${p}_and_${si}(vkeep, v${d}R), ${p}_andnot_${si}(vkeep, v${s}R));
+                v${d}G = ${p}_or_${si}(${p}_and_${si}(vkeep, v${d}G), ${p}_andnot_${si}(vkeep, v${s}G));
+                v${d}B = ${p}_or_${si}(${p}_and_${si}(vkeep, v${d}B), ${p}_andnot_${si}(vkeep, v${s}B));
+                break;
+            case SDL_COPY_BLEND:
+                vinvA = ${p}_sub_epi32(v255, v${s}A);
+                v${d}R = ${p}_add_epi32(v${s}R, $blend{R});
+                v${d}G = ${p}_add_epi32(v${s}G, $blend{G});
+                v${d}B = ${p}_add_epi32(v${s}B, $blend{B});
+                break;
+            case SDL_COPY_ADD:
+                v${d}R = ${p}_min_epi16(${p}_add_epi32(v${s}R, v${d}R), v255);
+                v${d}G = ${p}_min_epi16(${p}_add_epi32(v${s}G, v${d}G), v255);
+                v${d}B = ${p}_min_epi16(${p}_add_epi32(v${s}B, v${d}B), v255);
+                break;
+            case SDL_COPY_MOD:
+                v${d}R = $mod{R};
+                v${d}G = $mod{G};
+                v${d}B = $mod{B};
+                break;
+            }
+__EOF__
+        simd_set_rgba($isa, "dst", $dst);
+    } else {
+        simd_set_rgba($isa, "", $dst);
+    }
+}
+
+sub output_simdfunc
+{
+    my $isa = shift;
+    my $src = shift;
+    my $dst = shift;
+    my $modulate = shift;
+    my $blend = shift;
+    my $type = $isa->{type};
+    my $p = $isa->{p};
+    my $si = $isa->{si};
+    my $width = $isa->{width};
+
+    print FILE "#if $isa->{guard}\n";
+    output_copyfuncname($isa->{prefix}, $src, $dst, $modulate, $blend, 0, 1, "\n", $isa);
+    print FILE <<__EOF__;
+{
+    const int flags = info->flags;
+__EOF__
+    if ( $modulate ) {
+        print FILE <<__EOF__;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    const $type vmodulateR = ${p}_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateR : 255);
+    const $type vmodulateG = ${p}_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateG : 255);
+    const $type vmodulateB = ${p}_set1_epi32((flags & SDL_COPY_MODULATE_COLOR) ? modulateB : 255);
+    const $type vmodulateA = ${p}_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 255);
+__EOF__
+    }
+    print FILE <<__EOF__;
+    const $type v255 = ${p}_set1_epi32(0xFF);
+    const $type vdiv = ${p}_set1_epi32(0x8081);
+__EOF__
+    if ( $blend ) {
+        my $dstA = has_alpha($dst) ? ", dstA" : "";
+        my $vdstA = has_alpha($dst) ? ", vdstA" : "";
+        print FILE <<__EOF__;
+    const $type vzero = ${p}_setzero_${si}();
+    $type vkeep, vinvA;
+    $type vsrcpixel, vsrcR, vsrcG, vsrcB, vsrcA;
+    $type vdstpixel, vdstR, vdstG, vdstB$vdstA;
+    Uint32 srcpixel;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB$dstA;
+__EOF__
+    } else {
+        print FILE <<__EOF__;
+    $type vpixel, vR, vG, vB, vA;
+    Uint32 pixel;
+    Uint32 R, G, B, A;
+__EOF__
+    }
+    print FILE <<__EOF__;
+
+    while (info->dst_h--) {
+        $format_type{$src} *src = ($format_type{$src} *)info->src;
+        $format_type{$dst} *dst = ($format_type{$dst} *)info->dst;
+        int n = info->dst_w;
+        while (n >= $width) {
+__EOF__
+    output_simdcore($isa, $src, $dst, $modulate, $blend);
+    print FILE <<__EOF__;
+            src += $width;
+            dst += $width;
+            n -= $width;
+        }
+        while (n--) {
+__EOF__
+    output_copycore($src, $dst, $modulate, $blend);
+    print FILE <<__EOF__;
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* $isa->{guard} */
+
+__EOF__
+}
+
 sub output_copyfunc_h
 {
 }
@@ -398,7 +683,6 @@ __EOF__
                 for (my $blend = 0; $blend <= 1; ++$blend) {
                     for (my $scale = 0; $scale <= 1; ++$scale) {
                         if ( $modulate || $blend || $scale ) {
-                            print FILE "    { SDL_PIXELFORMAT_$src, SDL_PIXELFORMAT_$dst, ";
                             my $flags = "";
                             my $flag = "";
                             if ( $modulate ) {
@@ -428,6 +712,16 @@ __EOF__
                             if ( $flags eq "" ) {
                                 $flags = "0";
                             }
+                            if ( !$scale ) {
+                                foreach my $isa ( @simd_isas ) {
+                                    print FILE "#if $isa->{guard}\n";
+                                    print FILE "    { SDL_PIXELFORMAT_$src, SDL_PIXELFORMAT_$dst, ";
+                                    print FILE "($flags), $isa->{cpu},";
+                                    output_copyfuncname("", $src_formats[$i], $dst_formats[$j], $modulate, $blend, $scale, 0, " },\n", $isa);
+                                    print FILE "#endif\n";
+                                }
+                            }
+                            print FILE "    { SDL_PIXELFORMAT_$src, SDL_PIXELFORMAT_$dst, ";
                             print FILE "($flags), SDL_CPU_ANY,";
                             output_copyfuncname("", $src_formats[$i], $dst_formats[$j], $modulate, $blend, $scale, 0, " },\n");
                         }
@@ -452,6 +746,11 @@ sub output_copyfunc_c
         for (my $blend = 0; $blend <= 1; ++$blend) {
             for (my $scale = 0; $scale <= 1; ++$scale) {
                 if ( $modulate || $blend || $scale ) {
+                    if ( !$scale ) {
+                        foreach my $isa ( @simd_isas ) {
+                            output_simdfunc($isa, $src, $dst, $modulate, $blend);
+                        }
+                    }
                     output_copyfunc($src, $dst, $modulate, $blend, $scale);
                 }
             }
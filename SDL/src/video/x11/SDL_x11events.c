@@ -24,6 +24,10 @@
 #include <sys/types.h>
 #include <sys/time.h>
 #include <unistd.h>
+#include <fcntl.h>
+#ifdef __LINUX__
+#include <sys/eventfd.h>
+#endif
 
 #include "SDL_syswm.h"
 #include "SDL_x11video.h"
@@ -409,6 +413,93 @@ X11_PumpEvents(_THIS)
     }
 }
 
+/* The wakeup descriptor lets other threads interrupt X11_WaitEventTimeout()
+   when they post an event.  It's an eventfd on Linux and a pipe elsewhere.
+ */
+int
+X11_InitWakeup(_THIS)
+{
+    SDL_VideoData *data = (SDL_VideoData *) _this->driverdata;
+
+#if defined(__LINUX__) && defined(EFD_NONBLOCK)
+    data->wakeup_fd[0] = eventfd(0, EFD_NONBLOCK);
+    if (data->wakeup_fd[0] >= 0) {
+        data->wakeup_fd[1] = data->wakeup_fd[0];
+        return 0;
+    }
+#endif
+    if (pipe(data->wakeup_fd) < 0) {
+        data->wakeup_fd[0] = data->wakeup_fd[1] = -1;
+        SDL_SetError("Couldn't create X11 wakeup pipe");
+        return -1;
+    }
+    fcntl(data->wakeup_fd[0], F_SETFL, O_NONBLOCK);
+    fcntl(data->wakeup_fd[1], F_SETFL, O_NONBLOCK);
+    return 0;
+}
+
+void
+X11_QuitWakeup(_THIS)
+{
+    SDL_VideoData *data = (SDL_VideoData *) _this->driverdata;
+
+    if (data->wakeup_fd[1] >= 0 && data->wakeup_fd[1] != data->wakeup_fd[0]) {
+        close(data->wakeup_fd[1]);
+    }
+    if (data->wakeup_fd[0] >= 0) {
+        close(data->wakeup_fd[0]);
+    }
+    data->wakeup_fd[0] = data->wakeup_fd[1] = -1;
+}
+
+void
+X11_SendWakeupEvent(_THIS)
+{
+    SDL_VideoData *data = (SDL_VideoData *) _this->driverdata;
+    Uint64 value = 1;
+
+    /* If the write fails because the pipe is full, a wakeup is already
+       pending, so there's nothing to do about it */
+    if (data->wakeup_fd[1] >= 0) {
+        if (write(data->wakeup_fd[1], &value, sizeof(value)) < 0) {
+            return;
+        }
+    }
+}
+
+void
+X11_WaitEventTimeout(_THIS, int timeout)
+{
+    SDL_VideoData *data = (SDL_VideoData *) _this->driverdata;
+    int x11_fd = ConnectionNumber(data->display);
+    int wakeup_fd = data->wakeup_fd[0];
+    Uint64 value;
+    struct timeval tv, *tvp = NULL;
+    fd_set fdset;
+
+    /* Flush our requests, and don't sleep if events are already queued */
+    if (XEventsQueued(data->display, QueuedAfterFlush)) {
+        return;
+    }
+
+    if (timeout >= 0) {
+        tv.tv_sec = timeout / 1000;
+        tv.tv_usec = (timeout % 1000) * 1000;
+        tvp = &tv;
+    }
+    FD_ZERO(&fdset);
+    FD_SET(x11_fd, &fdset);
+    if (wakeup_fd >= 0) {
+        FD_SET(wakeup_fd, &fdset);
+    }
+    if (select(SDL_max(x11_fd, wakeup_fd) + 1, &fdset, NULL, NULL, tvp) > 0
+        && wakeup_fd >= 0 && FD_ISSET(wakeup_fd, &fdset)) {
+        while (read(wakeup_fd, &value, sizeof(value)) > 0) {
+            /* Drain all pending wakeups */ ;
+        }
+    }
+}
+
 /* This is so wrong it hurts */
 #define GNOME_SCREENSAVER_HACK
 #ifdef GNOME_SCREENSAVER_HACK
@@ -24,7 +24,11 @@
 #ifndef _SDL_x11events_h
 #define _SDL_x11events_h
 
+extern int X11_InitWakeup(_THIS);
+extern void X11_QuitWakeup(_THIS);
 extern void X11_PumpEvents(_THIS);
+extern void X11_WaitEventTimeout(_THIS, int timeout);
+extern void X11_SendWakeupEvent(_THIS);
 extern void X11_SuspendScreenSaver(_THIS);
 
 #endif /* _SDL_x11events_h */
@@ -130,6 +130,7 @@ X11_CreateDevice(int devindex)
         return NULL;
     }
     device->driverdata = data;
+    data->wakeup_fd[0] = data->wakeup_fd[1] = -1;
 
     /* FIXME: Do we need this?
        if ( (SDL_strncmp(XDisplayName(display), ":", 1) == 0) ||
@@ -171,6 +172,8 @@ X11_CreateDevice(int devindex)
     device->GetDisplayGammaRamp = X11_GetDisplayGammaRamp;
     device->SuspendScreenSaver = X11_SuspendScreenSaver;
     device->PumpEvents = X11_PumpEvents;
+    device->WaitEventTimeout = X11_WaitEventTimeout;
+    device->SendWakeupEvent = X11_SendWakeupEvent;
 
     device->CreateWindow = X11_CreateWindow;
     device->CreateWindowFrom = X11_CreateWindowFrom;
@@ -232,6 +235,10 @@ X11_VideoInit(_THIS)
 
     X11_InitModes(_this);
 
+    if (X11_InitWakeup(_this) != 0) {
+        return -1;
+    }
+
 #if SDL_VIDEO_RENDER_X11
     X11_AddRenderDriver(_this);
 #endif
@@ -261,6 +268,7 @@ X11_VideoQuit(_THIS)
     X11_QuitModes(_this);
     X11_QuitKeyboard(_this);
     X11_QuitMouse(_this);
+    X11_QuitWakeup(_this);
 }
 
 SDL_bool
@@ -69,6 +69,7 @@ typedef struct SDL_VideoData
     int windowlistlength;
     int keyboard;
     Atom WM_DELETE_WINDOW;
+    int wakeup_fd[2];           /* Read and write ends, may be one eventfd */
     SDL_scancode key_layout[256];
 } SDL_VideoData;
 
@@ -0,0 +1,179 @@
+/*
+ * Times SDL_ConvertAudio() on common conversions, in CPU cycles per sample
+ * frame of input, and checks that converting the buffer in blocks gives
+ * the same result as running each filter over the whole buffer.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SDL.h"
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+static Uint64
+get_cycles(void)
+{
+    Uint32 lo, hi;
+    __asm__ __volatile__("rdtsc":"=a"(lo), "=d"(hi));
+    return ((Uint64) hi << 32) | lo;
+}
+
+#define CYCLES  "cycles"
+#else
+#define get_cycles  SDL_GetPerformanceCounter
+#define CYCLES  "ticks"
+#endif
+
+typedef struct
+{
+    SDL_AudioFormat src_format;
+    Uint8 src_channels;
+    int src_rate;
+    SDL_AudioFormat dst_format;
+    Uint8 dst_channels;
+    int dst_rate;
+} Conversion;
+
+static const Conversion conversions[] = {
+    {AUDIO_S16LSB, 2, 22050, AUDIO_F32LSB, 2, 48000},
+    {AUDIO_S16LSB, 2, 44100, AUDIO_S16LSB, 2, 48000},
+    {AUDIO_S16LSB, 1, 22050, AUDIO_S16LSB, 2, 44100},
+    {AUDIO_F32LSB, 2, 48000, AUDIO_S16LSB, 2, 44100},
+    {AUDIO_U8, 1, 11025, AUDIO_S16LSB, 2, 44100},
+    {AUDIO_S16LSB, 1, 44100, AUDIO_F32LSB, 2, 44100},
+    {AUDIO_F32LSB, 6, 48000, AUDIO_S16LSB, 2, 48000},
+    {AUDIO_S16MSB, 2, 44100, AUDIO_S16LSB, 2, 44100},
+};
+
+static int frames = 4 * 44100;
+static int iterations = 10;
+
+static const char *
+format_name(SDL_AudioFormat format)
+{
+    switch (format) {
+    case AUDIO_U8:
+        return "U8";
+    case AUDIO_S16LSB:
+        return "S16LSB";
+    case AUDIO_S16MSB:
+        return "S16MSB";
+    case AUDIO_F32LSB:
+        return "F32LSB";
+    default:
+        return "?";
+    }
+}
+
+/* Converts the data with the given block size and returns the cycles taken
+   per input frame, leaving the result in 'cvt' */
+static double
+convert(const Conversion * c, const Uint8 * data, SDL_AudioCVT * cvt,
+        const char *block)
+{
+    static char env[64];
+    Uint64 start, best = 0;
+    int i;
+
+    SDL_snprintf(env, sizeof(env), "SDL_AUDIO_CONVERT_BLOCK_SIZE=%s", block);
+    SDL_putenv(env);
+    if (SDL_BuildAudioCVT(cvt, c->src_format, c->src_channels, c->src_rate,
+                          c->dst_format, c->dst_channels, c->dst_rate) < 0) {
+        fprintf(stderr, "Couldn't build CVT: %s\n", SDL_GetError());
+        exit(2);
+    }
+    cvt->len = frames * c->src_channels * (SDL_AUDIO_BITSIZE(c->src_format) / 8);
+    cvt->buf = (Uint8 *) SDL_malloc(cvt->len * cvt->len_mult);
+    if (!cvt->buf) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    for (i = 0; i < iterations; ++i) {
+        Uint64 elapsed;
+
+        SDL_memcpy(cvt->buf, data, cvt->len);
+        start = get_cycles();
+        SDL_ConvertAudio(cvt);
+        elapsed = get_cycles() - start;
+        if (i == 0 || elapsed < best) {
+            best = elapsed;
+        }
+    }
+    return (double) best / frames;
+}
+
+int
+main(int argc, char *argv[])
+{
+    Uint8 *data;
+    int i, j, errors = 0;
+
+    for (i = 1; i < argc; ++i) {
+        if (SDL_strcmp(argv[i], "--frames") == 0 && argv[i + 1]) {
+            frames = SDL_atoi(argv[++i]);
+        } else if (SDL_strcmp(argv[i], "--iterations") == 0 && argv[i + 1]) {
+            iterations = SDL_atoi(argv[++i]);
+        } else {
+            fprintf(stderr, "Usage: %s [--frames N] [--iterations N]\n",
+                    argv[0]);
+            return 1;
+        }
+    }
+    if (frames <= 0 || iterations <= 0) {
+        fprintf(stderr, "Invalid parameters\n");
+        return 1;
+    }
+
+    if (SDL_Init(0) < 0) {
+        fprintf(stderr, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    /* Random 16-bit samples, or floats in [-1, 1) */
+    data = (Uint8 *) SDL_malloc(frames * 6 * sizeof(float));
+    if (!data) {
+        fprintf(stderr, "Out of memory\n");
+        SDL_Quit();
+        return 1;
+    }
+    srand(42);
+
+    printf("%d frames, " CYCLES " per input frame\n", frames);
+    printf("%-36s %10s %10s\n", "", "blocks", "whole");
+    for (i = 0; i < SDL_arraysize(conversions); ++i) {
+        const Conversion *c = &conversions[i];
+        SDL_AudioCVT blocks, whole;
+        double blocks_cycles, whole_cycles;
+        char name[64];
+
+        for (j = 0; j < frames * 6; ++j) {
+            if (c->src_format == AUDIO_F32LSB) {
+                ((float *) data)[j] = (rand() % 65536 - 32768) / 32768.0f;
+            } else {
+                ((Uint16 *) data)[j] = (Uint16) rand();
+            }
+        }
+
+        blocks_cycles = convert(c, data, &blocks, "");
+        whole_cycles = convert(c, data, &whole, "0");
+        SDL_snprintf(name, sizeof(name), "%s %d %5d -> %s %d %5d",
+                     format_name(c->src_format), c->src_channels,
+                     c->src_rate, format_name(c->dst_format),
+                     c->dst_channels, c->dst_rate);
+        printf("%-36s %10.2f %10.2f\n", name, blocks_cycles, whole_cycles);
+
+        if (blocks.len_cvt != whole.len_cvt ||
+            SDL_memcmp(blocks.buf, whole.buf, blocks.len_cvt) != 0) {
+            printf("Converting %s in blocks gave a different result\n",
+                   name);
+            ++errors;
+        }
+        SDL_free(blocks.buf);
+        SDL_free(whole.buf);
+    }
+    SDL_free(data);
+
+    printf("%s\n", errors ? "FAILED" : "Passed");
+    SDL_Quit();
+    return errors ? 2 : 0;
+}
@@ -0,0 +1,208 @@
+/*
+ * Checks that the SIMD versions of the generated blitters produce exactly
+ * the same pixels as the C versions, for every format, blend mode and
+ * modulation combination, then times both.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SDL.h"
+
+/* These match the SDL_CPU_* blitter flags in src/video/SDL_blit.h */
+#define BLIT_CPU_C      "0"
+#define BLIT_CPU_SSE2   "8"
+#define BLIT_CPU_AVX2   "72"
+
+#define WIDTH   67              /* Odd, so the scalar tail gets tested */
+#define HEIGHT  19
+
+static const struct
+{
+    const char *name;
+    Uint32 Rmask, Gmask, Bmask, Amask;
+} formats[] = {
+    { "RGB888", 0x00FF0000, 0x0000FF00, 0x000000FF, 0x00000000 },
+    { "BGR888", 0x000000FF, 0x0000FF00, 0x00FF0000, 0x00000000 },
+    { "ARGB8888", 0x00FF0000, 0x0000FF00, 0x000000FF, 0xFF000000 },
+    { "RGBA8888", 0xFF000000, 0x00FF0000, 0x0000FF00, 0x000000FF },
+    { "ABGR8888", 0x000000FF, 0x0000FF00, 0x00FF0000, 0xFF000000 },
+    { "BGRA8888", 0x0000FF00, 0x00FF0000, 0xFF000000, 0x000000FF },
+};
+#define NUM_SRC_FORMATS (sizeof(formats) / sizeof(formats[0]))
+#define NUM_DST_FORMATS 3       /* The blitters only write the first three */
+
+static const struct
+{
+    const char *name;
+    int mode;
+} blendmodes[] = {
+    { "none", SDL_BLENDMODE_NONE },
+    { "mask", SDL_BLENDMODE_MASK },
+    { "blend", SDL_BLENDMODE_BLEND },
+    { "add", SDL_BLENDMODE_ADD },
+    { "mod", SDL_BLENDMODE_MOD },
+};
+#define NUM_BLENDMODES (sizeof(blendmodes) / sizeof(blendmodes[0]))
+
+static Uint32 srcpixels[WIDTH * HEIGHT];
+static Uint32 dstpixels[WIDTH * HEIGHT];
+
+static SDL_Surface *
+create_surface(int format, const Uint32 * pixels, int w, int h)
+{
+    SDL_Surface *surface;
+    int x, y;
+
+    surface = SDL_CreateRGBSurface(SDL_SWSURFACE, w, h, 32,
+                                   formats[format].Rmask,
+                                   formats[format].Gmask,
+                                   formats[format].Bmask,
+                                   formats[format].Amask);
+    if (!surface) {
+        fprintf(stderr, "Couldn't create surface: %s\n", SDL_GetError());
+        exit(1);
+    }
+    for (y = 0; y < h; ++y) {
+        Uint32 *row = (Uint32 *) ((Uint8 *) surface->pixels +
+                                  y * surface->pitch);
+        for (x = 0; x < w; ++x) {
+            row[x] = pixels[(y % HEIGHT) * WIDTH + (x % WIDTH)];
+        }
+    }
+    return surface;
+}
+
+/* Blits the test pattern with the given blitter CPU features */
+static SDL_Surface *
+run_blit(const char *cpu, int src_format, int dst_format, int blendmode,
+         int modulate)
+{
+    static char env[64];
+    SDL_Surface *src, *dst;
+
+    SDL_snprintf(env, sizeof(env), "SDL_BLIT_CPU_FEATURES=%s", cpu);
+    SDL_putenv(env);
+
+    src = create_surface(src_format, srcpixels, WIDTH, HEIGHT);
+    dst = create_surface(dst_format, dstpixels, WIDTH, HEIGHT);
+    SDL_SetSurfaceBlendMode(src, blendmodes[blendmode].mode);
+    if (modulate) {
+        SDL_SetSurfaceColorMod(src, 200, 100, 37);
+        SDL_SetSurfaceAlphaMod(src, 130);
+    }
+    SDL_BlitSurface(src, NULL, dst, NULL);
+    SDL_FreeSurface(src);
+    return dst;
+}
+
+static int
+check_blit(const char *isa, const char *cpu, int src_format,
+           int dst_format, int blendmode, int modulate)
+{
+    SDL_Surface *expected, *actual;
+    int y, result = 1;
+
+    expected = run_blit(BLIT_CPU_C, src_format, dst_format, blendmode,
+                        modulate);
+    actual = run_blit(cpu, src_format, dst_format, blendmode, modulate);
+    for (y = 0; y < HEIGHT; ++y) {
+        if (SDL_memcmp((Uint8 *) expected->pixels + y * expected->pitch,
+                       (Uint8 *) actual->pixels + y * actual->pitch,
+                       WIDTH * 4) != 0) {
+            printf("%s mismatch: %s -> %s, blend %s%s, row %d\n", isa,
+                   formats[src_format].name, formats[dst_format].name,
+                   blendmodes[blendmode].name,
+                   modulate ? ", modulated" : "", y);
+            result = 0;
+            break;
+        }
+    }
+    SDL_FreeSurface(expected);
+    SDL_FreeSurface(actual);
+    return result;
+}
+
+static int
+check_isa(const char *isa, const char *cpu)
+{
+    int i, j, blendmode, modulate;
+    int failures = 0;
+
+    for (i = 0; i < NUM_SRC_FORMATS; ++i) {
+        for (j = 0; j < NUM_DST_FORMATS; ++j) {
+            for (blendmode = 0; blendmode < NUM_BLENDMODES; ++blendmode) {
+                for (modulate = 0; modulate <= 1; ++modulate) {
+                    if (!check_blit(isa, cpu, i, j, blendmode, modulate)) {
+                        ++failures;
+                    }
+                }
+            }
+        }
+    }
+    printf("%s blitters: %s\n", isa, failures ? "FAILED" : "bit exact");
+    return failures;
+}
+
+/* Times an ARGB8888 -> RGB888 alpha blend, as used for sprites */
+static void
+time_isa(const char *isa, const char *cpu)
+{
+    static char env[64];
+    SDL_Surface *src, *dst;
+    Uint32 start, now;
+    int iterations = 0;
+
+    SDL_snprintf(env, sizeof(env), "SDL_BLIT_CPU_FEATURES=%s", cpu);
+    SDL_putenv(env);
+
+    src = create_surface(2, srcpixels, 1024, 768);
+    dst = create_surface(0, dstpixels, 1024, 768);
+    SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_BLEND);
+    SDL_SetSurfaceAlphaMod(src, 200);
+    start = now = SDL_GetTicks();
+    while ((now - start) < 1000) {
+        SDL_BlitSurface(src, NULL, dst, NULL);
+        ++iterations;
+        now = SDL_GetTicks();
+    }
+    printf("%s: %.1f MPix/s modulated alpha blend\n", isa,
+           (iterations * 1024.0 * 768.0) / ((now - start) * 1000.0));
+    SDL_FreeSurface(src);
+    SDL_FreeSurface(dst);
+}
+
+int
+main(int argc, char *argv[])
+{
+    int i, failures = 0;
+
+    if (SDL_Init(SDL_INIT_TIMER) < 0) {
+        fprintf(stderr, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    srand(argc > 1 ? atoi(argv[1]) : 42);
+    for (i = 0; i < WIDTH * HEIGHT; ++i) {
+        srcpixels[i] = ((Uint32) rand() << 16) ^ (Uint32) rand();
+        dstpixels[i] = ((Uint32) rand() << 16) ^ (Uint32) rand();
+    }
+    /* Make sure the fully transparent and opaque paths are covered */
+    for (i = 0; i < WIDTH; ++i) {
+        srcpixels[i] &= 0x00FFFF00;
+        srcpixels[WIDTH + i] |= 0xFF0000FF;
+    }
+
+    time_isa("C", BLIT_CPU_C);
+    if (SDL_HasSSE2()) {
+        failures += check_isa("SSE2", BLIT_CPU_SSE2);
+        time_isa("SSE2", BLIT_CPU_SSE2);
+    }
+    if (SDL_HasAVX2()) {
+        failures += check_isa("AVX2", BLIT_CPU_AVX2);
+        time_isa("AVX2", BLIT_CPU_AVX2);
+    }
+
+    SDL_Quit();
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,189 @@
+/*
+ * Benchmarks large software blits split across SDL_BLIT_THREADS threads,
+ * and checks that the threaded output matches the single threaded one.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "SDL.h"
+
+static int width = 1920;
+static int height = 1080;
+static int seconds = 2;
+static int maxthreads = 8;
+static int blend = 1;
+static Uint8 *reference = NULL;
+
+static void
+quit(int rc)
+{
+    SDL_Quit();
+    exit(rc);
+}
+
+static SDL_Surface *
+create_source(void)
+{
+    SDL_Surface *surface;
+    int x, y;
+
+    surface = SDL_CreateRGBSurface(SDL_SWSURFACE, width, height, 32,
+                                   0x00FF0000, 0x0000FF00, 0x000000FF,
+                                   0xFF000000);
+    if (!surface) {
+        return NULL;
+    }
+    for (y = 0; y < height; ++y) {
+        Uint32 *row = (Uint32 *) ((Uint8 *) surface->pixels +
+                                  y * surface->pitch);
+        for (x = 0; x < width; ++x) {
+            row[x] = ((Uint32) ((x + y) & 0xFF) << 24) |
+                ((Uint32) (x & 0xFF) << 16) |
+                ((Uint32) (y & 0xFF) << 8) | ((Uint32) (x ^ y) & 0xFF);
+        }
+    }
+    SDL_SetSurfaceBlendMode(surface,
+                            blend ? SDL_BLENDMODE_BLEND : SDL_BLENDMODE_NONE);
+    return surface;
+}
+
+static SDL_Surface *
+create_dest(void)
+{
+    SDL_Surface *surface;
+
+    surface = SDL_CreateRGBSurface(SDL_SWSURFACE, width, height, 32,
+                                   0x00FF0000, 0x0000FF00, 0x000000FF, 0);
+    if (surface) {
+        SDL_FillRect(surface, NULL, SDL_MapRGB(surface->format, 32, 64, 96));
+    }
+    return surface;
+}
+
+/* Compares against (or records) the output of the single threaded pass */
+static int
+check_pixels(SDL_Surface * surface)
+{
+    int y;
+
+    if (!reference) {
+        reference = (Uint8 *) SDL_malloc(width * height * 4);
+        if (!reference) {
+            return 0;
+        }
+        for (y = 0; y < height; ++y) {
+            SDL_memcpy(reference + y * width * 4,
+                       (Uint8 *) surface->pixels + y * surface->pitch,
+                       width * 4);
+        }
+        return 1;
+    }
+    for (y = 0; y < height; ++y) {
+        if (SDL_memcmp(reference + y * width * 4,
+                       (Uint8 *) surface->pixels + y * surface->pitch,
+                       width * 4) != 0) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* Returns the blit throughput in megapixels per second */
+static double
+run_test(int threads)
+{
+    static char env[64];
+    SDL_Surface *src, *dst;
+    Uint32 start, now;
+    int iterations;
+
+    SDL_snprintf(env, sizeof(env), "SDL_BLIT_THREADS=%d", threads);
+    SDL_putenv(env);
+    if (SDL_Init(SDL_INIT_VIDEO) < 0) {
+        fprintf(stderr, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        exit(1);
+    }
+
+    src = create_source();
+    dst = create_dest();
+    if (!src || !dst) {
+        fprintf(stderr, "Couldn't create surfaces: %s\n", SDL_GetError());
+        quit(2);
+    }
+
+    SDL_BlitSurface(src, NULL, dst, NULL);
+    if (!check_pixels(dst)) {
+        fprintf(stderr, "Blit with %d threads doesn't match!\n", threads);
+        quit(3);
+    }
+
+    iterations = 0;
+    start = now = SDL_GetTicks();
+    while ((now - start) < (Uint32) (seconds * 1000)) {
+        SDL_BlitSurface(src, NULL, dst, NULL);
+        ++iterations;
+        now = SDL_GetTicks();
+    }
+
+    SDL_FreeSurface(src);
+    SDL_FreeSurface(dst);
+    SDL_Quit();
+
+    if (now == start) {
+        return 0.0;
+    }
+    return ((double) iterations * width * height) /
+        ((double) (now - start) * 1000.0);
+}
+
+int
+main(int argc, char *argv[])
+{
+    double base = 0.0;
+    int i;
+
+    for (i = 1; i < argc; ++i) {
+        if (SDL_strcmp(argv[i], "--width") == 0 && argv[i + 1]) {
+            width = SDL_atoi(argv[++i]);
+        } else if (SDL_strcmp(argv[i], "--height") == 0 && argv[i + 1]) {
+            height = SDL_atoi(argv[++i]);
+        } else if (SDL_strcmp(argv[i], "--seconds") == 0 && argv[i + 1]) {
+            seconds = SDL_atoi(argv[++i]);
+        } else if (SDL_strcmp(argv[i], "--threads") == 0 && argv[i + 1]) {
+            maxthreads = SDL_atoi(argv[++i]);
+        } else if (SDL_strcmp(argv[i], "--noblend") == 0) {
+            blend = 0;
+        } else {
+            fprintf(stderr,
+                    "Usage: %s [--width N] [--height N] [--seconds N] [--threads N] [--noblend]\n",
+                    argv[0]);
+            return 1;
+        }
+    }
+    if (width <= 0 || height <= 0 || seconds <= 0 || maxthreads <= 0) {
+        fprintf(stderr, "Invalid parameters\n");
+        return 1;
+    }
+
+    /* The blit benchmark doesn't need a window */
+    if (!SDL_getenv("SDL_VIDEODRIVER")) {
+        SDL_putenv("SDL_VIDEODRIVER=dummy");
+    }
+
+    printf("%s blit of %dx%d ARGB8888 -> RGB888\n",
+           blend ? "Alpha blended" : "Opaque", width, height);
+    for (i = 1; i <= maxthreads; ++i) {
+        double mpix = run_test(i);
+
+        if (i == 1) {
+            base = mpix;
+        }
+        printf("%2d thread%s: %8.1f MPix/s (%.2fx)\n", i, i > 1 ? "s" : " ",
+               mpix, base > 0.0 ? mpix / base : 0.0);
+    }
+    SDL_free(reference);
+
+    return 0;
+}
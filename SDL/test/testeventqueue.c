@@ -0,0 +1,174 @@
+/*
+ * Stress test of the event queue: several threads push user events as fast
+ * as they can while the main thread drains them in batches, checking that
+ * every event arrives exactly once and in the order each thread posted it.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SDL.h"
+#include "SDL_thread.h"
+
+#define MAXTHREADS  32
+#define BATCHSIZE   64
+
+/* Every other event uses the second type, so masked reads get exercised */
+#define EVENT_EVEN  SDL_USEREVENT
+#define EVENT_ODD   (SDL_USEREVENT + 1)
+
+static int numthreads = 4;
+static int numevents = 1000000;
+
+static struct
+{
+    SDL_Thread *thread;
+    volatile int retries;
+    int received[2];
+} producers[MAXTHREADS];
+
+/* Call this instead of exit(), so we can clean up SDL: atexit() is evil. */
+static void
+quit(int rc)
+{
+    SDL_Quit();
+    exit(rc);
+}
+
+int SDLCALL
+ProducerThread(void *data)
+{
+    int tid = (int) (uintptr_t) data;
+    int i, retries = 0;
+    SDL_Event event;
+
+    for (i = 0; i < numevents; ++i) {
+        event.type = (i & 1) ? EVENT_ODD : EVENT_EVEN;
+        event.user.code = tid;
+        event.user.data1 = (void *) (uintptr_t) (i / 2);
+        event.user.data2 = NULL;
+        event.user.windowID = 0;
+        while (SDL_PushEvent(&event) <= 0) {
+            /* The queue is full, give the consumer a chance to catch up */
+            ++retries;
+            SDL_Delay(0);
+        }
+    }
+    producers[tid].retries = retries;
+    return 0;
+}
+
+/* Checks a batch of received events, returns the number of bad ones */
+static int
+CheckEvents(SDL_Event * events, int count)
+{
+    int i, errors = 0;
+
+    for (i = 0; i < count; ++i) {
+        int tid = events[i].user.code;
+        int odd = (events[i].type == EVENT_ODD);
+        int sequence = (int) (uintptr_t) events[i].user.data1;
+
+        if ((events[i].type != EVENT_EVEN && events[i].type != EVENT_ODD) ||
+            tid < 0 || tid >= numthreads) {
+            printf("Unexpected event type %d\n", events[i].type);
+            ++errors;
+            continue;
+        }
+        if (sequence != producers[tid].received[odd]) {
+            printf("Thread %d: got event %d, expected %d\n", tid,
+                   sequence, producers[tid].received[odd]);
+            ++errors;
+        }
+        producers[tid].received[odd] = sequence + 1;
+    }
+    return errors;
+}
+
+int
+main(int argc, char *argv[])
+{
+    SDL_Event events[BATCHSIZE];
+    Uint32 start, now;
+    int i, count, total, expected, errors, batches, retries;
+
+    for (i = 1; i < argc; ++i) {
+        if (SDL_strcmp(argv[i], "--threads") == 0 && argv[i + 1]) {
+            numthreads = SDL_atoi(argv[++i]);
+        } else if (SDL_strcmp(argv[i], "--events") == 0 && argv[i + 1]) {
+            numevents = SDL_atoi(argv[++i]);
+        } else {
+            fprintf(stderr, "Usage: %s [--threads N] [--events N]\n",
+                    argv[0]);
+            return 1;
+        }
+    }
+    if (numthreads <= 0 || numthreads > MAXTHREADS || numevents <= 0) {
+        fprintf(stderr, "Invalid parameters\n");
+        return 1;
+    }
+
+    /* The event queue is started by the video subsystem */
+    if (!SDL_getenv("SDL_VIDEODRIVER")) {
+        SDL_putenv("SDL_VIDEODRIVER=dummy");
+    }
+    if (SDL_Init(SDL_INIT_VIDEO) < 0) {
+        fprintf(stderr, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    printf("%d threads posting %d events each\n", numthreads, numevents);
+    start = SDL_GetTicks();
+    for (i = 0; i < numthreads; ++i) {
+        producers[i].thread =
+            SDL_CreateThread(ProducerThread, (void *) (uintptr_t) i);
+        if (producers[i].thread == NULL) {
+            fprintf(stderr, "Couldn't create thread: %s\n", SDL_GetError());
+            quit(1);
+        }
+    }
+
+    /* Alternate between draining everything and picking out one type */
+    expected = numthreads * numevents;
+    total = errors = batches = 0;
+    while (total < expected) {
+        Uint32 mask = (batches & 3) ? SDL_ALLEVENTS : SDL_EVENTMASK(EVENT_ODD);
+
+        count = SDL_PeepEvents(events, BATCHSIZE, SDL_GETEVENT, mask);
+        if (count < 0) {
+            fprintf(stderr, "Couldn't get events: %s\n", SDL_GetError());
+            quit(2);
+        }
+        if (count == 0) {
+            SDL_Delay(0);
+        }
+        errors += CheckEvents(events, count);
+        total += count;
+        ++batches;
+    }
+    now = SDL_GetTicks();
+
+    retries = 0;
+    for (i = 0; i < numthreads; ++i) {
+        SDL_WaitThread(producers[i].thread, NULL);
+        retries += producers[i].retries;
+        if (producers[i].received[0] + producers[i].received[1] != numevents) {
+            printf("Thread %d: lost events\n", i);
+            ++errors;
+        }
+    }
+    if (SDL_PeepEvents(NULL, 0, SDL_PEEKEVENT, SDL_ALLEVENTS) != 0) {
+        printf("Extra events left in the queue\n");
+        ++errors;
+    }
+
+    printf("%d events in %u ms (%.2f million events/sec)\n", total,
+           now - start, (now > start) ?
+           (total / 1000.0) / (now - start) : 0.0);
+    printf("%.1f events per batch, %d retries on a full queue\n",
+           (double) total / batches, retries);
+    printf("%s\n", errors ? "FAILED" : "Passed");
+
+    SDL_Quit();
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,163 @@
+/*
+ * Benchmarks the timer scheduler with many timers: the cost of adding and
+ * removing them, and how late they fire while they're all running.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "SDL.h"
+
+typedef struct
+{
+    SDL_TimerID id;
+    Uint32 interval;
+    Uint32 start;
+    int fired;
+    Uint32 total_late;
+    Uint32 max_late;
+} TimerData;
+
+static int numtimers = 10000;
+static int seconds = 3;
+static TimerData *timers = NULL;
+
+static Uint32 SDLCALL
+idle_callback(Uint32 interval, void *param)
+{
+    return interval;
+}
+
+/* Records how long after its schedule the timer fired */
+static Uint32 SDLCALL
+timer_callback(Uint32 interval, void *param)
+{
+    TimerData *data = (TimerData *) param;
+    Uint32 expected, now, late;
+
+    ++data->fired;
+    now = SDL_GetTicks();
+    expected = data->start + data->fired * data->interval;
+    late = ((int) (now - expected) > 0) ? (now - expected) : 0;
+    data->total_late += late;
+    if (late > data->max_late) {
+        data->max_late = late;
+    }
+    return interval;
+}
+
+static void
+shuffle(int *order, int count)
+{
+    int i;
+
+    for (i = 0; i < count; ++i) {
+        order[i] = i;
+    }
+    for (i = count - 1; i > 0; --i) {
+        int j = rand() % (i + 1);
+        int tmp = order[i];
+        order[i] = order[j];
+        order[j] = tmp;
+    }
+}
+
+int
+main(int argc, char *argv[])
+{
+    Uint32 start, now;
+    clock_t cpu;
+    double expected_fires, total_late;
+    int i, fired, max_late, *order;
+
+    for (i = 1; i < argc; ++i) {
+        if (SDL_strcmp(argv[i], "--timers") == 0 && argv[i + 1]) {
+            numtimers = SDL_atoi(argv[++i]);
+        } else if (SDL_strcmp(argv[i], "--seconds") == 0 && argv[i + 1]) {
+            seconds = SDL_atoi(argv[++i]);
+        } else {
+            fprintf(stderr, "Usage: %s [--timers N] [--seconds N]\n",
+                    argv[0]);
+            return 1;
+        }
+    }
+    if (numtimers <= 0 || seconds <= 0) {
+        fprintf(stderr, "Invalid parameters\n");
+        return 1;
+    }
+
+    if (SDL_Init(SDL_INIT_TIMER) < 0) {
+        fprintf(stderr, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+    timers = (TimerData *) SDL_calloc(numtimers, sizeof(*timers));
+    order = (int *) SDL_malloc(numtimers * sizeof(*order));
+    if (!timers || !order) {
+        fprintf(stderr, "Out of memory\n");
+        SDL_Quit();
+        return 1;
+    }
+    srand(42);
+
+    /* Time adding timers, and removing them in random order */
+    start = SDL_GetTicks();
+    for (i = 0; i < numtimers; ++i) {
+        timers[i].id = SDL_AddTimer(60000 + i, idle_callback, NULL);
+        if (!timers[i].id) {
+            fprintf(stderr, "Couldn't add timer: %s\n", SDL_GetError());
+            SDL_Quit();
+            return 2;
+        }
+    }
+    now = SDL_GetTicks();
+    printf("Added %d timers in %u ms\n", numtimers, now - start);
+    shuffle(order, numtimers);
+    start = SDL_GetTicks();
+    for (i = 0; i < numtimers; ++i) {
+        if (!SDL_RemoveTimer(timers[order[i]].id)) {
+            fprintf(stderr, "Couldn't remove timer %d\n", order[i]);
+            SDL_Quit();
+            return 3;
+        }
+    }
+    now = SDL_GetTicks();
+    printf("Removed %d timers in %u ms\n", numtimers, now - start);
+
+    /* Run them all with intervals from 10 ms to a second */
+    printf("Running %d timers for %d seconds...\n", numtimers, seconds);
+    cpu = clock();
+    for (i = 0; i < numtimers; ++i) {
+        timers[i].interval = 10 + (rand() % 991);
+        timers[i].start = SDL_GetTicks();
+        timers[i].id = SDL_AddTimer(timers[i].interval, timer_callback,
+                                    &timers[i]);
+    }
+    SDL_Delay(seconds * 1000);
+    for (i = 0; i < numtimers; ++i) {
+        SDL_RemoveTimer(timers[i].id);
+    }
+    cpu = clock() - cpu;
+
+    fired = 0;
+    max_late = 0;
+    total_late = 0.0;
+    expected_fires = 0.0;
+    for (i = 0; i < numtimers; ++i) {
+        fired += timers[i].fired;
+        total_late += timers[i].total_late;
+        if ((int) timers[i].max_late > max_late) {
+            max_late = timers[i].max_late;
+        }
+        expected_fires += (seconds * 1000) / timers[i].interval;
+    }
+    printf("%d callbacks (expected about %.0f)\n", fired, expected_fires);
+    printf("Average lateness %.2f ms, worst %d ms\n",
+           fired ? total_late / fired : 0.0, max_late);
+    printf("Used %.1f ms of CPU time\n", (cpu * 1000.0) / CLOCKS_PER_SEC);
+
+    SDL_free(order);
+    SDL_free(timers);
+    SDL_Quit();
+    return 0;
+}
@@ -0,0 +1,246 @@
+/*
+ * Compares loading files through SDL_RWFromFile() and SDL_RWFromMappedFile()
+ * with a warm page cache, checking that both give the same results.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SDL.h"
+
+#define BMPFILE "testmappedfile.bmp"
+#define WAVFILE "testmappedfile.wav"
+
+#define WAV_FREQ        44100
+#define WAV_SECONDS     5
+
+static int iterations = 200;
+
+/* Call this instead of exit(), so we can clean up SDL: atexit() is evil. */
+static void
+quit(int rc)
+{
+    remove(BMPFILE);
+    remove(WAVFILE);
+    SDL_Quit();
+    exit(rc);
+}
+
+static void
+create_bmp(int w, int h)
+{
+    SDL_Surface *surface;
+    int x, y;
+
+    surface = SDL_CreateRGBSurface(0, w, h, 24, 0x00FF0000, 0x0000FF00,
+                                   0x000000FF, 0);
+    if (!surface) {
+        fprintf(stderr, "Couldn't create surface: %s\n", SDL_GetError());
+        quit(1);
+    }
+    for (y = 0; y < h; ++y) {
+        Uint8 *row = (Uint8 *) surface->pixels + y * surface->pitch;
+        for (x = 0; x < w * 3; ++x) {
+            row[x] = (Uint8) (x * y + rand());
+        }
+    }
+    if (SDL_SaveBMP(surface, BMPFILE) < 0) {
+        fprintf(stderr, "Couldn't save %s: %s\n", BMPFILE, SDL_GetError());
+        quit(1);
+    }
+    SDL_FreeSurface(surface);
+}
+
+static void
+create_wav(void)
+{
+    SDL_RWops *dst;
+    Uint32 i, samples = WAV_FREQ * WAV_SECONDS * 2;
+
+    dst = SDL_RWFromFile(WAVFILE, "wb");
+    if (!dst) {
+        fprintf(stderr, "Couldn't create %s: %s\n", WAVFILE, SDL_GetError());
+        quit(1);
+    }
+    SDL_RWwrite(dst, "RIFF", 4, 1);
+    SDL_WriteLE32(dst, 36 + samples * 2);
+    SDL_RWwrite(dst, "WAVEfmt ", 8, 1);
+    SDL_WriteLE32(dst, 16);
+    SDL_WriteLE16(dst, 1);      /* PCM */
+    SDL_WriteLE16(dst, 2);
+    SDL_WriteLE32(dst, WAV_FREQ);
+    SDL_WriteLE32(dst, WAV_FREQ * 4);
+    SDL_WriteLE16(dst, 4);
+    SDL_WriteLE16(dst, 16);
+    SDL_RWwrite(dst, "data", 4, 1);
+    SDL_WriteLE32(dst, samples * 2);
+    for (i = 0; i < samples; ++i) {
+        SDL_WriteLE16(dst, (Uint16) rand());
+    }
+    SDL_RWclose(dst);
+}
+
+static SDL_RWops *
+open_file(const char *file, int mapped)
+{
+    SDL_RWops *src;
+
+    src = mapped ? SDL_RWFromMappedFile(file) : SDL_RWFromFile(file, "rb");
+    if (!src) {
+        fprintf(stderr, "Couldn't open %s: %s\n", file, SDL_GetError());
+        quit(1);
+    }
+    return src;
+}
+
+static SDL_Surface *
+load_bmp(int mapped)
+{
+    SDL_Surface *surface;
+
+    surface = SDL_LoadBMP_RW(open_file(BMPFILE, mapped), 1);
+    if (!surface) {
+        fprintf(stderr, "Couldn't load %s: %s\n", BMPFILE, SDL_GetError());
+        quit(2);
+    }
+    return surface;
+}
+
+static Uint8 *
+load_wav(int mapped, Uint32 * len)
+{
+    SDL_AudioSpec spec;
+    Uint8 *buf;
+
+    if (!SDL_LoadWAV_RW(open_file(WAVFILE, mapped), 1, &spec, &buf, len)) {
+        fprintf(stderr, "Couldn't load %s: %s\n", WAVFILE, SDL_GetError());
+        quit(2);
+    }
+    return buf;
+}
+
+static Uint32
+read_file(const char *file, int mapped, Uint8 * buf, Uint32 size)
+{
+    SDL_RWops *src = open_file(file, mapped);
+    Uint32 total = 0;
+    size_t n;
+
+    while ((n = SDL_RWread(src, buf, 1, size)) > 0) {
+        total += (Uint32) n;
+    }
+    SDL_RWclose(src);
+    return total;
+}
+
+static int
+check_results(void)
+{
+    SDL_Surface *a, *b;
+    Uint8 *wava, *wavb;
+    Uint32 lena, lenb;
+    int same;
+
+    a = load_bmp(0);
+    b = load_bmp(1);
+    same = (a->h == b->h && a->pitch == b->pitch &&
+            SDL_memcmp(a->pixels, b->pixels, a->h * a->pitch) == 0);
+    SDL_FreeSurface(a);
+    SDL_FreeSurface(b);
+    if (!same) {
+        printf("Mapped BMP doesn't match\n");
+        return 0;
+    }
+
+    wava = load_wav(0, &lena);
+    wavb = load_wav(1, &lenb);
+    same = (lena == lenb && SDL_memcmp(wava, wavb, lena) == 0);
+    SDL_FreeWAV(wava);
+    SDL_FreeWAV(wavb);
+    if (!same) {
+        printf("Mapped WAV doesn't match\n");
+        return 0;
+    }
+    return 1;
+}
+
+static void
+report(const char *what, int mapped, Uint64 start, Uint32 bytes)
+{
+    double seconds = (double) (SDL_GetPerformanceCounter() - start) /
+        SDL_GetPerformanceFrequency();
+
+    printf("%-10s %-7s %8.3f ms per load, %8.1f MB/s\n", what,
+           mapped ? "mapped" : "stdio", (seconds * 1000.0) / iterations,
+           ((double) bytes * iterations) / (seconds * 1024.0 * 1024.0));
+}
+
+int
+main(int argc, char *argv[])
+{
+    Uint8 *buf;
+    Uint32 bmpsize, wavsize, len;
+    Uint64 start;
+    int i, mapped;
+
+    for (i = 1; i < argc; ++i) {
+        if (SDL_strcmp(argv[i], "--iterations") == 0 && argv[i + 1]) {
+            iterations = SDL_atoi(argv[++i]);
+        } else {
+            fprintf(stderr, "Usage: %s [--iterations N]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (iterations <= 0) {
+        fprintf(stderr, "Invalid parameters\n");
+        return 1;
+    }
+
+    if (SDL_Init(SDL_INIT_TIMER) < 0) {
+        fprintf(stderr, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+    srand(42);
+    create_bmp(1024, 1024);
+    create_wav();
+
+    if (!check_results()) {
+        printf("FAILED\n");
+        quit(3);
+    }
+
+    /* Everything has been read once, so the page cache is warm */
+    buf = (Uint8 *) SDL_malloc(64 * 1024);
+    if (!buf) {
+        fprintf(stderr, "Out of memory\n");
+        quit(1);
+    }
+    bmpsize = read_file(BMPFILE, 0, buf, 64 * 1024);
+    wavsize = read_file(WAVFILE, 0, buf, 64 * 1024);
+    for (mapped = 0; mapped <= 1; ++mapped) {
+        start = SDL_GetPerformanceCounter();
+        for (i = 0; i < iterations; ++i) {
+            read_file(BMPFILE, mapped, buf, 64 * 1024);
+        }
+        report("read 64K", mapped, start, bmpsize);
+    }
+    for (mapped = 0; mapped <= 1; ++mapped) {
+        start = SDL_GetPerformanceCounter();
+        for (i = 0; i < iterations; ++i) {
+            SDL_FreeSurface(load_bmp(mapped));
+        }
+        report("BMP", mapped, start, bmpsize);
+    }
+    for (mapped = 0; mapped <= 1; ++mapped) {
+        start = SDL_GetPerformanceCounter();
+        for (i = 0; i < iterations; ++i) {
+            SDL_FreeWAV(load_wav(mapped, &len));
+        }
+        report("WAV", mapped, start, wavsize);
+    }
+    SDL_free(buf);
+
+    printf("Passed\n");
+    quit(0);
+    return 0;
+}
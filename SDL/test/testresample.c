@@ -1,6 +1,181 @@
 #include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
 #include "SDL.h"
 
+/*
+ * With --bench, measures the signal to noise ratio and speed of converting
+ * 44.1KHz to 48KHz at each SDL_AUDIO_RESAMPLE_QUALITY, and checks that
+ * resampling in pieces with SDL_AudioResample() gives the same samples as
+ * converting all at once.
+ */
+
+#define SRC_RATE    44100
+#define DST_RATE    48000
+
+static const char *quality_names[] = { "linear", "fast", "medium", "best" };
+
+static void
+set_quality(int quality)
+{
+    static char env[64];
+
+    SDL_snprintf(env, sizeof(env), "SDL_AUDIO_RESAMPLE_QUALITY=%d", quality);
+    SDL_putenv(env);
+}
+
+/* Converts 'frames' stereo frames at SRC_RATE to DST_RATE in one go */
+static Uint8 *
+convert(SDL_AudioFormat format, const void *src, int frames, int *len)
+{
+    const int framesize = 2 * (SDL_AUDIO_BITSIZE(format) / 8);
+    SDL_AudioCVT cvt;
+
+    if (SDL_BuildAudioCVT(&cvt, format, 2, SRC_RATE, format, 2,
+                          DST_RATE) < 0) {
+        fprintf(stderr, "failed to build CVT: %s\n", SDL_GetError());
+        exit(4);
+    }
+    cvt.len = frames * framesize;
+    cvt.buf = (Uint8 *) malloc(cvt.len * cvt.len_mult);
+    if (cvt.buf == NULL) {
+        fprintf(stderr, "Out of memory.\n");
+        exit(5);
+    }
+    memcpy(cvt.buf, src, cvt.len);
+    SDL_ConvertAudio(&cvt);
+    *len = cvt.len_cvt;
+    return cvt.buf;
+}
+
+/* Ratio of a sine wave to the difference from it, over the middle of the
+   output so the silence around the ends doesn't count. */
+static double
+sine_snr(double freq)
+{
+    const int frames = SRC_RATE;
+    float *src = (float *) malloc(frames * 2 * sizeof(float));
+    float *dst;
+    double signal = 0.0, noise = 0.0;
+    int i, len;
+
+    if (src == NULL) {
+        fprintf(stderr, "Out of memory.\n");
+        exit(5);
+    }
+    for (i = 0; i < frames; ++i) {
+        src[i * 2] = src[i * 2 + 1] =
+            (float) (0.5 * sin(2.0 * M_PI * freq * i / SRC_RATE));
+    }
+    dst = (float *) convert(AUDIO_F32SYS, src, frames, &len);
+    len /= 2 * sizeof(float);
+    for (i = len / 10; i < len - len / 10; ++i) {
+        const double ideal = 0.5 * sin(2.0 * M_PI * freq * i / DST_RATE);
+        signal += ideal * ideal;
+        noise += (dst[i * 2] - ideal) * (dst[i * 2] - ideal);
+    }
+    free(src);
+    free(dst);
+    return 10.0 * log10(signal / (noise + 1e-30));
+}
+
+static double
+throughput(const Sint16 * src, int frames, int iterations)
+{
+    Uint64 start = SDL_GetPerformanceCounter();
+    double seconds;
+    int i, len;
+
+    for (i = 0; i < iterations; ++i) {
+        free(convert(AUDIO_S16SYS, src, frames, &len));
+    }
+    seconds = (double) (SDL_GetPerformanceCounter() - start) /
+        SDL_GetPerformanceFrequency();
+    return ((double) frames * iterations) / seconds;
+}
+
+/* Feeds the resampler pieces of random sizes and compares the output with
+   converting the whole buffer with SDL_ConvertAudio() */
+static int
+check_pieces(const Sint16 * src, int frames, int quality)
+{
+    SDL_AudioResampler *resampler;
+    Uint8 *whole, *pieces;
+    int whole_len, len = 0, pos = 0, same;
+
+    set_quality(quality);
+    whole = convert(AUDIO_S16SYS, src, frames, &whole_len);
+    resampler = SDL_CreateAudioResampler(AUDIO_S16SYS, 2, SRC_RATE,
+                                         DST_RATE, quality);
+    pieces = (Uint8 *) malloc(whole_len + 4096);
+    if (resampler == NULL || pieces == NULL) {
+        fprintf(stderr, "Couldn't create resampler: %s\n", SDL_GetError());
+        exit(5);
+    }
+    while (pos < frames) {
+        int n = 1 + rand() % 2000;
+        if (n > frames - pos) {
+            n = frames - pos;
+        }
+        len += SDL_AudioResample(resampler, (const Uint8 *) (src + pos * 2),
+                                 n * 4, pieces + len, whole_len + 4096 - len);
+        pos += n;
+    }
+    SDL_FreeAudioResampler(resampler);
+
+    /* The resampler holds back the end of the input, so it made a bit less */
+    same = (len <= whole_len && len > whole_len - 1024 &&
+            memcmp(whole, pieces, len) == 0);
+    free(whole);
+    free(pieces);
+    return same;
+}
+
+static int
+benchmark(int seconds)
+{
+    const double freqs[] = { 1000.0, 8000.0, 16000.0 };
+    const int frames = SRC_RATE * seconds;
+    Sint16 *src = (Sint16 *) malloc(frames * 2 * sizeof(Sint16));
+    int i, quality, errors = 0;
+
+    if (src == NULL) {
+        fprintf(stderr, "Out of memory.\n");
+        return 5;
+    }
+    for (i = 0; i < frames * 2; ++i) {
+        src[i] = (Sint16) (rand() % 65536 - 32768);
+    }
+
+    printf("%d Hz to %d Hz, stereo\n", SRC_RATE, DST_RATE);
+    printf("%-8s %9s %9s %9s %14s %10s\n", "quality", "1KHz", "8KHz",
+           "16KHz", "frames/sec", "streams");
+    for (quality = 0; quality <= SDL_RESAMPLE_BEST; ++quality) {
+        double rate;
+
+        set_quality(quality);
+        printf("%-8s", quality_names[quality]);
+        for (i = 0; i < SDL_arraysize(freqs); ++i) {
+            printf(" %6.1f dB", sine_snr(freqs[i]));
+        }
+        rate = throughput(src, frames, 5);
+        printf(" %14.0f %10.1f\n", rate, rate / SRC_RATE);
+    }
+
+    for (quality = SDL_RESAMPLE_FAST; quality <= SDL_RESAMPLE_BEST;
+         ++quality) {
+        if (!check_pieces(src, frames, quality)) {
+            printf("Resampling in pieces at %s quality doesn't match\n",
+                   quality_names[quality]);
+            ++errors;
+        }
+    }
+    free(src);
+
+    printf("%s\n", errors ? "FAILED" : "Passed");
+    return errors ? 9 : 0;
+}
+
 int
 main(int argc, char **argv)
 {
@@ -13,9 +188,23 @@ main(int argc, char **argv)
     int blockalign = 0;
     int avgbytes = 0;
     SDL_RWops *io = NULL;
+    int i;
+
+    if (argc >= 2 && strcmp(argv[1], "--bench") == 0) {
+        int seconds = (argc >= 3) ? atoi(argv[2]) : 10;
+        if (seconds <= 0 || SDL_Init(SDL_INIT_TIMER) == -1) {
+            fprintf(stderr, "SDL_Init() failed: %s\n", SDL_GetError());
+            return 2;
+        }
+        srand(42);
+        i = benchmark(seconds);
+        SDL_Quit();
+        return i;
+    }
 
     if (argc != 4) {
         fprintf(stderr, "USAGE: %s in.wav out.wav newfreq\n", argv[0]);
+        fprintf(stderr, "       %s --bench [seconds]\n", argv[0]);
         return 1;
     }
 
@@ -0,0 +1,191 @@
+/*
+ * Checks SDL_RWBuffered() against reading the same data from memory, with
+ * random reads and seeks, then times small reads with and without it.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SDL.h"
+
+#define FILENAME    "testrwbuffer.dat"
+#define FILESIZE    (1024 * 1024)
+
+static Uint8 *data = NULL;
+
+/* Call this instead of exit(), so we can clean up SDL: atexit() is evil. */
+static void
+quit(int rc)
+{
+    remove(FILENAME);
+    SDL_free(data);
+    SDL_Quit();
+    exit(rc);
+}
+
+static SDL_RWops *
+open_file(void)
+{
+    SDL_RWops *src = SDL_RWFromFile(FILENAME, "rb");
+    if (!src) {
+        fprintf(stderr, "Couldn't open %s: %s\n", FILENAME, SDL_GetError());
+        quit(1);
+    }
+    return src;
+}
+
+/* Does the same random reads and seeks on the buffered file and in memory */
+static int
+check_buffered(int size, int operations)
+{
+    Uint8 expected[1024], actual[1024];
+    SDL_RWops *file, *buffered, *mem;
+    int i, errors = 0;
+
+    file = open_file();
+    buffered = SDL_RWBuffered(file, size, 0);
+    mem = SDL_RWFromConstMem(data, FILESIZE);
+    if (!buffered || !mem) {
+        fprintf(stderr, "Couldn't create RWops: %s\n", SDL_GetError());
+        quit(1);
+    }
+    for (i = 0; i < operations && !errors; ++i) {
+        long offset, a, b;
+        int objsize, num;
+
+        switch (rand() % 8) {
+        case 0:
+            offset = rand() % (FILESIZE + 1);
+            a = SDL_RWseek(buffered, offset, RW_SEEK_SET);
+            b = SDL_RWseek(mem, offset, RW_SEEK_SET);
+            break;
+        case 1:
+            offset = (rand() % 2048) - 1024;
+            if (SDL_RWtell(mem) + offset < 0 ||
+                SDL_RWtell(mem) + offset > FILESIZE) {
+                offset = 0;
+            }
+            a = SDL_RWseek(buffered, offset, RW_SEEK_CUR);
+            b = SDL_RWseek(mem, offset, RW_SEEK_CUR);
+            break;
+        case 2:
+            offset = -(rand() % 4096);
+            a = SDL_RWseek(buffered, offset, RW_SEEK_END);
+            b = SDL_RWseek(mem, offset, RW_SEEK_END);
+            break;
+        default:
+            objsize = 1 + rand() % 4;
+            num = rand() % (sizeof(actual) / objsize);
+            if (rand() % 4 == 0) {
+                num = 1;
+            }
+            a = SDL_RWread(buffered, actual, objsize, num);
+            b = SDL_RWread(mem, expected, objsize, num);
+            if (a == b && SDL_memcmp(actual, expected, a * objsize) != 0) {
+                printf("Read of %dx%d at %ld returned the wrong data\n",
+                       num, objsize, SDL_RWtell(mem));
+                ++errors;
+            }
+            break;
+        }
+        if (a != b || SDL_RWtell(buffered) != SDL_RWtell(mem)) {
+            printf("Operation %d: got %ld at %ld, expected %ld at %ld\n",
+                   i, a, SDL_RWtell(buffered), b, SDL_RWtell(mem));
+            ++errors;
+        }
+    }
+
+    /* Closing it should leave the file where reading stopped */
+    SDL_RWclose(buffered);
+    if (!errors && SDL_RWtell(file) != SDL_RWtell(mem)) {
+        printf("File left at %ld, expected %ld\n", SDL_RWtell(file),
+               SDL_RWtell(mem));
+        ++errors;
+    }
+    SDL_RWclose(file);
+    SDL_RWclose(mem);
+
+    printf("%d byte buffer: %s\n", size, errors ? "FAILED" : "passed");
+    return errors;
+}
+
+static double
+seconds_since(Uint64 start)
+{
+    return (double) (SDL_GetPerformanceCounter() - start) /
+        SDL_GetPerformanceFrequency();
+}
+
+static void
+time_reads(const char *name, int buffer)
+{
+    SDL_RWops *src;
+    Uint64 start;
+    Uint32 sum = 0;
+    Uint8 byte;
+    int i;
+
+    src = open_file();
+    if (buffer) {
+        src = SDL_RWBuffered(src, 0, 1);
+    }
+    start = SDL_GetPerformanceCounter();
+    while (SDL_RWread(src, &byte, 1, 1) == 1) {
+        sum += byte;
+    }
+    printf("%-10s 1 byte reads: %7.1f MB/s\n", name,
+           FILESIZE / (seconds_since(start) * 1024.0 * 1024.0));
+
+    SDL_RWseek(src, 0, RW_SEEK_SET);
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < FILESIZE / 4; ++i) {
+        sum += SDL_ReadBE32(src);
+    }
+    printf("%-10s SDL_ReadBE32: %7.1f MB/s\n", name,
+           FILESIZE / (seconds_since(start) * 1024.0 * 1024.0));
+    SDL_RWclose(src);
+
+    if (sum == 42) {
+        printf("\n");           /* Don't optimize the reads away */
+    }
+}
+
+int
+main(int argc, char *argv[])
+{
+    SDL_RWops *dst;
+    int i, errors = 0;
+
+    if (SDL_Init(0) < 0) {
+        fprintf(stderr, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    srand(argc > 1 ? atoi(argv[1]) : 42);
+    data = (Uint8 *) SDL_malloc(FILESIZE);
+    if (!data) {
+        fprintf(stderr, "Out of memory\n");
+        quit(1);
+    }
+    for (i = 0; i < FILESIZE; ++i) {
+        data[i] = (Uint8) rand();
+    }
+    dst = SDL_RWFromFile(FILENAME, "wb");
+    if (!dst || SDL_RWwrite(dst, data, FILESIZE, 1) != 1) {
+        fprintf(stderr, "Couldn't write %s: %s\n", FILENAME, SDL_GetError());
+        quit(1);
+    }
+    SDL_RWclose(dst);
+
+    errors += check_buffered(1, 10000);
+    errors += check_buffered(100, 100000);
+    errors += check_buffered(4096, 100000);
+    errors += check_buffered(100000, 10000);
+
+    time_reads("stdio", 0);
+    time_reads("buffered", 1);
+
+    printf("%s\n", errors ? "FAILED" : "Passed");
+    quit(errors ? 2 : 0);
+    return 0;
+}
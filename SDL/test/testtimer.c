@@ -26,6 +26,42 @@ callback(Uint32 interval, void *param)
     return interval;
 }
 
+/* Compares how close SDL_Delay() and SDL_DelayUntil() get to a deadline */
+static void
+test_delays(void)
+{
+    Uint64 frequency = SDL_GetPerformanceFrequency();
+    Uint64 start, now, deadline;
+    double delay_late = 0.0, until_late = 0.0;
+    int i;
+
+    printf("Performance counter frequency: %.0f Hz\n", (double) frequency);
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < 100; ++i) {
+        now = SDL_GetPerformanceCounter();
+    }
+    printf("Reading the counter takes %.1f ns\n",
+           ((now - start) * 1000000000.0) / frequency / 100);
+
+    for (i = 0; i < 100; ++i) {
+        start = SDL_GetPerformanceCounter();
+        deadline = start + (frequency * 5) / 1000;
+        SDL_Delay(5);
+        now = SDL_GetPerformanceCounter();
+        delay_late += ((double) now - deadline) / frequency;
+
+        start = SDL_GetPerformanceCounter();
+        deadline = start + (frequency * 5) / 1000;
+        SDL_DelayUntil(deadline);
+        now = SDL_GetPerformanceCounter();
+        until_late += ((double) now - deadline) / frequency;
+    }
+    printf("Average error waiting 5 ms: SDL_Delay() %.1f us, "
+           "SDL_DelayUntil() %.1f us\n", delay_late * 10000.0,
+           until_late * 10000.0);
+}
+
 int
 main(int argc, char *argv[])
 {
@@ -37,6 +73,8 @@ main(int argc, char *argv[])
         return (1);
     }
 
+    test_delays();
+
     /* Start the timer */
     desired = 0;
     if (argv[1]) {
@@ -0,0 +1,131 @@
+/*
+ * Measures how quickly SDL_WaitEvent() wakes up when another thread pushes
+ * an event, and how much CPU time it uses while waiting with nothing to do.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "SDL.h"
+#include "SDL_thread.h"
+
+static int iterations = 1000;
+static SDL_sem *woken = NULL;
+
+/* Call this instead of exit(), so we can clean up SDL: atexit() is evil. */
+static void
+quit(int rc)
+{
+    SDL_Quit();
+    exit(rc);
+}
+
+/* Pushes an event, then waits for the main thread to have received it */
+int SDLCALL
+PushThread(void *data)
+{
+    SDL_Event event;
+    int i;
+
+    event.type = SDL_USEREVENT;
+    event.user.code = 0;
+    event.user.data1 = NULL;
+    event.user.data2 = NULL;
+    event.user.windowID = 0;
+    for (i = 0; i < iterations; ++i) {
+        event.user.code = i;
+        if (SDL_PushEvent(&event) <= 0) {
+            fprintf(stderr, "Couldn't push event: %s\n", SDL_GetError());
+            return -1;
+        }
+        SDL_SemWait(woken);
+    }
+    return 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+    SDL_Thread *thread;
+    SDL_Event event;
+    Uint32 start, now;
+    clock_t cpu;
+    int i, idle = 1000;
+
+    for (i = 1; i < argc; ++i) {
+        if (SDL_strcmp(argv[i], "--iterations") == 0 && argv[i + 1]) {
+            iterations = SDL_atoi(argv[++i]);
+        } else if (SDL_strcmp(argv[i], "--idle") == 0 && argv[i + 1]) {
+            idle = SDL_atoi(argv[++i]);
+        } else {
+            fprintf(stderr, "Usage: %s [--iterations N] [--idle ms]\n",
+                    argv[0]);
+            return 1;
+        }
+    }
+    if (iterations <= 0 || idle < 0) {
+        fprintf(stderr, "Invalid parameters\n");
+        return 1;
+    }
+
+    /* The event queue is started by the video subsystem */
+    if (!SDL_getenv("SDL_VIDEODRIVER")) {
+        SDL_putenv("SDL_VIDEODRIVER=dummy");
+    }
+    if (SDL_Init(SDL_INIT_VIDEO) < 0) {
+        fprintf(stderr, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+    printf("Using %s video driver\n", SDL_GetCurrentVideoDriver());
+
+    /* Sleep with nothing to do, and see how much CPU that takes */
+    while (SDL_PollEvent(&event)) {
+        /* Throw away any startup events */ ;
+    }
+    cpu = clock();
+    start = SDL_GetTicks();
+    SDL_WaitEventTimeout(&event, idle);
+    now = SDL_GetTicks();
+    cpu = clock() - cpu;
+    printf("Idle wait of %u ms used %.1f ms of CPU time\n", now - start,
+           (cpu * 1000.0) / CLOCKS_PER_SEC);
+
+    /* Ping-pong events with another thread */
+    woken = SDL_CreateSemaphore(0);
+    if (!woken) {
+        fprintf(stderr, "Couldn't create semaphore: %s\n", SDL_GetError());
+        quit(1);
+    }
+    thread = SDL_CreateThread(PushThread, NULL);
+    if (!thread) {
+        fprintf(stderr, "Couldn't create thread: %s\n", SDL_GetError());
+        quit(1);
+    }
+    start = SDL_GetTicks();
+    for (i = 0; i < iterations; ++i) {
+        do {
+            if (!SDL_WaitEvent(&event)) {
+                fprintf(stderr, "Couldn't wait for event: %s\n",
+                        SDL_GetError());
+                quit(2);
+            }
+        } while (event.type != SDL_USEREVENT);
+        if (event.user.code != i) {
+            fprintf(stderr, "Got event %d, expected %d\n", event.user.code,
+                    i);
+            quit(3);
+        }
+        SDL_SemPost(woken);
+    }
+    now = SDL_GetTicks();
+    SDL_WaitThread(thread, NULL);
+    SDL_DestroySemaphore(woken);
+
+    printf("%d push-to-wake round trips in %u ms (%.1f us each)\n",
+           iterations, now - start,
+           ((now - start) * 1000.0) / iterations);
+
+    SDL_Quit();
+    return 0;
+}
@@ -27,32 +27,74 @@
 #include <ctype.h>
 
 #include "SDL_image.h"
+#include "IMG_internal.h"
 
 #define ARRAYSIZE(a) (sizeof(a) / sizeof((a)[0]))
 
-/* Table of image detection and loading functions */
+/* Table of image detection and loading functions, and whether the loader
+   can run on several threads at once (GIF and XPM keep static state) */
 static struct {
 	char *type;
 	int (SDLCALL *is)(SDL_RWops *src);
 	SDL_Surface *(SDLCALL *load)(SDL_RWops *src);
+	int reentrant;
 } supported[] = {
 	/* keep magicless formats first */
-	{ "TGA", NULL,      IMG_LoadTGA_RW },
-	{ "CUR", IMG_isCUR, IMG_LoadCUR_RW },
-	{ "ICO", IMG_isICO, IMG_LoadICO_RW },
-	{ "BMP", IMG_isBMP, IMG_LoadBMP_RW },
-	{ "GIF", IMG_isGIF, IMG_LoadGIF_RW },
-	{ "JPG", IMG_isJPG, IMG_LoadJPG_RW },
-	{ "LBM", IMG_isLBM, IMG_LoadLBM_RW },
-	{ "PCX", IMG_isPCX, IMG_LoadPCX_RW },
-	{ "PNG", IMG_isPNG, IMG_LoadPNG_RW },
-	{ "PNM", IMG_isPNM, IMG_LoadPNM_RW }, /* P[BGP]M share code */
-	{ "TIF", IMG_isTIF, IMG_LoadTIF_RW },
-	{ "XCF", IMG_isXCF, IMG_LoadXCF_RW },
-	{ "XPM", IMG_isXPM, IMG_LoadXPM_RW },
-	{ "XV",  IMG_isXV,  IMG_LoadXV_RW  }
+	{ "TGA", NULL,      IMG_LoadTGA_RW, 1 },
+	{ "CUR", IMG_isCUR, IMG_LoadCUR_RW, 1 },
+	{ "ICO", IMG_isICO, IMG_LoadICO_RW, 1 },
+	{ "BMP", IMG_isBMP, IMG_LoadBMP_RW, 1 },
+	{ "GIF", IMG_isGIF, IMG_LoadGIF_RW, 0 },
+	{ "JPG", IMG_isJPG, IMG_LoadJPG_RW, 1 },
+	{ "LBM", IMG_isLBM, IMG_LoadLBM_RW, 1 },
+	{ "PCX", IMG_isPCX, IMG_LoadPCX_RW, 1 },
+	{ "PNG", IMG_isPNG, IMG_LoadPNG_RW, 1 },
+	{ "PNM", IMG_isPNM, IMG_LoadPNM_RW, 1 }, /* P[BGP]M share code */
+	{ "TIF", IMG_isTIF, IMG_LoadTIF_RW, 1 },
+	{ "XCF", IMG_isXCF, IMG_LoadXCF_RW, 1 },
+	{ "XPM", IMG_isXPM, IMG_LoadXPM_RW, 0 },
+	{ "XV",  IMG_isXV,  IMG_LoadXV_RW,  1 }
 };
 
+/* Created by IMG_Init(), before any loading happens on several threads */
+static SDL_mutex *loader_lock = NULL;
+
+SDL_mutex *IMG_LockLoaders(void)
+{
+	SDL_mutex *lock = loader_lock;
+
+	if ( lock ) {
+		SDL_mutexP(lock);
+	}
+	return(lock);
+}
+
+void IMG_UnlockLoaders(SDL_mutex *lock)
+{
+	if ( lock ) {
+		SDL_mutexV(lock);
+	}
+}
+
+int IMG_Init(void)
+{
+	if ( !loader_lock ) {
+		loader_lock = SDL_CreateMutex();
+		if ( !loader_lock ) {
+			return(-1);
+		}
+	}
+	return(0);
+}
+
+void IMG_Quit(void)
+{
+	if ( loader_lock ) {
+		SDL_DestroyMutex(loader_lock);
+		loader_lock = NULL;
+	}
+}
+
 const SDL_version *IMG_Linked_Version(void)
 {
 	static SDL_version linked_version;
@@ -101,6 +143,8 @@ SDL_Surface *IMG_LoadTyped_RW(SDL_RWops *src, int freesrc, char *type)
 {
 	int i;
 	SDL_Surface *image;
+	SDL_RWops *buffered;
+	SDL_mutex *lock;
 
 	/* Make sure there is something to do.. */
 	if ( src == NULL ) {
@@ -116,6 +160,13 @@ SDL_Surface *IMG_LoadTyped_RW(SDL_RWops *src, int freesrc, char *type)
 		return(NULL);
 	}
 
+	/* Most of the decoders read a few bytes at a time, so read ahead */
+	buffered = SDL_RWBuffered(src, 0, freesrc);
+	if ( buffered ) {
+		src = buffered;
+		freesrc = 1;
+	}
+
 	/* Detect the type of image being loaded */
 	image = NULL;
 	for ( i=0; i < ARRAYSIZE(supported); ++i ) {
@@ -132,7 +183,11 @@ SDL_Surface *IMG_LoadTyped_RW(SDL_RWops *src, int freesrc, char *type)
 		fprintf(stderr, "IMGLIB: Loading image as %s\n",
 			supported[i].type);
 #endif
+		lock = NULL;
+		if(!supported[i].reentrant)
+			lock = IMG_LockLoaders();
 		image = supported[i].load(src);
+		IMG_UnlockLoaders(lock);
 		if(freesrc)
 			SDL_RWclose(src);
 		return image;
@@ -145,6 +200,183 @@ SDL_Surface *IMG_LoadTyped_RW(SDL_RWops *src, int freesrc, char *type)
 	return NULL;
 }
 
+/* The images being loaded by IMG_LoadBatch() */
+typedef struct {
+	const char **files;
+	SDL_RWops **srcs;
+	int freesrc;
+	char **types;
+	SDL_Surface **surfaces;
+	int count;
+	int next;		/* the next image to load */
+	int done;		/* the number of images finished */
+	SDL_mutex *lock;	/* protects next and done */
+	SDL_cond *progress;	/* signalled as images finish */
+} IMG_Batch;
+
+static SDL_Surface *IMG_LoadBatchImage(IMG_Batch *batch, int i)
+{
+	SDL_RWops *src;
+	char *ext;
+
+	if ( batch->files ) {
+		src = SDL_RWFromFile(batch->files[i], "rb");
+		if ( !src ) {
+			return NULL;
+		}
+		ext = strrchr(batch->files[i], '.');
+		if ( ext ) {
+			ext++;
+		}
+		return IMG_LoadTyped_RW(src, 1, ext);
+	}
+	return IMG_LoadTyped_RW(batch->srcs[i], batch->freesrc,
+	                        batch->types ? batch->types[i] : NULL);
+}
+
+static int SDLCALL IMG_BatchThread(void *data)
+{
+	IMG_Batch *batch = (IMG_Batch *)data;
+	int i;
+
+	SDL_mutexP(batch->lock);
+	while ( batch->next < batch->count ) {
+		i = batch->next++;
+		SDL_mutexV(batch->lock);
+
+		batch->surfaces[i] = IMG_LoadBatchImage(batch, i);
+
+		SDL_mutexP(batch->lock);
+		++batch->done;
+		SDL_CondSignal(batch->progress);
+	}
+	SDL_mutexV(batch->lock);
+	return 0;
+}
+
+static int IMG_LoadBatchImages(IMG_Batch *batch, int threads,
+                               IMG_BatchProgress progress, void *userdata)
+{
+	SDL_Thread **workers = NULL;
+	int i, done, loaded;
+
+	if ( threads > batch->count ) {
+		threads = batch->count;
+	}
+	if ( threads > 1 ) {
+		batch->lock = SDL_CreateMutex();
+		batch->progress = SDL_CreateCond();
+		workers = (SDL_Thread **)malloc(threads * sizeof(*workers));
+		if ( !loader_lock || !batch->lock || !batch->progress || !workers ) {
+			threads = 0;
+		}
+	}
+
+	if ( threads > 1 ) {
+		/* Keep the shared libraries loaded for the whole batch */
+#ifdef LOAD_JPG
+		IMG_InitJPG();
+#endif
+#ifdef LOAD_PNG
+		IMG_InitPNG();
+#endif
+#ifdef LOAD_TIF
+		IMG_InitTIF();
+#endif
+		for ( i = 0; i < threads; ++i ) {
+			workers[i] = SDL_CreateThread(IMG_BatchThread, batch);
+			if ( !workers[i] ) {
+				break;
+			}
+		}
+		threads = i;
+
+		/* Report the progress from this thread as images finish */
+		SDL_mutexP(batch->lock);
+		done = 0;
+		while ( threads > 0 && batch->done < batch->count ) {
+			SDL_CondWait(batch->progress, batch->lock);
+			if ( progress && batch->done != done ) {
+				done = batch->done;
+				SDL_mutexV(batch->lock);
+				progress(userdata, done, batch->count);
+				SDL_mutexP(batch->lock);
+			}
+		}
+		SDL_mutexV(batch->lock);
+		for ( i = 0; i < threads; ++i ) {
+			SDL_WaitThread(workers[i], NULL);
+		}
+#ifdef LOAD_TIF
+		IMG_QuitTIF();
+#endif
+#ifdef LOAD_PNG
+		IMG_QuitPNG();
+#endif
+#ifdef LOAD_JPG
+		IMG_QuitJPG();
+#endif
+		if ( progress && threads > 0 && done != batch->done ) {
+			progress(userdata, batch->done, batch->count);
+		}
+	}
+
+	/* Load whatever is left here, if there are no threads */
+	for ( i = batch->next; i < batch->count; ++i ) {
+		batch->surfaces[i] = IMG_LoadBatchImage(batch, i);
+		if ( progress ) {
+			progress(userdata, i + 1, batch->count);
+		}
+	}
+
+	if ( workers ) {
+		free(workers);
+	}
+	if ( batch->progress ) {
+		SDL_DestroyCond(batch->progress);
+	}
+	if ( batch->lock ) {
+		SDL_DestroyMutex(batch->lock);
+	}
+
+	loaded = 0;
+	for ( i = 0; i < batch->count; ++i ) {
+		if ( batch->surfaces[i] ) {
+			++loaded;
+		}
+	}
+	return loaded;
+}
+
+/* Load a batch of image files on several threads */
+int IMG_LoadBatch(const char **files, SDL_Surface **surfaces, int count,
+                  int threads, IMG_BatchProgress progress, void *userdata)
+{
+	IMG_Batch batch;
+
+	memset(&batch, 0, sizeof(batch));
+	batch.files = files;
+	batch.surfaces = surfaces;
+	batch.count = count;
+	return IMG_LoadBatchImages(&batch, threads, progress, userdata);
+}
+
+/* Load a batch of images from SDL datasources on several threads */
+int IMG_LoadBatch_RW(SDL_RWops **srcs, int freesrc, char **types,
+                     SDL_Surface **surfaces, int count,
+                     int threads, IMG_BatchProgress progress, void *userdata)
+{
+	IMG_Batch batch;
+
+	memset(&batch, 0, sizeof(batch));
+	batch.srcs = srcs;
+	batch.freesrc = freesrc;
+	batch.types = types;
+	batch.surfaces = surfaces;
+	batch.count = count;
+	return IMG_LoadBatchImages(&batch, threads, progress, userdata);
+}
+
 /* Invert the alpha of a surface for use with OpenGL
    This function is a no-op and only kept for backwards compatibility.
  */
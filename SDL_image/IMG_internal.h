@@ -0,0 +1,50 @@
+/*
+    SDL_image:  An example image loading library for use with SDL
+    Copyright (C) 1997-2009 Sam Lantinga
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+    Sam Lantinga
+    slouken@libsdl.org
+*/
+
+/* Functions shared between the image loaders, not part of the API */
+
+#ifndef _IMG_INTERNAL_H
+#define _IMG_INTERNAL_H
+
+/* Held while a loader that isn't reentrant runs, or while a library
+   reference count changes, once IMG_Init() has been called.
+   IMG_LockLoaders() returns the lock it took, or NULL, to pass back to
+   IMG_UnlockLoaders().
+ */
+extern SDL_mutex *IMG_LockLoaders(void);
+extern void IMG_UnlockLoaders(SDL_mutex *lock);
+
+/* The loaders using shared libraries, kept loaded during a batch */
+#ifdef LOAD_JPG
+extern int IMG_InitJPG(void);
+extern void IMG_QuitJPG(void);
+#endif
+#ifdef LOAD_PNG
+extern int IMG_InitPNG(void);
+extern void IMG_QuitPNG(void);
+#endif
+#ifdef LOAD_TIF
+extern int IMG_InitTIF(void);
+extern void IMG_QuitTIF(void);
+#endif
+
+#endif /* _IMG_INTERNAL_H */
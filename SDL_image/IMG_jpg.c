@@ -27,6 +27,7 @@
 #include <setjmp.h>
 
 #include "SDL_image.h"
+#include "IMG_internal.h"
 
 #ifdef LOAD_JPG
 
@@ -53,7 +54,7 @@ static struct {
 } lib;
 
 #ifdef LOAD_JPG_DYNAMIC
-int IMG_InitJPG()
+static int InitJPG()
 {
 	if ( lib.loaded == 0 ) {
 		lib.handle = SDL_LoadObject(LOAD_JPG_DYNAMIC);
@@ -128,7 +129,7 @@ int IMG_InitJPG()
 
 	return 0;
 }
-void IMG_QuitJPG()
+static void QuitJPG()
 {
 	if ( lib.loaded == 0 ) {
 		return;
@@ -139,7 +140,7 @@ void IMG_QuitJPG()
 	--lib.loaded;
 }
 #else
-int IMG_InitJPG()
+static int InitJPG()
 {
 	if ( lib.loaded == 0 ) {
 		lib.jpeg_calc_output_dimensions = jpeg_calc_output_dimensions;
@@ -156,7 +157,7 @@ int IMG_InitJPG()
 
 	return 0;
 }
-void IMG_QuitJPG()
+static void QuitJPG()
 {
 	if ( lib.loaded == 0 ) {
 		return;
@@ -167,6 +168,26 @@ void IMG_QuitJPG()
 }
 #endif /* LOAD_JPG_DYNAMIC */
 
+/* IMG_LoadBatch() may load images on several threads at once */
+int IMG_InitJPG()
+{
+	SDL_mutex *lock;
+	int retval;
+
+	lock = IMG_LockLoaders();
+	retval = InitJPG();
+	IMG_UnlockLoaders(lock);
+	return retval;
+}
+void IMG_QuitJPG()
+{
+	SDL_mutex *lock;
+
+	lock = IMG_LockLoaders();
+	QuitJPG();
+	IMG_UnlockLoaders(lock);
+}
+
 /* See if an image is contained in a data source */
 int IMG_isJPG(SDL_RWops *src)
 {
@@ -26,6 +26,7 @@
 #include <stdio.h>
 
 #include "SDL_image.h"
+#include "IMG_internal.h"
 
 #ifdef LOAD_PNG
 
@@ -92,7 +93,7 @@ static struct {
 } lib;
 
 #ifdef LOAD_PNG_DYNAMIC
-int IMG_InitPNG()
+static int InitPNG()
 {
 	if ( lib.loaded == 0 ) {
 		lib.handle = SDL_LoadObject(LOAD_PNG_DYNAMIC);
@@ -216,7 +217,7 @@ int IMG_InitPNG()
 
 	return 0;
 }
-void IMG_QuitPNG()
+static void QuitPNG()
 {
 	if ( lib.loaded == 0 ) {
 		return;
@@ -227,7 +228,7 @@ void IMG_QuitPNG()
 	--lib.loaded;
 }
 #else
-int IMG_InitPNG()
+static int InitPNG()
 {
 	if ( lib.loaded == 0 ) {
 		lib.png_create_info_struct = png_create_info_struct;
@@ -251,7 +252,7 @@ int IMG_InitPNG()
 
 	return 0;
 }
-void IMG_QuitPNG()
+static void QuitPNG()
 {
 	if ( lib.loaded == 0 ) {
 		return;
@@ -262,6 +263,26 @@ void IMG_QuitPNG()
 }
 #endif /* LOAD_PNG_DYNAMIC */
 
+/* IMG_LoadBatch() may load images on several threads at once */
+int IMG_InitPNG()
+{
+	SDL_mutex *lock;
+	int retval;
+
+	lock = IMG_LockLoaders();
+	retval = InitPNG();
+	IMG_UnlockLoaders(lock);
+	return retval;
+}
+void IMG_QuitPNG()
+{
+	SDL_mutex *lock;
+
+	lock = IMG_LockLoaders();
+	QuitPNG();
+	IMG_UnlockLoaders(lock);
+}
+
 /* See if an image is contained in a data source */
 int IMG_isPNG(SDL_RWops *src)
 {
@@ -25,6 +25,7 @@
 #include <stdio.h>
 
 #include "SDL_image.h"
+#include "IMG_internal.h"
 
 #ifdef LOAD_TIF
 
@@ -41,7 +42,7 @@ static struct {
 } lib;
 
 #ifdef LOAD_TIF_DYNAMIC
-int IMG_InitTIF()
+static int InitTIF()
 {
 	if ( lib.loaded == 0 ) {
 		lib.handle = SDL_LoadObject(LOAD_TIF_DYNAMIC);
@@ -88,7 +89,7 @@ int IMG_InitTIF()
 
 	return 0;
 }
-void IMG_QuitTIF()
+static void QuitTIF()
 {
 	if ( lib.loaded == 0 ) {
 		return;
@@ -99,7 +100,7 @@ void IMG_QuitTIF()
 	--lib.loaded;
 }
 #else
-int IMG_InitTIF()
+static int InitTIF()
 {
 	if ( lib.loaded == 0 ) {
 		lib.TIFFClientOpen = TIFFClientOpen;
@@ -112,7 +113,7 @@ int IMG_InitTIF()
 
 	return 0;
 }
-void IMG_QuitTIF()
+static void QuitTIF()
 {
 	if ( lib.loaded == 0 ) {
 		return;
@@ -123,6 +124,26 @@ void IMG_QuitTIF()
 }
 #endif /* LOAD_TIF_DYNAMIC */
 
+/* IMG_LoadBatch() may load images on several threads at once */
+int IMG_InitTIF()
+{
+	SDL_mutex *lock;
+	int retval;
+
+	lock = IMG_LockLoaders();
+	retval = InitTIF();
+	IMG_UnlockLoaders(lock);
+	return retval;
+}
+void IMG_QuitTIF()
+{
+	SDL_mutex *lock;
+
+	lock = IMG_LockLoaders();
+	QuitTIF();
+	IMG_UnlockLoaders(lock);
+}
+
 /*
  * These are the thunking routine to use the SDL_RWops* routines from
  * libtiff's internals.
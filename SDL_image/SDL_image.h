@@ -69,6 +69,25 @@ extern DECLSPEC SDL_Surface * SDLCALL IMG_LoadTyped_RW(SDL_RWops *src, int frees
 extern DECLSPEC SDL_Surface * SDLCALL IMG_Load(const char *file);
 extern DECLSPEC SDL_Surface * SDLCALL IMG_Load_RW(SDL_RWops *src, int freesrc);
 
+/* Set up the locking needed to load images on several threads at once,
+   and free it again.  Call these from one thread, while nothing is being
+   loaded.  IMG_Init() returns 0, or -1 if the lock couldn't be created.
+ */
+extern DECLSPEC int SDLCALL IMG_Init(void);
+extern DECLSPEC void SDLCALL IMG_Quit(void);
+
+/* Load a batch of images on the given number of threads.
+   The surfaces are stored in the same order as the files or data sources,
+   with NULL for any image that couldn't be loaded.  If 'progress' isn't
+   NULL, it's called on the calling thread as images finish, with the number
+   done so far and the total.  Without IMG_Init(), the images are all loaded
+   on the calling thread.
+   Returns the number of images that were loaded.
+ */
+typedef void (SDLCALL *IMG_BatchProgress)(void *userdata, int done, int total);
+extern DECLSPEC int SDLCALL IMG_LoadBatch(const char **files, SDL_Surface **surfaces, int count, int threads, IMG_BatchProgress progress, void *userdata);
+extern DECLSPEC int SDLCALL IMG_LoadBatch_RW(SDL_RWops **srcs, int freesrc, char **types, SDL_Surface **surfaces, int count, int threads, IMG_BatchProgress progress, void *userdata);
+
 /* Invert the alpha of a surface for use with OpenGL
    This function is now a no-op, and only provided for backwards compatibility.
 */
@@ -74,17 +74,88 @@ void draw_background(SDL_Surface *screen)
     }
 }
 
+/* Time loading an image with and without read-ahead buffering */
+void benchmark(const char *file, int iterations)
+{
+	static char *modes[] = {
+		"SDL_RWOPS_BUFFER_SIZE=0", "SDL_RWOPS_BUFFER_SIZE=4096"
+	};
+	SDL_Surface *image;
+	Uint32 start, now;
+	int i, mode;
+
+	for ( mode=0; mode < 2; ++mode ) {
+		SDL_putenv(modes[mode]);
+		start = SDL_GetTicks();
+		for ( i=0; i < iterations; ++i ) {
+			image = IMG_Load(file);
+			if ( image == NULL ) {
+				fprintf(stderr, "Couldn't load %s: %s\n",
+				        file, SDL_GetError());
+				return;
+			}
+			SDL_FreeSurface(image);
+		}
+		now = SDL_GetTicks();
+		printf("%s: %.3f ms per load %s\n", file,
+		       (double)(now - start) / iterations,
+		       mode ? "with read-ahead" : "unbuffered");
+	}
+}
+
+/* Show how far along a batch load is */
+static void SDLCALL batch_progress(void *userdata, int done, int total)
+{
+	fprintf(stderr, "\r%d/%d", done, total);
+	if ( done == total ) {
+		fprintf(stderr, "\n");
+	}
+}
+
+/* Time loading a set of images on one thread and on several */
+void batch_benchmark(const char **files, int count, int threads)
+{
+	SDL_Surface **images;
+	Uint32 start, now;
+	int i, pass, loaded, n;
+
+	images = (SDL_Surface **)malloc(count * sizeof(*images));
+	if ( images == NULL ) {
+		return;
+	}
+	if ( IMG_Init() < 0 ) {
+		fprintf(stderr, "Couldn't set up threaded loading: %s\n",
+		        IMG_GetError());
+	}
+	for ( pass=0; pass < 2; ++pass ) {
+		n = pass ? threads : 1;
+		start = SDL_GetTicks();
+		loaded = IMG_LoadBatch(files, images, count, n,
+		                       batch_progress, NULL);
+		now = SDL_GetTicks();
+		printf("%d of %d images in %u ms on %d thread(s)\n",
+		       loaded, count, now - start, n);
+		for ( i=0; i < count; ++i ) {
+			if ( images[i] ) {
+				SDL_FreeSurface(images[i]);
+			}
+		}
+	}
+	free(images);
+	IMG_Quit();
+}
+
 int main(int argc, char *argv[])
 {
 	Uint32 flags;
 	SDL_Surface *screen, *image;
-	int i, depth, done;
+	int i, depth, done, bench = 0;
 	SDL_Event event;
 	SDL_RWops* rw_ops;
 
 	/* Check command line usage */
 	if ( ! argv[1] ) {
-		fprintf(stderr, "Usage: %s <image_file>\n", argv[0]);
+		fprintf(stderr, "Usage: %s [-bench N] [-batch threads] <image_file> ...\n", argv[0]);
 		return(1);
 	}
 
@@ -101,6 +172,22 @@ int main(int argc, char *argv[])
 			flags |= SDL_FULLSCREEN;
 			continue;
 		}
+		if ( strcmp(argv[i], "-bench") == 0 && argv[i+1] ) {
+			bench = atoi(argv[++i]);
+			continue;
+		}
+		if ( bench > 0 ) {
+			benchmark(argv[i], bench);
+			continue;
+		}
+		if ( strcmp(argv[i], "-batch") == 0 && argv[i+1] ) {
+			int threads = atoi(argv[++i]);
+			if ( argv[i+1] ) {
+				batch_benchmark((const char **)&argv[i+1],
+				                argc - (i+1), threads);
+			}
+			break;
+		}
 #if 0
 		rw_ops = SDL_RWFromFile(argv[1], "r");
 		
@@ -115,6 +115,66 @@ typedef struct _Mix_Music Mix_Music;
 extern DECLSPEC int SDLCALL Mix_OpenAudio(int frequency, Uint16 format, int channels,
 							int chunksize);
 
+/* Open the mixer to render audio as fast as it can be mixed, rather than
+   play it.  The audio device is opened as with Mix_OpenAudio() but stays
+   paused, so set SDL_AUDIODRIVER to "dummy" (or "disk") before initializing
+   SDL to keep the sound card out of it.  Nothing is mixed until you call
+   Mix_RenderAudio().  With MIX_MUSICTHREAD, the music is waited for rather
+   than cut short when the decoder falls behind, so the same calls always
+   render the same audio.
+ */
+extern DECLSPEC int SDLCALL Mix_OpenAudioOffline(int frequency, Uint16 format, int channels,
+							int chunksize);
+
+/* Mix the next 'len' bytes of output into 'stream': music, channels and
+   post effects, in pieces of the chunk size given to Mix_OpenAudioOffline()
+   just as the audio device would have had them.  'len' is rounded down to
+   whole sample frames.  The sample clock advances by the frames rendered,
+   which is what Mix_PlayChannelAt(), timed and expiring channels and fades
+   all go by.
+   Returns the number of bytes rendered, or -1 if the mixer isn't open with
+   Mix_OpenAudioOffline().
+ */
+extern DECLSPEC int SDLCALL Mix_RenderAudio(Uint8 *stream, int len);
+
+/* With 8 and 16 bit formats, the channels are summed at 32 bit precision
+ *  and clipped once at the end, so loud channels don't clip each other
+ *  depending on the order they're mixed in. Define the environment variable
+ *  MIX_NOMIXBUS before you call Mix_OpenAudio() to mix each channel straight
+ *  into the output with SDL_MixAudio() instead, like older versions did.
+ */
+#define MIX_NOMIXBUS	"MIX_NOMIXBUS"
+
+/* Playing, halting and fading channels don't lock the audio device: the
+ *  calls are queued and carried out at the start of the next audio callback,
+ *  though Mix_Playing() sees them straight away.  Define the environment variable MIX_NOCOMMANDQUEUE before you call
+ *  Mix_OpenAudio() to have every call lock the audio device and take effect
+ *  immediately instead.
+ */
+#define MIX_NOCOMMANDQUEUE	"MIX_NOCOMMANDQUEUE"
+
+/* Music is normally decoded in the audio callback.  Define the environment
+ *  variable MIX_MUSICTHREAD to a number of milliseconds before you call
+ *  Mix_OpenAudio() to have a thread of its own decode the music that far
+ *  ahead, so a slow decoder or disk read can't hold up the audio device.
+ *  The volume and fades still change straight away.  External music commands
+ *  and native MIDI are played the same either way.
+ */
+#define MIX_MUSICTHREAD	"MIX_MUSICTHREAD"
+
+/* Timidity mixes all of the voices of a MIDI song one after another.
+ *  Define the environment variable MIX_TIMIDITYTHREADS to a number of
+ *  threads before you call Mix_OpenAudio() to have the voices shared out
+ *  between that many.  The music sounds exactly the same either way.
+ */
+#define MIX_TIMIDITYTHREADS	"MIX_TIMIDITYTHREADS"
+
+/* MikMod mixes modules with SSE2 where the CPU has it, which sounds exactly
+ *  the same as its C mixer.  Define the environment variable MIX_NOSIMDMIXER
+ *  before you call Mix_OpenAudio() to always use the C mixer.
+ */
+#define MIX_NOSIMDMIXER	"MIX_NOSIMDMIXER"
+
 /* Dynamically change the number of channels managed by the mixer.
    If decreasing the number of channels, the upper channels are
    stopped.
@@ -129,7 +189,34 @@ extern DECLSPEC int SDLCALL Mix_QuerySpec(int *frequency,Uint16 *format,int *cha
 
 /* Load a wave file or a music (.mod .s3m .it .xm) file */
 extern DECLSPEC Mix_Chunk * SDLCALL Mix_LoadWAV_RW(SDL_RWops *src, int freesrc);
-#define Mix_LoadWAV(file)	Mix_LoadWAV_RW(SDL_RWFromFile(file, "rb"), 1)
+#define Mix_LoadWAV(file)	Mix_LoadWAV_RW(SDL_RWFromMappedFile(file), 1)
+
+/* Every loaded chunk normally has samples of its own.  Define the
+ *  environment variable MIX_SHAREDCHUNKS before you call Mix_OpenAudio() to
+ *  have sounds loaded from memory, including the mapped files Mix_LoadWAV()
+ *  uses, share their samples with any loaded chunk that was decoded from the
+ *  same data.  Don't change a loaded chunk's samples in place if you do.
+ */
+#define MIX_SHAREDCHUNKS	"MIX_SHAREDCHUNKS"
+
+/* Keep the samples of sounds loaded from memory in 'directory', converted
+ *  to the audio device format, so loading them again skips decoding.  The
+ *  directory must already exist; NULL stops using it.
+ *  This function returns 0, or -1 if it runs out of memory.
+ */
+extern DECLSPEC int SDLCALL Mix_SetChunkCache(const char *directory);
+
+/* Load a wave file on a background thread.  The loads are done one at a
+ *  time in the order they were started, and the source mustn't be used
+ *  until the load has finished.  Every load has to be finished with
+ *  Mix_LoadWAVWait(), which returns the chunk, or NULL if it couldn't be
+ *  loaded.  Loads that haven't started when the audio device is closed fail.
+ */
+typedef struct _Mix_ChunkLoad Mix_ChunkLoad;
+extern DECLSPEC Mix_ChunkLoad * SDLCALL Mix_LoadWAVAsync_RW(SDL_RWops *src, int freesrc);
+#define Mix_LoadWAVAsync(file)	Mix_LoadWAVAsync_RW(SDL_RWFromMappedFile(file), 1)
+extern DECLSPEC int SDLCALL Mix_LoadWAVDone(Mix_ChunkLoad *load);
+extern DECLSPEC Mix_Chunk * SDLCALL Mix_LoadWAVWait(Mix_ChunkLoad *load);
 extern DECLSPEC Mix_Music * SDLCALL Mix_LoadMUS(const char *file);
 
 /* Load a music file from an SDL_RWop object (Ogg and MikMod specific currently)
@@ -268,6 +355,31 @@ extern DECLSPEC int SDLCALL Mix_RegisterEffect(int chan, Mix_EffectFunc_t f,
 					Mix_EffectDone_t d, void *arg);
 
 
+/*
+ * This is the format of a special effect callback that reads the channel's
+ *  data from (src) and writes the result to (dst), which are both (len)
+ *  bytes long. (src) may be the same as (dst), so process each sample
+ *  frame before writing it out.
+ */
+typedef void (*Mix_EffectCopyFunc_t)(int chan, const void *src, void *dst,
+					int len, void *udata);
+
+/* Register a special effect function that can also work as it copies.
+ *  This works like Mix_RegisterEffect(), but when this effect is the first
+ *  one on a channel, (copy) reads the chunk data straight from the chunk and
+ *  writes it to the effect buffer, instead of the mixer copying the data
+ *  first and then (f) working on the copy, which saves a pass over the data.
+ *  (f) is used when the effect isn't first, and is what you pass to
+ *  Mix_UnregisterEffect() to remove the effect. (copy) may be NULL.
+ *
+ * returns zero if error (no such channel), nonzero if added.
+ *  Error messages can be retrieved from Mix_GetError().
+ */
+extern DECLSPEC int SDLCALL Mix_RegisterCopyEffect(int chan, Mix_EffectFunc_t f,
+					Mix_EffectCopyFunc_t copy,
+					Mix_EffectDone_t d, void *arg);
+
+
 /* You may not need to call this explicitly, unless you need to stop an
  *  effect from processing in the middle of a chunk's playback.
  * Posteffects are never implicitly unregistered as they are for channels,
@@ -491,8 +603,20 @@ extern DECLSPEC int SDLCALL Mix_GroupNewer(int tag);
 #define Mix_PlayChannel(channel,chunk,loops) Mix_PlayChannelTimed(channel,chunk,loops,-1)
 /* The same as above, but the sound is played at most 'ticks' milliseconds */
 extern DECLSPEC int SDLCALL Mix_PlayChannelTimed(int channel, Mix_Chunk *chunk, int loops, int ticks);
+/* The same as above, but the sound starts at exactly sample frame 'when' of
+   the mixer's sample clock (see Mix_GetSampleClock()), or as soon as
+   possible if that has already passed.  The channel counts as playing while
+   it waits to start.
+*/
+extern DECLSPEC int SDLCALL Mix_PlayChannelAt(int channel, Mix_Chunk *chunk, int loops, Uint64 when);
 extern DECLSPEC int SDLCALL Mix_PlayMusic(Mix_Music *music, int loops);
 
+/* Get the number of sample frames the mixer has produced since the audio
+   device was opened.  Commands sent now take effect at the start of the
+   next audio callback, which is at least this far along the clock.
+*/
+extern DECLSPEC Uint64 SDLCALL Mix_GetSampleClock(void);
+
 /* Fade in music or a channel over "ms" milliseconds, same semantics as the "Play" functions */
 extern DECLSPEC int SDLCALL Mix_FadeInMusic(Mix_Music *music, int loops, int ms);
 extern DECLSPEC int SDLCALL Mix_FadeInMusicPos(Mix_Music *music, int loops, int ms, double position);
@@ -522,6 +646,8 @@ extern DECLSPEC int SDLCALL Mix_ExpireChannel(int channel, int ticks);
 /* Halt a channel, fading it out progressively till it's silent
    The ms parameter indicates the number of milliseconds the fading
    will take.
+   Fades change the gain smoothly from one sample frame to the next, on top
+   of the volume set with Mix_Volume(), which the fade leaves alone.
  */
 extern DECLSPEC int SDLCALL Mix_FadeOutChannel(int which, int ms);
 extern DECLSPEC int SDLCALL Mix_FadeOutGroup(int tag, int ms);
@@ -556,6 +682,13 @@ extern DECLSPEC int SDLCALL Mix_SetMusicPosition(double position);
 extern DECLSPEC int SDLCALL Mix_Playing(int channel);
 extern DECLSPEC int SDLCALL Mix_PlayingMusic(void);
 
+/* With MIX_MUSICTHREAD, get the number of sample frames of music decoded
+   ahead of playback, or -1 without a decoder thread.  The underrun count
+   goes up every time the audio callback runs out of decoded music.
+*/
+extern DECLSPEC int SDLCALL Mix_GetMusicBuffered(void);
+extern DECLSPEC int SDLCALL Mix_GetMusicUnderruns(void);
+
 /* Stop music and set external music playback command */
 extern DECLSPEC int SDLCALL Mix_SetMusicCMD(const char *command);
 
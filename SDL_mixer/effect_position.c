@@ -35,6 +35,10 @@
 #define __MIX_INTERNAL_EFFECT__
 #include "effects_internal.h"
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 /* profile code:
     #include <sys/time.h>
     #include <unistd.h>
@@ -112,10 +116,11 @@ static void _Eff_PositionDone(int channel, void *udata)
 }
 
 
-static void _Eff_position_u8(int chan, void *stream, int len, void *udata)
+static void _Eff_position_u8_copy(int chan, const void *src, void *dst, int len, void *udata)
 {
     volatile position_args *args = (volatile position_args *) udata;
-    Uint8 *ptr = (Uint8 *) stream;
+    const Uint8 *in = (const Uint8 *) src;
+    Uint8 *ptr = (Uint8 *) dst;
     int i;
 
         /*
@@ -124,29 +129,34 @@ static void _Eff_position_u8(int chan, void *stream, int len, void *udata)
          *  1.0, and are therefore throwaways.
          */
     if (len % sizeof (Uint16) != 0) {
-        *ptr = (Uint8) (((float) *ptr) * args->distance_f);
+        *ptr = (Uint8) (((float) *in) * args->distance_f);
         ptr++;
+        in++;
         len--;
     }
 
     if (args->room_angle == 0)
     for (i = 0; i < len; i += sizeof (Uint8) * 2) {
         /* must adjust the sample so that 0 is the center */
-        *ptr = (Uint8) ((Sint8) ((((float) (Sint8) (*ptr - 128)) 
+        *ptr = (Uint8) ((Sint8) ((((float) (Sint8) (*in - 128)) 
             * args->right_f) * args->distance_f) + 128);
         ptr++;
-        *ptr = (Uint8) ((Sint8) ((((float) (Sint8) (*ptr - 128)) 
+        in++;
+        *ptr = (Uint8) ((Sint8) ((((float) (Sint8) (*in - 128)) 
             * args->left_f) * args->distance_f) + 128);
         ptr++;
+        in++;
     }
     else for (i = 0; i < len; i += sizeof (Uint8) * 2) {
         /* must adjust the sample so that 0 is the center */
-        *ptr = (Uint8) ((Sint8) ((((float) (Sint8) (*ptr - 128)) 
+        *ptr = (Uint8) ((Sint8) ((((float) (Sint8) (*in - 128)) 
             * args->left_f) * args->distance_f) + 128);
         ptr++;
-        *ptr = (Uint8) ((Sint8) ((((float) (Sint8) (*ptr - 128)) 
+        in++;
+        *ptr = (Uint8) ((Sint8) ((((float) (Sint8) (*in - 128)) 
             * args->right_f) * args->distance_f) + 128);
         ptr++;
+        in++;
     }
 }
 static void _Eff_position_u8_c4(int chan, void *stream, int len, void *udata)
@@ -355,10 +365,12 @@ static void _Eff_position_u8_c6(int chan, void *stream, int len, void *udata)
  *  in case the user has called Mix_SetPanning() or whatnot again while this
  *  callback is running.
  */
-static void _Eff_position_table_u8(int chan, void *stream, int len, void *udata)
+static void _Eff_position_table_u8_copy(int chan, const void *src, void *dst, int len, void *udata)
 {
     volatile position_args *args = (volatile position_args *) udata;
-    Uint8 *ptr = (Uint8 *) stream;
+    const Uint8 *in = (const Uint8 *) src;
+    Uint8 *ptr = (Uint8 *) dst;
+    const Uint32 *q;
     Uint32 *p;
     int i;
     Uint8 *l = ((Uint8 *) _Eff_volume_table) + (256 * args->left_u8);
@@ -376,38 +388,43 @@ static void _Eff_position_table_u8(int chan, void *stream, int len, void *udata)
          *  be sure not to overrun the audio buffer...
          */
     while (len % sizeof (Uint32) != 0) {
-        *ptr = d[l[*ptr]];
+        *ptr = d[l[*in]];
         ptr++;
+        in++;
         if (args->channels > 1) {
-            *ptr = d[r[*ptr]];
+            *ptr = d[r[*in]];
             ptr++;
+            in++;
         }
         len -= args->channels;
     }
 
+    q = (const Uint32 *) in;
     p = (Uint32 *) ptr;
 
     for (i = 0; i < len; i += sizeof (Uint32)) {
 #if (SDL_BYTEORDER == SDL_BIG_ENDIAN)
-        *p = (d[l[(*p & 0xFF000000) >> 24]] << 24) |
-             (d[r[(*p & 0x00FF0000) >> 16]] << 16) |
-             (d[l[(*p & 0x0000FF00) >>  8]] <<  8) |
-             (d[r[(*p & 0x000000FF)      ]]      ) ;
+        *p = (d[l[(*q & 0xFF000000) >> 24]] << 24) |
+             (d[r[(*q & 0x00FF0000) >> 16]] << 16) |
+             (d[l[(*q & 0x0000FF00) >>  8]] <<  8) |
+             (d[r[(*q & 0x000000FF)      ]]      ) ;
 #else
-        *p = (d[r[(*p & 0xFF000000) >> 24]] << 24) |
-             (d[l[(*p & 0x00FF0000) >> 16]] << 16) |
-             (d[r[(*p & 0x0000FF00) >>  8]] <<  8) |
-             (d[l[(*p & 0x000000FF)      ]]      ) ;
+        *p = (d[r[(*q & 0xFF000000) >> 24]] << 24) |
+             (d[l[(*q & 0x00FF0000) >> 16]] << 16) |
+             (d[r[(*q & 0x0000FF00) >>  8]] <<  8) |
+             (d[l[(*q & 0x000000FF)      ]]      ) ;
 #endif
         ++p;
+        ++q;
     }
 }
 
 
-static void _Eff_position_s8(int chan, void *stream, int len, void *udata)
+static void _Eff_position_s8_copy(int chan, const void *src, void *dst, int len, void *udata)
 {
     volatile position_args *args = (volatile position_args *) udata;
-    Sint8 *ptr = (Sint8 *) stream;
+    const Sint8 *in = (const Sint8 *) src;
+    Sint8 *ptr = (Sint8 *) dst;
     int i;
 
         /*
@@ -416,24 +433,29 @@ static void _Eff_position_s8(int chan, void *stream, int len, void *udata)
          *  1.0, and are therefore throwaways.
          */
     if (len % sizeof (Sint16) != 0) {
-        *ptr = (Sint8) (((float) *ptr) * args->distance_f);
+        *ptr = (Sint8) (((float) *in) * args->distance_f);
         ptr++;
+        in++;
         len--;
     }
 
     if (args->room_angle == 180)
     for (i = 0; i < len; i += sizeof (Sint8) * 2) {
-        *ptr = (Sint8)((((float) *ptr) * args->right_f) * args->distance_f);
+        *ptr = (Sint8)((((float) *in) * args->right_f) * args->distance_f);
         ptr++;
-        *ptr = (Sint8)((((float) *ptr) * args->left_f) * args->distance_f);
+        in++;
+        *ptr = (Sint8)((((float) *in) * args->left_f) * args->distance_f);
         ptr++;
+        in++;
     }
     else
     for (i = 0; i < len; i += sizeof (Sint8) * 2) {
-        *ptr = (Sint8)((((float) *ptr) * args->left_f) * args->distance_f);
+        *ptr = (Sint8)((((float) *in) * args->left_f) * args->distance_f);
         ptr++;
-        *ptr = (Sint8)((((float) *ptr) * args->right_f) * args->distance_f);
+        in++;
+        *ptr = (Sint8)((((float) *in) * args->right_f) * args->distance_f);
         ptr++;
+        in++;
     }
 }
 static void _Eff_position_s8_c4(int chan, void *stream, int len, void *udata)
@@ -549,10 +571,12 @@ static void _Eff_position_s8_c6(int chan, void *stream, int len, void *udata)
  *  in case the user has called Mix_SetPanning() or whatnot again while this
  *  callback is running.
  */
-static void _Eff_position_table_s8(int chan, void *stream, int len, void *udata)
+static void _Eff_position_table_s8_copy(int chan, const void *src, void *dst, int len, void *udata)
 {
     volatile position_args *args = (volatile position_args *) udata;
-    Sint8 *ptr = (Sint8 *) stream;
+    const Sint8 *in = (const Sint8 *) src;
+    Sint8 *ptr = (Sint8 *) dst;
+    const Uint32 *q;
     Uint32 *p;
     int i;
     Sint8 *l = ((Sint8 *) _Eff_volume_table) + (256 * args->left_u8);
@@ -567,30 +591,34 @@ static void _Eff_position_table_s8(int chan, void *stream, int len, void *udata)
 
 
     while (len % sizeof (Uint32) != 0) {
-        *ptr = d[l[*ptr]];
+        *ptr = d[l[*in]];
         ptr++;
+        in++;
         if (args->channels > 1) {
-            *ptr = d[r[*ptr]];
+            *ptr = d[r[*in]];
             ptr++;
+            in++;
         }
         len -= args->channels;
     }
 
+    q = (const Uint32 *) in;
     p = (Uint32 *) ptr;
 
     for (i = 0; i < len; i += sizeof (Uint32)) {
 #if (SDL_BYTEORDER == SDL_BIG_ENDIAN)
-        *p = (d[l[((Sint16)(Sint8)((*p & 0xFF000000) >> 24))+128]] << 24) |
-             (d[r[((Sint16)(Sint8)((*p & 0x00FF0000) >> 16))+128]] << 16) |
-             (d[l[((Sint16)(Sint8)((*p & 0x0000FF00) >>  8))+128]] <<  8) |
-             (d[r[((Sint16)(Sint8)((*p & 0x000000FF)      ))+128]]      ) ;
+        *p = (d[l[((Sint16)(Sint8)((*q & 0xFF000000) >> 24))+128]] << 24) |
+             (d[r[((Sint16)(Sint8)((*q & 0x00FF0000) >> 16))+128]] << 16) |
+             (d[l[((Sint16)(Sint8)((*q & 0x0000FF00) >>  8))+128]] <<  8) |
+             (d[r[((Sint16)(Sint8)((*q & 0x000000FF)      ))+128]]      ) ;
 #else
-        *p = (d[r[((Sint16)(Sint8)((*p & 0xFF000000) >> 24))+128]] << 24) |
-             (d[l[((Sint16)(Sint8)((*p & 0x00FF0000) >> 16))+128]] << 16) |
-             (d[r[((Sint16)(Sint8)((*p & 0x0000FF00) >>  8))+128]] <<  8) |
-             (d[l[((Sint16)(Sint8)((*p & 0x000000FF)      ))+128]]      ) ;
+        *p = (d[r[((Sint16)(Sint8)((*q & 0xFF000000) >> 24))+128]] << 24) |
+             (d[l[((Sint16)(Sint8)((*q & 0x00FF0000) >> 16))+128]] << 16) |
+             (d[r[((Sint16)(Sint8)((*q & 0x0000FF00) >>  8))+128]] <<  8) |
+             (d[l[((Sint16)(Sint8)((*q & 0x000000FF)      ))+128]]      ) ;
 #endif
         ++p;
+        ++q;
     }
 
 
@@ -599,20 +627,22 @@ static void _Eff_position_table_s8(int chan, void *stream, int len, void *udata)
 
 /* !!! FIXME : Optimize the code for 16-bit samples? */
 
-static void _Eff_position_u16lsb(int chan, void *stream, int len, void *udata)
+static void _Eff_position_u16lsb_copy(int chan, const void *src, void *dst, int len, void *udata)
 {
     volatile position_args *args = (volatile position_args *) udata;
-    Uint16 *ptr = (Uint16 *) stream;
+    const Uint16 *in = (const Uint16 *) src;
+    Uint16 *ptr = (Uint16 *) dst;
     int i;
 
     for (i = 0; i < len; i += sizeof (Uint16) * 2) {
-        Sint16 sampl = (Sint16) (SDL_SwapLE16(*(ptr+0)) - 32768);
-        Sint16 sampr = (Sint16) (SDL_SwapLE16(*(ptr+1)) - 32768);
+        Sint16 sampl = (Sint16) (SDL_SwapLE16(*(in+0)) - 32768);
+        Sint16 sampr = (Sint16) (SDL_SwapLE16(*(in+1)) - 32768);
         
         Uint16 swapl = (Uint16) ((Sint16) (((float) sampl * args->left_f)
                                     * args->distance_f) + 32768);
         Uint16 swapr = (Uint16) ((Sint16) (((float) sampr * args->right_f)
                                     * args->distance_f) + 32768);
+        in += 2;
 
 	if (args->room_angle == 180) {
         	*(ptr++) = (Uint16) SDL_SwapLE16(swapr);
@@ -737,11 +767,13 @@ static void _Eff_position_u16lsb_c6(int chan, void *stream, int len, void *udata
     }
 }
 
-static void _Eff_position_s16lsb(int chan, void *stream, int len, void *udata)
+#if (SDL_BYTEORDER == SDL_BIG_ENDIAN)
+static void _Eff_position_s16lsb_copy(int chan, const void *src, void *dst, int len, void *udata)
 {
     /* 16 signed bits (lsb) * 2 channels. */
     volatile position_args *args = (volatile position_args *) udata;
-    Sint16 *ptr = (Sint16 *) stream;
+    const Sint16 *in = (const Sint16 *) src;
+    Sint16 *ptr = (Sint16 *) dst;
     int i;
 
 #if 0
@@ -752,10 +784,11 @@ static void _Eff_position_s16lsb(int chan, void *stream, int len, void *udata)
 #endif
 
     for (i = 0; i < len; i += sizeof (Sint16) * 2) {
-        Sint16 swapl = (Sint16) ((((float) (Sint16) SDL_SwapLE16(*(ptr+0))) *
+        Sint16 swapl = (Sint16) ((((float) (Sint16) SDL_SwapLE16(*(in+0))) *
                                     args->left_f) * args->distance_f);
-        Sint16 swapr = (Sint16) ((((float) (Sint16) SDL_SwapLE16(*(ptr+1))) *
+        Sint16 swapr = (Sint16) ((((float) (Sint16) SDL_SwapLE16(*(in+1))) *
                                     args->right_f) * args->distance_f);
+        in += 2;
 	if (args->room_angle == 180) {
         	*(ptr++) = (Sint16) SDL_SwapLE16(swapr);
         	*(ptr++) = (Sint16) SDL_SwapLE16(swapl);
@@ -867,22 +900,25 @@ static void _Eff_position_s16lsb_c6(int chan, void *stream, int len, void *udata
 	}
     }
 }
+#endif
 
-static void _Eff_position_u16msb(int chan, void *stream, int len, void *udata)
+static void _Eff_position_u16msb_copy(int chan, const void *src, void *dst, int len, void *udata)
 {
     /* 16 signed bits (lsb) * 2 channels. */
     volatile position_args *args = (volatile position_args *) udata;
-    Uint16 *ptr = (Uint16 *) stream;
+    const Uint16 *in = (const Uint16 *) src;
+    Uint16 *ptr = (Uint16 *) dst;
     int i;
 
     for (i = 0; i < len; i += sizeof (Sint16) * 2) {
-        Sint16 sampl = (Sint16) (SDL_SwapBE16(*(ptr+0)) - 32768);
-        Sint16 sampr = (Sint16) (SDL_SwapBE16(*(ptr+1)) - 32768);
+        Sint16 sampl = (Sint16) (SDL_SwapBE16(*(in+0)) - 32768);
+        Sint16 sampr = (Sint16) (SDL_SwapBE16(*(in+1)) - 32768);
         
         Uint16 swapl = (Uint16) ((Sint16) (((float) sampl * args->left_f)
                                     * args->distance_f) + 32768);
         Uint16 swapr = (Uint16) ((Sint16) (((float) sampr * args->right_f)
                                     * args->distance_f) + 32768);
+        in += 2;
 
 	if (args->room_angle == 180) {
         	*(ptr++) = (Uint16) SDL_SwapBE16(swapr);
@@ -1009,18 +1045,21 @@ static void _Eff_position_u16msb_c6(int chan, void *stream, int len, void *udata
     }
 }
 
-static void _Eff_position_s16msb(int chan, void *stream, int len, void *udata)
+#if (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+static void _Eff_position_s16msb_copy(int chan, const void *src, void *dst, int len, void *udata)
 {
     /* 16 signed bits (lsb) * 2 channels. */
     volatile position_args *args = (volatile position_args *) udata;
-    Sint16 *ptr = (Sint16 *) stream;
+    const Sint16 *in = (const Sint16 *) src;
+    Sint16 *ptr = (Sint16 *) dst;
     int i;
 
     for (i = 0; i < len; i += sizeof (Sint16) * 2) {
-        Sint16 swapl = (Sint16) ((((float) (Sint16) SDL_SwapBE16(*(ptr+0))) *
+        Sint16 swapl = (Sint16) ((((float) (Sint16) SDL_SwapBE16(*(in+0))) *
                                     args->left_f) * args->distance_f);
-        Sint16 swapr = (Sint16) ((((float) (Sint16) SDL_SwapBE16(*(ptr+1))) *
+        Sint16 swapr = (Sint16) ((((float) (Sint16) SDL_SwapBE16(*(in+1))) *
                                     args->right_f) * args->distance_f);
+        in += 2;
         *(ptr++) = (Sint16) SDL_SwapBE16(swapl);
         *(ptr++) = (Sint16) SDL_SwapBE16(swapr);
     }
@@ -1126,6 +1165,392 @@ static void _Eff_position_s16msb_c6(int chan, void *stream, int len, void *udata
 	}
     }
 }
+#endif
+
+/*
+ * Native 16 bit and float samples in mono, stereo, quad or 5.1. Each output
+ *  speaker takes one input speaker times a gain, with the speakers rotated
+ *  around the listener for the room angle. In 5.1, when the listener isn't
+ *  facing front, the center speaker is the average of the two speakers that
+ *  are now in front. The gains are read once per callback, and the SSE2
+ *  versions give the same results as the C versions.
+ */
+typedef struct _Eff_positionmap
+{
+    int channels;
+    float gain[6];          /* per output speaker, distance included */
+    int src[6];             /* the input speaker for each output speaker */
+    int center_a, center_b; /* input speakers mixed into the center, or -1 */
+    float center_gain_a, center_gain_b;
+} position_map;
+
+static void get_position_map(volatile position_args *args, position_map *map)
+{
+    static const int rotation[4][4] = {
+        { 0, 1, 2, 3 },     /* facing front */
+        { 1, 3, 0, 2 },     /* 90 degrees */
+        { 3, 2, 1, 0 },     /* 180 degrees */
+        { 2, 0, 3, 1 }      /* 270 degrees */
+    };
+    static const int center[4][2] = {
+        { -1, -1 }, { 1, 3 }, { 3, 2 }, { 0, 2 }
+    };
+    const int turn = (args->room_angle / 90) & 3;
+    float in_gain[6];
+    int i;
+
+    in_gain[0] = args->left_f * args->distance_f;
+    in_gain[1] = args->right_f * args->distance_f;
+    in_gain[2] = args->left_rear_f * args->distance_f;
+    in_gain[3] = args->right_rear_f * args->distance_f;
+    in_gain[4] = args->center_f * args->distance_f;
+    in_gain[5] = args->lfe_f * args->distance_f;
+
+    map->channels = args->channels;
+    map->center_a = map->center_b = -1;
+    map->center_gain_a = map->center_gain_b = 0.0f;
+    switch (map->channels) {
+        case 1:
+            map->src[0] = 0;
+            in_gain[0] = args->distance_f;
+            break;
+        case 2:
+            map->src[0] = (turn == 2) ? 1 : 0;
+            map->src[1] = (turn == 2) ? 0 : 1;
+            break;
+        default:
+            for (i = 0; i < 4; i++) {
+                map->src[i] = rotation[turn][i];
+            }
+            map->src[4] = 4;
+            map->src[5] = 5;
+            if (map->channels == 6 && turn != 0) {
+                map->center_a = center[turn][0];
+                map->center_b = center[turn][1];
+                map->center_gain_a = in_gain[map->center_a] * 0.5f;
+                map->center_gain_b = in_gain[map->center_b] * 0.5f;
+            }
+            break;
+    }
+    for (i = 0; i < map->channels; i++) {
+        map->gain[i] = in_gain[map->src[i]];
+    }
+}
+
+static void position_s16(const position_map *map, const Sint16 *in,
+                         Sint16 *out, int frames)
+{
+    const int channels = map->channels;
+    float frame[6];
+    int i, k;
+
+    for (i = 0; i < frames; i++) {
+        for (k = 0; k < channels; k++) {
+            frame[k] = (float) in[k];
+        }
+        for (k = 0; k < channels; k++) {
+            out[k] = (Sint16) (frame[map->src[k]] * map->gain[k]);
+        }
+        if (map->center_a >= 0) {
+            out[4] = (Sint16) (frame[map->center_a] * map->center_gain_a +
+                               frame[map->center_b] * map->center_gain_b);
+        }
+        in += channels;
+        out += channels;
+    }
+}
+
+#ifdef AUDIO_F32SYS
+static void position_f32(const position_map *map, const float *in,
+                         float *out, int frames)
+{
+    const int channels = map->channels;
+    float frame[6];
+    int i, k;
+
+    for (i = 0; i < frames; i++) {
+        for (k = 0; k < channels; k++) {
+            frame[k] = in[k];
+        }
+        for (k = 0; k < channels; k++) {
+            out[k] = frame[map->src[k]] * map->gain[k];
+        }
+        if (map->center_a >= 0) {
+            out[4] = frame[map->center_a] * map->center_gain_a +
+                     frame[map->center_b] * map->center_gain_b;
+        }
+        in += channels;
+        out += channels;
+    }
+}
+#endif
+
+#ifdef __SSE2__
+/* Scale 8 samples, rotating the speakers within each group of 4 */
+#define POSITION_S16_SSE2(gain_lo, gain_hi, rotate) \
+    { \
+        __m128i s = _mm_loadu_si128((const __m128i *) (in + i)); \
+        __m128 lo = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(s, s), 16)); \
+        __m128 hi = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(s, s), 16)); \
+        lo = _mm_mul_ps(_mm_shuffle_ps(lo, lo, rotate), gain_lo); \
+        hi = _mm_mul_ps(_mm_shuffle_ps(hi, hi, rotate), gain_hi); \
+        _mm_storeu_si128((__m128i *) (out + i), \
+            _mm_packs_epi32(_mm_cvttps_epi32(lo), _mm_cvttps_epi32(hi))); \
+        i += 8; \
+    }
+
+/* Scale 4 samples, rotating the speakers within them */
+#define POSITION_F32_SSE2(gain, rotate) \
+    { \
+        __m128 v = _mm_loadu_ps(in + i); \
+        _mm_storeu_ps(out + i, _mm_mul_ps(_mm_shuffle_ps(v, v, rotate), gain)); \
+        i += 4; \
+    }
+
+/* Turn a 5.1 frame away from the front, with the center mixed separately */
+#define POSITION_S16_SURROUND_SSE2(gain, rotate) \
+    { \
+        __m128i s = _mm_loadl_epi64((const __m128i *) (in + i)); \
+        __m128 v = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(s, s), 16)); \
+        const float ce = in[i + map->center_a] * map->center_gain_a + \
+                         in[i + map->center_b] * map->center_gain_b; \
+        const float lfe = in[i + 5] * g[5]; \
+        v = _mm_mul_ps(_mm_shuffle_ps(v, v, rotate), gain); \
+        s = _mm_cvttps_epi32(v); \
+        _mm_storel_epi64((__m128i *) (out + i), _mm_packs_epi32(s, s)); \
+        out[i + 4] = (Sint16) ce; \
+        out[i + 5] = (Sint16) lfe; \
+        i += 6; \
+    }
+
+#define POSITION_F32_SURROUND_SSE2(gain, rotate) \
+    { \
+        __m128 v = _mm_loadu_ps(in + i); \
+        const float ce = in[i + map->center_a] * map->center_gain_a + \
+                         in[i + map->center_b] * map->center_gain_b; \
+        const float lfe = in[i + 5] * g[5]; \
+        _mm_storeu_ps(out + i, _mm_mul_ps(_mm_shuffle_ps(v, v, rotate), gain)); \
+        out[i + 4] = ce; \
+        out[i + 5] = lfe; \
+        i += 6; \
+    }
+
+#define FRONT       _MM_SHUFFLE(3, 2, 1, 0)
+#define SWAP_PAIRS  _MM_SHUFFLE(2, 3, 0, 1)
+#define TURN_90     _MM_SHUFFLE(2, 0, 3, 1)
+#define TURN_180    _MM_SHUFFLE(0, 1, 2, 3)
+#define TURN_270    _MM_SHUFFLE(1, 3, 0, 2)
+
+static void position_s16_sse2(const position_map *map, const Sint16 *in,
+                              Sint16 *out, int frames)
+{
+    const int samples = frames * map->channels;
+    const float *g = map->gain;
+    int i = 0;
+
+    if (map->channels == 2) {
+        const __m128 gain = _mm_setr_ps(g[0], g[1], g[0], g[1]);
+        if (map->src[0] == 0) {
+            while (i + 8 <= samples) POSITION_S16_SSE2(gain, gain, FRONT)
+        } else {
+            while (i + 8 <= samples) POSITION_S16_SSE2(gain, gain, SWAP_PAIRS)
+        }
+    } else if (map->channels == 4) {
+        const __m128 gain = _mm_loadu_ps(g);
+        switch (map->src[0]) {
+            case 0:
+                while (i + 8 <= samples) POSITION_S16_SSE2(gain, gain, FRONT)
+                break;
+            case 1:
+                while (i + 8 <= samples) POSITION_S16_SSE2(gain, gain, TURN_90)
+                break;
+            case 3:
+                while (i + 8 <= samples) POSITION_S16_SSE2(gain, gain, TURN_180)
+                break;
+            case 2:
+                while (i + 8 <= samples) POSITION_S16_SSE2(gain, gain, TURN_270)
+                break;
+        }
+    } else if (map->channels == 6 && map->src[0] == 0) {
+        /* 4 frames are 24 samples, which repeat the gains every 12 */
+        const __m128 gain_a = _mm_setr_ps(g[0], g[1], g[2], g[3]);
+        const __m128 gain_b = _mm_setr_ps(g[4], g[5], g[0], g[1]);
+        const __m128 gain_c = _mm_setr_ps(g[2], g[3], g[4], g[5]);
+        while (i + 24 <= samples) {
+            POSITION_S16_SSE2(gain_a, gain_b, FRONT)
+            POSITION_S16_SSE2(gain_c, gain_a, FRONT)
+            POSITION_S16_SSE2(gain_b, gain_c, FRONT)
+        }
+    } else if (map->channels == 6) {
+        const __m128 gain = _mm_loadu_ps(g);
+        switch (map->src[0]) {
+            case 1:
+                while (i + 6 <= samples) POSITION_S16_SURROUND_SSE2(gain, TURN_90)
+                break;
+            case 3:
+                while (i + 6 <= samples) POSITION_S16_SURROUND_SSE2(gain, TURN_180)
+                break;
+            case 2:
+                while (i + 6 <= samples) POSITION_S16_SURROUND_SSE2(gain, TURN_270)
+                break;
+        }
+    }
+
+    /* whatever is left over */
+    position_s16(map, in + i, out + i, (samples - i) / map->channels);
+}
+
+#ifdef AUDIO_F32SYS
+static void position_f32_sse2(const position_map *map, const float *in,
+                              float *out, int frames)
+{
+    const int samples = frames * map->channels;
+    const float *g = map->gain;
+    int i = 0;
+
+    if (map->channels == 2) {
+        const __m128 gain = _mm_setr_ps(g[0], g[1], g[0], g[1]);
+        if (map->src[0] == 0) {
+            while (i + 4 <= samples) POSITION_F32_SSE2(gain, FRONT)
+        } else {
+            while (i + 4 <= samples) POSITION_F32_SSE2(gain, SWAP_PAIRS)
+        }
+    } else if (map->channels == 4) {
+        const __m128 gain = _mm_loadu_ps(g);
+        switch (map->src[0]) {
+            case 0:
+                while (i + 4 <= samples) POSITION_F32_SSE2(gain, FRONT)
+                break;
+            case 1:
+                while (i + 4 <= samples) POSITION_F32_SSE2(gain, TURN_90)
+                break;
+            case 3:
+                while (i + 4 <= samples) POSITION_F32_SSE2(gain, TURN_180)
+                break;
+            case 2:
+                while (i + 4 <= samples) POSITION_F32_SSE2(gain, TURN_270)
+                break;
+        }
+    } else if (map->channels == 6 && map->src[0] == 0) {
+        const __m128 gain_a = _mm_setr_ps(g[0], g[1], g[2], g[3]);
+        const __m128 gain_b = _mm_setr_ps(g[4], g[5], g[0], g[1]);
+        const __m128 gain_c = _mm_setr_ps(g[2], g[3], g[4], g[5]);
+        while (i + 12 <= samples) {
+            POSITION_F32_SSE2(gain_a, FRONT)
+            POSITION_F32_SSE2(gain_b, FRONT)
+            POSITION_F32_SSE2(gain_c, FRONT)
+        }
+    } else if (map->channels == 6) {
+        const __m128 gain = _mm_loadu_ps(g);
+        switch (map->src[0]) {
+            case 1:
+                while (i + 6 <= samples) POSITION_F32_SURROUND_SSE2(gain, TURN_90)
+                break;
+            case 3:
+                while (i + 6 <= samples) POSITION_F32_SURROUND_SSE2(gain, TURN_180)
+                break;
+            case 2:
+                while (i + 6 <= samples) POSITION_F32_SURROUND_SSE2(gain, TURN_270)
+                break;
+        }
+    }
+
+    position_f32(map, in + i, out + i, (samples - i) / map->channels);
+}
+#endif /* AUDIO_F32SYS */
+
+#undef FRONT
+#undef SWAP_PAIRS
+#undef TURN_90
+#undef TURN_180
+#undef TURN_270
+#endif /* __SSE2__ */
+
+/* Copy any partial frame at the end, which the kernels leave alone */
+static void position_copy_tail(const void *src, void *dst, int len, int framesize)
+{
+    int tail = len % framesize;
+    if (tail && src != dst) {
+        memcpy((Uint8 *) dst + len - tail, (const Uint8 *) src + len - tail, tail);
+    }
+}
+
+static void _Eff_position_s16sys_copy(int chan, const void *src, void *dst, int len, void *udata)
+{
+    position_map map;
+    get_position_map((volatile position_args *) udata, &map);
+    position_s16(&map, (const Sint16 *) src, (Sint16 *) dst,
+                 len / (sizeof (Sint16) * map.channels));
+    position_copy_tail(src, dst, len, sizeof (Sint16) * map.channels);
+}
+
+#ifdef __SSE2__
+static void _Eff_position_s16sys_sse2_copy(int chan, const void *src, void *dst, int len, void *udata)
+{
+    position_map map;
+    get_position_map((volatile position_args *) udata, &map);
+    position_s16_sse2(&map, (const Sint16 *) src, (Sint16 *) dst,
+                      len / (sizeof (Sint16) * map.channels));
+    position_copy_tail(src, dst, len, sizeof (Sint16) * map.channels);
+}
+#endif
+
+#ifdef AUDIO_F32SYS
+static void _Eff_position_f32sys_copy(int chan, const void *src, void *dst, int len, void *udata)
+{
+    position_map map;
+    get_position_map((volatile position_args *) udata, &map);
+    position_f32(&map, (const float *) src, (float *) dst,
+                 len / (sizeof (float) * map.channels));
+    position_copy_tail(src, dst, len, sizeof (float) * map.channels);
+}
+
+#ifdef __SSE2__
+static void _Eff_position_f32sys_sse2_copy(int chan, const void *src, void *dst, int len, void *udata)
+{
+    position_map map;
+    get_position_map((volatile position_args *) udata, &map);
+    position_f32_sse2(&map, (const float *) src, (float *) dst,
+                      len / (sizeof (float) * map.channels));
+    position_copy_tail(src, dst, len, sizeof (float) * map.channels);
+}
+#endif
+#endif /* AUDIO_F32SYS */
+
+/*
+ * The stereo and native effects read the chunk and write the effect buffer
+ *  in one pass when they're the first effect on a channel (see
+ *  Mix_RegisterCopyEffect()); otherwise they run in place on the output of
+ *  the previous effect.
+ */
+#define POSITION_IN_PLACE(name) \
+static void name(int chan, void *stream, int len, void *udata) \
+{ \
+    name##_copy(chan, stream, stream, len, udata); \
+}
+
+POSITION_IN_PLACE(_Eff_position_u8)
+POSITION_IN_PLACE(_Eff_position_table_u8)
+POSITION_IN_PLACE(_Eff_position_s8)
+POSITION_IN_PLACE(_Eff_position_table_s8)
+POSITION_IN_PLACE(_Eff_position_u16lsb)
+POSITION_IN_PLACE(_Eff_position_u16msb)
+#if (SDL_BYTEORDER == SDL_BIG_ENDIAN)
+POSITION_IN_PLACE(_Eff_position_s16lsb)
+#else
+POSITION_IN_PLACE(_Eff_position_s16msb)
+#endif
+POSITION_IN_PLACE(_Eff_position_s16sys)
+#ifdef __SSE2__
+POSITION_IN_PLACE(_Eff_position_s16sys_sse2)
+#endif
+#ifdef AUDIO_F32SYS
+POSITION_IN_PLACE(_Eff_position_f32sys)
+#ifdef __SSE2__
+POSITION_IN_PLACE(_Eff_position_f32sys_sse2)
+#endif
+#endif
+
 
 static void init_position_args(position_args *args)
 {
@@ -1184,17 +1609,56 @@ static position_args *get_position_arg(int channel)
 }
 
 
-static Mix_EffectFunc_t get_position_effect_func(Uint16 format, int channels)
+static Mix_EffectFunc_t get_position_effect_func(Uint16 format, int channels,
+                                                 Mix_EffectCopyFunc_t *copy)
 {
     Mix_EffectFunc_t f = NULL;
 
+    *copy = NULL;
+
+    /* Native 16 bit and float samples use the vectorized effects */
+    if (format == AUDIO_S16SYS
+#ifdef AUDIO_F32SYS
+        || format == AUDIO_F32SYS
+#endif
+       ) {
+        if (channels != 1 && channels != 2 && channels != 4 && channels != 6) {
+            return(NULL);
+        }
+#ifdef __SSE2__
+        if (SDL_HasSSE2()) {
+#ifdef AUDIO_F32SYS
+            if (format == AUDIO_F32SYS) {
+                *copy = _Eff_position_f32sys_sse2_copy;
+                return(_Eff_position_f32sys_sse2);
+            }
+#endif
+            *copy = _Eff_position_s16sys_sse2_copy;
+            return(_Eff_position_s16sys_sse2);
+        }
+#endif
+#ifdef AUDIO_F32SYS
+        if (format == AUDIO_F32SYS) {
+            *copy = _Eff_position_f32sys_copy;
+            return(_Eff_position_f32sys);
+        }
+#endif
+        *copy = _Eff_position_s16sys_copy;
+        return(_Eff_position_s16sys);
+    }
+
     switch (format) {
         case AUDIO_U8:
 	    switch (channels) {
 		    case 1:
 		    case 2:
-            		f = (_Eff_build_volume_table_u8()) ? _Eff_position_table_u8 :
-                                                 		_Eff_position_u8;
+            		if (_Eff_build_volume_table_u8()) {
+            		    f = _Eff_position_table_u8;
+            		    *copy = _Eff_position_table_u8_copy;
+            		} else {
+            		    f = _Eff_position_u8;
+            		    *copy = _Eff_position_u8_copy;
+            		}
 	    		break;
 	    	    case 4:
                         f = _Eff_position_u8_c4;
@@ -1209,8 +1673,13 @@ static Mix_EffectFunc_t get_position_effect_func(Uint16 format, int channels)
 	    switch (channels) {
 		    case 1:
 		    case 2:
-            		f = (_Eff_build_volume_table_s8()) ? _Eff_position_table_s8 :
-                                                 		_Eff_position_s8;
+            		if (_Eff_build_volume_table_s8()) {
+            		    f = _Eff_position_table_s8;
+            		    *copy = _Eff_position_table_s8_copy;
+            		} else {
+            		    f = _Eff_position_s8;
+            		    *copy = _Eff_position_s8_copy;
+            		}
 	    		break;
 	    	    case 4:
                         f = _Eff_position_s8_c4;
@@ -1226,6 +1695,7 @@ static Mix_EffectFunc_t get_position_effect_func(Uint16 format, int channels)
 		    case 1:
 		    case 2:
             		f = _Eff_position_u16lsb;
+            		*copy = _Eff_position_u16lsb_copy;
 	    		break;
 	    	    case 4:
             		f = _Eff_position_u16lsb_c4;
@@ -1236,11 +1706,13 @@ static Mix_EffectFunc_t get_position_effect_func(Uint16 format, int channels)
 	    }
             break;
 
+#if (SDL_BYTEORDER == SDL_BIG_ENDIAN)
         case AUDIO_S16LSB:
 	    switch (channels) {
 		    case 1:
 		    case 2:
             		f = _Eff_position_s16lsb;
+            		*copy = _Eff_position_s16lsb_copy;
 	    		break;
 	    	    case 4:
             		f = _Eff_position_s16lsb_c4;
@@ -1251,11 +1723,13 @@ static Mix_EffectFunc_t get_position_effect_func(Uint16 format, int channels)
 	    }
             break;
 
+#endif
         case AUDIO_U16MSB:
 	    switch (channels) {
 		    case 1:
 		    case 2:
             		f = _Eff_position_u16msb;
+            		*copy = _Eff_position_u16msb_copy;
 	    		break;
 	    	    case 4:
             		f = _Eff_position_u16msb_c4;
@@ -1266,11 +1740,13 @@ static Mix_EffectFunc_t get_position_effect_func(Uint16 format, int channels)
 	    }
             break;
 
+#if (SDL_BYTEORDER == SDL_LIL_ENDIAN)
         case AUDIO_S16MSB:
 	    switch (channels) {
 		    case 1:
 		    case 2:
             		f = _Eff_position_s16msb;
+            		*copy = _Eff_position_s16msb_copy;
 	    		break;
 	    	    case 4:
             		f = _Eff_position_s16msb_c4;
@@ -1281,6 +1757,7 @@ static Mix_EffectFunc_t get_position_effect_func(Uint16 format, int channels)
 	    }
             break;
 
+#endif
         default:
             Mix_SetError("Unsupported audio format");
     }
@@ -1426,6 +1903,7 @@ int Mix_SetPosition(int channel, Sint16 angle, Uint8 distance);
 int Mix_SetPanning(int channel, Uint8 left, Uint8 right)
 {
     Mix_EffectFunc_t f = NULL;
+    Mix_EffectCopyFunc_t copy = NULL;
     int channels;
     Uint16 format;
     position_args *args = NULL;
@@ -1447,10 +1925,11 @@ int Mix_SetPanning(int channel, Uint8 left, Uint8 right)
         return( Mix_SetPosition(channel, angle, 0) );
     }
 
-    f = get_position_effect_func(format, channels);
+    f = get_position_effect_func(format, channels, &copy);
     if (f == NULL)
         return(0);
 
+    _Mix_SyncChannel(channel);  /* a queued Mix_PlayChannel() resets effects */
     args = get_position_arg(channel);
     if (!args)
         return(0);
@@ -1472,7 +1951,7 @@ int Mix_SetPanning(int channel, Uint8 left, Uint8 right)
 
     if (!args->in_use) {
         args->in_use = 1;
-        return(Mix_RegisterEffect(channel, f, _Eff_PositionDone, (void *) args));
+        return(Mix_RegisterCopyEffect(channel, f, copy, _Eff_PositionDone, (void *) args));
     }
 
     return(1);
@@ -1482,15 +1961,17 @@ int Mix_SetPanning(int channel, Uint8 left, Uint8 right)
 int Mix_SetDistance(int channel, Uint8 distance)
 {
     Mix_EffectFunc_t f = NULL;
+    Mix_EffectCopyFunc_t copy = NULL;
     Uint16 format;
     position_args *args = NULL;
     int channels;
 
     Mix_QuerySpec(NULL, &format, &channels);
-    f = get_position_effect_func(format, channels);
+    f = get_position_effect_func(format, channels, &copy);
     if (f == NULL)
         return(0);
 
+    _Mix_SyncChannel(channel);  /* a queued Mix_PlayChannel() resets effects */
     args = get_position_arg(channel);
     if (!args)
         return(0);
@@ -1510,7 +1991,7 @@ int Mix_SetDistance(int channel, Uint8 distance)
     args->distance_f = ((float) distance) / 255.0f;
     if (!args->in_use) {
         args->in_use = 1;
-        return(Mix_RegisterEffect(channel, f, _Eff_PositionDone, (void *) args));
+        return(Mix_RegisterCopyEffect(channel, f, copy, _Eff_PositionDone, (void *) args));
     }
 
     return(1);
@@ -1520,13 +2001,14 @@ int Mix_SetDistance(int channel, Uint8 distance)
 int Mix_SetPosition(int channel, Sint16 angle, Uint8 distance)
 {
     Mix_EffectFunc_t f = NULL;
+    Mix_EffectCopyFunc_t copy = NULL;
     Uint16 format;
     int channels;
     position_args *args = NULL;
     Sint16 room_angle = 0;
 
     Mix_QuerySpec(NULL, &format, &channels);
-    f = get_position_effect_func(format, channels);
+    f = get_position_effect_func(format, channels, &copy);
     if (f == NULL)
         return(0);
 
@@ -1534,6 +2016,7 @@ int Mix_SetPosition(int channel, Sint16 angle, Uint8 distance)
     while (angle >= 360) angle -= 360;
     while (angle < 0) angle += 360;
 
+    _Mix_SyncChannel(channel);  /* a queued Mix_PlayChannel() resets effects */
     args = get_position_arg(channel);
     if (!args)
         return(0);
@@ -1585,7 +2068,7 @@ int Mix_SetPosition(int channel, Sint16 angle, Uint8 distance)
     args->room_angle = room_angle;
     if (!args->in_use) {
         args->in_use = 1;
-        return(Mix_RegisterEffect(channel, f, _Eff_PositionDone, (void *) args));
+        return(Mix_RegisterCopyEffect(channel, f, copy, _Eff_PositionDone, (void *) args));
     }
 
     return(1);
@@ -44,6 +44,7 @@ void *_Eff_build_volume_table_s8(void);
 void _Mix_InitEffects(void);
 void _Mix_DeinitEffects(void);
 void _Eff_PositionDeinit(void);
+void _Mix_SyncChannel(int channel);
 
 /* Set up for C function definitions, even when using C++ */
 #ifdef __cplusplus
@@ -581,6 +581,7 @@ enum {
 #define DMODE_SOFT_SNDFX 0x0004 /* Process sound effects via software mixer */
 #define DMODE_SOFT_MUSIC 0x0008 /* Process music via software mixer */
 #define DMODE_HQMIXER    0x0010 /* Use high-quality (slower) software mixer */
+#define DMODE_SIMDMIXER  0x0800 /* Use SSE2 mixing routines if built in */
 /* These take effect immediately. */
 #define DMODE_SURROUND   0x0100 /* enable surround sound */
 #define DMODE_INTERP     0x0200 /* enable interpolation */
@@ -43,6 +43,12 @@
 
 #include "mikmod_internals.h"
 
+#ifdef __SSE2__
+/* keep the compiler's _mm_malloc from clashing with MikMod's own */
+#define _MM_MALLOC_H_INCLUDED
+#define __MM_MALLOC_H
+#include <emmintrin.h>
+#endif
 
 /*
    Constant definitions
@@ -383,7 +389,100 @@ static SLONGLONG MixSurroundInterp(SWORD* srce,SLONG* dest,SLONGLONG index,SLONG
 	return index;
 }
 
+#ifdef __SSE2__
+/*========== SSE2 interpolating mixers, eight samples at a time */
+
+/* The two neighbouring samples weighted by (1-frac,frac) in one madd gives
+   exactly the srce[i]+((srce[i+1]-srce[i])*frac>>FRACBITS) of the mixers
+   above */
+static __m128i Interp_SSE2(SWORD* srce,SLONGLONG* index,SLONGLONG increment)
+{
+	SLONG pair[8],weight[8],frac;
+	SLONGLONG i=*index;
+	int t;
+
+	for(t=0;t<8;t++,i+=increment) {
+		frac=(SLONG)(i&FRACMASK);
+		memcpy(&pair[t],&srce[i>>FRACBITS],sizeof(SLONG));
+		weight[t]=(frac<<16)|(SLONG)(FRACMASK+1-frac);
+	}
+	*index=i;
+
+	return _mm_packs_epi32(
+	    _mm_srai_epi32(_mm_madd_epi16(_mm_loadu_si128((__m128i*)pair),
+	                   _mm_loadu_si128((__m128i*)weight)),FRACBITS),
+	    _mm_srai_epi32(_mm_madd_epi16(_mm_loadu_si128((__m128i*)(pair+4)),
+	                   _mm_loadu_si128((__m128i*)(weight+4))),FRACBITS));
+}
+
+/* dest[0..7] += sample*vol, with the full 32 bit products */
+static void MixProducts_SSE2(SLONG* dest,__m128i sample,__m128i vol)
+{
+	__m128i lo=_mm_mullo_epi16(sample,vol),hi=_mm_mulhi_epi16(sample,vol);
+
+	_mm_storeu_si128((__m128i*)dest,
+	    _mm_add_epi32(_mm_loadu_si128((__m128i*)dest),_mm_unpacklo_epi16(lo,hi)));
+	_mm_storeu_si128((__m128i*)(dest+4),
+	    _mm_add_epi32(_mm_loadu_si128((__m128i*)(dest+4)),_mm_unpackhi_epi16(lo,hi)));
+}
+
+typedef SLONGLONG (*MIXFUNC)(SWORD*,SLONG*,SLONGLONG,SLONGLONG,SLONG);
+
+/* Mixes with the given C mixer while the volume ramps, and for whatever is
+   left over after the multiples of eight; the rest goes through SSE2 with
+   the constant volumes lvol (and rvol in stereo). */
+static SLONGLONG MixInterp_SSE2(MIXFUNC mix,SWORD* srce,SLONG* dest,SLONGLONG index,SLONGLONG increment,SLONG todo,int lvol,int rvol,int stereo)
+{
+	SLONG done=MIN(todo,vnf->rampvol);
+	__m128i vol,sample;
+
+	if(done) {
+		index=mix(srce,dest,index,increment,done);
+		dest+=stereo?done<<1:done;
+		todo-=done;
+	}
+	if((lvol<-32768)||(lvol>32767)||(rvol<-32768)||(rvol>32767))
+		return mix(srce,dest,index,increment,todo);
+
+	vol=stereo?_mm_set_epi16(rvol,lvol,rvol,lvol,rvol,lvol,rvol,lvol):
+	           _mm_set1_epi16(lvol);
+	for(;todo>=8;todo-=8) {
+		sample=Interp_SSE2(srce,&index,increment);
+		if(stereo) {
+			MixProducts_SSE2(dest,_mm_unpacklo_epi16(sample,sample),vol);
+			MixProducts_SSE2(dest+8,_mm_unpackhi_epi16(sample,sample),vol);
+			dest+=16;
+		} else {
+			MixProducts_SSE2(dest,sample,vol);
+			dest+=8;
+		}
+	}
+	return todo?mix(srce,dest,index,increment,todo):index;
+}
+
+static SLONGLONG MixMonoInterp_SSE2(SWORD* srce,SLONG* dest,SLONGLONG index,SLONGLONG increment,SLONG todo)
+{
+	return MixInterp_SSE2(MixMonoInterp,srce,dest,index,increment,todo,
+	                      vnf->lvolsel,0,0);
+}
+
+static SLONGLONG MixStereoInterp_SSE2(SWORD* srce,SLONG* dest,SLONGLONG index,SLONGLONG increment,SLONG todo)
+{
+	return MixInterp_SSE2(MixStereoInterp,srce,dest,index,increment,todo,
+	                      vnf->lvolsel,vnf->rvolsel,1);
+}
+
+static SLONGLONG MixSurroundInterp_SSE2(SWORD* srce,SLONG* dest,SLONGLONG index,SLONGLONG increment,SLONG todo)
+{
+	int vol=(vnf->lvolsel>=vnf->rvolsel)?vnf->lvolsel:-vnf->rvolsel;
+
+	return MixInterp_SSE2(MixSurroundInterp,srce,dest,index,increment,todo,
+	                      vol,-vol,1);
+}
+#endif
+
 static void (*MixReverb)(SLONG* srce,NATIVE count);
+static void (*Mix32to16)(SWORD* dste,SLONG* srce,NATIVE count);
 
 /* Reverb macros */
 #define COMPUTE_LOC(n) loc##n = RVRindex % RVc##n
@@ -488,6 +587,18 @@ static void Mix32To16(SWORD* dste,SLONG* srce,NATIVE count)
 	}
 }
 
+#ifdef __SSE2__
+/* packs saturates exactly as CHECK_SAMPLE clips */
+static void Mix32To16_SSE2(SWORD* dste,SLONG* srce,NATIVE count)
+{
+	for(;count>=8;count-=8,srce+=8,dste+=8)
+		_mm_storeu_si128((__m128i*)dste,_mm_packs_epi32(
+		    _mm_srai_epi32(_mm_loadu_si128((__m128i*)srce),BITSHIFT),
+		    _mm_srai_epi32(_mm_loadu_si128((__m128i*)(srce+4)),BITSHIFT)));
+	Mix32To16(dste,srce,count);
+}
+#endif
+
 static void Mix32To8(SBYTE* dste,SLONG* srce,NATIVE count)
 {
 	SWORD x1,x2,x3,x4;
@@ -591,6 +702,20 @@ static void AddChannel(SLONG* ptr,NATIVE todo)
 		endpos=vnf->current+done*vnf->increment;
 
 		if(vnf->vol) {
+#ifdef __SSE2__
+			if((vc_mode & DMODE_SIMDMIXER)&&(md_mode & DMODE_INTERP)) {
+				if(vc_mode & DMODE_STEREO) {
+					if((vnf->pan==PAN_SURROUND)&&(vc_mode&DMODE_SURROUND))
+						vnf->current=MixSurroundInterp_SSE2
+						           (s,ptr,vnf->current,vnf->increment,done);
+					else
+						vnf->current=MixStereoInterp_SSE2
+						           (s,ptr,vnf->current,vnf->increment,done);
+				} else
+					vnf->current=MixMonoInterp_SSE2
+					               (s,ptr,vnf->current,vnf->increment,done);
+			} else
+#endif
 #ifndef NATIVE_64BIT_INT
 			/* use the 32 bit mixers as often as we can (they're much faster) */
 			if((vnf->current<0x7fffffff)&&(endpos<0x7fffffff)) {
@@ -661,6 +786,18 @@ static void AddChannel(SLONG* ptr,NATIVE todo)
 #include "virtch_common.c"
 #undef _IN_VIRTCH_
 
+#ifdef __SSE2__
+static void MixReverb_NormalSSE2(SLONG* srce,NATIVE count)
+{
+	MixReverb_SSE2(srce,count,58+(md_reverb<<2),0,MixReverb_Normal);
+}
+
+static void MixReverb_StereoSSE2(SLONG* srce,NATIVE count)
+{
+	MixReverb_SSE2(srce,count,92+(md_reverb<<1),1,MixReverb_Stereo);
+}
+#endif
+
 void VC1_WriteSamples(SBYTE* buf,ULONG todo)
 {
 	int left,portion=0,count;
@@ -721,7 +858,7 @@ void VC1_WriteSamples(SBYTE* buf,ULONG todo)
 			}
 
 			if(vc_mode & DMODE_16BITS)
-				Mix32To16((SWORD*) buffer, vc_tickbuf, count);
+				Mix32to16((SWORD*) buffer, vc_tickbuf, count);
 			else
 				Mix32To8((SBYTE*) buffer, vc_tickbuf, count);
 
@@ -749,6 +886,13 @@ BOOL VC1_Init(void)
 		}
 
 	MixReverb=(md_mode&DMODE_STEREO)?MixReverb_Stereo:MixReverb_Normal;
+	Mix32to16=Mix32To16;
+#ifdef __SSE2__
+	if(md_mode&DMODE_SIMDMIXER) {
+		MixReverb=(md_mode&DMODE_STEREO)?MixReverb_StereoSSE2:MixReverb_NormalSSE2;
+		Mix32to16=Mix32To16_SSE2;
+	}
+#endif
 	vc_mode = md_mode;
 	return 0;
 }
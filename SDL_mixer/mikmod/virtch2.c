@@ -44,6 +44,13 @@
 
 #include "mikmod_internals.h"
 
+#ifdef __SSE2__
+/* keep the compiler's _mm_malloc from clashing with MikMod's own */
+#define _MM_MALLOC_H_INCLUDED
+#define __MM_MALLOC_H
+#include <emmintrin.h>
+#endif
+
 #ifdef macintosh
 #define NO_64BIT_MIXER
 #endif
@@ -513,6 +520,56 @@ static void Mix32To16_Stereo(SWORD* dste,SLONG* srce,NATIVE count)
 	}
 }
 
+#if defined(__SSE2__) && (SAMPLING_SHIFT==2) && (MAXVOL_FACTOR==(1<<9))
+/* EXTRACT_SAMPLE and CHECK_SAMPLE on four samples: the division truncates
+   towards zero like C's, and packs saturates exactly as CHECK_SAMPLE clips */
+static __m128i Extract_SSE2(SLONG* srce)
+{
+	__m128i v=_mm_loadu_si128((__m128i*)srce);
+
+	v=_mm_srai_epi32(_mm_add_epi32(v,_mm_and_si128(_mm_srai_epi32(v,31),
+	                 _mm_set1_epi32(MAXVOL_FACTOR-1))),9);
+	v=_mm_packs_epi32(v,v);
+	return _mm_srai_epi32(_mm_unpacklo_epi16(v,v),16);
+}
+
+/* the sums of four samples over SAMPLING_FACTOR, which being unsigned makes
+   the C division round down rather than towards zero */
+#define Average_SSE2(sum) _mm_srai_epi32(sum,SAMPLING_SHIFT)
+
+static void Mix32To16_NormalSSE2(SWORD* dste,SLONG* srce,NATIVE count)
+{
+	__m128i a,b,c,d;
+
+	/* four output samples from sixteen oversampled ones */
+	for(;count>=16;count-=16,srce+=16,dste+=4) {
+		a=Extract_SSE2(srce);  b=Extract_SSE2(srce+4);
+		c=Extract_SSE2(srce+8);d=Extract_SSE2(srce+12);
+		a=_mm_add_epi32(_mm_unpacklo_epi32(a,b),_mm_unpackhi_epi32(a,b));
+		b=_mm_add_epi32(_mm_unpacklo_epi32(c,d),_mm_unpackhi_epi32(c,d));
+		a=Average_SSE2(_mm_add_epi32(_mm_unpacklo_epi64(a,b),
+		                             _mm_unpackhi_epi64(a,b)));
+		_mm_storel_epi64((__m128i*)dste,_mm_packs_epi32(a,a));
+	}
+	Mix32To16_Normal(dste,srce,count);
+}
+
+static void Mix32To16_StereoSSE2(SWORD* dste,SLONG* srce,NATIVE count)
+{
+	__m128i a,b;
+
+	/* two output frames from eight oversampled ones */
+	for(;count>=8;count-=8,srce+=16,dste+=4) {
+		a=_mm_add_epi32(Extract_SSE2(srce),Extract_SSE2(srce+4));
+		b=_mm_add_epi32(Extract_SSE2(srce+8),Extract_SSE2(srce+12));
+		a=Average_SSE2(_mm_add_epi32(_mm_unpacklo_epi64(a,b),
+		                             _mm_unpackhi_epi64(a,b)));
+		_mm_storel_epi64((__m128i*)dste,_mm_packs_epi32(a,a));
+	}
+	Mix32To16_Stereo(dste,srce,count);
+}
+#endif
+
 static void Mix32To8_Normal(SBYTE* dste,SLONG* srce,NATIVE count)
 {
 	NATIVE x1,x2,tmpx;
@@ -712,6 +769,18 @@ static void AddChannel(SLONG* ptr,NATIVE todo)
 #include "virtch_common.c"
 #undef _IN_VIRTCH_
 
+#ifdef __SSE2__
+static void MixReverb_NormalSSE2(SLONG* srce,NATIVE count)
+{
+	MixReverb_SSE2(srce,count,58+(md_reverb*4),0,MixReverb_Normal);
+}
+
+static void MixReverb_StereoSSE2(SLONG* srce,NATIVE count)
+{
+	MixReverb_SSE2(srce,count,58+(md_reverb*4),1,MixReverb_Stereo);
+}
+#endif
+
 void VC2_WriteSamples(SBYTE* buf,ULONG todo)
 {
 	int left,portion=0;
@@ -814,6 +883,21 @@ BOOL VC2_Init(void)
 		Mix32to8   = Mix32To8_Normal;
 		MixReverb  = MixReverb_Normal;
 	}
+#ifdef __SSE2__
+	if(md_mode & DMODE_SIMDMIXER) {
+		if(md_mode & DMODE_STEREO) {
+#if (SAMPLING_SHIFT==2) && (MAXVOL_FACTOR==(1<<9))
+			Mix32to16  = Mix32To16_StereoSSE2;
+#endif
+			MixReverb  = MixReverb_StereoSSE2;
+		} else {
+#if (SAMPLING_SHIFT==2) && (MAXVOL_FACTOR==(1<<9))
+			Mix32to16  = Mix32To16_NormalSSE2;
+#endif
+			MixReverb  = MixReverb_NormalSSE2;
+		}
+	}
+#endif
 	md_mode |= DMODE_INTERP;
 	vc_mode = md_mode;
 	return 0;
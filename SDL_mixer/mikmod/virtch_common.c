@@ -237,6 +237,105 @@ static ULONG bytes2samples(ULONG bytes)
 	return bytes;
 }
 
+#ifdef __SSE2__
+
+#define REVERB_BLOCK 512
+
+/* The low 32 bits of each product, which SSE2 has no instruction for */
+static __m128i MulLo_SSE2(__m128i a,__m128i b)
+{
+	__m128i even=_mm_mul_epu32(a,b);
+	__m128i odd=_mm_mul_epu32(_mm_srli_epi64(a,32),_mm_srli_epi64(b,32));
+
+	return _mm_unpacklo_epi32(_mm_shuffle_epi32(even,_MM_SHUFFLE(0,0,2,0)),
+	                          _mm_shuffle_epi32(odd,_MM_SHUFFLE(0,0,2,0)));
+}
+
+/* Runs one comb of the reverb over count frames of one channel. Each frame
+   writes the comb at loc and reads it back at loc+1 for the output, so as
+   long as count is less than the comb size every value read is from before
+   this block, and the frames can be done four at a time. */
+static void ReverbComb_SSE2(SLONG* buf,int size,SLONG* in,SLONG* out,
+                            int count,int pct,int sign)
+{
+	int loc=RVRindex%size,j=0,run;
+	__m128i p=_mm_set1_epi32(pct);
+
+	while(j<count) {
+		run=MIN(count-j,size-1-loc);
+		for(;run>=4;run-=4,j+=4,loc+=4) {
+			__m128i old=_mm_loadu_si128((__m128i*)(buf+loc));
+			__m128i next=_mm_loadu_si128((__m128i*)(buf+loc+1));
+			__m128i o=_mm_loadu_si128((__m128i*)(out+j));
+
+			_mm_storeu_si128((__m128i*)(buf+loc),
+			    _mm_add_epi32(_mm_loadu_si128((__m128i*)(in+j)),
+			                  _mm_srai_epi32(MulLo_SSE2(old,p),7)));
+			_mm_storeu_si128((__m128i*)(out+j),
+			    sign>0?_mm_add_epi32(o,next):_mm_sub_epi32(o,next));
+		}
+		for(;run;run--,j++,loc++) {
+			out[j]+=sign*buf[loc+1];
+			buf[loc]=in[j]+((pct*buf[loc])>>7);
+		}
+		if(j<count) {
+			/* the last slot of the comb, the output wraps to the first */
+			out[j]+=sign*buf[0];
+			buf[loc]=in[j]+((pct*buf[loc])>>7);
+			loc=0;
+			j++;
+		}
+	}
+}
+
+/* MixReverb for one or both channels, a block of frames at a time. Blocks
+   that would wrap RVRindex around, or combs too short to take a block, go
+   through the C reverb instead. */
+static void MixReverb_SSE2(SLONG* srce,NATIVE count,int pct,int stereo,
+                           void (*reverb)(SLONG*,NATIVE))
+{
+	SLONG in[REVERB_BLOCK],out[REVERB_BLOCK];
+	SLONG *combL[8],*combR[8],**comb;
+	int size[8];
+	int block,ch,n,t,step=stereo?2:1;
+
+	combL[0]=RVbufL1; combL[1]=RVbufL2; combL[2]=RVbufL3; combL[3]=RVbufL4;
+	combL[4]=RVbufL5; combL[5]=RVbufL6; combL[6]=RVbufL7; combL[7]=RVbufL8;
+	combR[0]=RVbufR1; combR[1]=RVbufR2; combR[2]=RVbufR3; combR[3]=RVbufR4;
+	combR[4]=RVbufR5; combR[5]=RVbufR6; combR[6]=RVbufR7; combR[7]=RVbufR8;
+	size[0]=RVc1; size[1]=RVc2; size[2]=RVc3; size[3]=RVc4;
+	size[4]=RVc5; size[5]=RVc6; size[6]=RVc7; size[7]=RVc8;
+
+	while(count) {
+		block=MIN(count,MIN(REVERB_BLOCK,RVc1-1));
+		if(block<1) {
+			reverb(srce,count);
+			return;
+		}
+		if((ULONG)(RVRindex+block)<RVRindex) {
+			reverb(srce,block);
+		} else {
+			for(ch=0;ch<step;ch++) {
+				comb=ch?combR:combL;
+				for(t=0;t<block;t++) {
+					in[t]=srce[t*step+ch]>>3;
+					out[t]=0;
+				}
+				for(n=0;n<8;n++)
+					ReverbComb_SSE2(comb[n],size[n],in,out,block,pct,
+					                (n&1)?-1:1);
+				for(t=0;t<block;t++)
+					srce[t*step+ch]+=out[t];
+			}
+			RVRindex+=block;
+		}
+		srce+=block*step;
+		count-=block;
+	}
+}
+
+#endif
+
 /* Fill the buffer with 'todo' bytes of silence (it depends on the mixing mode
    how the buffer is filled) */
 ULONG VC1_SilenceBytes(SBYTE* buf,ULONG todo)
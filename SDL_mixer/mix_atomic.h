@@ -0,0 +1,102 @@
+/*
+    SDL_mixer:  An audio mixer library based on the SDL library
+    Copyright (C) 1997-2009 Sam Lantinga
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Library General Public
+    License as published by the Free Software Foundation; either
+    version 2 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Library General Public License for more details.
+
+    You should have received a copy of the GNU Library General Public
+    License along with this library; if not, write to the Free
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+    Sam Lantinga
+    slouken@libsdl.org
+*/
+
+/* $Id$ */
+
+/* Atomic operations for the mixer's lock-free command queue and threads.
+   SDL doesn't export any, so these are the mixer's own.  If the compiler
+   doesn't provide them, MIX_ATOMIC_DISABLED is defined and the functions
+   are plain, non-atomic operations, so code using them must fall back to
+   locking the audio device or a mutex.
+ */
+
+#ifndef _MIX_ATOMIC_H_
+#define _MIX_ATOMIC_H_
+
+#include "SDL_stdinc.h"
+
+#if defined(__GNUC__) && \
+    ((__GNUC__ > 4) || (__GNUC__ == 4 && __GNUC_MINOR__ >= 1))
+
+#define _Mix_MemoryBarrier()	__sync_synchronize()
+
+static __inline__ SDL_bool _Mix_AtomicCAS(volatile int *a, int oldval, int newval)
+{
+	return __sync_bool_compare_and_swap(a, oldval, newval) ?
+		SDL_TRUE : SDL_FALSE;
+}
+
+static __inline__ int _Mix_AtomicAdd(volatile int *a, int value)
+{
+	return __sync_fetch_and_add(a, value);
+}
+
+#elif defined(_MSC_VER) && (_MSC_VER >= 1400)
+#include <intrin.h>
+
+static __inline__ void _Mix_MemoryBarrier(void)
+{
+	long barrier = 0;
+	_InterlockedExchange(&barrier, 0);
+}
+
+static __inline__ SDL_bool _Mix_AtomicCAS(volatile int *a, int oldval, int newval)
+{
+	return (_InterlockedCompareExchange((volatile long *)a, newval,
+					oldval) == oldval) ? SDL_TRUE : SDL_FALSE;
+}
+
+static __inline__ int _Mix_AtomicAdd(volatile int *a, int value)
+{
+	return _InterlockedExchangeAdd((volatile long *)a, value);
+}
+
+#else
+
+#define MIX_ATOMIC_DISABLED	1
+#define _Mix_MemoryBarrier()
+
+static __inline__ SDL_bool _Mix_AtomicCAS(volatile int *a, int oldval, int newval)
+{
+	if ( *a == oldval ) {
+		*a = newval;
+		return SDL_TRUE;
+	}
+	return SDL_FALSE;
+}
+
+static __inline__ int _Mix_AtomicAdd(volatile int *a, int value)
+{
+	int oldval = *a;
+	*a = oldval + value;
+	return oldval;
+}
+
+#endif
+
+/* Returns the current value of 'a' */
+static __inline__ int _Mix_AtomicGet(volatile int *a)
+{
+	return _Mix_AtomicAdd(a, 0);
+}
+
+#endif /* _MIX_ATOMIC_H_ */
@@ -27,6 +27,7 @@
 #include <string.h>
 
 #include "SDL_mutex.h"
+#include "SDL_thread.h"
 #include "SDL_endian.h"
 #include "SDL_timer.h"
 
@@ -35,10 +36,15 @@
 #include "load_voc.h"
 #include "load_ogg.h"
 #include "load_flac.h"
+#include "mix_atomic.h"
 
 #define __MIX_INTERNAL_EFFECT__
 #include "effects_internal.h"
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 /* Magic numbers for various audio file formats */
 #define RIFF		0x46464952		/* "RIFF" */
 #define WAVE		0x45564157		/* "WAVE" */
@@ -48,11 +54,13 @@
 #define FLAC		0x43614C66		/* "fLaC" */
 
 static int audio_opened = 0;
+static int audio_offline = 0;	/* mixed by Mix_RenderAudio() */
 static SDL_AudioSpec mixer;
 
 typedef struct _Mix_effectinfo
 {
 	Mix_EffectFunc_t callback;
+	Mix_EffectCopyFunc_t copy_callback;
 	Mix_EffectDone_t done_callback;
 	void *udata;
 	struct _Mix_effectinfo *next;
@@ -62,21 +70,83 @@ static struct _Mix_Channel {
 	Mix_Chunk *chunk;
 	int playing;
 	int paused;
+	Uint64 paused_at;	/* sample clock when it was paused */
 	Uint8 *samples;
 	int volume;
 	int looping;
 	int tag;
-	Uint32 expire;
+	Uint64 start;		/* sample clock to start at */
+	Uint64 expire;		/* sample clock to stop at, or 0 */
 	Uint32 start_time;
 	Mix_Fading fading;
-	int fade_volume;
-	Uint32 fade_length;
-	Uint32 ticks_fade;
+	float fade_gain;	/* gain when the fade started */
+	Uint32 fade_length;	/* in sample frames */
+	Uint32 fade_pos;
 	effect_info *effects;
+	volatile int pending;	/* see mix_mark_channel() */
 } *mix_channel = NULL;
 
 static effect_info *posteffects = NULL;
 
+/* Channel effects work on a copy of the chunk data in this buffer, which is
+   big enough for a whole audio callback.  Channels are mixed one at a time,
+   so they can all share it. */
+static Uint8 *effect_buf = NULL;
+static int effect_buf_len = 0;
+
+/* The mix bus: channels are summed here with 32 bits of headroom and then
+   clamped into the stream once, instead of SDL_MixAudio() clamping after
+   every channel.  Only used with 8 and 16 bit device formats. */
+static Sint32 *mix_bus = NULL;
+static int mix_bus_samples = 0;
+static enum {
+	MIX_BUS_OFF,		/* mixing straight into the stream */
+	MIX_BUS_EMPTY,		/* no channels mixed yet */
+	MIX_BUS_FILLED		/* holds the stream plus the channels so far */
+} mix_bus_state = MIX_BUS_OFF;
+
+/* Commands from the application are queued here and carried out at the
+   start of the next audio callback, so playing and stopping sounds never
+   has to wait for the mixer.  Each slot has a sequence number that says
+   whether it's free or filled in, and whoever holds the audio lock takes
+   the commands in order. */
+typedef enum {
+	MIX_COMMAND_PLAY,
+	MIX_COMMAND_FADEIN,
+	MIX_COMMAND_HALT,
+	MIX_COMMAND_FADEOUT,
+	MIX_COMMAND_EXPIRE,
+	MIX_COMMAND_VOLUME
+} mix_command_type;
+
+typedef struct {
+	mix_command_type type;
+	int channel;
+	Mix_Chunk *chunk;
+	int loops;
+	int ms;
+	int ticks;
+	int volume;
+	Uint64 start;		/* sample clock to start playing at */
+	Uint32 time;		/* SDL_GetTicks() when it was sent */
+	int marked;		/* counted in the channel's pending field */
+} mix_command;
+
+typedef struct {
+	volatile int sequence;
+	mix_command command;
+} mix_command_slot;
+
+#define MIX_COMMAND_QUEUE_SIZE	1024	/* must be a power of two */
+
+static mix_command_slot *mix_commands = NULL;
+static volatile int mix_command_post = 0;
+static int mix_command_take = 0;
+
+/* Sample frames mixed since the audio device was opened */
+static Uint64 mix_sample_clock = 0;
+static int mix_frame_size;
+
 static int num_channels;
 static int reserved_channels = 0;
 
@@ -91,6 +161,7 @@ static void (*channel_done_callback)(int channel) = NULL;
 /* Music function declarations */
 extern int open_music(SDL_AudioSpec *mixer);
 extern void close_music(void);
+extern void music_wait_decoder(int len);
 
 /* Support for user defined music functions, plus the default one */
 extern int volatile music_active;
@@ -127,6 +198,249 @@ static void _Mix_channel_done_playing(int channel)
 	_Mix_remove_all_effects(channel, &mix_channel[channel].effects);
 }
 
+/* Convert milliseconds to sample frames at the output rate */
+static Uint64 mix_ms_to_frames(int ms)
+{
+	return(((Uint64)ms * mixer.freq) / 1000);
+}
+
+/* The gain a channel's fade has got to */
+static float mix_fade_gain(const struct _Mix_Channel *channel)
+{
+	float target;
+
+	if ( channel->fading == MIX_NO_FADING || channel->fade_length == 0 ) {
+		return(1.0f);
+	}
+	target = (channel->fading == MIX_FADING_IN) ? 1.0f : 0.0f;
+	return(channel->fade_gain + (target - channel->fade_gain) *
+	       ((float)channel->fade_pos / channel->fade_length));
+}
+
+/* Is the channel playing right now, whatever is queued for it? */
+static int mix_channel_playing(int which)
+{
+	return((mix_channel[which].playing > 0) || (mix_channel[which].looping > 0));
+}
+
+/*
+ * A channel's pending field counts the play and halt commands queued for
+ *  it (in steps of two) and says in its lowest bit whether the channel
+ *  will be playing once they're carried out, so that Mix_Playing() and
+ *  finding a free channel see the commands straight away.
+ */
+static void mix_mark_channel(int which, int playing)
+{
+	int pending, marked;
+
+	do {
+		pending = _Mix_AtomicGet(&mix_channel[which].pending);
+		marked = (pending & ~1) + 2;
+		if ( playing ) {
+			marked |= 1;
+		}
+	} while ( !_Mix_AtomicCAS(&mix_channel[which].pending, pending, marked) );
+}
+
+/* Will the channel be playing once its queued commands are carried out? */
+static int mix_channel_will_play(int which)
+{
+	int pending = _Mix_AtomicGet(&mix_channel[which].pending);
+
+	if ( pending >> 1 ) {
+		return(pending & 1);
+	}
+	return(mix_channel_playing(which));
+}
+
+/* Find a free channel and mark it as playing, or return -1 */
+static int mix_claim_channel(void)
+{
+	int i, pending;
+
+	for ( i=reserved_channels; i<num_channels; ++i ) {
+		for ( ;; ) {
+			pending = _Mix_AtomicGet(&mix_channel[i].pending);
+			if ( (pending >> 1) ? (pending & 1) : (mix_channel[i].playing > 0) ) {
+				break;
+			}
+			if ( _Mix_AtomicCAS(&mix_channel[i].pending, pending, (pending & ~1) + 3) ) {
+				return(i);
+			}
+		}
+	}
+	return(-1);
+}
+
+/* Add a command to the queue, returns 0 if it's full */
+static int mix_post_command(const mix_command *command)
+{
+	const unsigned int mask = MIX_COMMAND_QUEUE_SIZE - 1;
+	mix_command_slot *slot;
+	int pos, diff;
+
+	pos = _Mix_AtomicGet(&mix_command_post);
+	for ( ;; ) {
+		slot = &mix_commands[pos & mask];
+		diff = (int) ((unsigned int) _Mix_AtomicGet(&slot->sequence) -
+		              (unsigned int) pos);
+		if ( diff == 0 ) {
+			if ( _Mix_AtomicCAS(&mix_command_post, pos,
+			                    (int) ((unsigned int) pos + 1)) ) {
+				break;
+			}
+		} else if ( diff < 0 ) {
+			return(0);
+		}
+		pos = _Mix_AtomicGet(&mix_command_post);
+	}
+
+	slot->command = *command;
+	_Mix_MemoryBarrier();
+	slot->sequence = (int) ((unsigned int) pos + 1);
+	return(1);
+}
+
+/*
+ * Carry out a command.
+ *  MAKE SURE SDL_LockAudio() is called before this (or you're in the
+ *   audio callback).
+ */
+static void mix_run_command(const mix_command *command)
+{
+	int which = command->channel;
+	struct _Mix_Channel *channel;
+
+	if ( which >= num_channels ) {
+		return;
+	}
+	switch (command->type) {
+	    case MIX_COMMAND_PLAY:
+	    case MIX_COMMAND_FADEIN:
+		channel = &mix_channel[which];
+		if ( mix_channel_playing(which) )
+			_Mix_channel_done_playing(which);
+		channel->samples = command->chunk->abuf;
+		channel->playing = command->chunk->alen;
+		channel->looping = command->loops;
+		channel->chunk = command->chunk;
+		channel->paused = 0;
+		channel->start_time = command->time;
+		channel->start = command->start;
+		if ( channel->start < mix_sample_clock ) {
+			channel->start = mix_sample_clock;
+		}
+		channel->expire = (command->ticks > 0) ? (channel->start + mix_ms_to_frames(command->ticks)) : 0;
+		channel->fading = MIX_NO_FADING;
+		if ( command->type == MIX_COMMAND_FADEIN && command->ms > 0 ) {
+			channel->fading = MIX_FADING_IN;
+			channel->fade_gain = 0.0f;
+			channel->fade_length = (Uint32)mix_ms_to_frames(command->ms);
+			channel->fade_pos = 0;
+		}
+		break;
+
+	    case MIX_COMMAND_HALT:
+		channel = &mix_channel[which];
+		if (channel->playing) {
+			_Mix_channel_done_playing(which);
+			channel->playing = 0;
+		}
+		channel->expire = 0;
+		channel->fading = MIX_NO_FADING;
+		break;
+
+	    case MIX_COMMAND_FADEOUT:
+		channel = &mix_channel[which];
+		if ( channel->playing && (channel->volume > 0) &&
+		     (channel->fading != MIX_FADING_OUT) ) {
+			channel->fade_gain = mix_fade_gain(channel);
+			channel->fading = MIX_FADING_OUT;
+			channel->fade_length = (Uint32)mix_ms_to_frames(command->ms);
+			channel->fade_pos = 0;
+		}
+		break;
+
+	    case MIX_COMMAND_EXPIRE:
+		mix_channel[which].expire = (command->ticks > 0) ? (mix_sample_clock + mix_ms_to_frames(command->ticks)) : 0;
+		break;
+
+	    case MIX_COMMAND_VOLUME:
+		mix_channel[which].volume = command->volume;
+		break;
+	}
+
+	if ( command->marked ) {
+		_Mix_AtomicAdd(&mix_channel[which].pending, -2);
+	}
+}
+
+/*
+ * Carry out the queued commands, in the order they were sent.
+ *  MAKE SURE SDL_LockAudio() is called before this (or you're in the
+ *   audio callback).
+ */
+static void mix_take_commands(void)
+{
+	const unsigned int mask = MIX_COMMAND_QUEUE_SIZE - 1;
+	mix_command command;
+
+	if ( !mix_commands ) {
+		return;
+	}
+	for ( ;; ) {
+		int pos = mix_command_take;
+		mix_command_slot *slot = &mix_commands[pos & mask];
+
+		if ( _Mix_AtomicGet(&slot->sequence) != (int) ((unsigned int) pos + 1) ) {
+			break;
+		}
+		command = slot->command;
+		_Mix_MemoryBarrier();
+		slot->sequence = (int) ((unsigned int) pos + mask + 1);
+		mix_command_take = (int) ((unsigned int) pos + 1);
+		mix_run_command(&command);
+	}
+}
+
+/* Send a command to the mixer, or carry it out right away if the queue
+   is turned off or full */
+static void mix_send_command(mix_command *command)
+{
+	command->time = SDL_GetTicks();
+	if ( mix_commands && mix_post_command(command) ) {
+		return;
+	}
+	SDL_LockAudio();
+	mix_take_commands();
+	mix_run_command(command);
+	SDL_UnlockAudio();
+}
+
+/* Carry out any play or halt commands still queued for a channel (or for
+   all of them if 'channel' is -1), so that changes made to it directly
+   come after them */
+void _Mix_SyncChannel(int channel)
+{
+	int i, pending = 0;
+
+	if ( !mix_commands ) {
+		return;
+	}
+	if ( channel == -1 ) {
+		for ( i=0; i<num_channels && !pending; ++i ) {
+			pending = _Mix_AtomicGet(&mix_channel[i].pending) >> 1;
+		}
+	} else if ( (channel >= 0) && (channel < num_channels) ) {
+		pending = _Mix_AtomicGet(&mix_channel[channel].pending) >> 1;
+	}
+	if ( pending ) {
+		SDL_LockAudio();
+		mix_take_commands();
+		SDL_UnlockAudio();
+	}
+}
+
 
 static void *Mix_DoEffects(int chan, void *snd, int len)
 {
@@ -137,11 +451,22 @@ static void *Mix_DoEffects(int chan, void *snd, int len)
 	if (e != NULL) {    /* are there any registered effects? */
 		/* if this is the postmix, we can just overwrite the original. */
 		if (!posteffect) {
-			buf = malloc(len);
-			if (buf == NULL) {
-				return(snd);
+			if (len <= effect_buf_len) {
+				buf = effect_buf;
+			} else {
+				buf = malloc(len);
+				if (buf == NULL) {
+					return(snd);
+				}
+			}
+
+			/* the first effect can copy the data as it works on it */
+			if (e->copy_callback != NULL) {
+				e->copy_callback(chan, snd, buf, len, e->udata);
+				e = e->next;
+			} else {
+				memcpy(buf, snd, len);
 			}
-		    memcpy(buf, snd, len);
 		}
 
 		for (; e != NULL; e = e->next) {
@@ -151,117 +476,417 @@ static void *Mix_DoEffects(int chan, void *snd, int len)
 		}
 	}
 
-	/* be sure to free() the return value if != snd ... */
+	/* be sure to call Mix_DoneEffects() with the return value... */
 	return(buf);
 }
 
+static void Mix_DoneEffects(void *buf, void *snd)
+{
+	if (buf != snd && buf != effect_buf) {
+		free(buf);
+	}
+}
+
+
+/* Load the stream, which already holds the music, into the mix bus */
+static void mix_bus_load(const Uint8 *stream, int samples)
+{
+	Sint32 *bus = mix_bus;
+	int i;
+
+	switch (mixer.format) {
+	    case AUDIO_U8:
+		for ( i=0; i<samples; ++i ) {
+			bus[i] = (Sint32)stream[i] - 128;
+		}
+		break;
+	    case AUDIO_S8:
+		for ( i=0; i<samples; ++i ) {
+			bus[i] = ((const Sint8 *)stream)[i];
+		}
+		break;
+	    case AUDIO_S16SYS:
+		for ( i=0; i<samples; ++i ) {
+			bus[i] = ((const Sint16 *)stream)[i];
+		}
+		break;
+	    default:
+		for ( i=0; i<samples; ++i ) {
+			bus[i] = (Sint16)SDL_Swap16(((const Uint16 *)stream)[i]);
+		}
+		break;
+	}
+}
+
+/* Add 'samples' samples of 16 bit audio at 'volume' to the mix bus.
+   Each sample is scaled by volume/128, as SDL_MixAudio() does. */
+static void mix_bus_add_s16(Sint32 *bus, const Sint16 *src, int samples, int volume)
+{
+#ifdef __SSE2__
+	const __m128i vol = _mm_set1_epi16((short)volume);
+
+	for ( ; samples >= 8; samples -= 8 ) {
+		__m128i s = _mm_loadu_si128((const __m128i *)src);
+		__m128i lo = _mm_mullo_epi16(s, vol);
+		__m128i hi = _mm_mulhi_epi16(s, vol);
+		__m128i a = _mm_loadu_si128((__m128i *)bus);
+		__m128i b = _mm_loadu_si128((__m128i *)(bus+4));
+		a = _mm_add_epi32(a, _mm_srai_epi32(_mm_unpacklo_epi16(lo, hi), 7));
+		b = _mm_add_epi32(b, _mm_srai_epi32(_mm_unpackhi_epi16(lo, hi), 7));
+		_mm_storeu_si128((__m128i *)bus, a);
+		_mm_storeu_si128((__m128i *)(bus+4), b);
+		src += 8;
+		bus += 8;
+	}
+#endif
+	while ( samples-- ) {
+		*bus++ += ((Sint32)*src++ * volume) >> 7;
+	}
+}
+
+static void mix_bus_add(int index, const Uint8 *src, int len, int volume)
+{
+	Sint32 *bus = mix_bus + index / ((mixer.format & 0xFF) / 8);
+	int i;
+
+	switch (mixer.format) {
+	    case AUDIO_U8:
+		for ( i=0; i<len; ++i ) {
+			bus[i] += (((Sint32)src[i] - 128) * volume) >> 7;
+		}
+		break;
+	    case AUDIO_S8:
+		for ( i=0; i<len; ++i ) {
+			bus[i] += ((Sint32)((const Sint8 *)src)[i] * volume) >> 7;
+		}
+		break;
+	    case AUDIO_S16SYS:
+		mix_bus_add_s16(bus, (const Sint16 *)src, len/2, volume);
+		break;
+	    default:
+		for ( i=0; i<len/2; ++i ) {
+			Sint32 sample = (Sint16)SDL_Swap16(((const Uint16 *)src)[i]);
+			bus[i] += (sample * volume) >> 7;
+		}
+		break;
+	}
+}
+
+/* Clamp the mix bus into the stream */
+static void mix_bus_store(Uint8 *stream, int samples)
+{
+	const Sint32 *bus = mix_bus;
+	int i;
+
+	switch (mixer.format) {
+	    case AUDIO_U8:
+	    case AUDIO_S8:
+		for ( i=0; i<samples; ++i ) {
+			Sint32 sample = bus[i];
+			if ( sample > 127 ) {
+				sample = 127;
+			} else if ( sample < -128 ) {
+				sample = -128;
+			}
+			stream[i] = (Uint8)(mixer.format == AUDIO_U8 ? sample + 128 : sample);
+		}
+		break;
+	    case AUDIO_S16SYS:
+		i = 0;
+#ifdef __SSE2__
+		for ( ; i+8 <= samples; i += 8 ) {
+			__m128i a = _mm_loadu_si128((const __m128i *)(bus+i));
+			__m128i b = _mm_loadu_si128((const __m128i *)(bus+i+4));
+			_mm_storeu_si128((__m128i *)(stream+i*2), _mm_packs_epi32(a, b));
+		}
+#endif
+		for ( ; i<samples; ++i ) {
+			Sint32 sample = bus[i];
+			if ( sample > 32767 ) {
+				sample = 32767;
+			} else if ( sample < -32768 ) {
+				sample = -32768;
+			}
+			((Sint16 *)stream)[i] = (Sint16)sample;
+		}
+		break;
+	    default:
+		for ( i=0; i<samples; ++i ) {
+			Sint32 sample = bus[i];
+			if ( sample > 32767 ) {
+				sample = 32767;
+			} else if ( sample < -32768 ) {
+				sample = -32768;
+			}
+			((Uint16 *)stream)[i] = SDL_Swap16((Uint16)sample);
+		}
+		break;
+	}
+}
+
+/* Mix a block of channel data into the 'len' byte stream at 'index' */
+static void mix_channel_data(Uint8 *stream, int len, int index, Uint8 *data, int mixable, int volume)
+{
+	if ( mix_bus_state == MIX_BUS_OFF ) {
+		SDL_MixAudio(stream+index, data, mixable, volume);
+		return;
+	}
+	if ( volume == 0 ) {
+		return;
+	}
+	if ( mix_bus_state == MIX_BUS_EMPTY ) {
+		mix_bus_load(stream, len / ((mixer.format & 0xFF) / 8));
+		mix_bus_state = MIX_BUS_FILLED;
+	}
+	mix_bus_add(index, data, mixable, volume);
+}
+
+#define RAMP_GAIN(g)	((g) < 0.0f ? 0.0f : ((g) > 1.0f ? 1.0f : (g)))
+
+/*
+ * Scale 'len' bytes of audio by a gain that starts at 'gain' and changes
+ *  by 'step' every sample frame, staying between 0 and 1.  This is how
+ *  channels and music fade in and out.  Returns 0 if the format isn't
+ *  supported.
+ */
+int _Mix_RampAudio(Uint8 *buf, int len, Uint16 format, int channels,
+					float gain, float step)
+{
+	int i, c, frames;
+	float g;
+
+	switch (format) {
+	    case AUDIO_U8:
+		frames = len / channels;
+		for ( i=0; i<frames; ++i ) {
+			g = RAMP_GAIN(gain + step * i);
+			for ( c=0; c<channels; ++c, ++buf ) {
+				*buf = (Uint8)(((int)*buf - 128) * g + 128.0f);
+			}
+		}
+		break;
+	    case AUDIO_S8: {
+		Sint8 *p = (Sint8 *)buf;
+		frames = len / channels;
+		for ( i=0; i<frames; ++i ) {
+			g = RAMP_GAIN(gain + step * i);
+			for ( c=0; c<channels; ++c, ++p ) {
+				*p = (Sint8)(*p * g);
+			}
+		}
+		break;
+	    }
+	    case AUDIO_S16SYS: {
+		Sint16 *p = (Sint16 *)buf;
+		frames = len / (channels * 2);
+		for ( i=0; i<frames; ++i ) {
+			g = RAMP_GAIN(gain + step * i);
+			for ( c=0; c<channels; ++c, ++p ) {
+				*p = (Sint16)(*p * g);
+			}
+		}
+		break;
+	    }
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+	    case AUDIO_S16MSB: {
+#else
+	    case AUDIO_S16LSB: {
+#endif
+		Uint16 *p = (Uint16 *)buf;
+		frames = len / (channels * 2);
+		for ( i=0; i<frames; ++i ) {
+			g = RAMP_GAIN(gain + step * i);
+			for ( c=0; c<channels; ++c, ++p ) {
+				*p = SDL_Swap16((Uint16)(Sint16)((Sint16)SDL_Swap16(*p) * g));
+			}
+		}
+		break;
+	    }
+#ifdef AUDIO_F32SYS
+	    case AUDIO_S32SYS: {
+		Sint32 *p = (Sint32 *)buf;
+		frames = len / (channels * 4);
+		for ( i=0; i<frames; ++i ) {
+			double dg = RAMP_GAIN(gain + step * i);
+			for ( c=0; c<channels; ++c, ++p ) {
+				*p = (Sint32)(*p * dg);
+			}
+		}
+		break;
+	    }
+	    case AUDIO_F32SYS: {
+		float *p = (float *)buf;
+		frames = len / (channels * 4);
+		for ( i=0; i<frames; ++i ) {
+			g = RAMP_GAIN(gain + step * i);
+			for ( c=0; c<channels; ++c, ++p ) {
+				*p *= g;
+			}
+		}
+		break;
+	    }
+#endif
+	    default:
+		return(0);
+	}
+	return(1);
+}
+
+/* Run the effects on a block of a channel and mix it into the stream */
+static void mix_channel_block(int which, Uint8 *stream, int len, int index,
+						Uint8 *data, int mixable)
+{
+	struct _Mix_Channel *channel = &mix_channel[which];
+	int volume = (channel->volume*channel->chunk->volume) / MIX_MAX_VOLUME;
+	Uint8 *mix_input;
+
+	mix_input = Mix_DoEffects(which, data, mixable);
+
+	if ( channel->fading != MIX_NO_FADING ) {
+		/* Fade a sample frame at a time, on a copy of the data */
+		int frames = mixable / mix_frame_size;
+		float gain = mix_fade_gain(channel);
+		float target = (channel->fading == MIX_FADING_IN) ? 1.0f : 0.0f;
+		float step = channel->fade_length ?
+			(target - channel->fade_gain) / channel->fade_length : 0.0f;
+
+		if ( mix_input == data ) {
+			if ( mixable <= effect_buf_len ) {
+				mix_input = effect_buf;
+			} else {
+				mix_input = (Uint8 *)malloc(mixable);
+			}
+			if ( mix_input != NULL ) {
+				memcpy(mix_input, data, mixable);
+			}
+		}
+		if ( mix_input == NULL ) {
+			mix_input = data;
+			volume = (int)(volume * gain);
+		} else if ( !_Mix_RampAudio(mix_input, mixable, mixer.format,
+		                            mixer.channels, gain, step) ) {
+			volume = (int)(volume * RAMP_GAIN(gain + step * frames / 2));
+		}
+
+		channel->fade_pos += frames;
+		if ( channel->fade_pos >= channel->fade_length &&
+		     channel->fading == MIX_FADING_IN ) {
+			channel->fading = MIX_NO_FADING;
+		}
+	}
+
+	mix_channel_data(stream, len, index, mix_input, mixable, volume);
+	Mix_DoneEffects(mix_input, data);
+}
+
+/* Mix whatever part of this callback a channel plays in */
+static void mix_channel_stream(int which, Uint8 *stream, int len)
+{
+	struct _Mix_Channel *channel = &mix_channel[which];
+	Uint64 end = mix_sample_clock + len / mix_frame_size;
+	int index = 0, stop = len, ending = 0, mixable;
+
+	/* Wait until it's time to start */
+	if ( channel->start >= end ) {
+		return;
+	}
+	if ( channel->start > mix_sample_clock ) {
+		index = (int)(channel->start - mix_sample_clock) * mix_frame_size;
+	}
+
+	/* Stop where it expires or finishes fading out */
+	if ( channel->expire > 0 && channel->expire <= end ) {
+		stop = 0;
+		if ( channel->expire > mix_sample_clock ) {
+			stop = (int)(channel->expire - mix_sample_clock) * mix_frame_size;
+		}
+		ending = 1;
+	}
+	if ( channel->fading == MIX_FADING_OUT ) {
+		Uint64 left = (Uint64)(channel->fade_length - channel->fade_pos) * mix_frame_size;
+		if ( index + left <= (Uint64)stop ) {
+			stop = index + (int)left;
+			ending = 1;
+		}
+	}
+
+	while ( channel->playing > 0 && index < stop ) {
+		mixable = channel->playing;
+		if ( mixable > stop - index ) {
+			mixable = stop - index;
+		}
+		mix_channel_block(which, stream, len, index, channel->samples, mixable);
+		channel->samples += mixable;
+		channel->playing -= mixable;
+		index += mixable;
+
+		if ( !channel->playing ) {
+			if ( channel->looping ) {
+				/* Go round again, filling the rest of the buffer */
+				--channel->looping;
+				channel->samples = channel->chunk->abuf;
+				channel->playing = channel->chunk->alen;
+			} else {
+				/* rcg06072001 Alert app if channel is done playing. */
+				_Mix_channel_done_playing(which);
+			}
+		}
+	}
+
+	if ( ending && channel->playing > 0 ) {
+		/* Expired, or faded out */
+		channel->playing = 0;
+		channel->looping = 0;
+		channel->fading = MIX_NO_FADING;
+		channel->expire = 0;
+		_Mix_channel_done_playing(which);
+	}
+}
 
 /* Mixing function */
 static void mix_channels(void *udata, Uint8 *stream, int len)
 {
-	Uint8 *mix_input;
-	int i, mixable, volume = SDL_MIX_MAXVOLUME;
-	Uint32 sdl_ticks;
+	int i;
 
 #if SDL_VERSION_ATLEAST(1, 3, 0)
 	/* Need to initialize the stream in SDL 1.3+ */
 	memset(stream, mixer.silence, len);
 #endif
 
+	/* Start and stop the channels as the application asked */
+	mix_take_commands();
+
 	/* Mix the music (must be done before the channels are added) */
 	if ( music_active || (mix_music != music_mixer) ) {
 		mix_music(music_data, stream, len);
 	}
 
+	/* Sum the channels on the mix bus if the stream fits on it */
+	if ( mix_bus && len <= mix_bus_samples * ((mixer.format & 0xFF) / 8) ) {
+		mix_bus_state = MIX_BUS_EMPTY;
+	} else {
+		mix_bus_state = MIX_BUS_OFF;
+	}
+
 	/* Mix any playing channels... */
-	sdl_ticks = SDL_GetTicks();
 	for ( i=0; i<num_channels; ++i ) {
-		if( ! mix_channel[i].paused ) {
-			if ( mix_channel[i].expire > 0 && mix_channel[i].expire < sdl_ticks ) {
-				/* Expiration delay for that channel is reached */
-				mix_channel[i].playing = 0;
-				mix_channel[i].fading = MIX_NO_FADING;
-				mix_channel[i].expire = 0;
-				_Mix_channel_done_playing(i);
-			} else if ( mix_channel[i].fading != MIX_NO_FADING ) {
-				Uint32 ticks = sdl_ticks - mix_channel[i].ticks_fade;
-				if( ticks > mix_channel[i].fade_length ) {
-				    Mix_Volume(i, mix_channel[i].fade_volume); /* Restore the volume */
-					if( mix_channel[i].fading == MIX_FADING_OUT ) {
-						mix_channel[i].playing = 0;
-						mix_channel[i].expire = 0;
-						_Mix_channel_done_playing(i);
-					}
-					mix_channel[i].fading = MIX_NO_FADING;
-				} else {
-					if( mix_channel[i].fading == MIX_FADING_OUT ) {
-						Mix_Volume(i, (mix_channel[i].fade_volume * (mix_channel[i].fade_length-ticks))
-								   / mix_channel[i].fade_length );
-					} else {
-						Mix_Volume(i, (mix_channel[i].fade_volume * ticks) / mix_channel[i].fade_length );
-					}
-				}
-			}
-			if ( mix_channel[i].playing > 0 ) {
-				int index = 0;
-				int remaining = len;
-				while (mix_channel[i].playing > 0 && index < len) {
-					remaining = len - index;
-					volume = (mix_channel[i].volume*mix_channel[i].chunk->volume) / MIX_MAX_VOLUME;
-					mixable = mix_channel[i].playing;
-					if ( mixable > remaining ) {
-						mixable = remaining;
-					}
-
-					mix_input = Mix_DoEffects(i, mix_channel[i].samples, mixable);
-					SDL_MixAudio(stream+index,mix_input,mixable,volume);
-					if (mix_input != mix_channel[i].samples)
-						free(mix_input);
-
-					mix_channel[i].samples += mixable;
-					mix_channel[i].playing -= mixable;
-					index += mixable;
-
-					/* rcg06072001 Alert app if channel is done playing. */
-					if (!mix_channel[i].playing && !mix_channel[i].looping) {
-						_Mix_channel_done_playing(i);
-					}
-				}
-
-				/* If looping the sample and we are at its end, make sure
-				   we will still return a full buffer */
-				while ( mix_channel[i].looping && index < len ) {
-					int alen = mix_channel[i].chunk->alen;
-					remaining = len - index;
-					if (remaining > alen) {
-						remaining = alen;
-					}
-
-					mix_input = Mix_DoEffects(i, mix_channel[i].chunk->abuf, remaining);
-					SDL_MixAudio(stream+index, mix_input, remaining, volume);
-					if (mix_input != mix_channel[i].chunk->abuf)
-						free(mix_input);
-
-					--mix_channel[i].looping;
-					mix_channel[i].samples = mix_channel[i].chunk->abuf + remaining;
-					mix_channel[i].playing = mix_channel[i].chunk->alen - remaining;
-					index += remaining;
-				}
-				if ( ! mix_channel[i].playing && mix_channel[i].looping ) {
-					--mix_channel[i].looping;
-					mix_channel[i].samples = mix_channel[i].chunk->abuf;
-					mix_channel[i].playing = mix_channel[i].chunk->alen;
-				}
-			}
+		if ( !mix_channel[i].paused && mix_channel[i].playing > 0 ) {
+			mix_channel_stream(i, stream, len);
 		}
 	}
 
+	if ( mix_bus_state == MIX_BUS_FILLED ) {
+		mix_bus_store(stream, len / ((mixer.format & 0xFF) / 8));
+	}
+
 	/* rcg06122001 run posteffects... */
 	Mix_DoEffects(MIX_CHANNEL_POST, stream, len);
 
 	if ( mix_postmix ) {
 		mix_postmix(mix_postmix_data, stream, len);
 	}
+
+	mix_sample_clock += len / mix_frame_size;
 }
 
 #if 0
@@ -275,15 +900,89 @@ static void PrintFormat(char *title, SDL_AudioSpec *fmt)
 #endif
 
 
+/* When MIX_SHAREDCHUNKS is set, loaded chunks that were decoded from the
+   same data share their samples.  They're looked up by a hash of the
+   encoded data and the format they were converted to, checked against a
+   copy of the data, and freed along with the last chunk using them.  Only
+   data that's already in memory is hashed, like the mapped files
+   Mix_LoadWAV() uses, since anything else would have to be read twice. */
+typedef struct _Mix_SharedSamples {
+	Uint64 key;		/* hash of the encoded data */
+	Uint8 *data;		/* copy of the encoded data */
+	Uint32 size;		/* length of the encoded data */
+	Uint16 format;		/* format the samples were converted to */
+	int channels;
+	int freq;
+	Uint8 *abuf;
+	Uint32 alen;
+	int refcount;
+	struct _Mix_SharedSamples *next;
+} shared_samples;
+
+static shared_samples *shared_chunks = NULL;
+static int share_chunks = 0;
+static char *chunk_cache = NULL;	/* directory of converted samples */
+
+/* Chunks can also be loaded in the background.  The loads are queued and
+   done in order by a single loader thread, which is started by the first
+   one and stopped when the audio device is closed. */
+struct _Mix_ChunkLoad {
+	SDL_RWops *src;
+	int freesrc;
+	Mix_Chunk *chunk;
+	char *error;
+	int done;
+	struct _Mix_ChunkLoad *next;
+};
+
+static Mix_ChunkLoad *loads_first = NULL;
+static Mix_ChunkLoad *loads_last = NULL;
+static SDL_Thread *loader = NULL;
+static int loader_quit = 0;
+static SDL_mutex *loader_lock = NULL;	/* also protects the caches */
+static SDL_cond *loader_cond = NULL;
+
+static void mix_init_loader(void)
+{
+	if ( loader_lock == NULL ) {
+		loader_lock = SDL_CreateMutex();
+		loader_cond = SDL_CreateCond();
+		if ( loader_cond == NULL ) {
+			SDL_DestroyMutex(loader_lock);
+			loader_lock = NULL;
+		}
+	}
+}
+
+/* Waits for the sound being loaded, and fails the rest */
+static void mix_stop_loader(void)
+{
+	SDL_Thread *thread;
+
+	if ( loader_lock ) {
+		SDL_mutexP(loader_lock);
+		loader_quit = 1;
+		SDL_CondBroadcast(loader_cond);
+		thread = loader;
+		loader = NULL;
+		SDL_mutexV(loader_lock);
+		if ( thread ) {
+			SDL_WaitThread(thread, NULL);
+		}
+		loader_quit = 0;
+	}
+}
+
 /* Open the mixer with a certain desired audio format */
-int Mix_OpenAudio(int frequency, Uint16 format, int nchannels, int chunksize)
+static int open_audio(int frequency, Uint16 format, int nchannels, int chunksize, int offline)
 {
 	int i;
 	SDL_AudioSpec desired;
 
 	/* If the mixer is already opened, increment open count */
 	if ( audio_opened ) {
-		if ( format == mixer.format && nchannels == mixer.channels ) {
+		if ( format == mixer.format && nchannels == mixer.channels &&
+		     offline == audio_offline ) {
 	    	++audio_opened;
 	    	return(0);
 		}
@@ -314,6 +1013,12 @@ int Mix_OpenAudio(int frequency, Uint16 format, int nchannels, int chunksize)
 		return(-1);
 	}
 
+	mix_frame_size = ((mixer.format & 0xFF) / 8) * mixer.channels;
+	mix_sample_clock = 0;
+
+	mix_init_loader();
+	share_chunks = (getenv(MIX_SHAREDCHUNKS) != NULL);
+
 	num_channels = MIX_CHANNELS;
 	mix_channel = (struct _Mix_Channel *) malloc(num_channels * sizeof(struct _Mix_Channel));
 
@@ -323,22 +1028,96 @@ int Mix_OpenAudio(int frequency, Uint16 format, int nchannels, int chunksize)
 		mix_channel[i].playing = 0;
 		mix_channel[i].looping = 0;
 		mix_channel[i].volume = SDL_MIX_MAXVOLUME;
-		mix_channel[i].fade_volume = SDL_MIX_MAXVOLUME;
 		mix_channel[i].fading = MIX_NO_FADING;
 		mix_channel[i].tag = -1;
+		mix_channel[i].start = 0;
 		mix_channel[i].expire = 0;
 		mix_channel[i].effects = NULL;
 		mix_channel[i].paused = 0;
+		mix_channel[i].pending = 0;
 	}
 	Mix_VolumeMusic(SDL_MIX_MAXVOLUME);
 
+	/* Set up the mix bus, unless the application wants the old behaviour */
+	switch (mixer.format) {
+	    case AUDIO_U8:
+	    case AUDIO_S8:
+	    case AUDIO_S16LSB:
+	    case AUDIO_S16MSB:
+		if ( getenv(MIX_NOMIXBUS) == NULL ) {
+			mix_bus_samples = mixer.size / ((mixer.format & 0xFF) / 8);
+			mix_bus = (Sint32 *) malloc(mix_bus_samples * sizeof(Sint32));
+		}
+		break;
+	    default:
+		break;
+	}
+
+	effect_buf_len = mixer.size;
+	effect_buf = (Uint8 *) malloc(effect_buf_len);
+	if ( effect_buf == NULL ) {
+		effect_buf_len = 0;
+	}
+
+	/* Set up the command queue, unless every call should lock the mixer */
+#ifndef MIX_ATOMIC_DISABLED
+	if ( getenv(MIX_NOCOMMANDQUEUE) == NULL ) {
+		mix_commands = (mix_command_slot *) malloc(MIX_COMMAND_QUEUE_SIZE * sizeof(mix_command_slot));
+		if ( mix_commands ) {
+			for ( i=0; i<MIX_COMMAND_QUEUE_SIZE; ++i ) {
+				mix_commands[i].sequence = i;
+			}
+			mix_command_post = 0;
+			mix_command_take = 0;
+		}
+	}
+#endif
+
 	_Mix_InitEffects();
 
 	audio_opened = 1;
-	SDL_PauseAudio(0);
+	audio_offline = offline;
+	if ( !offline ) {
+		SDL_PauseAudio(0);
+	}
 	return(0);
 }
 
+int Mix_OpenAudio(int frequency, Uint16 format, int nchannels, int chunksize)
+{
+	return(open_audio(frequency, format, nchannels, chunksize, 0));
+}
+
+/* The audio device is opened as usual but left paused, so the device thread
+   never calls mix_channels() and the application does instead. */
+int Mix_OpenAudioOffline(int frequency, Uint16 format, int nchannels, int chunksize)
+{
+	return(open_audio(frequency, format, nchannels, chunksize, 1));
+}
+
+/* Mixes a device buffer at a time, as the audio callback would be asked to */
+int Mix_RenderAudio(Uint8 *stream, int len)
+{
+	int amount, done;
+
+	if ( !audio_opened || !audio_offline ) {
+		Mix_SetError("Audio isn't open for rendering");
+		return(-1);
+	}
+	len -= len % mix_frame_size;
+	for ( done = 0; done < len; done += amount ) {
+		amount = len - done;
+		if ( amount > (int)mixer.size ) {
+			amount = mixer.size;
+		}
+		music_wait_decoder(amount);
+		SDL_LockAudio();
+		mix_channels(NULL, stream + done, amount);
+		SDL_UnlockAudio();
+	}
+	return(len);
+}
+
 /* Dynamically change the number of channels managed by the mixer.
    If decreasing the number of channels, the upper channels are
    stopped.
@@ -357,6 +1136,7 @@ int Mix_AllocateChannels(int numchans)
 		}
 	}
 	SDL_LockAudio();
+	mix_take_commands();
 	mix_channel = (struct _Mix_Channel *) realloc(mix_channel, numchans * sizeof(struct _Mix_Channel));
 	if ( numchans > num_channels ) {
 		/* Initialize the new channels */
@@ -366,12 +1146,13 @@ int Mix_AllocateChannels(int numchans)
 			mix_channel[i].playing = 0;
 			mix_channel[i].looping = 0;
 			mix_channel[i].volume = SDL_MIX_MAXVOLUME;
-			mix_channel[i].fade_volume = SDL_MIX_MAXVOLUME;
 			mix_channel[i].fading = MIX_NO_FADING;
 			mix_channel[i].tag = -1;
+			mix_channel[i].start = 0;
 			mix_channel[i].expire = 0;
 			mix_channel[i].effects = NULL;
 			mix_channel[i].paused = 0;
+			mix_channel[i].pending = 0;
 		}
 	}
 	num_channels = numchans;
@@ -402,14 +1183,368 @@ int Mix_QuerySpec(int *frequency, Uint16 *format, int *channels)
  *             generic setup, then call the correct file format loader.
  */
 
+/* Hashes the encoded sound data, eight bytes at a time in the style of
+   FNV-1a, with a final mix so every byte reaches the low bits */
+static Uint64 mix_hash_data(const Uint8 *data, Uint32 len)
+{
+	const Uint64 prime = ((Uint64)1 << 40) | 0x1B3;
+	Uint64 hash = ((Uint64)0xCBF29CE4 << 32) | 0x84222325;
+	Uint64 word;
+
+	hash ^= len;
+	while ( len >= sizeof(word) ) {
+		memcpy(&word, data, sizeof(word));
+		hash = (hash ^ SDL_SwapLE64(word)) * prime;
+		data += sizeof(word);
+		len -= sizeof(word);
+	}
+	while ( len-- ) {
+		hash = (hash ^ *data++) * prime;
+	}
+	hash ^= hash >> 32;
+	hash *= prime;
+	hash ^= hash >> 29;
+	return(hash);
+}
+
+/* Works out how much of the data is the sound, so a sound packed in with
+   others doesn't hash everything after it */
+static Uint32 mix_encoded_size(const Uint8 *data, size_t size)
+{
+	Uint32 len = 0;
+
+	if ( size > 0xFFFFFFFF ) {
+		size = 0xFFFFFFFF;
+	}
+	if ( size >= 12 ) {
+		if ( memcmp(data, "RIFF", 4) == 0 ) {
+			len = 8 + ((data[7]<<24)|(data[6]<<16)|(data[5]<<8)|data[4]);
+		} else if ( memcmp(data, "FORM", 4) == 0 ) {
+			len = 8 + ((data[4]<<24)|(data[5]<<16)|(data[6]<<8)|data[7]);
+		}
+	}
+	if ( len <= 12 || len > size ) {
+		len = (Uint32)size;
+	}
+	return(len);
+}
+
+/* Takes a reference to samples decoded from the same data for the current
+   device format, if there are any.  The loader lock must be held. */
+static Uint8 *mix_find_samples(Uint64 key, const Uint8 *data, Uint32 size, Uint32 *alen)
+{
+	shared_samples *entry;
+
+	for ( entry = shared_chunks; entry; entry = entry->next ) {
+		if ( entry->key == key && entry->size == size &&
+		     entry->format == mixer.format &&
+		     entry->channels == mixer.channels &&
+		     entry->freq == mixer.freq &&
+		     memcmp(entry->data, data, size) == 0 ) {
+			++entry->refcount;
+			*alen = entry->alen;
+			return(entry->abuf);
+		}
+	}
+	return(NULL);
+}
+
+/* Adds newly decoded samples to the shared ones, and returns the samples
+   the chunk should use: another thread may have decoded them first */
+static Uint8 *mix_share_samples(Uint64 key, const Uint8 *data, Uint32 size, Uint8 *abuf, Uint32 *alen)
+{
+	shared_samples *entry;
+	Uint8 *found;
+
+	SDL_mutexP(loader_lock);
+	found = mix_find_samples(key, data, size, alen);
+	if ( found ) {
+		free(abuf);
+		abuf = found;
+	} else {
+		entry = (shared_samples *)malloc(sizeof(shared_samples));
+		if ( entry ) {
+			entry->data = (Uint8 *)malloc(size);
+			if ( entry->data == NULL ) {
+				free(entry);
+				entry = NULL;
+			}
+		}
+		if ( entry ) {
+			memcpy(entry->data, data, size);
+			entry->key = key;
+			entry->size = size;
+			entry->format = mixer.format;
+			entry->channels = mixer.channels;
+			entry->freq = mixer.freq;
+			entry->abuf = abuf;
+			entry->alen = *alen;
+			entry->refcount = 1;
+			entry->next = shared_chunks;
+			shared_chunks = entry;
+		}
+	}
+	SDL_mutexV(loader_lock);
+	return(abuf);
+}
+
+/* Drops a chunk's reference to its samples, returns 1 if other chunks
+   are still using them */
+static int mix_release_samples(Uint8 *abuf)
+{
+	shared_samples *entry, *prev;
+	int used = 0;
+
+	if ( loader_lock == NULL ) {
+		return(0);
+	}
+	SDL_mutexP(loader_lock);
+	prev = NULL;
+	for ( entry = shared_chunks; entry; entry = entry->next ) {
+		if ( entry->abuf == abuf ) {
+			if ( --entry->refcount > 0 ) {
+				used = 1;
+			} else {
+				if ( prev ) {
+					prev->next = entry->next;
+				} else {
+					shared_chunks = entry->next;
+				}
+				free(entry->data);
+				free(entry);
+			}
+			break;
+		}
+		prev = entry;
+	}
+	SDL_mutexV(loader_lock);
+	return(used);
+}
+
+#define MIXC		0x4358494d		/* "MIXC" */
+#define MIXC_VERSION	1
+#define MIXC_HEADER	28			/* tag, version, spec, lengths */
+
+/* Returns the cache file for the data converted to the current device
+   format, or NULL if there's no cache.  The loader lock must be held. */
+static char *mix_cache_file(Uint64 key, Uint32 size)
+{
+	char *path;
+	size_t len;
+
+	if ( chunk_cache == NULL ) {
+		return(NULL);
+	}
+	len = strlen(chunk_cache) + 64;
+	path = (char *)malloc(len);
+	if ( path ) {
+		SDL_snprintf(path, len, "%s/%08x%08x-%x-%x-%d-%d.pcm",
+			chunk_cache, (Uint32)(key >> 32), (Uint32)key, size,
+			mixer.format, mixer.channels, mixer.freq);
+	}
+	return(path);
+}
+
+/* Reads converted samples from the cache.  The file has a "MIXC" tag, the
+   version, the device format, channels and frequency, the length of the
+   encoded data and of the samples, then a copy of the encoded data so a
+   hash collision can't load the wrong sound, then the samples.  Anything
+   that doesn't match exactly is ignored. */
+static Uint8 *mix_load_cached(const char *path, const Uint8 *data, Uint32 size, Uint32 *alen)
+{
+	SDL_RWops *rw;
+	Uint8 *copy = NULL;
+	Uint8 *abuf = NULL;
+	int filesize;
+
+	rw = SDL_RWFromFile(path, "rb");
+	if ( rw == NULL ) {
+		return(NULL);
+	}
+	filesize = SDL_RWseek(rw, 0, RW_SEEK_END);
+	SDL_RWseek(rw, 0, RW_SEEK_SET);
+	if ( SDL_ReadLE32(rw) == MIXC &&
+	     SDL_ReadLE32(rw) == MIXC_VERSION &&
+	     SDL_ReadLE32(rw) == mixer.format &&
+	     SDL_ReadLE32(rw) == (Uint32)mixer.channels &&
+	     SDL_ReadLE32(rw) == (Uint32)mixer.freq &&
+	     SDL_ReadLE32(rw) == size ) {
+		*alen = SDL_ReadLE32(rw);
+		if ( *alen > 0 && filesize >= MIXC_HEADER &&
+		     (Uint32)filesize - MIXC_HEADER >= size &&
+		     (Uint32)filesize - MIXC_HEADER - size == *alen ) {
+			copy = (Uint8 *)malloc(size);
+		}
+		if ( copy && SDL_RWread(rw, copy, size, 1) == 1 &&
+		     memcmp(copy, data, size) == 0 ) {
+			abuf = (Uint8 *)malloc(*alen);
+		}
+		if ( abuf && SDL_RWread(rw, abuf, *alen, 1) != 1 ) {
+			free(abuf);
+			abuf = NULL;
+		}
+		free(copy);
+	}
+	SDL_RWclose(rw);
+	return(abuf);
+}
+
+/* Writes converted samples to the cache, through a temporary file so
+   nobody reads a partly written one */
+static void mix_save_cached(const char *path, const Uint8 *data, Uint32 size, const Uint8 *abuf, Uint32 alen)
+{
+	SDL_RWops *rw;
+	char *temp;
+	size_t len;
+	int ok;
+
+	len = strlen(path) + 32;
+	temp = (char *)malloc(len);
+	if ( temp == NULL ) {
+		return;
+	}
+	SDL_snprintf(temp, len, "%s.%lu.tmp", path, (unsigned long)SDL_ThreadID());
+	rw = SDL_RWFromFile(temp, "wb");
+	if ( rw ) {
+		ok = SDL_WriteLE32(rw, MIXC) &&
+		     SDL_WriteLE32(rw, MIXC_VERSION) &&
+		     SDL_WriteLE32(rw, mixer.format) &&
+		     SDL_WriteLE32(rw, mixer.channels) &&
+		     SDL_WriteLE32(rw, mixer.freq) &&
+		     SDL_WriteLE32(rw, size) &&
+		     SDL_WriteLE32(rw, alen) &&
+		     SDL_RWwrite(rw, data, size, 1) == 1 &&
+		     SDL_RWwrite(rw, abuf, alen, 1) == 1;
+		if ( SDL_RWclose(rw) < 0 ) {
+			ok = 0;
+		}
+		if ( !ok || rename(temp, path) != 0 ) {
+			remove(temp);
+		}
+	}
+	free(temp);
+}
+
+/* Decodes a sound file and converts it to the device format */
+static int mix_decode_chunk(SDL_RWops *src, int freesrc, Uint8 **abuf, Uint32 *alen)
+{
+	Uint32 magic;
+	SDL_AudioSpec wavespec, *loaded;
+	SDL_AudioCVT wavecvt;
+	int samplesize;
+	Uint8 *buf;
+
+	/* Find out what kind of audio file this is */
+	magic = SDL_ReadLE32(src);
+	/* Seek backwards for compatibility with older loaders */
+	SDL_RWseek(src, -(int)sizeof(Uint32), SEEK_CUR);
+
+	switch (magic) {
+		case WAVE:
+		case RIFF:
+			loaded = SDL_LoadWAV_RW(src, freesrc, &wavespec,
+					abuf, alen);
+			break;
+		case FORM:
+			loaded = Mix_LoadAIFF_RW(src, freesrc, &wavespec,
+					abuf, alen);
+			break;
+#ifdef OGG_MUSIC
+		case OGGS:
+			loaded = Mix_LoadOGG_RW(src, freesrc, &wavespec,
+					abuf, alen);
+			break;
+#endif
+#ifdef FLAC_MUSIC
+		case FLAC:
+			loaded = Mix_LoadFLAC_RW(src, freesrc, &wavespec,
+					abuf, alen);
+			break;
+#endif
+		case CREA:
+			loaded = Mix_LoadVOC_RW(src, freesrc, &wavespec,
+					abuf, alen);
+			break;
+		default:
+			SDL_SetError("Unrecognized sound file type");
+			if ( freesrc ) {
+				SDL_RWclose(src);
+			}
+			return(-1);
+	}
+	if ( !loaded ) {
+		return(-1);
+	}
+
+#if 0
+	PrintFormat("Audio device", &mixer);
+	PrintFormat("-- Wave file", &wavespec);
+#endif
+
+	/* Build the audio converter and create conversion buffers */
+	if ( SDL_BuildAudioCVT(&wavecvt,
+			wavespec.format, wavespec.channels, wavespec.freq,
+			mixer.format, mixer.channels, mixer.freq) < 0 ) {
+		if ( magic == WAVE || magic == RIFF ) {
+			SDL_FreeWAV(*abuf);
+		} else {
+			free(*abuf);
+		}
+		return(-1);
+	}
+	samplesize = ((wavespec.format & 0xFF)/8)*wavespec.channels;
+	wavecvt.len = *alen & ~(samplesize-1);
+	if ( magic == WAVE || magic == RIFF ) {
+		/* SDL_LoadWAV_RW() has its own allocator, so copy the samples */
+		wavecvt.buf = (Uint8 *)malloc(wavecvt.len*wavecvt.len_mult);
+		if ( wavecvt.buf == NULL ) {
+			SDL_SetError("Out of memory");
+			SDL_FreeWAV(*abuf);
+			return(-1);
+		}
+		memcpy(wavecvt.buf, *abuf, wavecvt.len);
+		SDL_FreeWAV(*abuf);
+	} else if ( wavecvt.len_mult > 1 ) {
+		/* The other loaders use malloc(), so convert in place */
+		wavecvt.buf = (Uint8 *)realloc(*abuf, wavecvt.len*wavecvt.len_mult);
+		if ( wavecvt.buf == NULL ) {
+			SDL_SetError("Out of memory");
+			free(*abuf);
+			return(-1);
+		}
+	} else {
+		wavecvt.buf = *abuf;
+	}
+
+	/* Run the audio converter */
+	if ( SDL_ConvertAudio(&wavecvt) < 0 ) {
+		free(wavecvt.buf);
+		return(-1);
+	}
+	*abuf = wavecvt.buf;
+	*alen = wavecvt.len_cvt;
+
+	/* Give back whatever the conversion didn't need */
+	if ( wavecvt.len_cvt > 0 &&
+	     wavecvt.len_cvt < wavecvt.len*wavecvt.len_mult ) {
+		buf = (Uint8 *)realloc(wavecvt.buf, wavecvt.len_cvt);
+		if ( buf ) {
+			*abuf = buf;
+		}
+	}
+	return(0);
+}
+
 /* Load a wave file */
 Mix_Chunk *Mix_LoadWAV_RW(SDL_RWops *src, int freesrc)
 {
-	Uint32 magic;
 	Mix_Chunk *chunk;
-	SDL_AudioSpec wavespec, *loaded;
-	SDL_AudioCVT wavecvt;
-	int samplesize;
+	const Uint8 *data;
+	size_t avail;
+	Uint64 key = 0;
+	Uint32 size = 0;
+	int hashed = 0, shared = 0;
+	char *path = NULL;
 
 	/* rcg06012001 Make sure src is valid */
 	if ( ! src ) {
@@ -435,85 +1570,246 @@ Mix_Chunk *Mix_LoadWAV_RW(SDL_RWops *src, int freesrc)
 		}
 		return(NULL);
 	}
+	chunk->abuf = NULL;
+
+	/* Sounds in memory can come from the caches without being decoded */
+	data = (const Uint8 *)SDL_RWGetPointer(src, &avail);
+	if ( data && loader_lock && (share_chunks || chunk_cache) ) {
+		size = mix_encoded_size(data, avail);
+		key = mix_hash_data(data, size);
+		hashed = 1;
+		SDL_mutexP(loader_lock);
+		if ( share_chunks ) {
+			chunk->abuf = mix_find_samples(key, data, size, &chunk->alen);
+			shared = (chunk->abuf != NULL);
+		}
+		if ( chunk->abuf == NULL ) {
+			path = mix_cache_file(key, size);
+		}
+		SDL_mutexV(loader_lock);
+		if ( path ) {
+			chunk->abuf = mix_load_cached(path, data, size, &chunk->alen);
+		}
+	}
 
-	/* Find out what kind of audio file this is */
-	magic = SDL_ReadLE32(src);
-	/* Seek backwards for compatibility with older loaders */
-	SDL_RWseek(src, -(int)sizeof(Uint32), SEEK_CUR);
-
-	switch (magic) {
-		case WAVE:
-		case RIFF:
-			loaded = SDL_LoadWAV_RW(src, freesrc, &wavespec,
-					(Uint8 **)&chunk->abuf, &chunk->alen);
-			break;
-		case FORM:
-			loaded = Mix_LoadAIFF_RW(src, freesrc, &wavespec,
-					(Uint8 **)&chunk->abuf, &chunk->alen);
-			break;
-#ifdef OGG_MUSIC
-		case OGGS:
-			loaded = Mix_LoadOGG_RW(src, freesrc, &wavespec,
-					(Uint8 **)&chunk->abuf, &chunk->alen);
-			break;
-#endif
-#ifdef FLAC_MUSIC
-		case FLAC:
-			loaded = Mix_LoadFLAC_RW(src, freesrc, &wavespec,
-					(Uint8 **)&chunk->abuf, &chunk->alen);
-			break;
-#endif
-		case CREA:
-			loaded = Mix_LoadVOC_RW(src, freesrc, &wavespec,
-					(Uint8 **)&chunk->abuf, &chunk->alen);
-			break;
-		default:
-			SDL_SetError("Unrecognized sound file type");
-			return(0);			
+	if ( chunk->abuf ) {
+		if ( share_chunks && !shared ) {
+			chunk->abuf = mix_share_samples(key, data, size, chunk->abuf, &chunk->alen);
+		}
+		/* Leave the source where the loaders would have */
+		if ( freesrc ) {
+			SDL_RWclose(src);
+		} else {
+			SDL_RWseek(src, size, RW_SEEK_CUR);
+		}
+	} else if ( hashed ) {
+		/* The data is compared against the caches, so keep it around */
+		if ( mix_decode_chunk(src, 0, &chunk->abuf, &chunk->alen) < 0 ) {
+			if ( freesrc ) {
+				SDL_RWclose(src);
+			}
+			free(path);
+			free(chunk);
+			return(NULL);
+		}
+		if ( path ) {
+			mix_save_cached(path, data, size, chunk->abuf, chunk->alen);
+		}
+		if ( share_chunks ) {
+			chunk->abuf = mix_share_samples(key, data, size, chunk->abuf, &chunk->alen);
+		}
+		if ( freesrc ) {
+			SDL_RWclose(src);
+		}
+	} else {
+		if ( mix_decode_chunk(src, freesrc, &chunk->abuf, &chunk->alen) < 0 ) {
+			free(chunk);
+			return(NULL);
+		}
 	}
-	if ( !loaded ) {
-		free(chunk);
-		return(NULL);
+	free(path);
+
+	chunk->allocated = 1;
+	chunk->volume = MIX_MAX_VOLUME;
+	return(chunk);
+}
+
+/* Loads the queued sounds until the audio device is closed */
+static int mix_loader_thread(void *unused)
+{
+	Mix_ChunkLoad *load;
+	Mix_Chunk *chunk;
+	char *error;
+	int quit;
+
+	SDL_mutexP(loader_lock);
+	while ( loads_first || !loader_quit ) {
+		if ( loads_first == NULL ) {
+			SDL_CondWait(loader_cond, loader_lock);
+			continue;
+		}
+		load = loads_first;
+		loads_first = load->next;
+		if ( loads_first == NULL ) {
+			loads_last = NULL;
+		}
+		quit = loader_quit;
+		SDL_mutexV(loader_lock);
+
+		if ( quit ) {
+			SDL_SetError("Audio device was closed");
+			if ( load->freesrc ) {
+				SDL_RWclose(load->src);
+			}
+			chunk = NULL;
+		} else {
+			chunk = Mix_LoadWAV_RW(load->src, load->freesrc);
+		}
+		error = NULL;
+		if ( chunk == NULL ) {
+			error = (char *)malloc(strlen(SDL_GetError())+1);
+			if ( error ) {
+				strcpy(error, SDL_GetError());
+			}
+		}
+
+		SDL_mutexP(loader_lock);
+		load->chunk = chunk;
+		load->error = error;
+		load->done = 1;
+		SDL_CondBroadcast(loader_cond);
 	}
+	SDL_mutexV(loader_lock);
+	return(0);
+}
 
-#if 0
-	PrintFormat("Audio device", &mixer);
-	PrintFormat("-- Wave file", &wavespec);
-#endif
+/* Load a wave file in the background */
+Mix_ChunkLoad *Mix_LoadWAVAsync_RW(SDL_RWops *src, int freesrc)
+{
+	Mix_ChunkLoad *load;
+	int queued = 0;
 
-	/* Build the audio converter and create conversion buffers */
-	if ( SDL_BuildAudioCVT(&wavecvt,
-			wavespec.format, wavespec.channels, wavespec.freq,
-			mixer.format, mixer.channels, mixer.freq) < 0 ) {
-		SDL_FreeWAV(chunk->abuf);
-		free(chunk);
+	if ( ! src ) {
+		SDL_SetError("Mix_LoadWAVAsync_RW with NULL src");
 		return(NULL);
 	}
-	samplesize = ((wavespec.format & 0xFF)/8)*wavespec.channels;
-	wavecvt.len = chunk->alen & ~(samplesize-1);
-	wavecvt.buf = (Uint8 *)malloc(wavecvt.len*wavecvt.len_mult);
-	if ( wavecvt.buf == NULL ) {
+	if ( ! audio_opened ) {
+		SDL_SetError("Audio device hasn't been opened");
+		if ( freesrc ) {
+			SDL_RWclose(src);
+		}
+		return(NULL);
+	}
+	load = (Mix_ChunkLoad *)calloc(1, sizeof(Mix_ChunkLoad));
+	if ( load == NULL ) {
 		SDL_SetError("Out of memory");
-		SDL_FreeWAV(chunk->abuf);
-		free(chunk);
+		if ( freesrc ) {
+			SDL_RWclose(src);
+		}
 		return(NULL);
 	}
-	memcpy(wavecvt.buf, chunk->abuf, chunk->alen);
-	SDL_FreeWAV(chunk->abuf);
+	load->src = src;
+	load->freesrc = freesrc;
 
-	/* Run the audio converter */
-	if ( SDL_ConvertAudio(&wavecvt) < 0 ) {
-		free(wavecvt.buf);
-		free(chunk);
+	if ( loader_lock ) {
+		SDL_mutexP(loader_lock);
+		if ( loader == NULL ) {
+			loader = SDL_CreateThread(mix_loader_thread, NULL);
+		}
+		if ( loader ) {
+			if ( loads_last ) {
+				loads_last->next = load;
+			} else {
+				loads_first = load;
+			}
+			loads_last = load;
+			SDL_CondBroadcast(loader_cond);
+			queued = 1;
+		}
+		SDL_mutexV(loader_lock);
+	}
+
+	/* Without a loader thread, load it right away */
+	if ( !queued ) {
+		load->chunk = Mix_LoadWAV_RW(src, freesrc);
+		if ( load->chunk == NULL ) {
+			load->error = (char *)malloc(strlen(SDL_GetError())+1);
+			if ( load->error ) {
+				strcpy(load->error, SDL_GetError());
+			}
+		}
+		load->done = 1;
+	}
+	return(load);
+}
+
+/* Find out whether a background load has finished */
+int Mix_LoadWAVDone(Mix_ChunkLoad *load)
+{
+	int done;
+
+	if ( load == NULL ) {
+		return(1);
+	}
+	if ( loader_lock ) {
+		SDL_mutexP(loader_lock);
+		done = load->done;
+		SDL_mutexV(loader_lock);
+	} else {
+		done = load->done;
+	}
+	return(done);
+}
+
+/* Wait for a background load to finish and get the chunk */
+Mix_Chunk *Mix_LoadWAVWait(Mix_ChunkLoad *load)
+{
+	Mix_Chunk *chunk;
+
+	if ( load == NULL ) {
 		return(NULL);
 	}
-	chunk->allocated = 1;
-	chunk->abuf = wavecvt.buf;
-	chunk->alen = wavecvt.len_cvt;
-	chunk->volume = MIX_MAX_VOLUME;
+	if ( loader_lock ) {
+		SDL_mutexP(loader_lock);
+		while ( ! load->done ) {
+			SDL_CondWait(loader_cond, loader_lock);
+		}
+		SDL_mutexV(loader_lock);
+	}
+	chunk = load->chunk;
+	if ( chunk == NULL ) {
+		SDL_SetError("%s", load->error ? load->error : "Out of memory");
+	}
+	free(load->error);
+	free(load);
 	return(chunk);
 }
 
+/* Keep the converted samples of loaded sounds in a directory */
+int Mix_SetChunkCache(const char *directory)
+{
+	char *copy = NULL;
+
+	if ( directory ) {
+		copy = (char *)malloc(strlen(directory)+1);
+		if ( copy == NULL ) {
+			SDL_SetError("Out of memory");
+			return(-1);
+		}
+		strcpy(copy, directory);
+	}
+	mix_init_loader();
+	if ( loader_lock ) {
+		SDL_mutexP(loader_lock);
+	}
+	free(chunk_cache);
+	chunk_cache = copy;
+	if ( loader_lock ) {
+		SDL_mutexV(loader_lock);
+	}
+	return(0);
+}
+
 /* Load a wave file of the mixer format from a memory buffer */
 Mix_Chunk *Mix_QuickLoad_WAV(Uint8 *mem)
 {
@@ -585,6 +1881,7 @@ void Mix_FreeChunk(Mix_Chunk *chunk)
 	if ( chunk ) {
 		/* Guarantee that this chunk isn't playing */
 		SDL_LockAudio();
+		mix_take_commands();
 		if ( mix_channel ) {
 			for ( i=0; i<num_channels; ++i ) {
 				if ( chunk == mix_channel[i].chunk ) {
@@ -593,8 +1890,8 @@ void Mix_FreeChunk(Mix_Chunk *chunk)
 			}
 		}
 		SDL_UnlockAudio();
-		/* Actually free the chunk */
-		if ( chunk->allocated ) {
+		/* Actually free the chunk, unless other chunks share its samples */
+		if ( chunk->allocated && !mix_release_samples(chunk->abuf) ) {
 			free(chunk->abuf);
 		}
 		free(chunk);
@@ -666,6 +1963,64 @@ static int checkchunkintegral(Mix_Chunk *chunk)
 	return chunk->alen;
 }
 
+/* Start a chunk playing, on the first free channel if 'which' is -1 */
+static int mix_play_channel(mix_command_type type, int which, Mix_Chunk *chunk,
+					int loops, int ms, int ticks, Uint64 start)
+{
+	mix_command command;
+	int i;
+
+	if ( which >= num_channels ) {
+		Mix_SetError("Invalid channel number");
+		return(-1);
+	}
+
+	memset(&command, 0, sizeof(command));
+	command.type = type;
+	command.chunk = chunk;
+	command.loops = loops;
+	command.ms = ms;
+	command.ticks = ticks;
+	command.start = start;
+
+	if ( mix_commands ) {
+		/* Mark the channel as playing and leave the rest to the mixer */
+		if ( which == -1 ) {
+			which = mix_claim_channel();
+		} else if ( which >= 0 ) {
+			mix_mark_channel(which, 1);
+		}
+		if ( which >= 0 ) {
+			command.channel = which;
+			command.marked = 1;
+			mix_send_command(&command);
+		}
+	} else {
+		/* Lock the mixer while modifying the playing channels */
+		SDL_LockAudio();
+		if ( which == -1 ) {
+			for ( i=reserved_channels; i<num_channels; ++i ) {
+				if ( mix_channel[i].playing <= 0 )
+					break;
+			}
+			if ( i < num_channels ) {
+				which = i;
+			}
+		}
+		if ( which >= 0 ) {
+			command.channel = which;
+			command.time = SDL_GetTicks();
+			mix_run_command(&command);
+		}
+		SDL_UnlockAudio();
+	}
+
+	if ( which == -1 ) {
+		Mix_SetError("No free channels available");
+	}
+	return(which);
+}
+
 /* Play an audio chunk on a specific channel.
    If the specified channel is -1, play on the first free channel.
    'ticks' is the number of milliseconds at most to play the sample, or -1
@@ -674,8 +2029,6 @@ static int checkchunkintegral(Mix_Chunk *chunk)
 */
 int Mix_PlayChannelTimed(int which, Mix_Chunk *chunk, int loops, int ticks)
 {
-	int i;
-
 	/* Don't play null pointers :-) */
 	if ( chunk == NULL ) {
 		Mix_SetError("Tried to play a NULL chunk");
@@ -686,42 +2039,37 @@ int Mix_PlayChannelTimed(int which, Mix_Chunk *chunk, int loops, int ticks)
 		return(-1);
 	}
 
-	/* Lock the mixer while modifying the playing channels */
-	SDL_LockAudio();
-	{
-		/* If which is -1, play on the first free channel */
-		if ( which == -1 ) {
-			for ( i=reserved_channels; i<num_channels; ++i ) {
-				if ( mix_channel[i].playing <= 0 )
-					break;
-			}
-			if ( i == num_channels ) {
-				Mix_SetError("No free channels available");
-				which = -1;
-			} else {
-				which = i;
-			}
-		}
+	/* Return the channel on which the sound is being played */
+	return(mix_play_channel(MIX_COMMAND_PLAY, which, chunk, loops, 0, ticks, 0));
+}
 
-		/* Queue up the audio data for this channel */
-		if ( which >= 0 ) {
-			Uint32 sdl_ticks = SDL_GetTicks();
-			if (Mix_Playing(which))
-				_Mix_channel_done_playing(which);
-			mix_channel[which].samples = chunk->abuf;
-			mix_channel[which].playing = chunk->alen;
-			mix_channel[which].looping = loops;
-			mix_channel[which].chunk = chunk;
-			mix_channel[which].paused = 0;
-			mix_channel[which].fading = MIX_NO_FADING;
-			mix_channel[which].start_time = sdl_ticks;
-			mix_channel[which].expire = (ticks>0) ? (sdl_ticks + ticks) : 0;
-		}
+/* Play an audio chunk starting at a given point on the sample clock */
+int Mix_PlayChannelAt(int which, Mix_Chunk *chunk, int loops, Uint64 when)
+{
+	/* Don't play null pointers :-) */
+	if ( chunk == NULL ) {
+		Mix_SetError("Tried to play a NULL chunk");
+		return(-1);
+	}
+	if ( !checkchunkintegral(chunk)) {
+		Mix_SetError("Tried to play a chunk with a bad frame");
+		return(-1);
 	}
-	SDL_UnlockAudio();
 
-	/* Return the channel on which the sound is being played */
-	return(which);
+	return(mix_play_channel(MIX_COMMAND_PLAY, which, chunk, loops, 0, -1, when));
+}
+
+/* Get the number of sample frames mixed since the audio device was opened */
+Uint64 Mix_GetSampleClock(void)
+{
+	Uint64 clock;
+
+	/* The audio thread advances it, and a 64-bit read can tear on 32-bit
+	   systems, so read it while the mixer is locked out */
+	SDL_LockAudio();
+	clock = mix_sample_clock;
+	SDL_UnlockAudio();
+	return(clock);
 }
 
 /* Change the expiration delay for a channel */
@@ -735,9 +2083,13 @@ int Mix_ExpireChannel(int which, int ticks)
 			status += Mix_ExpireChannel(i, ticks);
 		}
 	} else if ( which < num_channels ) {
-		SDL_LockAudio();
-		mix_channel[which].expire = (ticks>0) ? (SDL_GetTicks() + ticks) : 0;
-		SDL_UnlockAudio();
+		mix_command command;
+
+		memset(&command, 0, sizeof(command));
+		command.type = MIX_COMMAND_EXPIRE;
+		command.channel = which;
+		command.ticks = ticks;
+		mix_send_command(&command);
 		++ status;
 	}
 	return(status);
@@ -746,8 +2098,6 @@ int Mix_ExpireChannel(int which, int ticks)
 /* Fade in a sound on a channel, over ms milliseconds */
 int Mix_FadeInChannelTimed(int which, Mix_Chunk *chunk, int loops, int ms, int ticks)
 {
-	int i;
-
 	/* Don't play null pointers :-) */
 	if ( chunk == NULL ) {
 		return(-1);
@@ -757,44 +2107,8 @@ int Mix_FadeInChannelTimed(int which, Mix_Chunk *chunk, int loops, int ms, int t
 		return(-1);
 	}
 
-	/* Lock the mixer while modifying the playing channels */
-	SDL_LockAudio();
-	{
-		/* If which is -1, play on the first free channel */
-		if ( which == -1 ) {
-			for ( i=reserved_channels; i<num_channels; ++i ) {
-				if ( mix_channel[i].playing <= 0 )
-					break;
-			}
-			if ( i == num_channels ) {
-				which = -1;
-			} else {
-				which = i;
-			}
-		}
-
-		/* Queue up the audio data for this channel */
-		if ( which >= 0 ) {
-			Uint32 sdl_ticks = SDL_GetTicks();
-			if (Mix_Playing(which))
-				_Mix_channel_done_playing(which);
-			mix_channel[which].samples = chunk->abuf;
-			mix_channel[which].playing = chunk->alen;
-			mix_channel[which].looping = loops;
-			mix_channel[which].chunk = chunk;
-			mix_channel[which].paused = 0;
-			mix_channel[which].fading = MIX_FADING_IN;
-			mix_channel[which].fade_volume = mix_channel[which].volume;
-			mix_channel[which].volume = 0;
-			mix_channel[which].fade_length = (Uint32)ms;
-			mix_channel[which].start_time = mix_channel[which].ticks_fade = sdl_ticks;
-			mix_channel[which].expire = (ticks > 0) ? (sdl_ticks+ticks) : 0;
-		}
-	}
-	SDL_UnlockAudio();
-
 	/* Return the channel on which the sound is being played */
-	return(which);
+	return(mix_play_channel(MIX_COMMAND_FADEIN, which, chunk, loops, ms, ticks, 0));
 }
 
 /* Set volume of a particular channel */
@@ -815,7 +2129,18 @@ int Mix_Volume(int which, int volume)
 			if ( volume > SDL_MIX_MAXVOLUME ) {
 				volume = SDL_MIX_MAXVOLUME;
 			}
-			mix_channel[which].volume = volume;
+			if ( _Mix_AtomicGet(&mix_channel[which].pending) >> 1 ) {
+				/* Set it after the queued commands */
+				mix_command command;
+
+				memset(&command, 0, sizeof(command));
+				command.type = MIX_COMMAND_VOLUME;
+				command.channel = which;
+				command.volume = volume;
+				mix_send_command(&command);
+			} else {
+				mix_channel[which].volume = volume;
+			}
 		}
 	}
 	return(prev_volume);
@@ -836,25 +2161,37 @@ int Mix_VolumeChunk(Mix_Chunk *chunk, int volume)
 }
 
 /* Halt playing of a particular channel */
+static void mix_halt_channel(int which)
+{
+	mix_command command;
+
+	memset(&command, 0, sizeof(command));
+	command.type = MIX_COMMAND_HALT;
+	command.channel = which;
+	if ( mix_commands ) {
+		mix_mark_channel(which, 0);
+		command.marked = 1;
+	}
+	mix_send_command(&command);
+}
 int Mix_HaltChannel(int which)
 {
 	int i;
 
 	if ( which == -1 ) {
 		for ( i=0; i<num_channels; ++i ) {
-			Mix_HaltChannel(i);
+			mix_halt_channel(i);
 		}
+	} else if ( (which >= 0) && (which < num_channels) ) {
+		mix_halt_channel(which);
 	} else {
-		SDL_LockAudio();
-		if (mix_channel[which].playing) {
-			_Mix_channel_done_playing(which);
-		mix_channel[which].playing = 0;
-		}
-		mix_channel[which].expire = 0;
-		if(mix_channel[which].fading != MIX_NO_FADING) /* Restore volume */
-			mix_channel[which].volume = mix_channel[which].fade_volume;
-		mix_channel[which].fading = MIX_NO_FADING;
-		SDL_UnlockAudio();
+		Mix_SetError("Invalid channel number");
+		return(-1);
+	}
+	/* The channel finished callback runs before this returns, as it
+	   always has, so the halt can't wait for the next audio callback */
+	if ( channel_done_callback ) {
+		_Mix_SyncChannel(which);
 	}
 	return(0);
 }
@@ -885,19 +2222,19 @@ int Mix_FadeOutChannel(int which, int ms)
 			for ( i=0; i<num_channels; ++i ) {
 				status += Mix_FadeOutChannel(i, ms);
 			}
-		} else {
-			SDL_LockAudio();
-			if ( mix_channel[which].playing && 
+		} else if ( (which >= 0) && (which < num_channels) ) {
+			if ( mix_channel_will_play(which) &&
 			    (mix_channel[which].volume > 0) &&
 			    (mix_channel[which].fading != MIX_FADING_OUT) ) {
+				mix_command command;
 
-				mix_channel[which].fading = MIX_FADING_OUT;
-				mix_channel[which].fade_volume = mix_channel[which].volume;
-				mix_channel[which].fade_length = ms;
-				mix_channel[which].ticks_fade = SDL_GetTicks();
+				memset(&command, 0, sizeof(command));
+				command.type = MIX_COMMAND_FADEOUT;
+				command.channel = which;
+				command.ms = ms;
+				mix_send_command(&command);
 				++status;
 			}
-			SDL_UnlockAudio();
 		}
 	}
 	return(status);
@@ -918,6 +2255,10 @@ int Mix_FadeOutGroup(int tag, int ms)
 
 Mix_Fading Mix_FadingChannel(int which)
 {
+	if ( (which < 0) || (which >= num_channels) ) {
+		return(MIX_NO_FADING);
+	}
+	_Mix_SyncChannel(which);
 	return mix_channel[which].fading;
 }
 
@@ -933,16 +2274,12 @@ int Mix_Playing(int which)
 		int i;
 
 		for ( i=0; i<num_channels; ++i ) {
-			if ((mix_channel[i].playing > 0) ||
-				(mix_channel[i].looping > 0))
-			{
+			if ( mix_channel_will_play(i) ) {
 				++status;
 			}
 		}
 	} else {
-		if ((mix_channel[which].playing > 0) ||
-			(mix_channel[which].looping > 0))
-		{
+		if ( mix_channel_will_play(which) ) {
 			++status;
 		}
 	}
@@ -955,6 +2292,7 @@ Mix_Chunk *Mix_GetChunk(int channel)
 	Mix_Chunk *retval = NULL;
 
 	if ((channel >= 0) && (channel < num_channels)) {
+		_Mix_SyncChannel(channel);
 		retval = mix_channel[channel].chunk;
 	}
 
@@ -968,16 +2306,28 @@ void Mix_CloseAudio(void)
 
 	if ( audio_opened ) {
 		if ( audio_opened == 1 ) {
+			mix_stop_loader();
 			for (i = 0; i < num_channels; i++) {
 				Mix_UnregisterAllEffects(i);
 			}
 			Mix_UnregisterAllEffects(MIX_CHANNEL_POST);
 			close_music();
 			Mix_HaltChannel(-1);
+			SDL_LockAudio();
+			mix_take_commands();
+			SDL_UnlockAudio();
 			_Mix_DeinitEffects();
 			SDL_CloseAudio();
 			free(mix_channel);
 			mix_channel = NULL;
+			free(mix_bus);
+			mix_bus = NULL;
+			free(effect_buf);
+			effect_buf = NULL;
+			effect_buf_len = 0;
+			free(mix_commands);
+			mix_commands = NULL;
+			audio_offline = 0;
 		}
 		--audio_opened;
 	}
@@ -987,17 +2337,22 @@ void Mix_CloseAudio(void)
 void Mix_Pause(int which)
 {
 	Uint32 sdl_ticks = SDL_GetTicks();
+	Uint64 clock = Mix_GetSampleClock();
+
+	_Mix_SyncChannel(which);
 	if ( which == -1 ) {
 		int i;
 
 		for ( i=0; i<num_channels; ++i ) {
 			if ( mix_channel[i].playing > 0 ) {
 				mix_channel[i].paused = sdl_ticks;
+				mix_channel[i].paused_at = clock;
 			}
 		}
 	} else {
 		if ( mix_channel[which].playing > 0 ) {
 			mix_channel[which].paused = sdl_ticks;
+			mix_channel[which].paused_at = clock;
 		}
 	}
 }
@@ -1005,23 +2360,22 @@ void Mix_Pause(int which)
 /* Resume a paused channel */
 void Mix_Resume(int which)
 {
-	Uint32 sdl_ticks = SDL_GetTicks();
-
 	SDL_LockAudio();
+	mix_take_commands();
 	if ( which == -1 ) {
 		int i;
 
 		for ( i=0; i<num_channels; ++i ) {
 			if ( mix_channel[i].playing > 0 ) {
 				if(mix_channel[i].expire > 0)
-					mix_channel[i].expire += sdl_ticks - mix_channel[i].paused;
+					mix_channel[i].expire += mix_sample_clock - mix_channel[i].paused_at;
 				mix_channel[i].paused = 0;
 			}
 		}
 	} else {
 		if ( mix_channel[which].playing > 0 ) {
 			if(mix_channel[which].expire > 0)
-				mix_channel[which].expire += sdl_ticks - mix_channel[which].paused;
+				mix_channel[which].expire += mix_sample_clock - mix_channel[which].paused_at;
 			mix_channel[which].paused = 0;
 		}
 	}
@@ -1074,7 +2428,7 @@ int Mix_GroupAvailable(int tag)
 	int i;
 	for( i=0; i < num_channels; i ++ ) {
 		if ( ((tag == -1) || (tag == mix_channel[i].tag)) &&
-		                    (mix_channel[i].playing <= 0) )
+		                    !mix_channel_will_play(i) )
 			return i;
 	}
 	return(-1);
@@ -1097,6 +2451,8 @@ int Mix_GroupOldest(int tag)
 	int chan = -1;
 	Uint32 mintime = SDL_GetTicks();
 	int i;
+
+	_Mix_SyncChannel(-1);
 	for( i=0; i < num_channels; i ++ ) {
 		if ( (mix_channel[i].tag==tag || tag==-1) && mix_channel[i].playing > 0
 			 && mix_channel[i].start_time <= mintime ) {
@@ -1113,6 +2469,8 @@ int Mix_GroupNewer(int tag)
 	int chan = -1;
 	Uint32 maxtime = 0;
 	int i;
+
+	_Mix_SyncChannel(-1);
 	for( i=0; i < num_channels; i ++ ) {
 		if ( (mix_channel[i].tag==tag || tag==-1) && mix_channel[i].playing > 0
 			 && mix_channel[i].start_time >= maxtime ) {
@@ -1133,7 +2491,7 @@ int Mix_GroupNewer(int tag)
 
 /* MAKE SURE you hold the audio lock (SDL_LockAudio()) before calling this! */
 static int _Mix_register_effect(effect_info **e, Mix_EffectFunc_t f,
-				Mix_EffectDone_t d, void *arg)
+			Mix_EffectCopyFunc_t copy, Mix_EffectDone_t d, void *arg)
 {
 	effect_info *new_e = malloc(sizeof (effect_info));
 
@@ -1153,6 +2511,7 @@ static int _Mix_register_effect(effect_info **e, Mix_EffectFunc_t f,
 	}
 
 	new_e->callback = f;
+	new_e->copy_callback = copy;
 	new_e->done_callback = d;
 	new_e->udata = arg;
 	new_e->next = NULL;
@@ -1236,6 +2595,13 @@ static int _Mix_remove_all_effects(int channel, effect_info **e)
 
 int Mix_RegisterEffect(int channel, Mix_EffectFunc_t f,
 			Mix_EffectDone_t d, void *arg)
+{
+	return(Mix_RegisterCopyEffect(channel, f, NULL, d, arg));
+}
+
+
+int Mix_RegisterCopyEffect(int channel, Mix_EffectFunc_t f,
+			Mix_EffectCopyFunc_t copy, Mix_EffectDone_t d, void *arg)
 {
 	effect_info **e = NULL;
 	int retval;
@@ -1251,7 +2617,8 @@ int Mix_RegisterEffect(int channel, Mix_EffectFunc_t f,
 	}
 
 	SDL_LockAudio();
-	retval = _Mix_register_effect(e, f, d, arg);
+	mix_take_commands();
+	retval = _Mix_register_effect(e, f, copy, d, arg);
 	SDL_UnlockAudio();
 	return(retval);
 }
@@ -1273,6 +2640,7 @@ int Mix_UnregisterEffect(int channel, Mix_EffectFunc_t f)
 	}
 
 	SDL_LockAudio();
+	mix_take_commands();
 	retval = _Mix_remove_effect(channel, e, f);
 	SDL_UnlockAudio();
 	return(retval);
@@ -1295,6 +2663,7 @@ int Mix_UnregisterAllEffects(int channel)
 	}
 
 	SDL_LockAudio();
+	mix_take_commands();
 	retval = _Mix_remove_all_effects(channel, e);
 	SDL_UnlockAudio();
 	return(retval);
@@ -29,8 +29,11 @@
 #include "SDL_endian.h"
 #include "SDL_audio.h"
 #include "SDL_timer.h"
+#include "SDL_thread.h"
+#include "SDL_cpuinfo.h"
 
 #include "SDL_mixer.h"
+#include "mix_atomic.h"
 
 #define SDL_SURROUND
 
@@ -141,7 +144,7 @@ struct _Mix_Music {
 #endif
 	} data;
 	Mix_Fading fading;
-	int fade_step;
+	int fade_step;		/* in sample frames */
 	int fade_steps;
 	int error;
 };
@@ -159,8 +162,36 @@ static int native_midi_ok;
 static int current_output_channels;
 static Uint16 current_output_format;
 
-/* Used to calculate fading steps */
-static int ms_per_step;
+/* Used to fade the music a sample frame at a time */
+static int music_freq;
+static Uint16 music_format;
+static int music_channels;
+extern int _Mix_RampAudio(Uint8 *buf, int len, Uint16 format, int channels,
+					float gain, float step);
+
+/* With MIX_MUSICTHREAD set, music that goes through the stream is decoded
+   ahead of playback by its own thread into a ring of samples, and the audio
+   callback just copies them out and applies the volume and fades.  The
+   decoders are only used with the decoder lock held, which the callback
+   never takes: when it finishes the music, the thread stops the decoder.
+   The ring is written by the thread and read by the callback without any
+   locking, and only reset with both the decoder lock and the audio lock. */
+static SDL_Thread *music_decoder = NULL;
+static SDL_mutex *music_decoder_lock = NULL;
+static SDL_sem *music_decoder_wake = NULL;
+static SDL_cond *music_ring_filled = NULL;	/* signaled with the decoder lock */
+static volatile int music_decoder_quit;
+static Mix_Music *music_decoding = NULL;	/* what the thread is decoding */
+static int music_decoder_ended;		/* set by music_decoder_loop() */
+static Uint8 *music_ring = NULL;
+static Uint32 music_ring_size;		/* in bytes, a power of two */
+static volatile Uint32 music_ring_write;	/* bytes written so far */
+static volatile Uint32 music_ring_read;		/* bytes read so far */
+static volatile int music_ring_ended;	/* everything has been decoded */
+static Uint8 *music_block = NULL;	/* decoded into, then copied to the ring */
+static int music_block_len;
+static int music_frame_size;
+static volatile int music_underruns;
 
 /* Local low-level functions prototypes */
 static void music_internal_initialize_volume(void);
@@ -168,7 +199,28 @@ static void music_internal_volume(int volume);
 static int  music_internal_play(Mix_Music *music, double position);
 static int  music_internal_position(double position);
 static int  music_internal_playing();
+static int  music_internal_streamed(Mix_Music *music);
+static void music_internal_stop(Mix_Music *music);
 static void music_internal_halt(void);
+static void music_reset_ring(void);
+static void music_stop_decoder(void);
+
+/* Lock out the decoder thread and the audio callback */
+static void music_lock(void)
+{
+	if ( music_decoder_lock ) {
+		SDL_mutexP(music_decoder_lock);
+	}
+	SDL_LockAudio();
+}
+
+static void music_unlock(void)
+{
+	SDL_UnlockAudio();
+	if ( music_decoder_lock ) {
+		SDL_mutexV(music_decoder_lock);
+	}
+}
 
 
 /* Support for hooking when the music has finished */
@@ -210,167 +262,443 @@ static int music_halt_or_loop (void)
 	return 1;
 }
 
+/* The decoder thread's music_halt_or_loop(): the music is restarted with
+   the audio device locked, or left for the callback to halt once it has
+   played everything that was decoded */
+static int music_decoder_loop(Mix_Music *music)
+{
+	int more = 1;
 
+	SDL_LockAudio();
+	if ( music != music_playing ) {
+		more = 0;
+	} else if ( !music_internal_playing() ) {
+		if ( music_loops && --music_loops ) {
+			Mix_Fading current_fade = music->fading;
+			music_internal_play(music, 0.0);
+			music->fading = current_fade;
+			music_decoding = music;
+		} else {
+			music_decoder_ended = 1;
+			more = 0;
+		}
+	}
+	SDL_UnlockAudio();
+	return(more);
+}
 
-/* Mixing function */
-void music_mixer(void *udata, Uint8 *stream, int len)
+#if defined(OGG_MUSIC) || defined(FLAC_MUSIC)
+/* Should decoding go on after the music reached its end? */
+static int music_more(Mix_Music *music, int threaded)
 {
-	if ( music_playing && music_active ) {
-		/* Handle fading */
-		if ( music_playing->fading != MIX_NO_FADING ) {
-			if ( music_playing->fade_step++ < music_playing->fade_steps ) {
-				int volume;
-				int fade_step = music_playing->fade_step;
-				int fade_steps = music_playing->fade_steps;
+	if ( threaded ) {
+		return(music_decoder_loop(music));
+	}
+	return(music_halt_or_loop());
+}
+#endif
 
-				if ( music_playing->fading == MIX_FADING_OUT ) {
-					volume = (music_volume * (fade_steps-fade_step)) / fade_steps;
-				} else { /* Fading in */
-					volume = (music_volume * fade_step) / fade_steps;
-				}
-				music_internal_volume(volume);
-			} else {
-				if ( music_playing->fading == MIX_FADING_OUT ) {
-					music_internal_halt();
-					if ( music_finished_hook ) {
-						music_finished_hook();
-					}
-					return;
-				}
-				music_playing->fading = MIX_NO_FADING;
-			}
-		}
-		
-		if (music_halt_or_loop() == 0)
-			return;
-		
-		
-		switch (music_playing->type) {
+/* Decodes some of the music into a buffer that's been filled with silence */
+static void music_decode(Mix_Music *music, Uint8 *stream, int len, int threaded)
+{
+	switch (music->type) {
 #ifdef CMD_MUSIC
-			case MUS_CMD:
-				/* The playing is done externally */
-				break;
+		case MUS_CMD:
+			/* The playing is done externally */
+			break;
 #endif
 #ifdef WAV_MUSIC
-			case MUS_WAV:
-				WAVStream_PlaySome(stream, len);
-				break;
+		case MUS_WAV:
+			WAVStream_PlaySome(stream, len);
+			break;
 #endif
 #if defined(MOD_MUSIC) || defined(LIBMIKMOD_MUSIC)
-			case MUS_MOD:
-				if (current_output_channels > 2) {
-					int small_len = 2 * len / current_output_channels;
-					int i;
-					Uint8 *src, *dst;
-
-					VC_WriteBytes((SBYTE *)stream, small_len);
-					/* and extend to len by copying channels */
-					src = stream + small_len;
-					dst = stream + len;
-
-					switch (current_output_format & 0xFF) {
-						case 8:
-							for ( i=small_len/2; i; --i ) {
-								src -= 2;
-								dst -= current_output_channels;
-								dst[0] = src[0];
-								dst[1] = src[1];
-								dst[2] = src[0];
-								dst[3] = src[1];
-								if (current_output_channels == 6) {
-									dst[4] = src[0];
-									dst[5] = src[1];
-								}
-							}
-							break;
-						case 16:
-							for ( i=small_len/4; i; --i ) {
-								src -= 4;
-								dst -= 2 * current_output_channels;
-								dst[0] = src[0];
-								dst[1] = src[1];
-								dst[2] = src[2];
-								dst[3] = src[3];
+		case MUS_MOD:
+			if (current_output_channels > 2) {
+				int small_len = 2 * len / current_output_channels;
+				int i;
+				Uint8 *src, *dst;
+
+				VC_WriteBytes((SBYTE *)stream, small_len);
+				/* and extend to len by copying channels */
+				src = stream + small_len;
+				dst = stream + len;
+
+				switch (current_output_format & 0xFF) {
+					case 8:
+						for ( i=small_len/2; i; --i ) {
+							src -= 2;
+							dst -= current_output_channels;
+							dst[0] = src[0];
+							dst[1] = src[1];
+							dst[2] = src[0];
+							dst[3] = src[1];
+							if (current_output_channels == 6) {
 								dst[4] = src[0];
 								dst[5] = src[1];
-								dst[6] = src[2];
-								dst[7] = src[3];
-								if (current_output_channels == 6) {
-									dst[8] = src[0];
-									dst[9] = src[1];
-									dst[10] = src[2];
-									dst[11] = src[3];
-								}
 							}
-							break;
-					}
+						}
+						break;
+					case 16:
+						for ( i=small_len/4; i; --i ) {
+							src -= 4;
+							dst -= 2 * current_output_channels;
+							dst[0] = src[0];
+							dst[1] = src[1];
+							dst[2] = src[2];
+							dst[3] = src[3];
+							dst[4] = src[0];
+							dst[5] = src[1];
+							dst[6] = src[2];
+							dst[7] = src[3];
+							if (current_output_channels == 6) {
+								dst[8] = src[0];
+								dst[9] = src[1];
+								dst[10] = src[2];
+								dst[11] = src[3];
+							}
+						}
+						break;
+				}
 
 
 
+			}
+			else VC_WriteBytes((SBYTE *)stream, len);
+			if ( music_swap8 ) {
+				Uint8 *dst;
+				int i;
+
+				dst = stream;
+				for ( i=len; i; --i ) {
+					*dst++ ^= 0x80;
 				}
-				else VC_WriteBytes((SBYTE *)stream, len);
-				if ( music_swap8 ) {
-					Uint8 *dst;
-					int i;
-
-					dst = stream;
-					for ( i=len; i; --i ) {
-						*dst++ ^= 0x80;
-					}
-				} else
-				if ( music_swap16 ) {
-					Uint8 *dst, tmp;
-					int i;
-
-					dst = stream;
-					for ( i=(len/2); i; --i ) {
-						tmp = dst[0];
-						dst[0] = dst[1];
-						dst[1] = tmp;
-						dst += 2;
-					}
+			} else
+			if ( music_swap16 ) {
+				Uint8 *dst, tmp;
+				int i;
+
+				dst = stream;
+				for ( i=(len/2); i; --i ) {
+					tmp = dst[0];
+					dst[0] = dst[1];
+					dst[1] = tmp;
+					dst += 2;
 				}
-				break;
+			}
+			break;
 #endif
 #ifdef MID_MUSIC
 #ifdef USE_TIMIDITY_MIDI
-			case MUS_MID:
-				if ( timidity_ok ) {
-					int samples = len / samplesize;
+		case MUS_MID:
+			if ( timidity_ok ) {
+				int samples = len / samplesize;
   					Timidity_PlaySome(stream, samples);
-				}
-				break;
+			}
+			break;
 #endif
 #endif
 #ifdef OGG_MUSIC
-			case MUS_OGG:
-				
-				len = OGG_playAudio(music_playing->data.ogg, stream, len);
-				if (len > 0 && music_halt_or_loop())
-					OGG_playAudio(music_playing->data.ogg, stream, len);
+		case MUS_OGG:
 			
-				break;
+			len = OGG_playAudio(music->data.ogg, stream, len);
+			if (len > 0 && music_more(music, threaded))
+				OGG_playAudio(music->data.ogg, stream, len);
+		
+			break;
 #endif
 #ifdef FLAC_MUSIC
-			case MUS_FLAC:
-				len = FLAC_playAudio(music_playing->data.flac, stream, len);
-				if (len > 0 && music_halt_or_loop())
-					FLAC_playAudio(music_playing->data.flac, stream, len);
-				break;
+		case MUS_FLAC:
+			len = FLAC_playAudio(music->data.flac, stream, len);
+			if (len > 0 && music_more(music, threaded))
+				FLAC_playAudio(music->data.flac, stream, len);
+			break;
 #endif
 #ifdef MP3_MUSIC
-			case MUS_MP3:
-				smpeg.SMPEG_playAudio(music_playing->data.mp3, stream, len);
-				break;
+		case MUS_MP3:
+			smpeg.SMPEG_playAudio(music->data.mp3, stream, len);
+			break;
 #endif
 #ifdef MP3_MAD_MUSIC
-			case MUS_MP3_MAD:
-				mad_getSamples(music_playing->data.mp3_mad, stream, len);
-				break;
+		case MUS_MP3_MAD:
+			mad_getSamples(music->data.mp3_mad, stream, len);
+			break;
 #endif
-			default:
-				/* Unknown music type?? */
-				break;
+		default:
+			/* Unknown music type?? */
+			break;
+	}
+}
+
+/* Decodes a block of music into the ring, which must have room for it.
+   Needs the decoder lock. */
+static void music_decode_block(Mix_Music *music)
+{
+	Uint32 pos, part;
+
+	memset(music_block, (music_format == AUDIO_U8) ? 0x80 : 0x00,
+	       music_block_len);
+	if ( music_decoder_loop(music) ) {
+		music_decode(music, music_block, music_block_len, 1);
+	}
+
+	pos = music_ring_write & (music_ring_size - 1);
+	part = music_ring_size - pos;
+	if ( part > (Uint32)music_block_len ) {
+		part = music_block_len;
+	}
+	memcpy(music_ring + pos, music_block, part);
+	memcpy(music_ring, music_block + part, music_block_len - part);
+	_Mix_MemoryBarrier();
+	music_ring_write += music_block_len;
+	if ( music_decoder_ended ) {
+		_Mix_MemoryBarrier();
+		music_ring_ended = 1;
+	}
+	SDL_CondBroadcast(music_ring_filled);
+}
+
+/* Keeps the ring full of decoded music until the audio device is closed */
+static int music_decoder_thread(void *unused)
+{
+	Mix_Music *music;
+
+	SDL_mutexP(music_decoder_lock);
+	while ( !music_decoder_quit ) {
+		music = music_playing;
+		if ( music_decoding && music_decoding != music ) {
+			/* The callback finished it, so stop the decoder */
+			music_internal_stop(music_decoding);
+			music_decoding = NULL;
+		}
+		if ( !music || music != music_decoding || !music_active ||
+		     music_ring_ended || music_decoder_ended ||
+		     music_ring_size - (music_ring_write - music_ring_read) <
+		     (Uint32)music_block_len ) {
+			SDL_mutexV(music_decoder_lock);
+			SDL_SemWaitTimeout(music_decoder_wake, 100);
+			SDL_mutexP(music_decoder_lock);
+			continue;
+		}
+
+		music_decode_block(music);
+	}
+	SDL_mutexV(music_decoder_lock);
+	return(0);
+}
+
+/* Copies decoded music out of the ring, returns how many bytes there were */
+static int music_ring_copy(Uint8 *stream, int len)
+{
+	Uint32 avail, pos, part;
+
+	avail = music_ring_write - music_ring_read;
+	_Mix_MemoryBarrier();
+	if ( (Uint32)len > avail ) {
+		len = avail;
+	}
+	pos = music_ring_read & (music_ring_size - 1);
+	part = music_ring_size - pos;
+	if ( part > (Uint32)len ) {
+		part = len;
+	}
+	memcpy(stream, music_ring + pos, part);
+	memcpy(stream + part, music_ring, len - part);
+	_Mix_MemoryBarrier();
+	music_ring_read += len;
+	SDL_SemPost(music_decoder_wake);
+	return(len);
+}
+
+/* Empties the ring and has the thread decode the music that's playing now,
+   starting with a block here so it doesn't begin with an underrun.
+   Needs both the decoder lock and the audio lock, and lets go of the audio
+   lock while it decodes so the callback isn't held up. */
+static void music_reset_ring(void)
+{
+	Mix_Music *music;
+
+	if ( music_ring ) {
+		music = music_playing;
+		music_decoding = music;
+		music_decoder_ended = 0;
+		music_ring_ended = 0;
+		music_ring_read = 0;
+		music_ring_write = 0;
+		if ( music && music_internal_streamed(music) ) {
+			SDL_UnlockAudio();
+			music_decode_block(music);
+			SDL_LockAudio();
+		}
+		SDL_SemPost(music_decoder_wake);
+	}
+}
+
+/* Halts the music from the audio callback, which can't stop a decoder
+   that the decoder thread might be using */
+static void music_finish(int threaded)
+{
+	if ( threaded ) {
+		music_playing->fading = MIX_NO_FADING;
+		music_playing = NULL;
+		SDL_SemPost(music_decoder_wake);
+	} else {
+		music_internal_halt();
+	}
+	if ( music_finished_hook ) {
+		music_finished_hook();
+	}
+}
+
+/* Starts the decoder thread with a ring that holds 'ms' of music */
+static void music_start_decoder(SDL_AudioSpec *mixer, int ms)
+{
+	Uint32 len;
+
+	music_frame_size = ((mixer->format & 0xFF) / 8) * mixer->channels;
+	music_block_len = mixer->size;
+	len = (Uint32)((Sint64)ms * mixer->freq / 1000) * music_frame_size;
+	music_ring_size = 1;
+	while ( music_ring_size < len || music_ring_size < 4 * mixer->size ) {
+		music_ring_size *= 2;
+	}
+	music_ring = (Uint8 *)malloc(music_ring_size);
+	music_block = (Uint8 *)malloc(music_block_len);
+	music_decoder_lock = SDL_CreateMutex();
+	music_decoder_wake = SDL_CreateSemaphore(0);
+	music_ring_filled = SDL_CreateCond();
+	music_decoder_quit = 0;
+	music_decoding = NULL;
+	music_ring_read = 0;
+	music_ring_write = 0;
+	music_ring_ended = 0;
+	if ( music_ring && music_block && music_decoder_lock &&
+	     music_decoder_wake && music_ring_filled ) {
+		music_decoder = SDL_CreateThread(music_decoder_thread, NULL);
+	}
+	if ( music_decoder == NULL ) {
+		/* Decode in the callback after all */
+		music_stop_decoder();
+	}
+}
+
+static void music_stop_decoder(void)
+{
+	if ( music_decoder ) {
+		music_decoder_quit = 1;
+		SDL_SemPost(music_decoder_wake);
+		SDL_WaitThread(music_decoder, NULL);
+		music_decoder = NULL;
+	}
+	if ( music_decoder_lock ) {
+		SDL_DestroyMutex(music_decoder_lock);
+		music_decoder_lock = NULL;
+	}
+	if ( music_decoder_wake ) {
+		SDL_DestroySemaphore(music_decoder_wake);
+		music_decoder_wake = NULL;
+	}
+	if ( music_ring_filled ) {
+		SDL_DestroyCond(music_ring_filled);
+		music_ring_filled = NULL;
+	}
+	free(music_ring);
+	music_ring = NULL;
+	free(music_block);
+	music_block = NULL;
+}
+
+/* When rendering offline, nothing is waiting on the audio, so rather than
+   run out the mixer waits for the decoder thread to get 'len' bytes ahead.
+   It's called without the audio lock, which the thread needs to loop. */
+void music_wait_decoder(int len)
+{
+	if ( music_ring == NULL ) {
+		return;
+	}
+	SDL_mutexP(music_decoder_lock);
+	while ( music_active && music_playing &&
+	        music_decoding == music_playing &&
+	        music_internal_streamed(music_playing) && !music_ring_ended &&
+	        music_ring_write - music_ring_read < (Uint32)len ) {
+		SDL_CondWait(music_ring_filled, music_decoder_lock);
+	}
+	SDL_mutexV(music_decoder_lock);
+}
+
+/* Mixing function */
+void music_mixer(void *udata, Uint8 *stream, int len)
+{
+	if ( music_playing && music_active ) {
+		int frames = len / ((music_format & 0xFF) / 8) / music_channels;
+		int streamed = music_internal_streamed(music_playing);
+		int threaded = (music_ring && streamed);
+		float gain = 1.0f, step = 0.0f;
+
+		/* Handle fading */
+		if ( music_playing->fading != MIX_NO_FADING ) {
+			int fade_step = music_playing->fade_step;
+			int fade_steps = music_playing->fade_steps;
+
+			if ( fade_step < fade_steps ) {
+				gain = (float)fade_step / fade_steps;
+				step = 1.0f / fade_steps;
+				if ( music_playing->fading == MIX_FADING_OUT ) {
+					gain = 1.0f - gain;
+					step = -step;
+				}
+				music_playing->fade_step += frames;
+				if ( !streamed ) {
+					/* It doesn't go through the stream, so step the volume */
+					float end = gain + step * frames;
+					if ( end < 0.0f ) {
+						end = 0.0f;
+					} else if ( end > 1.0f ) {
+						end = 1.0f;
+					}
+					music_internal_volume((int)(music_volume * end));
+					gain = 1.0f;
+					step = 0.0f;
+				}
+			} else {
+				if ( music_playing->fading == MIX_FADING_OUT ) {
+					music_finish(threaded);
+					return;
+				}
+				music_playing->fading = MIX_NO_FADING;
+			}
+		}
+
+		if ( threaded ) {
+			int ended;
+
+			/* The decoders play at full volume, so it's applied here */
+			gain = gain * music_volume / MIX_MAX_VOLUME;
+			step = step * music_volume / MIX_MAX_VOLUME;
+			/* Check for the end before copying, or the last block could
+			   land between a short copy and the check and be dropped */
+			ended = music_ring_ended;
+			_Mix_MemoryBarrier();
+			if ( music_ring_copy(stream, len) < len ) {
+				if ( ended ) {
+					_Mix_RampAudio(stream, len, music_format,
+					               music_channels, gain, step);
+					music_finish(threaded);
+					return;
+				}
+				++music_underruns;
+			}
+		} else {
+			if (music_halt_or_loop() == 0)
+				return;
+
+			music_decode(music_playing, stream, len, 0);
+		}
+
+		/* Fade the music a sample frame at a time */
+		if ( step != 0.0f || gain != 1.0f ) {
+			_Mix_RampAudio(stream, len, music_format, music_channels,
+			               gain, step);
 		}
 	}
 }
@@ -440,6 +768,11 @@ int open_music(SDL_AudioSpec *mixer)
 	md_pansep  = 128;
 	md_reverb  = 0;
 	md_mode    |= DMODE_HQMIXER|DMODE_SOFT_MUSIC|DMODE_SURROUND;
+#ifdef DMODE_SIMDMIXER
+	if ( SDL_HasSSE2() && !getenv(MIX_NOSIMDMIXER) ) {
+		md_mode |= DMODE_SIMDMIXER;
+	}
+#endif
 #ifdef LIBMIKMOD_MUSIC
 	list = MikMod_InfoDriver();
 	if ( list )
@@ -465,6 +798,9 @@ int open_music(SDL_AudioSpec *mixer)
 	if ( Timidity_Init(mixer->freq, mixer->format,
 	                    mixer->channels, mixer->samples) == 0 ) {
 		timidity_ok = 1;
+		if ( getenv(MIX_TIMIDITYTHREADS) ) {
+			Timidity_SetThreads(atoi(getenv(MIX_TIMIDITYTHREADS)));
+		}
 	} else {
 		timidity_ok = 0;
 	}
@@ -498,8 +834,14 @@ int open_music(SDL_AudioSpec *mixer)
 	}
 	Mix_VolumeMusic(SDL_MIX_MAXVOLUME);
 
-	/* Calculate the number of ms for each callback */
-	ms_per_step = (int) (((float)mixer->samples * 1000.0) / mixer->freq);
+	music_freq = mixer->freq;
+	music_format = mixer->format;
+	music_channels = mixer->channels;
+
+	music_underruns = 0;
+	if ( getenv(MIX_MUSICTHREAD) ) {
+		music_start_decoder(mixer, atoi(getenv(MIX_MUSICTHREAD)));
+	}
 
 	return(0);
 }
@@ -701,19 +1043,25 @@ void Mix_FreeMusic(Mix_Music *music)
 {
 	if ( music ) {
 		/* Stop the music if it's currently playing */
-		SDL_LockAudio();
+		music_lock();
 		if ( music == music_playing ) {
 			/* Wait for any fade out to finish */
 			while ( music->fading == MIX_FADING_OUT ) {
-				SDL_UnlockAudio();
+				music_unlock();
 				SDL_Delay(100);
-				SDL_LockAudio();
+				music_lock();
 			}
 			if ( music == music_playing ) {
 				music_internal_halt();
+				music_reset_ring();
 			}
 		}
-		SDL_UnlockAudio();
+		if ( music == music_decoding ) {
+			/* The callback finished it, but the decoder wasn't stopped */
+			music_internal_stop(music);
+			music_decoding = NULL;
+		}
+		music_unlock();
 		switch (music->type) {
 #ifdef CMD_MUSIC
 			case MUS_CMD:
@@ -905,20 +1253,24 @@ int Mix_FadeInMusicPos(Mix_Music *music, int loops, int ms, double position)
 		music->fading = MIX_NO_FADING;
 	}
 	music->fade_step = 0;
-	music->fade_steps = ms/ms_per_step;
+	music->fade_steps = (int)(((Sint64)ms * music_freq) / 1000);
 
 	/* Play the puppy */
-	SDL_LockAudio();
+	music_lock();
 	/* If the current music is fading out, wait for the fade to complete */
 	while ( music_playing && (music_playing->fading == MIX_FADING_OUT) ) {
-		SDL_UnlockAudio();
+		music_unlock();
 		SDL_Delay(100);
-		SDL_LockAudio();
+		music_lock();
 	}
 	music_active = 1;
 	music_loops = loops;
+	if ( music_decoding && music_decoding != music_playing ) {
+		music_internal_stop(music_decoding);
+	}
 	retval = music_internal_play(music, position);
-	SDL_UnlockAudio();
+	music_reset_ring();
+	music_unlock();
 
 	return(retval);
 }
@@ -978,25 +1330,48 @@ int Mix_SetMusicPosition(double position)
 {
 	int retval;
 
-	SDL_LockAudio();
+	music_lock();
 	if ( music_playing ) {
 		retval = music_internal_position(position);
 		if ( retval < 0 ) {
 			Mix_SetError("Position not implemented for music type");
+		} else {
+			music_reset_ring();
 		}
 	} else {
 		Mix_SetError("Music isn't playing");
 		retval = -1;
 	}
-	SDL_UnlockAudio();
+	music_unlock();
 
 	return(retval);
 }
 
+/* Does the music go through the stream, so it can be faded there? */
+static int music_internal_streamed(Mix_Music *music)
+{
+	switch (music->type) {
+#ifdef CMD_MUSIC
+	    case MUS_CMD:
+		return(0);
+#endif
+#if defined(MID_MUSIC) && defined(USE_NATIVE_MIDI)
+	    case MUS_MID:
+		return(!native_midi_ok);
+#endif
+	    default:
+		return(1);
+	}
+}
+
 /* Set the music's initial volume */
 static void music_internal_initialize_volume(void)
 {
-	if ( music_playing->fading == MIX_FADING_IN ) {
+	if ( music_ring && music_internal_streamed(music_playing) ) {
+		/* The volume is applied after the decoder thread */
+		music_internal_volume(MIX_MAX_VOLUME);
+	} else if ( music_playing->fading == MIX_FADING_IN &&
+	            !music_internal_streamed(music_playing) ) {
 		music_internal_volume(0);
 	} else {
 		music_internal_volume(music_volume);
@@ -1073,21 +1448,22 @@ int Mix_VolumeMusic(int volume)
 		volume = SDL_MIX_MAXVOLUME;
 	}
 	music_volume = volume;
-	SDL_LockAudio();
-	if ( music_playing ) {
+	music_lock();
+	if ( music_playing &&
+	     !(music_ring && music_internal_streamed(music_playing)) ) {
 		music_internal_volume(music_volume);
 	}
-	SDL_UnlockAudio();
+	music_unlock();
 	return(prev_volume);
 }
 
-/* Halt playing of music */
-static void music_internal_halt(void)
+/* Stop a music's decoder */
+static void music_internal_stop(Mix_Music *music)
 {
-	switch (music_playing->type) {
+	switch (music->type) {
 #ifdef CMD_MUSIC
 	    case MUS_CMD:
-		MusicCMD_Stop(music_playing->data.cmd);
+		MusicCMD_Stop(music->data.cmd);
 		break;
 #endif
 #ifdef WAV_MUSIC
@@ -1116,38 +1492,45 @@ static void music_internal_halt(void)
 #endif
 #ifdef OGG_MUSIC
 	    case MUS_OGG:
-		OGG_stop(music_playing->data.ogg);
+		OGG_stop(music->data.ogg);
 		break;
 #endif
 #ifdef FLAC_MUSIC
 	    case MUS_FLAC:
-		FLAC_stop(music_playing->data.flac);
+		FLAC_stop(music->data.flac);
 		break;
 #endif
 #ifdef MP3_MUSIC
 	    case MUS_MP3:
-		smpeg.SMPEG_stop(music_playing->data.mp3);
+		smpeg.SMPEG_stop(music->data.mp3);
 		break;
 #endif
 #ifdef MP3_MAD_MUSIC
 	    case MUS_MP3_MAD:
-		mad_stop(music_playing->data.mp3_mad);
+		mad_stop(music->data.mp3_mad);
 		break;
 #endif
 	    default:
 		/* Unknown music type?? */
-		return;
+		break;
 	}
+}
+
+/* Halt playing of music */
+static void music_internal_halt(void)
+{
+	music_internal_stop(music_playing);
 	music_playing->fading = MIX_NO_FADING;
 	music_playing = NULL;
 }
 int Mix_HaltMusic(void)
 {
-	SDL_LockAudio();
+	music_lock();
 	if ( music_playing ) {
 		music_internal_halt();
+		music_reset_ring();
 	}
-	SDL_UnlockAudio();
+	music_unlock();
 
 	return(0);
 }
@@ -1164,7 +1547,10 @@ int Mix_FadeOutMusic(int ms)
 
 	SDL_LockAudio();
 	if ( music_playing) {
-                int fade_steps = (ms + ms_per_step - 1)/ms_per_step;
+                int fade_steps = (int)(((Sint64)ms * music_freq) / 1000);
+                if ( fade_steps < 1 ) {
+                        fade_steps = 1;
+                }
                 if ( music_playing->fading == MIX_NO_FADING ) {
 	        	music_playing->fade_step = 0;
                 } else {
@@ -1174,10 +1560,13 @@ int Mix_FadeOutMusic(int ms)
                                 step = music_playing->fade_step;
                         } else {
                                 step = old_fade_steps
-                                        - music_playing->fade_step + 1;
+                                        - music_playing->fade_step;
                         }
-                        music_playing->fade_step = (step * fade_steps)
-                                / old_fade_steps;
+                        if ( step < 0 ) {
+                                step = 0;
+                        }
+                        music_playing->fade_step = (int)(((Sint64)step * fade_steps)
+                                / old_fade_steps);
                 }
 		music_playing->fading = MIX_FADING_OUT;
 		music_playing->fade_steps = fade_steps;
@@ -1303,13 +1692,35 @@ int Mix_PlayingMusic(void)
 
 	SDL_LockAudio();
 	if ( music_playing ) {
-		playing = music_internal_playing();
+		if ( music_ring && music_internal_streamed(music_playing) ) {
+			/* It plays until the callback has used up the ring */
+			playing = 1;
+		} else {
+			playing = music_internal_playing();
+		}
 	}
 	SDL_UnlockAudio();
 
 	return(playing);
 }
 
+/* How much music the decoder thread has decoded ahead */
+int Mix_GetMusicBuffered(void)
+{
+	if ( ! music_ring ) {
+		return(-1);
+	}
+	if ( ! music_playing ) {
+		return(0);
+	}
+	return (int)((music_ring_write - music_ring_read) / music_frame_size);
+}
+
+int Mix_GetMusicUnderruns(void)
+{
+	return(music_underruns);
+}
+
 /* Set the external music playback command */
 int Mix_SetMusicCMD(const char *command)
 {
@@ -1391,6 +1802,7 @@ int Mix_GetSynchroValue(void)
 void close_music(void)
 {
 	Mix_HaltMusic();
+	music_stop_decoder();
 #ifdef CMD_MUSIC
 	Mix_SetMusicCMD(NULL);
 #endif
@@ -1587,7 +1999,12 @@ Mix_Music *Mix_LoadMUS_RW(SDL_RWops *rw)
 #endif
 #ifdef USE_TIMIDITY_MIDI
 		if ( timidity_ok ) {
-			music->data.midi = Timidity_LoadSong_RW(rw);
+			/* The song is read all at once, a few bytes at a time */
+			SDL_RWops *buffered = SDL_RWBuffered(rw, 0, 0);
+			music->data.midi = Timidity_LoadSong_RW(buffered ? buffered : rw);
+			if ( buffered ) {
+				SDL_RWclose(buffered);
+			}
 			if ( music->data.midi == NULL ) {
 				Mix_SetError("%s", Timidity_Error());
 				music->error = 1;
@@ -1601,8 +2018,13 @@ Mix_Music *Mix_LoadMUS_RW(SDL_RWops *rw)
 #endif
 #if defined(MOD_MUSIC) || defined(LIBMIKMOD_MUSIC)
 	if (1) {
+		/* The module is read all at once, a few bytes at a time */
+		SDL_RWops *buffered = SDL_RWBuffered(rw, 0, 0);
 		music->type=MUS_MOD;
-		music->data.module=MikMod_LoadSongRW(rw,64);
+		music->data.module=MikMod_LoadSongRW(buffered ? buffered : rw,64);
+		if (buffered) {
+			SDL_RWclose(buffered);
+		}
 		if (music->data.module==NULL) {
 			Mix_SetError("%s",MikMod_strerror(MikMod_errno));
 			music->error=1;
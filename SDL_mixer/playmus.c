@@ -58,7 +58,7 @@ void CleanUp(int exitcode)
 
 void Usage(char *argv0)
 {
-	fprintf(stderr, "Usage: %s [-i] [-l] [-8] [-r rate] [-c channels] [-b buffers] [-v N] [-rwops] <musicfile>\n", argv0);
+	fprintf(stderr, "Usage: %s [-i] [-l] [-8] [-r rate] [-c channels] [-b buffers] [-v N] [-rwops] [-bench seconds] <musicfile>\n", argv0);
 }
 
 void Menu(void)
@@ -86,6 +86,88 @@ void Menu(void)
 		   Mix_PausedMusic() ? "yes" : "no");
 }
 
+/*
+ * Render each file offline for a while and time the mixing, with and
+ *  without the SIMD module mixer.  The rendering is the same every run, so
+ *  a checksum of it is printed too; both mixers should give the same one.
+ */
+static double time_music(const char *file, int seconds, int audio_rate,
+			Uint16 audio_format, int audio_channels, Uint32 *sum)
+{
+	Uint8 stream[4096];
+	Uint64 start, ticks = 0;
+	int len, left, i;
+
+	if (Mix_OpenAudioOffline(audio_rate, audio_format, audio_channels, 1024) < 0) {
+		fprintf(stderr, "Couldn't open audio: %s\n", SDL_GetError());
+		CleanUp(2);
+	}
+	audio_open = 1;
+	Mix_QuerySpec(&audio_rate, &audio_format, &audio_channels);
+	music = Mix_LoadMUS(file);
+	if ( music == NULL ) {
+		fprintf(stderr, "Couldn't load %s: %s\n", file, SDL_GetError());
+		CleanUp(2);
+	}
+
+	*sum = 0;
+	Mix_PlayMusic(music, -1);
+	left = seconds * audio_rate * audio_channels * ((audio_format & 0xFF) / 8);
+	while ( left > 0 ) {
+		start = SDL_GetPerformanceCounter();
+		len = Mix_RenderAudio(stream, (left < (int)sizeof(stream)) ? left : (int)sizeof(stream));
+		ticks += SDL_GetPerformanceCounter() - start;
+		if ( len <= 0 ) {
+			break;
+		}
+		for ( i=0; i < len; ++i ) {
+			*sum = (*sum << 5) + *sum + stream[i];
+		}
+		left -= len;
+	}
+	Mix_HaltMusic();
+
+	Mix_FreeMusic(music);
+	music = NULL;
+	Mix_CloseAudio();
+	audio_open = 0;
+
+	return ticks * 1000000.0 / SDL_GetPerformanceFrequency() /
+		((double)seconds * audio_rate / 1024);
+}
+
+static void benchmark(char **files, int seconds, int audio_rate,
+					Uint16 audio_format, int audio_channels)
+{
+	static struct {
+		char *name;
+		char *env;
+	} modes[] = {
+		{ "SIMD mixer", "" },
+		{ "C mixer", "MIX_NOSIMDMIXER=1" }
+	};
+	int i, mode;
+	double usec;
+	Uint32 sum;
+
+	SDL_putenv("SDL_AUDIODRIVER=dummy");
+	if ( SDL_Init(SDL_INIT_AUDIO) < 0 ) {
+		fprintf(stderr, "Couldn't initialize SDL: %s\n",SDL_GetError());
+		exit(255);
+	}
+	for ( mode=0; mode < SDL_arraysize(modes); ++mode ) {
+		if ( *modes[mode].env ) {
+			SDL_putenv(modes[mode].env);
+		}
+		for ( i=0; files[i]; ++i ) {
+			usec = time_music(files[i], seconds, audio_rate,
+					audio_format, audio_channels, &sum);
+			printf("%-12s %8.1f us per 1024 frames  %08x  %s\n",
+				modes[mode].name, usec, sum, files[i]);
+		}
+	}
+}
+
 void IntHandler(int sig)
 {
 	switch (sig) {
@@ -106,6 +188,7 @@ int main(int argc, char *argv[])
 	int looping = 0;
 	int interactive = 0;
 	int rwops = 0;
+	int bench = 0;
 	int i;
 
 	/* Initialize variables */
@@ -146,6 +229,10 @@ int main(int argc, char *argv[])
 		} else
 		if ( strcmp(argv[i], "-rwops") == 0 ) {
 			rwops = 1;
+		} else
+		if ( (strcmp(argv[i], "-bench") == 0) && argv[i+1] ) {
+			++i;
+			bench = atoi(argv[i]);
 		} else {
 			Usage(argv[0]);
 			return(1);
@@ -155,6 +242,10 @@ int main(int argc, char *argv[])
 		Usage(argv[0]);
 		return(1);
 	}
+	if ( bench > 0 ) {
+		benchmark(&argv[i], bench, audio_rate, audio_format, audio_channels);
+		CleanUp(0);
+	}
 
 	/* Initialize the SDL library */
 	if ( SDL_Init(SDL_INIT_AUDIO) < 0 ) {
@@ -210,6 +301,10 @@ int main(int argc, char *argv[])
 			else
 				SDL_Delay(100);
 		}
+		if ( Mix_GetMusicBuffered() >= 0 ) {
+			printf("Decoder thread ran out %d times\n",
+				Mix_GetMusicUnderruns());
+		}
 		Mix_FreeMusic(music);
 		if ( rwops ) {
 			SDL_FreeRW(rwfp);
@@ -268,7 +268,371 @@ static void CleanUp(int exitcode)
 
 static void Usage(char *argv0)
 {
-	fprintf(stderr, "Usage: %s [-8] [-r rate] [-c channels] [-f] [-F] [-l] [-m] <wavefile>\n", argv0);
+	fprintf(stderr, "Usage: %s [-8] [-r rate] [-c channels] [-f] [-F] [-l] [-m] [-bench seconds] [-benchpos seconds] [-stress seconds] [-benchload count] [-cache directory] <wavefile>\n", argv0);
+}
+
+
+/*
+ * Time the channel mixing with the wave playing on many channels at once.
+ *  The music hook runs just before the channels are mixed and the postmix
+ *  callback just after, so together they time the mixing itself.
+ */
+static Uint64 mix_start, mix_time;
+static int mix_calls;
+
+static void bench_start(void *udata, Uint8 *stream, int len)
+{
+	mix_start = SDL_GetPerformanceCounter();
+}
+
+static void bench_stop(void *udata, Uint8 *stream, int len)
+{
+	mix_time += SDL_GetPerformanceCounter() - mix_start;
+	++mix_calls;
+}
+
+enum { BENCH_PLAIN, BENCH_PANNED, BENCH_POSITIONED };
+
+/* Returns the microseconds taken to mix 1024 sample frames */
+static double time_mixing(const char *file, int seconds, int audio_rate,
+			Uint16 audio_format, int audio_channels, int count, int effect)
+{
+	double usec;
+	int chan;
+
+	if (Mix_OpenAudio(audio_rate, audio_format, audio_channels, 1024) < 0) {
+		fprintf(stderr, "Couldn't open audio: %s\n", SDL_GetError());
+		CleanUp(2);
+	}
+	audio_open = 1;
+	wave = Mix_LoadWAV(file);
+	if ( wave == NULL ) {
+		fprintf(stderr, "Couldn't load %s: %s\n", file, SDL_GetError());
+		CleanUp(2);
+	}
+
+	Mix_AllocateChannels(count);
+	SDL_LockAudio();
+	for ( chan=0; chan < count; ++chan ) {
+		Mix_Volume(chan, 32 + (chan * 7) % 97);
+		Mix_PlayChannel(chan, wave, -1);
+	}
+	SDL_UnlockAudio();
+	for ( chan=0; chan < count; ++chan ) {
+		if ( effect == BENCH_PANNED ) {
+			Mix_SetPanning(chan, 255 - chan % 256, chan % 256);
+		} else if ( effect == BENCH_POSITIONED ) {
+			Mix_SetPosition(chan, (chan * 37) % 360, chan % 200);
+		}
+	}
+
+	SDL_LockAudio();
+	mix_time = 0;
+	mix_calls = 0;
+	Mix_HookMusic(bench_start, NULL);
+	Mix_SetPostMix(bench_stop, NULL);
+	SDL_UnlockAudio();
+
+	SDL_Delay(seconds * 1000);
+
+	SDL_LockAudio();
+	usec = mix_calls ? mix_time * 1000000.0 /
+			SDL_GetPerformanceFrequency() / mix_calls : 0.0;
+	SDL_UnlockAudio();
+
+	Mix_HaltChannel(-1);
+	Mix_FreeChunk(wave);
+	wave = NULL;
+	Mix_CloseAudio();
+	audio_open = 0;
+
+	return usec;
+}
+
+/* Nothing to play to, so the mixer runs as it would on a real device */
+static void bench_init(void)
+{
+	SDL_putenv("SDL_AUDIODRIVER=dummy");
+	if ( SDL_Init(SDL_INIT_AUDIO) < 0 ) {
+		fprintf(stderr, "Couldn't initialize SDL: %s\n",SDL_GetError());
+		exit(255);
+	}
+}
+
+static void benchmark(const char *file, int seconds, int audio_rate,
+					Uint16 audio_format, int audio_channels)
+{
+	static const int counts[] = { 8, 64, 256 };
+	static struct {
+		char *name;
+		char *env;
+		int effect;
+	} modes[] = {
+		{ "mix bus", "", BENCH_PLAIN },
+		{ "mix bus, panned", "", BENCH_PANNED },
+		{ "direct", "MIX_NOMIXBUS=1", BENCH_PLAIN },
+		{ "direct, panned", "", BENCH_PANNED }
+	};
+	int i, mode;
+
+	bench_init();
+	for ( mode=0; mode < SDL_arraysize(modes); ++mode ) {
+		if ( *modes[mode].env ) {
+			SDL_putenv(modes[mode].env);
+		}
+		for ( i=0; i < SDL_arraysize(counts); ++i ) {
+			printf("%3d channels, %-16s %8.1f us per 1024 frames\n",
+				counts[i], modes[mode].name,
+				time_mixing(file, seconds, audio_rate, audio_format,
+					audio_channels, counts[i], modes[mode].effect));
+		}
+	}
+}
+
+/* Time Mix_SetPosition() on 64 channels for each output format */
+static void benchmark_position(const char *file, int seconds, int audio_rate)
+{
+	static const struct {
+		char *name;
+		Uint16 format;
+	} formats[] = {
+		{ "U8", AUDIO_U8 },
+		{ "S16", AUDIO_S16SYS },
+#ifdef AUDIO_F32SYS
+		{ "F32", AUDIO_F32SYS },
+#endif
+	};
+	static const int layouts[] = { 2, 4, 6 };
+	int i, j;
+
+	bench_init();
+	printf("64 channels, us per 1024 frames\n");
+	for ( i=0; i < SDL_arraysize(formats); ++i ) {
+		/* Music support may not handle every format */
+		if ( Mix_OpenAudio(audio_rate, formats[i].format, 2, 1024) < 0 ) {
+			printf("%-3s skipped: %s\n", formats[i].name, Mix_GetError());
+			continue;
+		}
+		Mix_CloseAudio();
+		for ( j=0; j < SDL_arraysize(layouts); ++j ) {
+			double plain = time_mixing(file, seconds, audio_rate,
+				formats[i].format, layouts[j], 64, BENCH_PLAIN);
+			double positioned = time_mixing(file, seconds, audio_rate,
+				formats[i].format, layouts[j], 64, BENCH_POSITIONED);
+			printf("%-3s %d channel: %8.1f mixing, %8.1f positioned, %8.1f in the effect\n",
+				formats[i].name, layouts[j], plain, positioned,
+				positioned - plain);
+		}
+	}
+}
+
+
+/*
+ * Time loading the wave file a number of times, keeping every chunk until
+ *  the end: sharing the samples decoded the first time, decoding it every
+ *  time, in the background, and reading the samples from a chunk cache.
+ */
+static double time_loads(const char *file, int count, int async,
+			Uint64 *started)
+{
+	Mix_Chunk **chunks;
+	Mix_ChunkLoad **loads;
+	Uint64 start;
+	double msec;
+	int i;
+
+	chunks = (Mix_Chunk **)calloc(count, sizeof(Mix_Chunk *));
+	loads = (Mix_ChunkLoad **)calloc(count, sizeof(Mix_ChunkLoad *));
+	if ( !chunks || !loads ) {
+		fprintf(stderr, "Out of memory\n");
+		CleanUp(2);
+	}
+
+	start = SDL_GetPerformanceCounter();
+	for ( i=0; i < count; ++i ) {
+		if ( async ) {
+			loads[i] = Mix_LoadWAVAsync(file);
+		} else {
+			chunks[i] = Mix_LoadWAV(file);
+		}
+	}
+	*started = SDL_GetPerformanceCounter() - start;
+	if ( async ) {
+		for ( i=0; i < count; ++i ) {
+			chunks[i] = Mix_LoadWAVWait(loads[i]);
+		}
+	}
+	msec = (SDL_GetPerformanceCounter() - start) * 1000.0 /
+			SDL_GetPerformanceFrequency() / count;
+
+	for ( i=0; i < count; ++i ) {
+		if ( chunks[i] == NULL ) {
+			fprintf(stderr, "Couldn't load %s: %s\n", file, SDL_GetError());
+			CleanUp(2);
+		}
+		Mix_FreeChunk(chunks[i]);
+	}
+	free(loads);
+	free(chunks);
+	return msec;
+}
+
+static void benchmark_load(const char *file, int count, const char *cache,
+			int audio_rate, Uint16 audio_format, int audio_channels)
+{
+	static const struct {
+		char *name;
+		char *env;
+		int async;
+		int cached;
+	} modes[] = {
+		{ "decoded", "", 0, 0 },
+		{ "background", "", 1, 0 },
+		{ "chunk cache", "", 0, 1 },
+		{ "shared", "MIX_SHAREDCHUNKS=1", 0, 0 }
+	};
+	Uint64 started;
+	double msec;
+	int mode;
+
+	bench_init();
+	for ( mode=0; mode < SDL_arraysize(modes); ++mode ) {
+		if ( modes[mode].cached && !cache ) {
+			continue;
+		}
+		if ( *modes[mode].env ) {
+			SDL_putenv(modes[mode].env);
+		}
+		if (Mix_OpenAudio(audio_rate, audio_format, audio_channels, 1024) < 0) {
+			fprintf(stderr, "Couldn't open audio: %s\n", SDL_GetError());
+			CleanUp(2);
+		}
+		audio_open = 1;
+		Mix_SetChunkCache(modes[mode].cached ? cache : NULL);
+		if ( modes[mode].cached ) {
+			/* Fill the cache first */
+			time_loads(file, 1, 0, &started);
+		}
+		msec = time_loads(file, count, modes[mode].async, &started);
+		printf("%-12s %8.2f ms per load, %8.2f ms before returning\n",
+			modes[mode].name, msec,
+			started * 1000.0 / SDL_GetPerformanceFrequency() / count);
+		Mix_SetChunkCache(NULL);
+		Mix_CloseAudio();
+		audio_open = 0;
+	}
+}
+
+/*
+ * Issue about 10000 channel commands a second from this thread while the
+ *  mixer runs, and see how long the calls take and how late the audio
+ *  callbacks get, with and without the command queue.
+ */
+static Uint64 last_callback, max_interval, total_interval;
+static int callbacks;
+
+static void stress_callback(void *udata, Uint8 *stream, int len)
+{
+	Uint64 now = SDL_GetPerformanceCounter();
+
+	if ( last_callback ) {
+		Uint64 interval = now - last_callback;
+		if ( interval > max_interval ) {
+			max_interval = interval;
+		}
+		total_interval += interval;
+		++callbacks;
+	}
+	last_callback = now;
+}
+
+static void stress_commands(const char *name, const char *file, int seconds,
+		int audio_rate, Uint16 audio_format, int audio_channels)
+{
+	const double usec = 1000000.0 / SDL_GetPerformanceFrequency();
+	Uint64 start, elapsed, max_call = 0, total_call = 0;
+	Uint32 begin, end;
+	int commands = 0;
+
+	if (Mix_OpenAudio(audio_rate, audio_format, audio_channels, 1024) < 0) {
+		fprintf(stderr, "Couldn't open audio: %s\n", SDL_GetError());
+		CleanUp(2);
+	}
+	audio_open = 1;
+	wave = Mix_LoadWAV(file);
+	if ( wave == NULL ) {
+		fprintf(stderr, "Couldn't load %s: %s\n", file, SDL_GetError());
+		CleanUp(2);
+	}
+	Mix_AllocateChannels(64);
+
+	SDL_LockAudio();
+	last_callback = 0;
+	max_interval = 0;
+	total_interval = 0;
+	callbacks = 0;
+	Mix_HookMusic(stress_callback, NULL);
+	SDL_UnlockAudio();
+
+	begin = SDL_GetTicks();
+	end = begin + seconds * 1000;
+	while ( SDL_GetTicks() < end ) {
+		/* Catch up to ten commands for every millisecond so far */
+		while ( commands < (int) (SDL_GetTicks() - begin) * 10 ) {
+			int chan = (commands * 7) % 64;
+
+			start = SDL_GetPerformanceCounter();
+			switch (commands % 4) {
+			    case 0:
+				if ( Mix_PlayChannel(-1, wave, 0) < 0 ) {
+					Mix_HaltChannel(chan);
+				}
+				break;
+			    case 1:
+				Mix_Volume(chan, commands % MIX_MAX_VOLUME);
+				break;
+			    case 2:
+				Mix_FadeOutChannel(chan, 50);
+				break;
+			    case 3:
+				Mix_HaltChannel(chan);
+				break;
+			}
+			elapsed = SDL_GetPerformanceCounter() - start;
+			if ( elapsed > max_call ) {
+				max_call = elapsed;
+			}
+			total_call += elapsed;
+			++commands;
+		}
+		SDL_Delay(1);
+	}
+
+	SDL_LockAudio();
+	Mix_HookMusic(NULL, NULL);
+	SDL_UnlockAudio();
+	printf("%-14s %6d commands/s, calls %6.2f us avg %8.1f us max, "
+		"callbacks every %6.0f us, %6.0f us max\n", name,
+		commands / seconds, total_call * usec / commands, max_call * usec,
+		callbacks ? total_interval * usec / callbacks : 0.0,
+		max_interval * usec);
+
+	Mix_HaltChannel(-1);
+	Mix_FreeChunk(wave);
+	wave = NULL;
+	Mix_CloseAudio();
+	audio_open = 0;
+}
+
+static void stress(const char *file, int seconds, int audio_rate,
+					Uint16 audio_format, int audio_channels)
+{
+	bench_init();
+	stress_commands("command queue", file, seconds, audio_rate,
+			audio_format, audio_channels);
+	SDL_putenv("MIX_NOCOMMANDQUEUE=1");
+	stress_commands("locking", file, seconds, audio_rate,
+			audio_format, audio_channels);
 }
 
 
@@ -343,6 +707,11 @@ int main(int argc, char *argv[])
 	int i;
 	int reverse_stereo = 0;
 	int reverse_sample = 0;
+	int bench = 0;
+	int benchpos = 0;
+	int stress_seconds = 0;
+	int benchload = 0;
+	char *cache = NULL;
 
 	setbuf(stdout, NULL);    /* rcg06132001 for debugging purposes. */
 	setbuf(stderr, NULL);    /* rcg06192001 for debugging purposes, too. */
@@ -377,6 +746,26 @@ int main(int argc, char *argv[])
 		} else
 		if ( strcmp(argv[i], "-F") == 0 ) { /* rcg06172001 flip sample */
 			reverse_sample = 1;
+		} else
+		if ( (strcmp(argv[i], "-bench") == 0) && argv[i+1] ) {
+			++i;
+			bench = atoi(argv[i]);
+		} else
+		if ( (strcmp(argv[i], "-benchpos") == 0) && argv[i+1] ) {
+			++i;
+			benchpos = atoi(argv[i]);
+		} else
+		if ( (strcmp(argv[i], "-stress") == 0) && argv[i+1] ) {
+			++i;
+			stress_seconds = atoi(argv[i]);
+		} else
+		if ( (strcmp(argv[i], "-benchload") == 0) && argv[i+1] ) {
+			++i;
+			benchload = atoi(argv[i]);
+		} else
+		if ( (strcmp(argv[i], "-cache") == 0) && argv[i+1] ) {
+			++i;
+			cache = argv[i];
 		} else {
 			Usage(argv[0]);
 			return(1);
@@ -387,6 +776,25 @@ int main(int argc, char *argv[])
 		return(1);
 	}
 
+	if ( bench > 0 ) {
+		benchmark(argv[i], bench, audio_rate, audio_format, audio_channels);
+		CleanUp(0);
+	}
+	if ( benchpos > 0 ) {
+		benchmark_position(argv[i], benchpos, audio_rate);
+		CleanUp(0);
+	}
+	if ( stress_seconds > 0 ) {
+		stress(argv[i], stress_seconds, audio_rate, audio_format,
+			audio_channels);
+		CleanUp(0);
+	}
+	if ( benchload > 0 ) {
+		benchmark_load(argv[i], benchload, cache, audio_rate,
+			audio_format, audio_channels);
+		CleanUp(0);
+	}
+
 	/* Initialize the SDL library */
 	if ( SDL_Init(SDL_INIT_AUDIO) < 0 ) {
 		fprintf(stderr, "Couldn't initialize SDL: %s\n",SDL_GetError());
@@ -418,6 +826,9 @@ int main(int argc, char *argv[])
 #endif
 
 	/* Load the requested wave file */
+	if ( cache ) {
+		Mix_SetChunkCache(cache);
+	}
 	wave = Mix_LoadWAV(argv[i]);
 	if ( wave == NULL ) {
 		fprintf(stderr, "Couldn't load %s: %s\n",
@@ -218,6 +218,79 @@ static int update_signal(int v)
 #define MIXCENT(a,b) *lp++ += (a/2+b/2) * s
 #define MIXHALF(a)	*lp++ += (a>>1)*s;
 
+#if defined(__SSE2__) && !defined(LOOKUP_HACK)
+#include <emmintrin.h>
+
+/* Product of eight samples and a 16-bit volume as two vectors of int32:
+   the low and high halves of each product, interleaved. */
+#  define MIX_SSE2_PRODUCTS(p0, p1, sp, vol) \
+  { \
+    __m128i x=_mm_loadu_si128((__m128i *)(sp)), \
+      lo=_mm_mullo_epi16(x, vol), hi=_mm_mulhi_epi16(x, vol); \
+    p0=_mm_unpacklo_epi16(lo, hi); \
+    p1=_mm_unpackhi_epi16(lo, hi); \
+  }
+#  define MIX_SSE2_ADD(lp, p) \
+  _mm_storeu_si128((__m128i *)(lp), \
+		   _mm_add_epi32(_mm_loadu_si128((__m128i *)(lp)), p))
+#  define MIX_SSE2_VOLUME_OK(a) ((a) >= -32768 && (a) <= 32767)
+#endif
+
+/* One channel of count samples at a constant volume */
+static void mix_mono_run(resample_t *sp, int32 *lp, final_volume_t left,
+			 int count)
+{
+  resample_t s;
+
+#ifdef MIX_SSE2_PRODUCTS
+  if (MIX_SSE2_VOLUME_OK(left))
+    {
+      __m128i vol=_mm_set1_epi16((short)left), p0, p1;
+
+      for (; count >= 8; count -= 8, sp += 8, lp += 8)
+	{
+	  MIX_SSE2_PRODUCTS(p0, p1, sp, vol);
+	  MIX_SSE2_ADD(lp, p0);
+	  MIX_SSE2_ADD(lp+4, p1);
+	}
+    }
+#endif
+  while (count--)
+    {
+      s = *sp++;
+      MIXATION(left);
+    }
+}
+
+/* Both channels of stereo output, the same volume in each */
+static void mix_center_run(resample_t *sp, int32 *lp, final_volume_t left,
+			   int count)
+{
+  resample_t s;
+
+#ifdef MIX_SSE2_PRODUCTS
+  if (MIX_SSE2_VOLUME_OK(left))
+    {
+      __m128i vol=_mm_set1_epi16((short)left), p0, p1;
+
+      for (; count >= 8; count -= 8, sp += 8, lp += 16)
+	{
+	  MIX_SSE2_PRODUCTS(p0, p1, sp, vol);
+	  MIX_SSE2_ADD(lp, _mm_unpacklo_epi32(p0, p0));
+	  MIX_SSE2_ADD(lp+4, _mm_unpackhi_epi32(p0, p0));
+	  MIX_SSE2_ADD(lp+8, _mm_unpacklo_epi32(p1, p1));
+	  MIX_SSE2_ADD(lp+12, _mm_unpackhi_epi32(p1, p1));
+	}
+    }
+#endif
+  while (count--)
+    {
+      s = *sp++;
+      MIXATION(left);
+      MIXATION(left);
+    }
+}
+
 static void mix_mystery_signal(resample_t *sp, int32 *lp, int v, int count)
 {
   Voice *vp = voice + v;
@@ -314,14 +387,17 @@ static void mix_center_signal(resample_t *sp, int32 *lp, int v, int count)
     if (cc < count)
       {
 	count -= cc;
+	if (num_ochannels == 2)
+	  {
+	    mix_center_run(sp, lp, left, cc);
+	    sp += cc;
+	    lp += 2*cc;
+	  }
+	else
 	while (cc--)
 	  {
 	    s = *sp++;
-		if (num_ochannels == 2) {
-	    		MIXATION(left);
-	    		MIXATION(left);
-		}
-		else if (num_ochannels == 4) {
+		if (num_ochannels == 4) {
 			MIXATION(left);
 			MIXSKIP;
 			MIXATION(left);
@@ -344,14 +420,13 @@ static void mix_center_signal(resample_t *sp, int32 *lp, int v, int count)
     else
       {
 	vp->control_counter = cc - count;
+	if (num_ochannels == 2)
+	  mix_center_run(sp, lp, left, count);
+	else
 	while (count--)
 	  {
 	    s = *sp++;
-		if (num_ochannels == 2) {
-	    		MIXATION(left);
-	    		MIXATION(left);
-		}
-		else if (num_ochannels == 4) {
+		if (num_ochannels == 4) {
 			MIXATION(left);
 			MIXSKIP;
 			MIXATION(left);
@@ -510,7 +585,6 @@ static void mix_mono_signal(resample_t *sp, int32 *lp, int v, int count)
   final_volume_t 
     left=vp->left_mix;
   int cc;
-  resample_t s;
   
   if (!(cc = vp->control_counter))
     {
@@ -524,11 +598,9 @@ static void mix_mono_signal(resample_t *sp, int32 *lp, int v, int count)
     if (cc < count)
       {
 	count -= cc;
-	while (cc--)
-	  {
-	    s = *sp++;
-	    MIXATION(left);
-	  }
+	mix_mono_run(sp, lp, left, cc);
+	sp += cc;
+	lp += cc;
 	cc = control_ratio;
 	if (update_signal(v))
 	  return;	/* Envelope ran out */
@@ -537,11 +609,7 @@ static void mix_mono_signal(resample_t *sp, int32 *lp, int v, int count)
     else
       {
 	vp->control_counter = cc - count;
-	while (count--)
-	  {
-	    s = *sp++;
-	    MIXATION(left);
-	  }
+	mix_mono_run(sp, lp, left, count);
 	return;
       }
 }
@@ -579,14 +647,15 @@ static void mix_center(resample_t *sp, int32 *lp, int v, int count)
     left=voice[v].left_mix;
   resample_t s;
   
+  if (num_ochannels == 2)
+    {
+      mix_center_run(sp, lp, left, count);
+      return;
+    }
   while (count--)
     {
       s = *sp++;
-		if (num_ochannels == 2) {
-      			MIXATION(left);
-      			MIXATION(left);
-		}
-		else if (num_ochannels == 4) {
+		if (num_ochannels == 4) {
       			MIXATION(left);
       			MIXATION(left);
 			MIXSKIP;
@@ -656,15 +725,7 @@ static void mix_single_right(resample_t *sp, int32 *lp, int v, int count)
 
 static void mix_mono(resample_t *sp, int32 *lp, int v, int count)
 {
-  final_volume_t 
-    left=voice[v].left_mix;
-  resample_t s;
-  
-  while (count--)
-    {
-      s = *sp++;
-      MIXATION(left);
-    }
+  mix_mono_run(sp, lp, voice[v].left_mix, count);
 }
 
 /* Ramp a note out in c samples */
@@ -801,7 +862,7 @@ static void ramp_out(resample_t *sp, int32 *lp, int v, int32 c)
 
 /**************** interface function ******************/
 
-void mix_voice(int32 *buf, int v, int32 c)
+void mix_voice(int32 *buf, int v, int32 c, resample_t *rbuf)
 {
   Voice *vp=voice+v;
   int32 count=c;
@@ -811,13 +872,13 @@ void mix_voice(int32 *buf, int v, int32 c)
     {
       if (count>=MAX_DIE_TIME)
 	count=MAX_DIE_TIME;
-      sp=resample_voice(v, &count);
+      sp=resample_voice(v, &count, rbuf);
       ramp_out(sp, buf, v, count);
       vp->status=VOICE_FREE;
     }
   else
     {
-      sp=resample_voice(v, &count);
+      sp=resample_voice(v, &count, rbuf);
       if (count<0) return;
       if (play_mode->encoding & PE_MONO)
 	{
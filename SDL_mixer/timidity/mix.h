@@ -22,6 +22,6 @@
 
 */
 
-extern void mix_voice(int32 *buf, int v, int32 c);
+extern void mix_voice(int32 *buf, int v, int32 c, resample_t *rbuf);
 extern int recompute_envelope(int v);
 extern void apply_envelope_to_amp(int v);
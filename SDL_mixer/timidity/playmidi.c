@@ -26,6 +26,7 @@
 #include <string.h>
 
 #include <SDL_rwops.h>
+#include <SDL_thread.h>
 
 #include "config.h"
 #include "common.h"
@@ -36,6 +37,7 @@
 #include "mix.h"
 #include "ctrlmode.h"
 #include "timidity.h"
+#include "../mix_atomic.h"
 
 #include "tables.h"
 
@@ -85,6 +87,30 @@ static int32 buffered_count;
 extern int32 *common_buffer;
 extern resample_t *resample_buffer; /* to free it on Timidity_Close */
 
+/* With more than one render thread, do_compute_data() hands the voices
+   out one at a time to the renderers and to itself.  Each renderer mixes
+   into a resample buffer and an accumulator of its own, and the
+   accumulators are added into the common buffer at the end.  A voice
+   only touches its own state while it's being mixed and the sums are in
+   integers, so the output doesn't depend on who mixed which voice. */
+typedef struct {
+  SDL_Thread *thread;
+  SDL_sem *go;
+  int32 *buffer;
+  resample_t *resample_buffer;
+  int mixed;
+} Renderer;
+
+/* Not worth waking the renderers for less than this */
+#define MIN_RENDER_COUNT 64
+
+static Renderer *renderers = NULL;
+static int renderer_count = 0;
+static SDL_sem *renderers_done = NULL;
+static volatile int renderers_quit = 0;
+static volatile int next_voice = 0;
+static uint32 render_count = 0;
+
 static MidiEvent *event_list, *current_event;
 static int32 sample_count, current_sample;
 
@@ -1442,27 +1468,154 @@ static int apply_controls(void)
     return rc;
 }
 
-static void do_compute_data(uint32 count)
+static void render_voice(int i, int32 *buf, uint32 count, resample_t *rbuf)
+{
+  if (!voice[i].sample_offset && voice[i].echo_delay_count)
+    {
+      if ((uint32)voice[i].echo_delay_count >= count) voice[i].echo_delay_count -= count;
+      else
+	{
+	  mix_voice(buf+voice[i].echo_delay_count, i, count-voice[i].echo_delay_count, rbuf);
+	  voice[i].echo_delay_count = 0;
+	}
+    }
+  else mix_voice(buf, i, count, rbuf);
+}
+
+/* Mixes voices into buf until they've all been taken.  Returns 1 if it
+   mixed any, clearing buf first if asked to. */
+static int render_voices(int32 *buf, uint32 count, resample_t *rbuf, int clear)
+{
+  int i, mixed=0;
+
+  while ((i=_Mix_AtomicAdd(&next_voice, 1)) < voices)
+    {
+      if (voice[i].status == VOICE_FREE)
+	continue;
+      if (!mixed && clear)
+	memset(buf, 0, count * num_ochannels * 4);
+      mixed=1;
+      render_voice(i, buf, count, rbuf);
+    }
+  return mixed;
+}
+
+static int renderer_thread(void *data)
+{
+  Renderer *r=(Renderer *)data;
+
+  for (;;)
+    {
+      SDL_SemWait(r->go);
+      if (renderers_quit)
+	break;
+      r->mixed=render_voices(r->buffer, render_count, r->resample_buffer, 1);
+      SDL_SemPost(renderers_done);
+    }
+  return 0;
+}
+
+static void stop_renderers(void)
 {
   int i;
-  if (!count) return; /* (gl) */
-  memset(buffer_pointer, 0, count * num_ochannels * 4);
-  for (i=0; i<voices; i++)
+
+  renderers_quit=1;
+  for (i=0; i<renderer_count; i++)
+    SDL_SemPost(renderers[i].go);
+  for (i=0; i<renderer_count; i++)
+    {
+      SDL_WaitThread(renderers[i].thread, NULL);
+      SDL_DestroySemaphore(renderers[i].go);
+      free(renderers[i].buffer);
+      free(renderers[i].resample_buffer);
+    }
+  free(renderers);
+  renderers=NULL;
+  renderer_count=0;
+  renderers_quit=0;
+  if (renderers_done) {
+    SDL_DestroySemaphore(renderers_done);
+    renderers_done=NULL;
+  }
+}
+
+int Timidity_SetThreads(int threads)
+{
+#ifndef MIX_ATOMIC_DISABLED
+  Renderer *r;
+#endif
+
+  stop_renderers();
+#ifndef MIX_ATOMIC_DISABLED
+  if (threads <= 1 || !common_buffer)
+    return 0;
+  renderers_done=SDL_CreateSemaphore(0);
+  if (!renderers_done)
+    return -1;
+  renderers=(Renderer *)safe_malloc((threads-1) * sizeof(Renderer));
+  while (renderer_count < threads-1)
     {
-      if(voice[i].status != VOICE_FREE)
+      r=&renderers[renderer_count];
+      r->go=SDL_CreateSemaphore(0);
+      if (!r->go)
+	break;
+      r->buffer=(int32 *)safe_malloc(AUDIO_BUFFER_SIZE*num_ochannels*sizeof(int32));
+      r->resample_buffer=(resample_t *)safe_malloc(AUDIO_BUFFER_SIZE*sizeof(resample_t)+100);
+      r->thread=SDL_CreateThread(renderer_thread, r);
+      if (!r->thread)
 	{
-	  if (!voice[i].sample_offset && voice[i].echo_delay_count)
-	    {
-		if ((uint32)voice[i].echo_delay_count >= count) voice[i].echo_delay_count -= count;
-		else
-		  {
-	            mix_voice(buffer_pointer+voice[i].echo_delay_count, i, count-voice[i].echo_delay_count);
-		    voice[i].echo_delay_count = 0;
-		  }
-	    }
-	  else mix_voice(buffer_pointer, i, count);
+	  SDL_DestroySemaphore(r->go);
+	  free(r->buffer);
+	  free(r->resample_buffer);
+	  break;
 	}
+      renderer_count++;
     }
+  if (!renderer_count)
+    {
+      stop_renderers();
+      return -1;
+    }
+#endif
+  return 0;
+}
+
+static void do_compute_data(uint32 count)
+{
+  int i, j, active, woken;
+  if (!count) return; /* (gl) */
+  memset(buffer_pointer, 0, count * num_ochannels * 4);
+
+  active=0;
+  if (renderer_count && count >= MIN_RENDER_COUNT)
+    for (i=0; i<voices; i++)
+      if (voice[i].status != VOICE_FREE)
+	active++;
+
+  if (active > 1)
+    {
+      woken=(active-1 < renderer_count) ? active-1 : renderer_count;
+      next_voice=0;
+      render_count=count;
+      for (i=0; i<woken; i++)
+	SDL_SemPost(renderers[i].go);
+      render_voices(buffer_pointer, count, resample_buffer, 0);
+      for (i=0; i<woken; i++)
+	SDL_SemWait(renderers_done);
+      for (i=0; i<woken; i++)
+	if (renderers[i].mixed)
+	  {
+	    int32 *sp=renderers[i].buffer;
+	    for (j=count*num_ochannels; j--; )
+	      buffer_pointer[j] += sp[j];
+	  }
+    }
+  else
+    for (i=0; i<voices; i++)
+      {
+	if(voice[i].status != VOICE_FREE)
+	  render_voice(i, buffer_pointer, count, resample_buffer);
+      }
   current_sample += count;
 }
 
@@ -1782,6 +1935,7 @@ void Timidity_FreeSong(MidiSong *song)
 
 void Timidity_Close(void)
 {
+  stop_renderers();
   if (resample_buffer) {
     free(resample_buffer);
     resample_buffer=NULL;
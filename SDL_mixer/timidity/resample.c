@@ -56,11 +56,70 @@
 #define FINALINTERP if (ofs == le) *dest++=src[ofs>>FRACTION_BITS];
 /* So it isn't interpolation. At least it's final. */
 
-extern resample_t *resample_buffer;
+#if defined(__SSE2__) && defined(LINEAR_INTERPOLATION) && \
+    !defined(LOOKUP_HACK) && SDL_BYTEORDER == SDL_LIL_ENDIAN
+#include <string.h>
+#include <emmintrin.h>
+
+/* A sample and the one after it, as one 32-bit lane */
+static int32 rs_pair(sample_t *src, int32 ofs)
+{
+  int32 pair;
+  memcpy(&pair, src + (ofs>>FRACTION_BITS), sizeof(pair));
+  return pair;
+}
+
+/* Does RESAMPLATION with a fixed increment eight points at a time, for
+   as long as there are eight left in *ip.  v1*(1-frac) + v2*frac is a
+   single multiply-add on each pair, and comes out exactly the same as
+   v1 + (v2-v1)*frac once it's shifted down. */
+static resample_t *rs_run(resample_t *dest, sample_t *src, int32 *ofsp,
+			  int32 incr, int32 *ip)
+{
+  int32 ofs=*ofsp, i=*ip;
+  __m128i
+    mask=_mm_set1_epi32(FRACTION_MASK),
+    one=_mm_set1_epi32(1<<FRACTION_BITS),
+    steps=_mm_setr_epi32(0, incr, 2*incr, 3*incr),
+    four=_mm_set1_epi32(4*incr);
+
+  while (i >= 8)
+    {
+      __m128i f0, f1, w0, w1, p0, p1;
+
+      f0=_mm_add_epi32(_mm_set1_epi32(ofs), steps);
+      f1=_mm_and_si128(_mm_add_epi32(f0, four), mask);
+      f0=_mm_and_si128(f0, mask);
+      w0=_mm_or_si128(_mm_slli_epi32(f0, 16), _mm_sub_epi32(one, f0));
+      w1=_mm_or_si128(_mm_slli_epi32(f1, 16), _mm_sub_epi32(one, f1));
+      p0=_mm_setr_epi32(rs_pair(src, ofs), rs_pair(src, ofs+incr),
+			rs_pair(src, ofs+2*incr), rs_pair(src, ofs+3*incr));
+      p1=_mm_setr_epi32(rs_pair(src, ofs+4*incr), rs_pair(src, ofs+5*incr),
+			rs_pair(src, ofs+6*incr), rs_pair(src, ofs+7*incr));
+      p0=_mm_srai_epi32(_mm_madd_epi16(p0, w0), FRACTION_BITS);
+      p1=_mm_srai_epi32(_mm_madd_epi16(p1, w1), FRACTION_BITS);
+      _mm_storeu_si128((__m128i *)dest, _mm_packs_epi32(p0, p1));
+      dest += 8;
+      ofs += 8*incr;
+      i -= 8;
+    }
+  *ofsp=ofs;
+  *ip=i;
+  return dest;
+}
+
+#  define RESAMPLE_RUN(i) \
+  { \
+    dest=rs_run(dest, src, &ofs, incr, &i); \
+    while (i--) { RESAMPLATION; ofs += incr; } \
+  }
+#else
+#  define RESAMPLE_RUN(i) while (i--) { RESAMPLATION; ofs += incr; }
+#endif
 
 /*************** resampling with fixed increment *****************/
 
-static resample_t *rs_plain(int v, int32 *countptr)
+static resample_t *rs_plain(int v, int32 *countptr, resample_t *buffer)
 {
 
   /* Play sample until end, then free the voice. */
@@ -69,7 +128,7 @@ static resample_t *rs_plain(int v, int32 *countptr)
   Voice 
     *vp=&voice[v];
   resample_t 
-    *dest=resample_buffer;
+    *dest=buffer;
   sample_t 
     *src=vp->sample->data;
   int32 
@@ -79,7 +138,7 @@ static resample_t *rs_plain(int v, int32 *countptr)
     count=*countptr;
 
 #ifdef PRECALC_LOOPS
-  int32 i, j;
+  int32 i;
 
   if (incr<0) incr = -incr; /* In case we're coming out of a bidir loop */
 
@@ -94,11 +153,7 @@ static resample_t *rs_plain(int v, int32 *countptr)
     } 
   else count -= i;
 
-  for(j = 0; j < i; j++)
-    {
-      RESAMPLATION;
-      ofs += incr;
-    }
+  RESAMPLE_RUN(i);
 
   if (ofs >= le) 
     {
@@ -125,10 +180,10 @@ static resample_t *rs_plain(int v, int32 *countptr)
 #endif /* PRECALC_LOOPS */
   
   vp->sample_offset=ofs; /* Update offset */
-  return resample_buffer;
+  return buffer;
 }
 
-static resample_t *rs_loop(Voice *vp, int32 count)
+static resample_t *rs_loop(Voice *vp, int32 count, resample_t *buffer)
 {
 
   /* Play sample until end-of-loop, skip back and continue. */
@@ -140,14 +195,14 @@ static resample_t *rs_loop(Voice *vp, int32 count)
     le=vp->sample->loop_end, 
     ll=le - vp->sample->loop_start;
   resample_t
-    *dest=resample_buffer;
+    *dest=buffer;
   sample_t
     *src=vp->sample->data;
 
 #ifdef PRECALC_LOOPS
   int32 i;
  
-  if (ofs < 0 || le < 0) return resample_buffer;
+  if (ofs < 0 || le < 0) return buffer;
 
   while (count) 
     {
@@ -163,11 +218,7 @@ static resample_t *rs_loop(Voice *vp, int32 count)
 	} 
       else count -= i;
       if (i > 0)
-      while (i--) 
-	{
-	  RESAMPLATION;
-	  ofs += incr;
-	}
+      RESAMPLE_RUN(i);
     }
 #else
   while (count--)
@@ -180,10 +231,10 @@ static resample_t *rs_loop(Voice *vp, int32 count)
 #endif
 
   vp->sample_offset=ofs; /* Update offset */
-  return resample_buffer;
+  return buffer;
 }
 
-static resample_t *rs_bidir(Voice *vp, int32 count)
+static resample_t *rs_bidir(Voice *vp, int32 count, resample_t *buffer)
 {
   INTERPVARS;
   int32 
@@ -192,7 +243,7 @@ static resample_t *rs_bidir(Voice *vp, int32 count)
     le=vp->sample->loop_end,
     ls=vp->sample->loop_start;
   resample_t 
-    *dest=resample_buffer; 
+    *dest=buffer; 
   sample_t 
     *src=vp->sample->data;
 
@@ -215,11 +266,7 @@ static resample_t *rs_bidir(Voice *vp, int32 count)
 	  count = 0;
 	} 
       else count -= i;
-      while (i--) 
-	{
-	  RESAMPLATION;
-	  ofs += incr;
-	}
+      RESAMPLE_RUN(i);
     }
 
   /* Then do the bidirectional looping */
@@ -234,11 +281,7 @@ static resample_t *rs_bidir(Voice *vp, int32 count)
 	  count = 0;
 	} 
       else count -= i;
-      while (i--) 
-	{
-	  RESAMPLATION;
-	  ofs += incr;
-	}
+      RESAMPLE_RUN(i);
       if (ofs>=le) 
 	{
 	  /* fold the overshoot back in */
@@ -288,7 +331,7 @@ static resample_t *rs_bidir(Voice *vp, int32 count)
 #endif /* PRECALC_LOOPS */
   vp->sample_increment=incr;
   vp->sample_offset=ofs; /* Update offset */
-  return resample_buffer;
+  return buffer;
 }
 
 /*********************** vibrato versions ***************************/
@@ -368,7 +411,7 @@ static int32 update_vibrato(Voice *vp, int sign)
   return (int32) a;
 }
 
-static resample_t *rs_vib_plain(int v, int32 *countptr)
+static resample_t *rs_vib_plain(int v, int32 *countptr, resample_t *buffer)
 {
 
   /* Play sample until end, then free the voice. */
@@ -376,7 +419,7 @@ static resample_t *rs_vib_plain(int v, int32 *countptr)
   INTERPVARS;
   Voice *vp=&voice[v];
   resample_t 
-    *dest=resample_buffer; 
+    *dest=buffer; 
   sample_t 
     *src=vp->sample->data;
   int32 
@@ -413,10 +456,10 @@ static resample_t *rs_vib_plain(int v, int32 *countptr)
   vp->vibrato_control_counter=cc;
   vp->sample_increment=incr;
   vp->sample_offset=ofs; /* Update offset */
-  return resample_buffer;
+  return buffer;
 }
 
-static resample_t *rs_vib_loop(Voice *vp, int32 count)
+static resample_t *rs_vib_loop(Voice *vp, int32 count, resample_t *buffer)
 {
 
   /* Play sample until end-of-loop, skip back and continue. */
@@ -428,7 +471,7 @@ static resample_t *rs_vib_loop(Voice *vp, int32 count)
     le=vp->sample->loop_end,
     ll=le - vp->sample->loop_start;
   resample_t 
-    *dest=resample_buffer; 
+    *dest=buffer; 
   sample_t 
     *src=vp->sample->data;
   int 
@@ -455,11 +498,7 @@ static resample_t *rs_vib_loop(Voice *vp, int32 count)
 	} 
       else cc -= i;
       count -= i;
-      while(i--) 
-	{
-	  RESAMPLATION;
-	  ofs += incr;
-	}
+      RESAMPLE_RUN(i);
       if(vibflag) 
 	{
 	  cc = vp->vibrato_control_ratio;
@@ -486,10 +525,10 @@ static resample_t *rs_vib_loop(Voice *vp, int32 count)
   vp->vibrato_control_counter=cc;
   vp->sample_increment=incr;
   vp->sample_offset=ofs; /* Update offset */
-  return resample_buffer;
+  return buffer;
 }
 
-static resample_t *rs_vib_bidir(Voice *vp, int32 count)
+static resample_t *rs_vib_bidir(Voice *vp, int32 count, resample_t *buffer)
 {
   INTERPVARS;
   int32 
@@ -498,7 +537,7 @@ static resample_t *rs_vib_bidir(Voice *vp, int32 count)
     le=vp->sample->loop_end, 
     ls=vp->sample->loop_start;
   resample_t 
-    *dest=resample_buffer; 
+    *dest=buffer; 
   sample_t 
     *src=vp->sample->data;
   int 
@@ -524,11 +563,7 @@ static resample_t *rs_vib_bidir(Voice *vp, int32 count)
 	} 
       else cc -= i;
       count -= i;
-      while (i--) 
-	{
-	  RESAMPLATION;
-	  ofs += incr;
-	}
+      RESAMPLE_RUN(i);
       if (vibflag) 
 	{
 	  cc = vp->vibrato_control_ratio;
@@ -551,11 +586,7 @@ static resample_t *rs_vib_bidir(Voice *vp, int32 count)
 	} 
       else cc -= i;
       count -= i;
-      while (i--) 
-	{
-	  RESAMPLATION;
-	  ofs += incr;
-	}
+      RESAMPLE_RUN(i);
       if (vibflag) 
 	{
 	  cc = vp->vibrato_control_ratio;
@@ -623,10 +654,10 @@ static resample_t *rs_vib_bidir(Voice *vp, int32 count)
   vp->vibrato_control_counter=cc;
   vp->sample_increment=incr;
   vp->sample_offset=ofs; /* Update offset */
-  return resample_buffer;
+  return buffer;
 }
 
-resample_t *resample_voice(int v, int32 *countptr)
+resample_t *resample_voice(int v, int32 *countptr, resample_t *buffer)
 {
   int32 ofs;
   uint8 modes;
@@ -663,12 +694,12 @@ resample_t *resample_voice(int v, int32 *countptr)
 	   (vp->status==VOICE_ON || vp->status==VOICE_SUSTAINED)))
 	{
 	  if (modes & MODES_PINGPONG)
-	    return rs_vib_bidir(vp, *countptr);
+	    return rs_vib_bidir(vp, *countptr, buffer);
 	  else
-	    return rs_vib_loop(vp, *countptr);
+	    return rs_vib_loop(vp, *countptr, buffer);
 	}
       else
-	return rs_vib_plain(v, countptr);
+	return rs_vib_plain(v, countptr, buffer);
     }
   else
     {
@@ -677,12 +708,12 @@ resample_t *resample_voice(int v, int32 *countptr)
 	   (vp->status==VOICE_ON || vp->status==VOICE_SUSTAINED)))
 	{
 	  if (modes & MODES_PINGPONG)
-	    return rs_bidir(vp, *countptr);
+	    return rs_bidir(vp, *countptr, buffer);
 	  else
-	    return rs_loop(vp, *countptr);
+	    return rs_loop(vp, *countptr, buffer);
 	}
       else
-	return rs_plain(v, countptr);
+	return rs_plain(v, countptr, buffer);
     }
 }
 
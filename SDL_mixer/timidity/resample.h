@@ -20,5 +20,5 @@
     resample.h
 */
 
-extern resample_t *resample_voice(int v, int32 *countptr);
+extern resample_t *resample_voice(int v, int32 *countptr, resample_t *buffer);
 extern void pre_resample(Sample *sp);
@@ -24,6 +24,7 @@ typedef struct _MidiSong MidiSong;
 extern int Timidity_Init(int rate, int format, int channels, int samples);
 extern char *Timidity_Error(void);
 extern void Timidity_SetVolume(int volume);
+extern int Timidity_SetThreads(int threads);
 extern int Timidity_PlaySome(void *stream, int samples);
 extern MidiSong *Timidity_LoadSong(char *midifile);
 extern MidiSong *Timidity_LoadSong_RW(SDL_RWops *rw);
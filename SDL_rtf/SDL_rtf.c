@@ -78,9 +78,17 @@ RTF_Context *RTF_CreateContext(RTF_FontEngine *fontEngine)
 int RTF_Load_RW(RTF_Context *ctx, SDL_RWops *src, int freesrc)
 {
         int retval;
+        SDL_RWops *buffered;
 
         ecClearContext(ctx);
 
+        /* The parser reads a character at a time, so read ahead */
+        buffered = SDL_RWBuffered(src, 0, freesrc);
+        if ( buffered ) {
+                src = buffered;
+                freesrc = 1;
+        }
+
         /* Set up the input stream for loading */
         ctx->rds = 0;
         ctx->ris = 0;
@@ -188,6 +188,7 @@ int ecClearColors(RTF_Context *ctx)
         RTF_FreeColor(e->color);
         free(e);
     }
+    ctx->colorTable = NULL;
     return ecOK;
 }
 
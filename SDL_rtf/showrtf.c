@@ -162,9 +162,34 @@ static void LoadRTF(RTF_Context *ctx, const char *file)
     SDL_WM_SetCaption(RTF_GetTitle(ctx), file);
 }
 
+/* Time loading a document with and without read-ahead buffering */
+static void BenchmarkRTF(RTF_Context *ctx, const char *file, int iterations)
+{
+    static char *modes[] = {
+        "SDL_RWOPS_BUFFER_SIZE=0", "SDL_RWOPS_BUFFER_SIZE=4096"
+    };
+    Uint32 start, now;
+    int i, mode;
+
+    for ( mode = 0; mode < 2; ++mode ) {
+        SDL_putenv(modes[mode]);
+        start = SDL_GetTicks();
+        for ( i = 0; i < iterations; ++i ) {
+            if ( RTF_Load(ctx, file) < 0 ) {
+                fprintf(stderr, "Couldn't load %s: %s\n", file, RTF_GetError());
+                return;
+            }
+        }
+        now = SDL_GetTicks();
+        printf("%s: %.3f ms per load %s\n", file,
+               (double)(now - start) / iterations,
+               mode ? "with read-ahead" : "unbuffered");
+    }
+}
+
 static void PrintUsage(const char *argv0)
 {
-    printf("Usage: %s -fdefault font.ttf [-froman font.ttf] [-fswiss font.ttf] [-fmodern font.ttf] [-fscript font.ttf] [-fdecor font.ttf] [-ftech font.ttf] file.rtf\n", argv0);
+    printf("Usage: %s -fdefault font.ttf [-froman font.ttf] [-fswiss font.ttf] [-fmodern font.ttf] [-fscript font.ttf] [-fdecor font.ttf] [-ftech font.ttf] [-bench N] file.rtf\n", argv0);
 }
 
 static void cleanup(int exitcode)
@@ -178,6 +203,7 @@ int main(int argc, char *argv[])
 {
     int i, start, stop;
     int done;
+    int bench = 0;
     int height;
     int offset;
     SDL_Surface *screen;
@@ -202,6 +228,8 @@ int main(int argc, char *argv[])
             FontList[FontFamilyToIndex(RTF_FontDecor)] = argv[++i];
         } else if ( strcmp(argv[i], "-ftech") == 0 ) {
             FontList[FontFamilyToIndex(RTF_FontTech)] = argv[++i];
+        } else if ( strcmp(argv[i], "-bench") == 0 ) {
+            bench = atoi(argv[++i]);
         } else {
             break;
         }
@@ -245,6 +273,11 @@ int main(int argc, char *argv[])
         fprintf(stderr, "Couldn't create RTF context: %s\n", RTF_GetError());
         cleanup(5);
     }
+    if ( bench > 0 ) {
+        BenchmarkRTF(ctx, argv[i], bench);
+        RTF_FreeContext(ctx);
+        cleanup(0);
+    }
     LoadRTF(ctx, argv[i]);
 
     /* Render the document to the screen */
@@ -61,6 +61,16 @@
 #define CACHED_BITMAP	0x01
 #define CACHED_PIXMAP	0x02
 
+/* The styles that change the glyphs themselves */
+#define GLYPH_STYLES	(TTF_STYLE_BOLD|TTF_STYLE_ITALIC)
+
+/* How many bytes of glyphs a font keeps by default */
+#define DEFAULT_CACHE_SIZE	(2*1024*1024)
+
+/* The smallest atlas page, and the opaque block used for underlines */
+#define ATLAS_SIZE	512
+#define ATLAS_BLOCK	4
+
 /* Cached glyph information */
 typedef struct cached_glyph {
 	int stored;
@@ -74,8 +84,76 @@ typedef struct cached_glyph {
 	int yoffset;
 	int advance;
 	Uint16 cached;
+
+	/* The glyph cache key, and the glyphs used just before and after */
+	Uint16 ch;
+	int style;
+	int newer;
+	int older;
+
+	/* The atlas page plus one and position, if the glyph was packed */
+	int atlas;
+	int atlas_x;
+	int atlas_y;
 } c_glyph;
 
+/* How many characters a TTF_PrewarmFont() thread takes at a time */
+#define PREWARM_CHUNK	64
+
+/* The number of hash chains for cached runs of text */
+#define RUN_BUCKETS	256
+
+/* How the surface of a cached run was rendered */
+#define RUN_SOLID	1
+#define RUN_SHADED	2
+#define RUN_BLENDED	3
+
+/* A cached run of text, with its size and the last surface it was
+   rendered to */
+typedef struct cached_run {
+	Uint32 hash;
+	Uint16 *text;
+	int len;
+	int swapped;
+	int w;
+	int h;
+	int mode;
+	SDL_Color fg;
+	SDL_Color bg;
+	SDL_Surface *surface;
+	long size;
+	struct cached_run *next;
+	struct cached_run *newer;
+	struct cached_run *older;
+} c_run;
+
+/* The glyphs being rasterized by TTF_PrewarmFont() */
+typedef struct prewarm_job {
+	TTF_Font *font;
+	unsigned char *bytes;
+	long size;
+	Uint16 first;
+	int count;
+	int next;
+	SDL_mutex *lock;
+	c_glyph *glyphs;
+} prewarm_job;
+
+/* A row of glyphs on an atlas page, filled from the left */
+typedef struct atlas_shelf {
+	int y;
+	int height;
+	int x;
+} atlas_shelf;
+
+/* A surface that glyphs are packed into */
+typedef struct atlas_page {
+	SDL_Surface *surface;
+	atlas_shelf *shelves;
+	int num_shelves;
+	int updated;
+} atlas_page;
+
 /* The structure used to hold internal font information */
 struct _TTF_Font {
 	/* Freetype2 maintains all sorts of useful info itself */
@@ -98,10 +176,38 @@ struct _TTF_Font {
 	int underline_offset;
 	int underline_height;
 
-	/* Cache for style-transformed glyphs */
+	/* Cache for style-transformed glyphs.  The glyphs are kept in an
+	   array and found through an open-addressed hash table of their
+	   indices plus one, by character and style.  Once they take up more
+	   than cache_size bytes, the least recently used ones are freed. */
 	c_glyph *current;
-	c_glyph cache[256];
-	c_glyph scratch;
+	c_glyph *glyphs;
+	int num_glyphs;
+	int free_glyph;		/* chained through 'older', or -1 */
+	int *hash;
+	int hash_size;		/* a power of two */
+	int newest;
+	int oldest;
+	long cache_size;
+	long cache_bytes;
+	int cache_hits;
+	int cache_misses;
+	int cache_evictions;
+
+	/* Runs of text that were measured or rendered, by hash of the text,
+	   with the least recently used freed first past run_cache_size */
+	c_run **runs;
+	c_run *newest_run;
+	c_run *oldest_run;
+	long run_cache_size;
+	long run_cache_bytes;
+	int run_surfaces;
+	int run_hits;
+	int run_misses;
+
+	/* Pages of packed glyphs, which stay cached as long as the font */
+	atlas_page *atlas;
+	int num_atlas;
 
 	/* We are responsible for closing the font stream */
 	SDL_RWops *src;
@@ -110,6 +216,9 @@ struct _TTF_Font {
 
 	/* For non-scalable formats, we must remember which font index size */
 	int font_size_family;
+
+	/* The point size of scalable fonts, for TTF_PrewarmFont() */
+	int ptsize;
 };
 
 /* The FreeType font engine/library */
@@ -257,6 +366,11 @@ TTF_Font* TTF_OpenFontIndexRW( SDL_RWops *src, int freesrc, int ptsize, long ind
 	}
 	memset(font, 0, sizeof(*font));
 
+	font->free_glyph = -1;
+	font->newest = -1;
+	font->oldest = -1;
+	font->cache_size = DEFAULT_CACHE_SIZE;
+
 	font->src = src;
 	font->freesrc = freesrc;
 
@@ -290,6 +404,7 @@ TTF_Font* TTF_OpenFontIndexRW( SDL_RWops *src, int freesrc, int ptsize, long ind
 	if ( FT_IS_SCALABLE(face) ) {
 
 	  	/* Set the character size and use default DPI (72) */
+	  	font->ptsize = ptsize;
 	  	error = FT_Set_Char_Size( font->face, 0, ptsize * 64, 0, 0 );
 			if( error ) {
 	    	TTF_SetFTError( "Couldn't set font size", error );
@@ -392,18 +507,204 @@ static void Flush_Glyph( c_glyph* glyph )
 static void Flush_Cache( TTF_Font* font )
 {
 	int i;
-	int size = sizeof( font->cache ) / sizeof( font->cache[0] );
 
-	for( i = 0; i < size; ++i ) {
-		if( font->cache[i].cached ) {
-			Flush_Glyph( &font->cache[i] );
+	for( i = 0; i < font->num_glyphs; ++i ) {
+		Flush_Glyph( &font->glyphs[i] );
+	}
+	for( i = 0; i < font->num_atlas; ++i ) {
+		SDL_FreeSurface( font->atlas[i].surface );
+		free( font->atlas[i].shelves );
+	}
+	free( font->atlas );
+	font->atlas = NULL;
+	font->num_atlas = 0;
+	free( font->glyphs );
+	font->glyphs = NULL;
+	font->num_glyphs = 0;
+	font->free_glyph = -1;
+	free( font->hash );
+	font->hash = NULL;
+	font->hash_size = 0;
+	font->newest = -1;
+	font->oldest = -1;
+	font->cache_bytes = 0;
+	font->current = NULL;
+}
+
+static long Glyph_Size( const c_glyph* glyph )
+{
+	long size = sizeof( *glyph );
+
+	if( glyph->bitmap.buffer ) {
+		size += glyph->bitmap.pitch * glyph->bitmap.rows;
+	}
+	if( glyph->pixmap.buffer ) {
+		size += glyph->pixmap.pitch * glyph->pixmap.rows;
+	}
+	return size;
+}
+
+static int Hash_Glyph( const TTF_Font* font, Uint16 ch, int style )
+{
+	Uint32 hash = ((Uint32)ch | ((Uint32)style << 16)) * 2654435761U;
+
+	return (int)(hash ^ (hash >> 15)) & (font->hash_size - 1);
+}
+
+/* Returns the index of the cached glyph, or -1 */
+static int Lookup_Glyph( const TTF_Font* font, Uint16 ch, int style )
+{
+	int slot;
+	c_glyph* glyph;
+
+	if ( ! font->hash ) {
+		return -1;
+	}
+	for ( slot = Hash_Glyph( font, ch, style ); font->hash[slot];
+	      slot = (slot + 1) & (font->hash_size - 1) ) {
+		glyph = &font->glyphs[font->hash[slot] - 1];
+		if ( glyph->ch == ch && glyph->style == style ) {
+			return font->hash[slot] - 1;
+		}
+	}
+	return -1;
+}
+
+static void Insert_Hash( TTF_Font* font, int i )
+{
+	int slot = Hash_Glyph( font, font->glyphs[i].ch, font->glyphs[i].style );
+
+	while ( font->hash[slot] ) {
+		slot = (slot + 1) & (font->hash_size - 1);
+	}
+	font->hash[slot] = i + 1;
+}
+
+/* Empties the glyph's slot, moving back any glyphs after it that would
+   otherwise no longer be found */
+static void Remove_Hash( TTF_Font* font, int i )
+{
+	int mask = font->hash_size - 1;
+	int slot, next, home;
+
+	slot = Hash_Glyph( font, font->glyphs[i].ch, font->glyphs[i].style );
+	while ( font->hash[slot] != i + 1 ) {
+		slot = (slot + 1) & mask;
+	}
+	font->hash[slot] = 0;
+	for ( next = (slot + 1) & mask; font->hash[next];
+	      next = (next + 1) & mask ) {
+		c_glyph* glyph = &font->glyphs[font->hash[next] - 1];
+		home = Hash_Glyph( font, glyph->ch, glyph->style );
+		if ( ((next - home) & mask) >= ((next - slot) & mask) ) {
+			font->hash[slot] = font->hash[next];
+			font->hash[next] = 0;
+			slot = next;
 		}
+	}
+}
+
+static void Unlink_Glyph( TTF_Font* font, int i )
+{
+	c_glyph* glyph = &font->glyphs[i];
 
+	if ( glyph->newer >= 0 ) {
+		font->glyphs[glyph->newer].older = glyph->older;
+	} else {
+		font->newest = glyph->older;
 	}
-	if( font->scratch.cached ) {
-		Flush_Glyph( &font->scratch );
+	if ( glyph->older >= 0 ) {
+		font->glyphs[glyph->older].newer = glyph->newer;
+	} else {
+		font->oldest = glyph->newer;
 	}
+}
 
+static void Link_Glyph( TTF_Font* font, int i )
+{
+	c_glyph* glyph = &font->glyphs[i];
+
+	glyph->newer = -1;
+	glyph->older = font->newest;
+	if ( font->newest >= 0 ) {
+		font->glyphs[font->newest].newer = i;
+	} else {
+		font->oldest = i;
+	}
+	font->newest = i;
+}
+
+/* Frees the least recently used glyphs until the cache fits, except for
+   the one being used */
+static void Trim_Cache( TTF_Font* font, int keep )
+{
+	int i;
+
+	while ( font->cache_bytes > font->cache_size &&
+	        font->oldest >= 0 && font->oldest != keep ) {
+		i = font->oldest;
+		Remove_Hash( font, i );
+		Unlink_Glyph( font, i );
+		font->cache_bytes -= Glyph_Size( &font->glyphs[i] );
+		Flush_Glyph( &font->glyphs[i] );
+		font->glyphs[i].older = font->free_glyph;
+		font->free_glyph = i;
+		++font->cache_evictions;
+	}
+}
+
+/* Adds an empty glyph to the cache, returns its index or -1 */
+static int New_Glyph( TTF_Font* font, Uint16 ch, int style )
+{
+	int i;
+
+	if ( font->free_glyph < 0 ) {
+		int num_glyphs = font->num_glyphs ? font->num_glyphs * 2 : 64;
+		c_glyph* glyphs;
+
+		glyphs = (c_glyph*)realloc( font->glyphs,
+		                            num_glyphs * sizeof(*glyphs) );
+		if ( ! glyphs ) {
+			return -1;
+		}
+		memset( &glyphs[font->num_glyphs], 0,
+		        (num_glyphs - font->num_glyphs) * sizeof(*glyphs) );
+		for ( i = num_glyphs - 1; i >= font->num_glyphs; --i ) {
+			glyphs[i].older = font->free_glyph;
+			font->free_glyph = i;
+		}
+		font->glyphs = glyphs;
+		font->num_glyphs = num_glyphs;
+	}
+	if ( font->hash_size < font->num_glyphs * 2 ) {
+		int* old_hash = font->hash;
+		int old_size = font->hash_size;
+		int hash_size = font->num_glyphs * 2;
+		int* hash = (int*)malloc( hash_size * sizeof(*hash) );
+
+		if ( ! hash ) {
+			return -1;
+		}
+		memset( hash, 0, hash_size * sizeof(*hash) );
+		font->hash = hash;
+		font->hash_size = hash_size;
+		for ( i = 0; i < old_size; ++i ) {
+			if ( old_hash[i] ) {
+				Insert_Hash( font, old_hash[i] - 1 );
+			}
+		}
+		free( old_hash );
+	}
+
+	i = font->free_glyph;
+	font->free_glyph = font->glyphs[i].older;
+	memset( &font->glyphs[i], 0, sizeof(font->glyphs[i]) );
+	font->glyphs[i].ch = ch;
+	font->glyphs[i].style = style;
+	Insert_Hash( font, i );
+	Link_Glyph( font, i );
+	font->cache_bytes += Glyph_Size( &font->glyphs[i] );
+	return i;
 }
 
 static FT_Error Load_Glyph( TTF_Font* font, Uint16 ch, c_glyph* cached, int want )
@@ -702,24 +1003,248 @@ static FT_Error Load_Glyph( TTF_Font* font, Uint16 ch, c_glyph* cached, int want
 static FT_Error Find_Glyph( TTF_Font* font, Uint16 ch, int want )
 {
 	int retval = 0;
+	int style = font->style & GLYPH_STYLES;
+	int i;
+	long size;
 
-	if( ch < 256 ) {
-		font->current = &font->cache[ch];
-	} else {
-		if ( font->scratch.cached != ch ) {
-			Flush_Glyph( &font->scratch );
+	i = Lookup_Glyph( font, ch, style );
+	if ( i < 0 ) {
+		i = New_Glyph( font, ch, style );
+		if ( i < 0 ) {
+			return FT_Err_Out_Of_Memory;
 		}
-		font->current = &font->scratch;
+	} else if ( i != font->newest && ! font->glyphs[i].atlas ) {
+		Unlink_Glyph( font, i );
+		Link_Glyph( font, i );
 	}
+	font->current = &font->glyphs[i];
+
 	if ( (font->current->stored & want) != want ) {
+		++font->cache_misses;
+		size = Glyph_Size( font->current );
 		retval = Load_Glyph( font, ch, font->current, want );
+		if ( ! font->current->atlas ) {
+			font->cache_bytes += Glyph_Size( font->current ) - size;
+		}
+		Trim_Cache( font, i );
+	} else {
+		++font->cache_hits;
 	}
 	return retval;
 }
 
+static void Free_Run( TTF_Font* font, c_run* run )
+{
+	c_run** prev;
+
+	for ( prev = &font->runs[run->hash % RUN_BUCKETS]; *prev != run;
+	      prev = &(*prev)->next ) {
+		continue;
+	}
+	*prev = run->next;
+	if ( run->newer ) {
+		run->newer->older = run->older;
+	} else {
+		font->newest_run = run->older;
+	}
+	if ( run->older ) {
+		run->older->newer = run->newer;
+	} else {
+		font->oldest_run = run->newer;
+	}
+	font->run_cache_bytes -= run->size;
+	if ( run->surface ) {
+		SDL_FreeSurface( run->surface );
+	}
+	free( run->text );
+	free( run );
+}
+
+static void Flush_Runs( TTF_Font* font )
+{
+	while ( font->oldest_run ) {
+		Free_Run( font, font->oldest_run );
+	}
+}
+
+static void Trim_Runs( TTF_Font* font )
+{
+	while ( font->run_cache_bytes > font->run_cache_size &&
+	        font->oldest_run ) {
+		Free_Run( font, font->oldest_run );
+	}
+}
+
+static Uint32 Hash_Run( const Uint16* text, int* len )
+{
+	Uint32 hash = 2166136261U;
+	int i;
+
+	for ( i = 0; text[i]; ++i ) {
+		hash = (hash ^ text[i]) * 16777619U;
+	}
+	*len = i;
+	return hash ^ TTF_byteswapped;
+}
+
+/* Returns the cached run of the text, or NULL */
+static c_run* Find_Run( TTF_Font* font, const Uint16* text )
+{
+	Uint32 hash;
+	int len;
+	c_run* run;
+
+	if ( ! font->runs ) {
+		return NULL;
+	}
+	hash = Hash_Run( text, &len );
+	for ( run = font->runs[hash % RUN_BUCKETS]; run; run = run->next ) {
+		if ( run->hash == hash && run->len == len &&
+		     run->swapped == TTF_byteswapped &&
+		     memcmp( run->text, text, len * sizeof(*text) ) == 0 ) {
+			break;
+		}
+	}
+	if ( run && run->newer ) {
+		/* Move it to the front of the list */
+		run->newer->older = run->older;
+		if ( run->older ) {
+			run->older->newer = run->newer;
+		} else {
+			font->oldest_run = run->newer;
+		}
+		run->newer = NULL;
+		run->older = font->newest_run;
+		font->newest_run->newer = run;
+		font->newest_run = run;
+	}
+	return run;
+}
+
+static void Add_Run( TTF_Font* font, const Uint16* text, int w, int h )
+{
+	c_run* run;
+
+	if ( ! font->runs ) {
+		font->runs = (c_run**)malloc( RUN_BUCKETS * sizeof(*font->runs) );
+		if ( ! font->runs ) {
+			return;
+		}
+		memset( font->runs, 0, RUN_BUCKETS * sizeof(*font->runs) );
+	}
+	run = (c_run*)malloc( sizeof(*run) );
+	if ( ! run ) {
+		return;
+	}
+	memset( run, 0, sizeof(*run) );
+	run->hash = Hash_Run( text, &run->len );
+	run->text = (Uint16*)malloc( (run->len + 1) * sizeof(*text) );
+	if ( ! run->text ) {
+		free( run );
+		return;
+	}
+	memcpy( run->text, text, (run->len + 1) * sizeof(*text) );
+	run->swapped = TTF_byteswapped;
+	run->w = w;
+	run->h = h;
+	run->size = sizeof(*run) + (run->len + 1) * sizeof(*text);
+
+	run->next = font->runs[run->hash % RUN_BUCKETS];
+	font->runs[run->hash % RUN_BUCKETS] = run;
+	run->older = font->newest_run;
+	if ( font->newest_run ) {
+		font->newest_run->newer = run;
+	} else {
+		font->oldest_run = run;
+	}
+	font->newest_run = run;
+	font->run_cache_bytes += run->size;
+	Trim_Runs( font );
+}
+
+/* Copies a text surface along with its palette and colorkey */
+static SDL_Surface* Copy_Surface( SDL_Surface* src, int mode )
+{
+	SDL_Surface* dst;
+	SDL_PixelFormat* format = src->format;
+
+	dst = SDL_CreateRGBSurface( SDL_SWSURFACE, src->w, src->h,
+	                            format->BitsPerPixel, format->Rmask,
+	                            format->Gmask, format->Bmask, format->Amask );
+	if ( ! dst ) {
+		return NULL;
+	}
+	memcpy( dst->pixels, src->pixels, src->pitch * src->h );
+	if ( format->palette ) {
+		memcpy( dst->format->palette->colors, format->palette->colors,
+		        format->palette->ncolors * sizeof(SDL_Color) );
+	}
+	if ( mode == RUN_SOLID ) {
+		SDL_SetColorKey( dst, SDL_SRCCOLORKEY, 0 );
+	}
+	return dst;
+}
+
+static int Same_Color( SDL_Color a, SDL_Color b )
+{
+	return a.r == b.r && a.g == b.g && a.b == b.b;
+}
+
+/* Returns a copy of the text's cached surface, or NULL */
+static SDL_Surface* Find_Run_Surface( TTF_Font* font, const Uint16* text,
+                                      int mode, SDL_Color fg, SDL_Color bg )
+{
+	c_run* run;
+
+	if ( ! font->run_surfaces ) {
+		return NULL;
+	}
+	run = Find_Run( font, text );
+	if ( ! run || ! run->surface || run->mode != mode ||
+	     ! Same_Color( run->fg, fg ) || ! Same_Color( run->bg, bg ) ) {
+		return NULL;
+	}
+	++font->run_hits;
+	return Copy_Surface( run->surface, mode );
+}
+
+/* Keeps a copy of the surface the text was just rendered to */
+static void Add_Run_Surface( TTF_Font* font, const Uint16* text, int mode,
+                             SDL_Color fg, SDL_Color bg, SDL_Surface* textbuf )
+{
+	c_run* run;
+	SDL_Surface* surface;
+
+	if ( ! font->run_surfaces || ! textbuf ) {
+		return;
+	}
+	run = Find_Run( font, text );
+	if ( ! run ) {
+		return;
+	}
+	surface = Copy_Surface( textbuf, mode );
+	if ( ! surface ) {
+		return;
+	}
+	if ( run->surface ) {
+		font->run_cache_bytes -= run->surface->pitch * run->surface->h;
+		run->size -= run->surface->pitch * run->surface->h;
+		SDL_FreeSurface( run->surface );
+	}
+	run->mode = mode;
+	run->fg = fg;
+	run->bg = bg;
+	run->surface = surface;
+	run->size += surface->pitch * surface->h;
+	font->run_cache_bytes += surface->pitch * surface->h;
+	Trim_Runs( font );
+}
+
 void TTF_CloseFont( TTF_Font* font )
 {
 	if ( font ) {
+		Flush_Runs( font );
+		free( font->runs );
 		Flush_Cache( font );
 		if ( font->face ) {
 			FT_Done_Face( font->face );
@@ -775,6 +1300,33 @@ static Uint16 *UTF8_to_UNICODE(Uint16 *unicode, const char *utf8, int len)
 	return unicode;
 }
 
+/* Decode one UTF-8 character the way UTF8_to_UNICODE() does, without
+   reading past the end of the string */
+static Uint16 UTF8_getch(const char **src)
+{
+	const unsigned char *p = (const unsigned char *)*src;
+	Uint32 ch = *p++;
+	int left = 0;
+
+	if ( ch >= 0xF0 ) {
+		ch &= 0x07;
+		left = 3;
+	} else
+	if ( ch >= 0xE0 ) {
+		ch &= 0x0F;
+		left = 2;
+	} else
+	if ( ch >= 0xC0 ) {
+		ch &= 0x1F;
+		left = 1;
+	}
+	while ( left-- && *p ) {
+		ch = (ch << 6) | (*p++ & 0x3F);
+	}
+	*src = (const char *)p;
+	return (Uint16)ch;
+}
+
 int TTF_FontHeight(const TTF_Font *font)
 {
 	return(font->height);
@@ -903,7 +1455,7 @@ int TTF_SizeUTF8(TTF_Font *font, const char *text, int *w, int *h)
 	return status;
 }
 
-int TTF_SizeUNICODE(TTF_Font *font, const Uint16 *text, int *w, int *h)
+static int Size_UNICODE(TTF_Font *font, const Uint16 *text, int *w, int *h)
 {
 	int status;
 	const Uint16 *ch;
@@ -1024,6 +1576,35 @@ int TTF_SizeUNICODE(TTF_Font *font, const Uint16 *text, int *w, int *h)
 	return status;
 }
 
+int TTF_SizeUNICODE(TTF_Font *font, const Uint16 *text, int *w, int *h)
+{
+	c_run *run;
+	int width, height;
+
+	if ( font->run_cache_size <= 0 ) {
+		return Size_UNICODE(font, text, w, h);
+	}
+	run = Find_Run(font, text);
+	if ( run ) {
+		++font->run_hits;
+		width = run->w;
+		height = run->h;
+	} else {
+		++font->run_misses;
+		if ( Size_UNICODE(font, text, &width, &height) < 0 ) {
+			return -1;
+		}
+		Add_Run(font, text, width, height);
+	}
+	if ( w ) {
+		*w = width;
+	}
+	if ( h ) {
+		*h = height;
+	}
+	return 0;
+}
+
 /* Convert the Latin-1 text to UNICODE and render it
 */
 SDL_Surface *TTF_RenderText_Solid(TTF_Font *font,
@@ -1078,7 +1659,7 @@ SDL_Surface *TTF_RenderUTF8_Solid(TTF_Font *font,
 	return(textbuf);
 }
 
-SDL_Surface *TTF_RenderUNICODE_Solid(TTF_Font *font,
+static SDL_Surface *Render_UNICODE_Solid(TTF_Font *font,
 				const Uint16 *text, SDL_Color fg)
 {
 	int xstart;
@@ -1218,6 +1799,20 @@ SDL_Surface *TTF_RenderUNICODE_Solid(TTF_Font *font,
 	return textbuf;
 }
 
+SDL_Surface *TTF_RenderUNICODE_Solid(TTF_Font *font,
+				const Uint16 *text, SDL_Color fg)
+{
+	SDL_Color bg = { 0, 0, 0, 0 };
+	SDL_Surface *textbuf;
+
+	textbuf = Find_Run_Surface(font, text, RUN_SOLID, fg, bg);
+	if ( ! textbuf ) {
+		textbuf = Render_UNICODE_Solid(font, text, fg);
+		Add_Run_Surface(font, text, RUN_SOLID, fg, bg, textbuf);
+	}
+	return textbuf;
+}
+
 SDL_Surface *TTF_RenderGlyph_Solid(TTF_Font *font, Uint16 ch, SDL_Color fg)
 {
 	SDL_Surface *textbuf;
@@ -1333,7 +1928,7 @@ SDL_Surface *TTF_RenderUTF8_Shaded(TTF_Font *font,
 	return(textbuf);
 }
 
-SDL_Surface* TTF_RenderUNICODE_Shaded( TTF_Font* font,
+static SDL_Surface* Render_UNICODE_Shaded( TTF_Font* font,
 				       const Uint16* text,
 				       SDL_Color fg,
 				       SDL_Color bg )
@@ -1478,6 +2073,21 @@ SDL_Surface* TTF_RenderUNICODE_Shaded( TTF_Font* font,
 	return textbuf;
 }
 
+SDL_Surface* TTF_RenderUNICODE_Shaded( TTF_Font* font,
+				       const Uint16* text,
+				       SDL_Color fg,
+				       SDL_Color bg )
+{
+	SDL_Surface* textbuf;
+
+	textbuf = Find_Run_Surface(font, text, RUN_SHADED, fg, bg);
+	if ( ! textbuf ) {
+		textbuf = Render_UNICODE_Shaded(font, text, fg, bg);
+		Add_Run_Surface(font, text, RUN_SHADED, fg, bg, textbuf);
+	}
+	return textbuf;
+}
+
 SDL_Surface* TTF_RenderGlyph_Shaded( TTF_Font* font,
 				     Uint16 ch,
 				     SDL_Color fg,
@@ -1600,7 +2210,7 @@ SDL_Surface *TTF_RenderUTF8_Blended(TTF_Font *font,
 	return(textbuf);
 }
 
-SDL_Surface *TTF_RenderUNICODE_Blended(TTF_Font *font,
+static SDL_Surface *Render_UNICODE_Blended(TTF_Font *font,
 				const Uint16 *text, SDL_Color fg)
 {
 	int xstart;
@@ -1736,6 +2346,20 @@ SDL_Surface *TTF_RenderUNICODE_Blended(TTF_Font *font,
 	return(textbuf);
 }
 
+SDL_Surface *TTF_RenderUNICODE_Blended(TTF_Font *font,
+				const Uint16 *text, SDL_Color fg)
+{
+	SDL_Color bg = { 0, 0, 0, 0 };
+	SDL_Surface *textbuf;
+
+	textbuf = Find_Run_Surface(font, text, RUN_BLENDED, fg, bg);
+	if ( ! textbuf ) {
+		textbuf = Render_UNICODE_Blended(font, text, fg);
+		Add_Run_Surface(font, text, RUN_BLENDED, fg, bg, textbuf);
+	}
+	return textbuf;
+}
+
 SDL_Surface *TTF_RenderGlyph_Blended(TTF_Font *font, Uint16 ch, SDL_Color fg)
 {
 	SDL_Surface *textbuf;
@@ -1793,10 +2417,463 @@ SDL_Surface *TTF_RenderGlyph_Blended(TTF_Font *font, Uint16 ch, SDL_Color fg)
 	return(textbuf);
 }
 
+/* Adds an empty atlas page big enough for the glyph, returns its index */
+static int New_Atlas( TTF_Font* font, int w, int h )
+{
+	atlas_page* atlas;
+	int size;
+
+	size = ATLAS_SIZE;
+	while ( size < w || size < h || size < font->height * 8 ) {
+		size *= 2;
+	}
+	atlas = (atlas_page*)realloc( font->atlas,
+	                              (font->num_atlas + 1) * sizeof(*atlas) );
+	if ( ! atlas ) {
+		TTF_SetError( "Out of memory" );
+		return -1;
+	}
+	font->atlas = atlas;
+	atlas = &font->atlas[font->num_atlas];
+	memset( atlas, 0, sizeof(*atlas) );
+
+	/* White, with the glyphs in the alpha channel */
+	atlas->surface = SDL_AllocSurface( SDL_SWSURFACE, size, size, 32,
+	                 0x00FF0000, 0x0000FF00, 0x000000FF, 0xFF000000 );
+	if ( ! atlas->surface ) {
+		return -1;
+	}
+	SDL_FillRect( atlas->surface, NULL, 0x00FFFFFF );
+	atlas->updated = 1;
+	return font->num_atlas++;
+}
+
+/* Finds room for a w by h box, preferring the shelf that fits it best */
+static int Pack_Atlas( atlas_page* atlas, int w, int h, int* x, int* y )
+{
+	atlas_shelf* shelf;
+	atlas_shelf* best = NULL;
+	int size = atlas->surface->w;
+	int top = 0;
+	int i;
+
+	for ( i = 0; i < atlas->num_shelves; ++i ) {
+		shelf = &atlas->shelves[i];
+		if ( shelf->height >= h && shelf->height <= h + h / 2 + 2 &&
+		     shelf->x + w <= size &&
+		     ( ! best || shelf->height < best->height ) ) {
+			best = shelf;
+		}
+		top = shelf->y + shelf->height;
+	}
+	if ( ! best ) {
+		if ( top + h > size || w > size ) {
+			return 0;
+		}
+		shelf = (atlas_shelf*)realloc( atlas->shelves,
+		                (atlas->num_shelves + 1) * sizeof(*shelf) );
+		if ( ! shelf ) {
+			return 0;
+		}
+		atlas->shelves = shelf;
+		best = &atlas->shelves[atlas->num_shelves++];
+		best->y = top;
+		best->height = h;
+		best->x = 0;
+	}
+	*x = best->x;
+	*y = best->y;
+	best->x += w;
+	return 1;
+}
+
+/* Finds room on some atlas page for a w by h box, returns the page index */
+static int Place_Atlas( TTF_Font* font, int w, int h, int* x, int* y )
+{
+	int page;
+
+	/* Leave a transparent pixel between glyphs so they don't bleed */
+	++w;
+	++h;
+	for ( page = 0; page < font->num_atlas; ++page ) {
+		if ( Pack_Atlas( &font->atlas[page], w, h, x, y ) ) {
+			return page;
+		}
+	}
+	page = New_Atlas( font, w, h );
+	if ( page < 0 ) {
+		return -1;
+	}
+	if ( ! Pack_Atlas( &font->atlas[page], w, h, x, y ) ) {
+		TTF_SetError( "Out of memory" );
+		return -1;
+	}
+	return page;
+}
+
+/* Copies the current glyph's pixmap into an atlas page, and keeps the
+   glyph cached for as long as the atlas */
+static int Pack_Glyph( TTF_Font* font )
+{
+	c_glyph* glyph = font->current;
+	SDL_Surface* surface;
+	Uint8* src;
+	Uint32* dst;
+	int width, row, col;
+	int page, x, y;
+
+	width = glyph->pixmap.width;
+	if ( width > glyph->maxx - glyph->minx ) {
+		width = glyph->maxx - glyph->minx;
+	}
+	page = Place_Atlas( font, width, glyph->pixmap.rows, &x, &y );
+	if ( page < 0 ) {
+		return -1;
+	}
+	surface = font->atlas[page].surface;
+	for ( row = 0; row < glyph->pixmap.rows; ++row ) {
+		src = glyph->pixmap.buffer + glyph->pixmap.pitch * row;
+		dst = (Uint32*)surface->pixels +
+			(y + row) * surface->pitch/4 + x;
+		for ( col = 0; col < width; ++col ) {
+			*dst++ = 0x00FFFFFF | ((Uint32)*src++ << 24);
+		}
+	}
+	font->atlas[page].updated = 1;
+
+	Unlink_Glyph( font, (int)(glyph - font->glyphs) );
+	font->cache_bytes -= Glyph_Size( glyph );
+	glyph->atlas = page + 1;
+	glyph->atlas_x = x;
+	glyph->atlas_y = y;
+	return 0;
+}
+
+/* Packs an opaque block to draw underlines with, the first thing on the
+   first atlas page so it's always at the top left corner */
+static int Atlas_Block( TTF_Font* font )
+{
+	SDL_Surface* surface;
+	Uint32* dst;
+	int x, y, row, col;
+
+	if ( font->num_atlas == 0 ) {
+		if ( Place_Atlas( font, ATLAS_BLOCK, ATLAS_BLOCK, &x, &y ) < 0 ) {
+			return -1;
+		}
+		surface = font->atlas[0].surface;
+		for ( row = 0; row < ATLAS_BLOCK; ++row ) {
+			dst = (Uint32*)surface->pixels + row * surface->pitch/4;
+			for ( col = 0; col < ATLAS_BLOCK; ++col ) {
+				*dst++ = 0xFFFFFFFF;
+			}
+		}
+	}
+	return 0;
+}
+
+int TTF_LayoutUTF8_Atlas(TTF_Font *font, const char *text, int x, int y,
+                         TTF_Quad *quads, int maxquads)
+{
+	int xstart;
+	int width;
+	int left, right, z;
+	int num_chars;
+	int num_quads;
+	const char *ch;
+	c_glyph *glyph;
+	FT_Error error;
+	FT_Long use_kerning;
+	FT_UInt prev_index = 0;
+	TTF_Quad *quad;
+
+	if ( Atlas_Block(font) < 0 ) {
+		return -1;
+	}
+
+	/* check kerning */
+	use_kerning = FT_HAS_KERNING( font->face );
+
+	/* Load and lay out each character */
+	xstart = 0;
+	left = right = 0;
+	num_chars = 0;
+	num_quads = 0;
+	for ( ch=text; *ch; ) {
+		Uint16 c = UTF8_getch(&ch);
+		if ( c == UNICODE_BOM_NATIVE || c == UNICODE_BOM_SWAPPED ) {
+			continue;
+		}
+		error = Find_Glyph(font, c, CACHED_METRICS|CACHED_PIXMAP);
+		if( error ) {
+			TTF_SetFTError("Couldn't find glyph", error);
+			return -1;
+		}
+		glyph = font->current;
+		/* Ensure the width of the pixmap is correct. On some cases,
+		 * freetype may report a larger pixmap than possible.*/
+		width = glyph->pixmap.width;
+		if (width > glyph->maxx - glyph->minx) {
+			width = glyph->maxx - glyph->minx;
+		}
+		/* do kerning, if possible AC-Patch */
+		if ( use_kerning && prev_index && glyph->index ) {
+			FT_Vector delta;
+			FT_Get_Kerning( font->face, prev_index, glyph->index, ft_kerning_default, &delta );
+			xstart += delta.x >> 6;
+		}
+
+		/* Compensate for the wrap around bug with negative minx's */
+		if ( (num_chars == 0) && (glyph->minx < 0) ) {
+			xstart -= glyph->minx;
+		}
+
+		if ( width > 0 && glyph->pixmap.rows > 0 ) {
+			if ( ! glyph->atlas && Pack_Glyph(font) < 0 ) {
+				return -1;
+			}
+			if ( num_quads < maxquads ) {
+				quad = &quads[num_quads];
+				quad->page = glyph->atlas - 1;
+				quad->src.x = glyph->atlas_x;
+				quad->src.y = glyph->atlas_y;
+				quad->src.w = width;
+				quad->src.h = glyph->pixmap.rows;
+				quad->dst.x = x + xstart + glyph->minx;
+				quad->dst.y = y + glyph->yoffset;
+				quad->dst.w = width;
+				quad->dst.h = glyph->pixmap.rows;
+			}
+			++num_quads;
+		}
+
+		/* Keep track of the text bounds like TTF_SizeUTF8() */
+		z = xstart + glyph->minx;
+		if ( left > z ) {
+			left = z;
+		}
+		if ( font->style & TTF_STYLE_BOLD ) {
+			xstart += font->glyph_overhang;
+		}
+		z = xstart + (glyph->advance > glyph->maxx ? glyph->advance : glyph->maxx);
+		if ( right < z ) {
+			right = z;
+		}
+		xstart += glyph->advance;
+		prev_index = glyph->index;
+		++num_chars;
+	}
+
+	/* Handle the underline style, stretching the middle of the block */
+	if( (font->style & TTF_STYLE_UNDERLINE) && right > left ) {
+		if ( num_quads < maxquads ) {
+			quad = &quads[num_quads];
+			quad->page = 0;
+			quad->src.x = 1;
+			quad->src.y = 1;
+			quad->src.w = ATLAS_BLOCK - 2;
+			quad->src.h = ATLAS_BLOCK - 2;
+			quad->dst.x = x;
+			quad->dst.y = y + font->ascent - font->underline_offset - 1;
+			if ( quad->dst.y - y >= font->height ) {
+				quad->dst.y = y + (font->height-1) - font->underline_height;
+			}
+			quad->dst.w = right - left;
+			quad->dst.h = font->underline_height;
+		}
+		++num_quads;
+	}
+	return num_quads;
+}
+
+SDL_Surface *TTF_GetFontAtlas(TTF_Font *font, int page, int *updated)
+{
+	if ( page < 0 || page >= font->num_atlas ) {
+		return NULL;
+	}
+	if ( updated ) {
+		*updated = font->atlas[page].updated;
+	}
+	font->atlas[page].updated = 0;
+	return font->atlas[page].surface;
+}
+
+/* Rasterizes characters for TTF_PrewarmFont() with a face of its own */
+static int Prewarm_Thread( void* data )
+{
+	prewarm_job* job = (prewarm_job*)data;
+	TTF_Font font = *job->font;
+	FT_Library thread_library;
+	FT_Face face;
+	int i, end;
+
+	if ( FT_Init_FreeType( &thread_library ) ) {
+		return -1;
+	}
+	if ( FT_New_Memory_Face( thread_library, job->bytes, job->size,
+	                         job->font->face->face_index, &face ) ) {
+		FT_Done_FreeType( thread_library );
+		return -1;
+	}
+	if ( FT_IS_SCALABLE(face) ) {
+		FT_Set_Char_Size( face, 0, font.ptsize * 64, 0, 0 );
+	} else {
+		FT_Set_Pixel_Sizes( face,
+			face->available_sizes[font.font_size_family].height,
+			face->available_sizes[font.font_size_family].width );
+	}
+	/* Load_Glyph() only reads the font, so it can use a copy */
+	font.face = face;
+
+	for ( ; ; ) {
+		SDL_mutexP( job->lock );
+		i = job->next;
+		job->next += PREWARM_CHUNK;
+		SDL_mutexV( job->lock );
+		if ( i >= job->count ) {
+			break;
+		}
+		end = i + PREWARM_CHUNK;
+		if ( end > job->count ) {
+			end = job->count;
+		}
+		for ( ; i < end; ++i ) {
+			Uint16 ch = (Uint16)(job->first + i);
+			if ( FT_Get_Char_Index( face, ch ) ) {
+				Load_Glyph( &font, ch, &job->glyphs[i],
+				            CACHED_METRICS|CACHED_PIXMAP );
+			}
+		}
+	}
+
+	FT_Done_Face( face );
+	FT_Done_FreeType( thread_library );
+	return 0;
+}
+
+/* Moves a rasterized glyph into the cache, unless it's there already */
+static void Merge_Glyph( TTF_Font* font, Uint16 ch, c_glyph* loaded )
+{
+	int want = CACHED_METRICS|CACHED_PIXMAP;
+	int style = font->style & GLYPH_STYLES;
+	c_glyph* glyph;
+	c_glyph key;
+	int i;
+
+	if ( (loaded->stored & want) != want ) {
+		Flush_Glyph( loaded );
+		return;
+	}
+	i = Lookup_Glyph( font, ch, style );
+	if ( i >= 0 ) {
+		glyph = &font->glyphs[i];
+		if ( (glyph->stored & want) == want ) {
+			Flush_Glyph( loaded );
+			return;
+		}
+		font->cache_bytes -= Glyph_Size( glyph );
+		Flush_Glyph( glyph );
+	} else {
+		i = New_Glyph( font, ch, style );
+		if ( i < 0 ) {
+			Flush_Glyph( loaded );
+			return;
+		}
+		glyph = &font->glyphs[i];
+		font->cache_bytes -= Glyph_Size( glyph );
+	}
+
+	/* Take the bitmaps, keeping the cache bookkeeping */
+	key = *glyph;
+	*glyph = *loaded;
+	glyph->ch = key.ch;
+	glyph->style = key.style;
+	glyph->newer = key.newer;
+	glyph->older = key.older;
+	glyph->atlas = key.atlas;
+	glyph->atlas_x = key.atlas_x;
+	glyph->atlas_y = key.atlas_y;
+	font->cache_bytes += Glyph_Size( glyph );
+	Trim_Cache( font, i );
+}
+
+int TTF_PrewarmFont( TTF_Font* font, Uint16 first, Uint16 last, int threads )
+{
+	prewarm_job job;
+	SDL_Thread** workers;
+	int status = -1;
+	int i;
+
+	if ( last < first ) {
+		return 0;
+	}
+	if ( threads <= 1 ) {
+		for ( i = first; i <= last; ++i ) {
+			if ( FT_Get_Char_Index( font->face, i ) ) {
+				Find_Glyph( font, (Uint16)i,
+				            CACHED_METRICS|CACHED_PIXMAP );
+			}
+		}
+		return 0;
+	}
+
+	memset( &job, 0, sizeof(job) );
+	job.font = font;
+	job.first = first;
+	job.count = last - first + 1;
+
+	/* The threads open their own faces over a copy of the font file */
+	job.size = font->args.stream->size;
+	job.bytes = (unsigned char*)malloc( job.size );
+	job.glyphs = (c_glyph*)malloc( job.count * sizeof(*job.glyphs) );
+	workers = (SDL_Thread**)malloc( threads * sizeof(*workers) );
+	job.lock = SDL_CreateMutex();
+	if ( ! job.bytes || ! job.glyphs || ! workers || ! job.lock ) {
+		TTF_SetError( "Out of memory" );
+		goto done;
+	}
+	if ( RWread( font->args.stream, 0, job.bytes, job.size ) !=
+	     (unsigned long)job.size ) {
+		TTF_SetError( "Couldn't read font file" );
+		goto done;
+	}
+	memset( job.glyphs, 0, job.count * sizeof(*job.glyphs) );
+
+	for ( i = 0; i < threads; ++i ) {
+		workers[i] = SDL_CreateThread( Prewarm_Thread, &job );
+		if ( ! workers[i] ) {
+			break;
+		}
+	}
+	while ( i-- > 0 ) {
+		SDL_WaitThread( workers[i], NULL );
+	}
+
+	/* Anything the threads didn't get to is left to load on demand */
+	for ( i = 0; i < job.count; ++i ) {
+		Merge_Glyph( font, (Uint16)(first + i), &job.glyphs[i] );
+	}
+	font->current = NULL;
+	status = 0;
+
+done:
+	if ( job.lock ) {
+		SDL_DestroyMutex( job.lock );
+	}
+	free( workers );
+	free( job.glyphs );
+	free( job.bytes );
+	return status;
+}
+
 void TTF_SetFontStyle( TTF_Font* font, int style )
 {
+	/* The glyphs are cached by style, but the runs have to be measured
+	   and rendered again */
+	if ( style != font->style ) {
+		Flush_Runs( font );
+	}
 	font->style = style;
-	Flush_Cache( font );
 }
 
 int TTF_GetFontStyle( const TTF_Font* font )
@@ -1804,6 +2881,54 @@ int TTF_GetFontStyle( const TTF_Font* font )
 	return font->style;
 }
 
+void TTF_SetFontCacheSize( TTF_Font* font, long bytes )
+{
+	font->cache_size = bytes;
+	Trim_Cache( font, -1 );
+	font->current = NULL;
+}
+
+void TTF_GetFontCacheStats( const TTF_Font* font, int* hits, int* misses,
+                            int* evictions, long* bytes )
+{
+	if ( hits ) {
+		*hits = font->cache_hits;
+	}
+	if ( misses ) {
+		*misses = font->cache_misses;
+	}
+	if ( evictions ) {
+		*evictions = font->cache_evictions;
+	}
+	if ( bytes ) {
+		*bytes = font->cache_bytes;
+	}
+}
+
+void TTF_SetFontRunCache( TTF_Font* font, long bytes, int surfaces )
+{
+	font->run_cache_size = bytes;
+	font->run_surfaces = surfaces;
+	if ( ! surfaces ) {
+		Flush_Runs( font );
+	}
+	Trim_Runs( font );
+}
+
+void TTF_GetFontRunCacheStats( const TTF_Font* font, int* hits, int* misses,
+                               long* bytes )
+{
+	if ( hits ) {
+		*hits = font->run_hits;
+	}
+	if ( misses ) {
+		*misses = font->run_misses;
+	}
+	if ( bytes ) {
+		*bytes = font->run_cache_bytes;
+	}
+}
+
 void TTF_Quit( void )
 {
 	if ( TTF_initialized ) {
@@ -102,6 +102,37 @@ extern DECLSPEC TTF_Font * SDLCALL TTF_OpenFontIndexRW(SDL_RWops *src, int frees
 extern DECLSPEC int SDLCALL TTF_GetFontStyle(const TTF_Font *font);
 extern DECLSPEC void SDLCALL TTF_SetFontStyle(TTF_Font *font, int style);
 
+/* Set how many bytes of rendered glyphs the font may keep, 2 MB by default.
+   The glyphs used least recently are freed first when it's over the limit.
+*/
+extern DECLSPEC void SDLCALL TTF_SetFontCacheSize(TTF_Font *font, long bytes);
+
+/* Get the number of glyph cache hits, misses and evictions so far, and the
+   bytes currently cached.  Any of the pointers may be NULL.
+*/
+extern DECLSPEC void SDLCALL TTF_GetFontCacheStats(const TTF_Font *font, int *hits, int *misses, int *evictions, long *bytes);
+
+/* Set how many bytes of measured strings the font may keep, 0 by default.
+   If 'surfaces' is non-zero, the last surface each string was rendered to
+   is kept as well, and rendering it again the same way returns a copy.
+   The strings are forgotten when the font style changes.
+*/
+extern DECLSPEC void SDLCALL TTF_SetFontRunCache(TTF_Font *font, long bytes, int surfaces);
+
+/* Get the number of string cache hits and misses so far, and the bytes
+   currently cached.  Any of the pointers may be NULL.
+*/
+extern DECLSPEC void SDLCALL TTF_GetFontRunCacheStats(const TTF_Font *font, int *hits, int *misses, long *bytes);
+
+/* Rasterize the antialiased glyphs for the characters from 'first' to 'last'
+   in the current style, on the given number of threads, and add them to
+   the font's glyph cache.  Each thread opens the font on its own, so the
+   font must not be used by other threads until this returns.  The glyph
+   cache should be made big enough to hold them.
+   Returns 0 if successful, -1 on error.
+*/
+extern DECLSPEC int SDLCALL TTF_PrewarmFont(TTF_Font *font, Uint16 first, Uint16 last, int threads);
+
 /* Get the total height of the font - usually equal to point size */
 extern DECLSPEC int SDLCALL TTF_FontHeight(const TTF_Font *font);
 
@@ -207,6 +238,32 @@ extern DECLSPEC SDL_Surface * SDLCALL TTF_RenderUNICODE_Blended(TTF_Font *font,
 extern DECLSPEC SDL_Surface * SDLCALL TTF_RenderGlyph_Blended(TTF_Font *font,
 						Uint16 ch, SDL_Color fg);
 
+/* A glyph to copy from one of the font's atlas pages to the screen */
+typedef struct _TTF_Quad {
+	int page;
+	SDL_Rect src;
+	SDL_Rect dst;
+} TTF_Quad;
+
+/* Lay out UTF-8 text with its top left corner at (x, y), packing the glyphs
+   it uses into the font's atlas pages the first time they're seen.  Up to
+   'maxquads' quads are filled in, to be drawn in order, for example with
+   SDL_RenderCopy() from textures made from the pages.  This doesn't
+   allocate anything once the glyphs are packed.
+   Returns the number of quads the text needs, or -1 on error.
+*/
+extern DECLSPEC int SDLCALL TTF_LayoutUTF8_Atlas(TTF_Font *font,
+				const char *text, int x, int y,
+				TTF_Quad *quads, int maxquads);
+
+/* Get an atlas page of the font, or NULL if there's no such page.  It is a
+   32-bit surface of white pixels with the glyphs in the alpha channel, so
+   the text color is set with color modulation.  If 'updated' isn't NULL,
+   it's set to 1 if glyphs were added to the page since it was last gotten.
+*/
+extern DECLSPEC SDL_Surface * SDLCALL TTF_GetFontAtlas(TTF_Font *font,
+				int page, int *updated);
+
 /* For compatibility with previous versions, here are the old functions */
 #define TTF_RenderText(font, text, fg, bg)	\
 	TTF_RenderText_Shaded(font, text, fg, bg)
@@ -38,9 +38,26 @@
 #define DEFAULT_PTSIZE	18
 #define DEFAULT_TEXT	"The quick brown fox jumped over the lazy dog"
 #define NUM_COLORS      256
+#define NUM_LABELS      200
+#define MAX_QUADS       64
+
+/* A paragraph of Chinese in UTF-8, for the benchmark */
+#define DEFAULT_CJK_TEXT \
+"\xe5\xa4\xa9\xe5\x9c\xb0\xe7\x8e\x84\xe9\xbb\x84\xef\xbc\x8c\xe5" \
+"\xae\x87\xe5\xae\x99\xe6\xb4\xaa\xe8\x8d\x92\xe3\x80\x82\xe6\x97" \
+"\xa5\xe6\x9c\x88\xe7\x9b\x88\xe6\x98\x83\xef\xbc\x8c\xe8\xbe\xb0" \
+"\xe5\xae\xbf\xe5\x88\x97\xe5\xbc\xa0\xe3\x80\x82\xe5\xaf\x92\xe6" \
+"\x9d\xa5\xe6\x9a\x91\xe5\xbe\x80\xef\xbc\x8c\xe7\xa7\x8b\xe6\x94" \
+"\xb6\xe5\x86\xac\xe8\x97\x8f\xe3\x80\x82\xe9\x97\xb0\xe4\xbd\x99" \
+"\xe6\x88\x90\xe5\xb2\x81\xef\xbc\x8c\xe5\xbe\x8b\xe5\x90\x95\xe8" \
+"\xb0\x83\xe9\x98\xb3\xe3\x80\x82\xe4\xba\x91\xe8\x85\xbe\xe8\x87" \
+"\xb4\xe9\x9b\xa8\xef\xbc\x8c\xe9\x9c\xb2\xe7\xbb\x93\xe4\xb8\xba" \
+"\xe9\x9c\x9c\xe3\x80\x82\xe9\x87\x91\xe7\x94\x9f\xe4\xb8\xbd\xe6" \
+"\xb0\xb4\xef\xbc\x8c\xe7\x8e\x89\xe5\x87\xba\xe6\x98\x86\xe5\x86" \
+"\x88\xe3\x80\x82"
 
 static char *Usage =
-"Usage: %s [-solid] [-utf8|-unicode] [-b] [-i] [-u] [-fgcol r,g,b] [-bgcol r,g,b] <font>.ttf [ptsize] [text]\n";
+"Usage: %s [-solid] [-utf8|-unicode] [-b] [-i] [-u] [-fgcol r,g,b] [-bgcol r,g,b] [-bench count] [-framebench frames] [-prewarm threads] <font>.ttf [ptsize] [text]\n";
 
 static void cleanup(int exitcode)
 {
@@ -49,6 +66,139 @@ static void cleanup(int exitcode)
 	exit(exitcode);
 }
 
+/* Render the UTF-8 message count times and report the glyph cache use */
+static void bench(TTF_Font *font, const char *message, int count, SDL_Color *forecol)
+{
+	SDL_Surface *text;
+	Uint64 start;
+	double usecs;
+	int i, hits, misses, evictions;
+	long bytes;
+
+	start = SDL_GetPerformanceCounter();
+	for ( i = 0; i < count; ++i ) {
+		text = TTF_RenderUTF8_Blended(font, message, *forecol);
+		if ( text == NULL ) {
+			fprintf(stderr, "Couldn't render text: %s\n", SDL_GetError());
+			return;
+		}
+		SDL_FreeSurface(text);
+	}
+	usecs = (double)(SDL_GetPerformanceCounter() - start) * 1000000.0 /
+	        SDL_GetPerformanceFrequency();
+
+	TTF_GetFontCacheStats(font, &hits, &misses, &evictions, &bytes);
+	printf("%8.1f us per render, %d hits, %d misses, %d evictions, %ld bytes cached\n",
+	       usecs / count, hits, misses, evictions, bytes);
+}
+
+/* Time opening the font and rasterizing every glyph it has */
+static void prewarm_bench(const char *file, int ptsize, int threads)
+{
+	TTF_Font *font;
+	Uint64 start;
+	double msecs;
+	long bytes;
+
+	start = SDL_GetPerformanceCounter();
+	font = TTF_OpenFont(file, ptsize);
+	if ( font == NULL ) {
+		fprintf(stderr, "Couldn't load %d pt font from %s: %s\n",
+					ptsize, file, SDL_GetError());
+		return;
+	}
+	TTF_SetFontCacheSize(font, 256*1024*1024);
+	if ( TTF_PrewarmFont(font, 0x20, 0xFFFF, threads) < 0 ) {
+		fprintf(stderr, "Couldn't prewarm font: %s\n", SDL_GetError());
+	}
+	msecs = (double)(SDL_GetPerformanceCounter() - start) * 1000.0 /
+	        SDL_GetPerformanceFrequency();
+	TTF_GetFontCacheStats(font, NULL, NULL, NULL, &bytes);
+	printf("%2d thread(s): %8.1f ms, %ld bytes cached\n",
+	       threads, msecs, bytes);
+	TTF_CloseFont(font);
+}
+
+/* Draw a frame of HUD labels, rendering each one to its own surface */
+static void frame_surfaces(TTF_Font *font, SDL_Surface *frame, int n, SDL_Color *forecol)
+{
+	SDL_Surface *text;
+	SDL_Rect dstrect;
+	char label[64];
+	int i;
+
+	for ( i = 0; i < NUM_LABELS; ++i ) {
+		sprintf(label, "Unit %d  HP %d/%d", i, (n + i * 7) % 100, 100);
+		text = TTF_RenderUTF8_Blended(font, label, *forecol);
+		if ( text ) {
+			dstrect.x = (i % 4) * 160;
+			dstrect.y = (i / 4) * 9 % frame->h;
+			SDL_BlitSurface(text, NULL, frame, &dstrect);
+			SDL_FreeSurface(text);
+		}
+	}
+}
+
+/* Draw the same frame from the font's glyph atlas */
+static void frame_atlas(TTF_Font *font, SDL_Surface *frame, int n, SDL_Color *forecol)
+{
+	static TTF_Quad quads[MAX_QUADS];
+	SDL_Surface *page;
+	SDL_Rect dstrect;
+	char label[64];
+	int i, q, count;
+
+	for ( i = 0; i < NUM_LABELS; ++i ) {
+		sprintf(label, "Unit %d  HP %d/%d", i, (n + i * 7) % 100, 100);
+		count = TTF_LayoutUTF8_Atlas(font, label, (i % 4) * 160,
+		                             (i / 4) * 9 % frame->h,
+		                             quads, MAX_QUADS);
+		for ( q = 0; q < count && q < MAX_QUADS; ++q ) {
+			page = TTF_GetFontAtlas(font, quads[q].page, NULL);
+			dstrect = quads[q].dst;
+			SDL_BlitSurface(page, &quads[q].src, frame, &dstrect);
+		}
+	}
+}
+
+/* Time drawing frames of labels both ways into an offscreen frame */
+static void frame_bench(TTF_Font *font, int frames, SDL_Color *forecol)
+{
+	SDL_Surface *frame;
+	Uint64 start;
+	double usecs;
+	int n;
+
+	frame = SDL_CreateRGBSurface(SDL_SWSURFACE, 640, 480, 32,
+	                   0x00FF0000, 0x0000FF00, 0x000000FF, 0);
+	if ( frame == NULL ) {
+		fprintf(stderr, "Couldn't create frame: %s\n", SDL_GetError());
+		return;
+	}
+
+	start = SDL_GetPerformanceCounter();
+	for ( n = 0; n < frames; ++n ) {
+		SDL_FillRect(frame, NULL, 0);
+		frame_surfaces(font, frame, n, forecol);
+	}
+	usecs = (double)(SDL_GetPerformanceCounter() - start) * 1000000.0 /
+	        SDL_GetPerformanceFrequency();
+	printf("Surfaces: %8.1f us per frame of %d labels\n",
+	       usecs / frames, NUM_LABELS);
+
+	start = SDL_GetPerformanceCounter();
+	for ( n = 0; n < frames; ++n ) {
+		SDL_FillRect(frame, NULL, 0);
+		frame_atlas(font, frame, n, forecol);
+	}
+	usecs = (double)(SDL_GetPerformanceCounter() - start) * 1000000.0 /
+	        SDL_GetPerformanceFrequency();
+	printf("Atlas:    %8.1f us per frame of %d labels\n",
+	       usecs / frames, NUM_LABELS);
+
+	SDL_FreeSurface(frame);
+}
+
 int main(int argc, char *argv[])
 {
 	char *argv0 = argv[0];
@@ -68,6 +218,9 @@ int main(int argc, char *argv[])
 	int rendersolid;
 	int renderstyle;
 	int dump;
+	int benchcount;
+	int benchframes;
+	int prewarmthreads;
 	enum {
 		RENDER_LATIN1,
 		RENDER_UTF8,
@@ -77,6 +230,9 @@ int main(int argc, char *argv[])
 
 	/* Look for special execution mode */
 	dump = 0;
+	benchcount = 0;
+	benchframes = 0;
+	prewarmthreads = 0;
 	/* Look for special rendering types */
 	rendersolid = 0;
 	renderstyle = TTF_STYLE_NORMAL;
@@ -106,6 +262,15 @@ int main(int argc, char *argv[])
 		if ( strcmp(argv[i], "-dump") == 0 ) {
 			dump = 1;
 		} else
+		if ( strcmp(argv[i], "-bench") == 0 && argv[i+1] ) {
+			benchcount = atoi(argv[++i]);
+		} else
+		if ( strcmp(argv[i], "-framebench") == 0 && argv[i+1] ) {
+			benchframes = atoi(argv[++i]);
+		} else
+		if ( strcmp(argv[i], "-prewarm") == 0 && argv[i+1] ) {
+			prewarmthreads = atoi(argv[++i]);
+		} else
 		if ( strcmp(argv[i], "-fgcol") == 0 ) {
 			int r, g, b;
 			if ( sscanf (argv[++i], "%d,%d,%d", &r, &g, &b) != 3 ) {
@@ -187,6 +352,51 @@ int main(int argc, char *argv[])
 		cleanup(0);
 	}
 
+	if ( prewarmthreads > 0 ) {
+		TTF_CloseFont(font);
+		prewarm_bench(argv[0], ptsize, 1);
+		if ( prewarmthreads > 1 ) {
+			prewarm_bench(argv[0], ptsize, prewarmthreads);
+		}
+		cleanup(0);
+	}
+
+	if ( benchframes > 0 ) {
+		frame_bench(font, benchframes, forecol);
+		TTF_CloseFont(font);
+		cleanup(0);
+	}
+
+	if ( benchcount > 0 ) {
+		message = (argc > 2) ? argv[2] : DEFAULT_CJK_TEXT;
+		printf("Cached:   ");
+		bench(font, message, benchcount, forecol);
+		TTF_CloseFont(font);
+
+		/* Again without keeping any glyphs between renders */
+		font = TTF_OpenFont(argv[0], ptsize);
+		if ( font == NULL ) {
+			cleanup(2);
+		}
+		TTF_SetFontStyle(font, renderstyle);
+		TTF_SetFontCacheSize(font, 0);
+		printf("Uncached: ");
+		bench(font, message, benchcount, forecol);
+		TTF_CloseFont(font);
+
+		/* Again keeping the rendered string */
+		font = TTF_OpenFont(argv[0], ptsize);
+		if ( font == NULL ) {
+			cleanup(2);
+		}
+		TTF_SetFontStyle(font, renderstyle);
+		TTF_SetFontRunCache(font, 1024*1024, 1);
+		printf("Strings:  ");
+		bench(font, message, benchcount, forecol);
+		TTF_CloseFont(font);
+		cleanup(0);
+	}
+
 	/* Set a 640x480x8 video mode */
 	screen = SDL_SetVideoMode(640, 480, 8, SDL_SWSURFACE);
 	if ( screen == NULL ) {